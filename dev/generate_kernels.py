@@ -0,0 +1,283 @@
+"""
+Generate the kernels that evaluate the generalized exponential terms of the
+residual Helmholtz energy of some fluids with their coefficients written into
+the code; called from CMake with the fluids of the COOLPROP_SPECIALIZED_FLUIDS
+option, e.g.
+
+    python generate_kernels.py Water CO2 R134a Nitrogen
+
+The fluids are looked up in dev/fluids by file name, name or alias, and the
+kernels for the default EOS are written to include/specialized_residual_kernels.h,
+which is included by src/Backends/Helmholtz/SpecializedKernels.cpp.
+
+In the kernels, integer exponents of delta and tau are products of the powers
+of delta and tau, the non-integer powers and the exp(u) are evaluated
+once for all the terms that have the same exponent or u, and the parts of u
+that a term does not have are left out.  The derivatives are formed as in
+ResidualHelmholtzGeneralizedExponential::all, in CoolPropDbl, with coefficients
+that are the same numbers as those that the library parses from the JSON.  The
+exp() and log() are those of double, which the generic code calls too, and
+exp(-c*delta^l) is a factor of its own as it is there, so that the kernels
+differ from the generic code only by the order in which the same terms are
+rounded and summed.
+"""
+from __future__ import division, print_function, unicode_literals
+from datetime import datetime
+import os
+import sys
+import json
+import glob
+import re
+from decimal import Decimal, getcontext
+
+# Enough digits that the differences of the coefficients, like l_i-1, are exact
+getcontext().prec = 60
+
+repo_root_path = os.path.normpath(os.path.join(os.path.abspath(__file__), '..', '..'))
+outfile = os.path.join(repo_root_path, 'include', 'specialized_residual_kernels.h')
+
+def load_fluid(name):
+    """ Load the JSON of the fluid with the given file name, name or alias """
+    for file in sorted(glob.glob(os.path.join(repo_root_path, 'dev', 'fluids', '*.json'))):
+        fluid = json.load(open(file, 'r'))
+        file_name = os.path.split(file)[1].split('.')[0]
+        if name in [file_name, fluid['NAME']] + fluid['ALIASES']:
+            return fluid
+    raise ValueError('fluid ' + name + ' was not found in dev/fluids')
+
+def rapidjson_double(x):
+    """
+    The double that the rapidjson of the library parses from the number x as it is
+    written to all_fluids.json by json.dumps; it accumulates the digits in a double
+    and ignores the digits after the 16th of the fraction, so it is not always the
+    double nearest to x
+    """
+    if not isinstance(x, float):
+        return float(x)
+    text = json.dumps(x)
+    minus = text.startswith('-')
+    if minus:
+        text = text[1:]
+    mantissa, _, exponent = text.lower().partition('e')
+    integer, _, fraction = mantissa.partition('.')
+    if not fraction and not exponent:
+        return -float(int(integer)) if minus else float(int(integer))
+    # The integer part fits in 64 bits for the coefficients of the fluids
+    d = float(int(integer))
+    exp_frac = 0
+    for digit in fraction:
+        if exp_frac > -16:
+            d = d*10 + int(digit)
+            exp_frac -= 1
+    d *= float('1e' + str(int(exponent or '0') + exp_frac))
+    return -d if minus else d
+
+def to_elements(alphar):
+    """
+    Convert the contributions to alphar to the elements of the generalized
+    exponential term, in the same way as parse_alphar in FluidLibrary.h and the
+    add_* functions of ResidualHelmholtzGeneralizedExponential
+    """
+    elements = []
+    for contribution in alphar:
+        type = contribution['type']
+        contribution = dict([(k, [rapidjson_double(x) for x in v] if isinstance(v, list) else v) for k, v in contribution.items()])
+        if type in ['ResidualHelmholtzNonAnalytic', 'ResidualHelmholtzAssociating']:
+            # These are evaluated by the generic code
+            continue
+        for i in range(len(contribution['n'])):
+            el = dict(n = contribution['n'][i], d = contribution['d'][i], t = contribution['t'][i], c = 0, l = 0, omega = 0, m = 0,
+                      eta1 = 0, epsilon1 = 0, eta2 = 0, epsilon2 = 0, beta1 = 0, gamma1 = 0, beta2 = 0, gamma2 = 0, type = type)
+            if type == 'ResidualHelmholtzPower':
+                el['l'] = contribution['l'][i]
+                el['c'] = 1.0 if el['l'] > 0 else 0.0
+            elif type == 'ResidualHelmholtzExponential':
+                el['c'] = contribution['g'][i]
+                el['l'] = contribution['l'][i]
+            elif type == 'ResidualHelmholtzGaussian':
+                el['eta2'] = contribution['eta'][i]
+                el['epsilon2'] = contribution['epsilon'][i]
+                el['beta2'] = contribution['beta'][i]
+                el['gamma2'] = contribution['gamma'][i]
+            elif type == 'ResidualHelmholtzGERG2008Gaussian':
+                el['eta2'] = contribution['eta'][i]
+                el['epsilon2'] = contribution['epsilon'][i]
+                el['eta1'] = contribution['beta'][i]
+                el['epsilon1'] = contribution['gamma'][i]
+            elif type == 'ResidualHelmholtzLemmon2005':
+                el['c'] = 1.0
+                el['omega'] = 1.0
+                el['l'] = contribution['l'][i]
+                el['m'] = contribution['m'][i]
+            else:
+                raise ValueError('kernels cannot be generated for terms of type ' + type)
+            elements.append(el)
+    return elements
+
+# The coefficients of an element, as the members of SpecializedResidualKernel
+coefficient_keys = ['n', 'd', 't', 'c', 'l', 'omega', 'm', 'eta1', 'epsilon1', 'eta2', 'epsilon2', 'beta1', 'gamma1', 'beta2', 'gamma2']
+
+# The largest exponent that the generic code takes as an integer power, GENERALIZED_EXPONENTIAL_MAX_POWER in src/Helmholtz.cpp
+max_integer_power = 20
+
+def is_int(x):
+    return float(x) == int(x)
+
+def lit(x):
+    """ A long double literal that is the same number as x, a double or the exact Decimal of an expression of doubles """
+    x = Decimal(x)
+    if x == x.to_integral_value():
+        return str(int(x)) + '.0L'
+    # 21 significant digits, which round to the same long double as x, since x has at most 64 significant bits
+    mantissa, exponent = '{0:.20e}'.format(x).split('e')
+    mantissa = mantissa.rstrip('0')
+    if mantissa.endswith('.'):
+        mantissa += '0'
+    return mantissa + 'e' + exponent + 'L'
+
+class KernelWriter(object):
+
+    def __init__(self):
+        self.delta_powers = set() # integer powers of delta
+        self.tau_powers = set() # integer powers of tau
+        self.lines = []
+        self.names = {}
+
+    def power(self, variable, x):
+        """ The expression for variable^x, which is hoisted out of the terms """
+        if x == 0:
+            return None
+        if is_int(x) and 0 < x <= max_integer_power:
+            (self.delta_powers if variable == 'delta' else self.tau_powers).add(int(x))
+            return variable + '_' + str(int(x))
+        key = (variable, float(x))
+        if key not in self.names:
+            self.names[key] = variable + '_pow_' + str(len([k for k in self.names if k[0] == variable]))
+            self.lines.append('    const CoolPropDbl {name:s} = exp(static_cast<double>({x:s}*log_{v:s}));'.format(name = self.names[key], x = lit(x), v = variable))
+        return self.names[key]
+
+    def u(self, el):
+        """
+        The names of the factors exp(-c*delta^l) and exp(u) of the element, without the factors that it does not have, and of the derivatives
+        of u, or literal zeros, with u hoisted out of the terms; the exp(-c*delta^l) is not part of the exp(u), as in the generic code
+        """
+        parts = []
+        if el['c'] != 0 and el['l'] != 0: parts.append(('c', el['c'], el['l']))
+        if el['omega'] != 0 and el['m'] != 0: parts.append(('omega', el['omega'], el['m']))
+        if el['eta1'] != 0: parts.append(('eta1', el['eta1'], el['epsilon1']))
+        if el['eta2'] != 0: parts.append(('eta2', el['eta2'], el['epsilon2']))
+        if el['beta1'] != 0: parts.append(('beta1', el['beta1'], el['gamma1']))
+        if el['beta2'] != 0: parts.append(('beta2', el['beta2'], el['gamma2']))
+        zero = '0'
+        if not parts:
+            return [], [zero]*6
+        key = tuple(parts)
+        if key in self.names:
+            return self.names[key]
+        i = str(len([k for k in self.names if k[0] not in ['delta', 'tau']]))
+        u, ddelta, dtau = [], [[], [], []], [[], [], []]
+        lines = []
+        for part, a, b in parts:
+            if part in ['c', 'omega']:
+                variable = 'delta' if part == 'c' else 'tau'
+                derivs = ddelta if part == 'c' else dtau
+                # -a*variable^b and its derivatives, formed as in ResidualHelmholtzGeneralizedExponential::all, where tau^m is always exp(m*log(tau))
+                name = '{p:s}_{i:s}'.format(p = part, i = i)
+                if part == 'c':
+                    lines.append('    const CoolPropDbl {name:s} = {ma:s}*{pw:s};'.format(name = name, ma = lit(-a), pw = self.power(variable, b)))
+                    lines.append('    const CoolPropDbl exp_{name:s} = exp(static_cast<double>({name:s}));'.format(name = name))
+                    lines.append('    const CoolPropDbl d{name:s} = {name:s}*{b:s}*one_over_{v:s};'.format(name = name, b = lit(b), v = variable))
+                else:
+                    lines.append('    const CoolPropDbl {name:s} = {ma:s}*exp(static_cast<double>({b:s}*log_tau));'.format(name = name, ma = lit(-a), b = lit(b)))
+                    u.append(name)
+                    lines.append('    const CoolPropDbl d{name:s} = {name:s}*({b:s}*one_over_{v:s});'.format(name = name, b = lit(b), v = variable))
+                derivs[0].append('d' + name)
+                if b != 1:
+                    lines.append('    const CoolPropDbl d2{name:s} = {b:s}*d{name:s}*one_over_{v:s};'.format(name = name, b = lit(Decimal(b)-1), v = variable))
+                    derivs[1].append('d2' + name)
+                    if b != 2:
+                        lines.append('    const CoolPropDbl d3{name:s} = {b:s}*d2{name:s}*one_over_{v:s};'.format(name = name, b = lit(Decimal(b)-2), v = variable))
+                        derivs[2].append('d3' + name)
+            else:
+                variable = 'delta' if part in ['eta1', 'eta2'] else 'tau'
+                derivs = ddelta if variable == 'delta' else dtau
+                if part in ['eta1', 'beta1']:
+                    u.append('{a:s}*({v:s}_-{b:s})'.format(a = lit(-a), v = variable, b = lit(b)))
+                    derivs[0].append(lit(-a))
+                else:
+                    u.append('{a:s}*POW2({v:s}_-{b:s})'.format(a = lit(-a), v = variable, b = lit(b)))
+                    derivs[0].append('{a:s}*({v:s}_-{b:s})'.format(a = lit(-2*Decimal(a)), v = variable, b = lit(b)))
+                    derivs[1].append(lit(-2*a))
+        names = [['exp_c_' + i] if parts[0][0] == 'c' else []]
+        if u:
+            names[0].append('exp_u_' + i)
+            lines.append('    const CoolPropDbl exp_u_{i:s} = exp(static_cast<double>({u:s}));'.format(i = i, u = ' + '.join(u)))
+        for j, d in enumerate(ddelta + dtau):
+            if not d:
+                names.append(zero)
+            else:
+                name = ['du_ddelta', 'd2u_ddelta2', 'd3u_ddelta3', 'du_dtau', 'd2u_dtau2', 'd3u_dtau3'][j] + '_' + i
+                lines.append('    const CoolPropDbl {name:s} = {expr:s};'.format(name = name, expr = ' + '.join(d)))
+                names.append(name)
+        self.lines += lines
+        self.names[key] = names[0], names[1:]
+        return self.names[key]
+
+    def kernel(self, identifier, elements):
+        terms = []
+        for el in elements:
+            # In the order of the generic code: tau^t*exp(-c*delta^l)*exp(u)*(n*delta^d)
+            tau_t, delta_d = self.power('tau', el['t']), self.power('delta', el['d'])
+            exp_u, du = self.u(el)
+            factors = ([tau_t] if tau_t is not None else []) + exp_u + [lit(el['n']) + ('*' + delta_d if delta_d is not None else '')]
+            if len(factors) > 1 and delta_d is not None:
+                factors[-1] = '(' + factors[-1] + ')'
+            terms.append('    add_specialized_residual_term(sums, flags, delta_, tau_, {d:s}, {t:s}, {ndteu:s}, {du:s});'.format(d = lit(el['d']), t = lit(el['t']), ndteu = '*'.join(factors), du = ', '.join(du)))
+
+        head = ['    const CoolPropDbl tau_ = tau, delta_ = delta, one_over_delta = 1/delta_, one_over_tau = 1/tau_;']
+        body = '\n'.join(self.lines)
+        for variable in ['delta', 'tau']:
+            if 'log_' + variable in body:
+                head.append('    const CoolPropDbl log_{v:s} = log(static_cast<double>({v:s}_));'.format(v = variable))
+            # Each power is the one below it times the variable, as in the generic code
+            powers = self.delta_powers if variable == 'delta' else self.tau_powers
+            for k in range(1, max(powers) + 1 if powers else 1):
+                head.append('    const CoolPropDbl {v:s}_{k:d} = {expr:s};'.format(v = variable, k = k, expr = variable + '_' if k == 1 else '{v:s}_{h:d}*{v:s}_'.format(v = variable, h = k-1)))
+
+        code  = 'static void {i:s}_residual_kernel(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags)\n{{\n'.format(i = identifier)
+        code += '\n'.join(head) + '\n'
+        code += body + '\n'
+        code += '    SpecializedResidualSums sums;\n'
+        code += '\n'.join(terms) + '\n'
+        code += '    add_specialized_residual_sums(sums, one_over_delta, one_over_tau, derivs);\n}\n'
+        return code
+
+def generate(fluid_names):
+    if not fluid_names:
+        raise ValueError('no fluids were given to generate the kernels for')
+    output = '// Kernels of the generalized exponential terms of ' + ', '.join(fluid_names) + '; see dev/generate_kernels.py\n\n'
+    output += 'namespace CoolProp{\n\n'
+    entries = []
+    for name in fluid_names:
+        fluid = load_fluid(name)
+        identifier = re.sub('[^0-9a-zA-Z_]', '_', fluid['NAME'])
+        elements = to_elements(fluid['EOS'][0]['alphar'])
+        # All the coefficients, in the order of the members of SpecializedResidualKernel, so that the library can check all of them
+        for key in coefficient_keys:
+            output += 'static const CoolPropDbl {i:s}_{k:s}[] = {{{v:s}}};\n'.format(i = identifier, k = key, v = ', '.join([lit(el[key]) for el in elements]))
+        output += KernelWriter().kernel(identifier, elements) + '\n'
+        entries.append('    {{"{name:s}", {i:s}_residual_kernel, {N:d}, {arrays:s}}}'.format(name = fluid['NAME'], i = identifier, N = len(elements),
+                                                                                         arrays = ', '.join([identifier + '_' + key for key in coefficient_keys])))
+    output += 'static const SpecializedResidualKernel specialized_residual_kernels[] = {\n' + ',\n'.join(entries) + '\n};\n\n'
+    output += '} /* namespace CoolProp */\n'
+
+    # Only write the file if the kernels have changed, so that it is not compiled again
+    if os.path.exists(outfile) and open(outfile, 'r').read().split('\n', 2)[-1] == output:
+        print(outfile + ' is up to date')
+        return
+    with open(outfile, 'w') as fp:
+        fp.write('// File generated by the script dev/generate_kernels.py on ' + str(datetime.now()) + '\n\n' + output)
+    print(outfile + ' written to file')
+
+if __name__=='__main__':
+    generate(sys.argv[1:])
@@ -33,7 +33,7 @@ class CachedElement {
 
 private:
     bool is_cached;
-    long double value;
+    CoolPropDbl value;
 public:
     /// Default constructor
     CachedElement() {
@@ -62,18 +62,21 @@ public:
             throw std::exception();
         }
     }
-    operator long double() {
+    #if !defined(COOLPROP_REAL_DOUBLE)
+    /// Cast to CoolPropDbl, for returning value; the same as the cast to double if CoolPropDbl is double
+    operator CoolPropDbl() {
         if (is_cached) {return value; }
         else {
             throw std::exception();
         }
     }
+    #endif
     /// Clear the flag and the value
     void clear() {
         is_cached = false;
         this->value = _HUGE;
     };
-    long double &pt(){
+    CoolPropDbl &pt(){
         return this->value;
     }
 };
@@ -22,7 +22,14 @@
     X(NORMALIZE_GAS_CONSTANTS, "NORMALIZE_GAS_CONSTANTS", true) \
     X(CRITICAL_WITHIN_1UK, "CRITICAL_WITHIN_1UK", true) \
     X(CRITICAL_SPLINES_ENABLED, "CRITICAL_SPLINES_ENABLED", true) \
-	X(ALTERNATIVE_REFPROP_PATH, "ALTERNATIVE_REFPROP_PATH", "") 
+	X(ALTERNATIVE_REFPROP_PATH, "ALTERNATIVE_REFPROP_PATH", "") \
+	X(ALTERNATIVE_FLUIDS_DATABASE_PATH, "ALTERNATIVE_FLUIDS_DATABASE_PATH", "") \
+	X(TABULAR_NX, "TABULAR_NX", 200.0) \
+	X(TABULAR_NY, "TABULAR_NY", 200.0) \
+	X(TABULAR_BUILD_THREADS, "TABULAR_BUILD_THREADS", 0.0) \
+	X(TABULAR_REFINEMENT_TOLERANCE, "TABULAR_REFINEMENT_TOLERANCE", 0.0) \
+	X(TABULAR_TABLE_TYPE, "TABULAR_TABLE_TYPE", "LOGPH") \
+	X(ALTERNATIVE_TABLES_DIRECTORY, "ALTERNATIVE_TABLES_DIRECTORY", "") 
 
  // Use preprocessor to create the Enum
  enum configuration_keys{
@@ -3,6 +3,12 @@ This header file includes the high level API that is meant to be accessed via C+
 
 For the C-style wrapper, refer to CoolPropLib.h
 
+Thread safety: the functions in this header can be called from several threads at the same time (from within OpenMP or TBB loops
+for instance).  The fluid libraries are loaded once, by whichever thread needs them first, and the fluid data are never modified
+after that; changing the reference state swaps in a modified copy of the fluid, which is only seen by states that are constructed
+afterwards.  The error and warning strings are kept per thread.  The debug level is a global setting and should be set before
+starting threads.  An AbstractState instance must not be used by more than one thread at the same time.
+
 \sa CoolPropLib.h
 */
 
@@ -60,6 +66,46 @@ You might want to start by looking at CoolProp.h
     /// @param FluidName The fluid name
     std::vector<double> PropsSI(const std::string &Output, const std::string &Name1, const std::vector<double> &Prop1, const std::string &Name2, const std::vector<double> Prop2, const std::string &FluidName);
 
+    /// Evaluate one output for many states in one call
+    ///
+    /// The output, the input pair and the backend are resolved once, and then every point only requires an update of the same state,
+    /// which removes the fixed cost of a PropsSI call for each point.  If a point fails, _HUGE is stored for that point, the error string is set
+    /// (use get_global_param_string("errstring") to retrieve it), and the remaining points are still evaluated.
+    /// @param Output The output parameter, one of "T","D","H",etc.
+    /// @param Name1 The first state variable name, one of "T","D","H",etc.
+    /// @param Prop1 Pointer to the N values of the first state variable
+    /// @param Name2 The second state variable name, one of "T","D","H",etc.
+    /// @param Prop2 Pointer to the N values of the second state variable
+    /// @param N The number of points
+    /// @param FluidName The fluid name, or names seperated by '&' if a mixture
+    /// @param z The mole or mass fractions depending on the requirements of the backend; may be empty for a pure fluid or a predefined mixture
+    /// @param out Pointer to a buffer of N values that will be filled with the outputs
+    void PropsSIbatch(const std::string &Output, const std::string &Name1, const double *Prop1, const std::string &Name2, const double *Prop2, std::size_t N, const std::string &FluidName, const std::vector<double> &z, double *out);
+    /// Evaluate several outputs for many states, with exactly one flash calculation per state
+    ///
+    /// Works like PropsSIbatch, but all the outputs are obtained from the same update of the state, so asking for
+    /// "T", "D", "C", "V" and "L" at a given (p,h) point only runs the flash once.
+    /// @param Outputs The output parameters, each one of "T","D","H",etc. or a string representation of a derivative
+    /// @param Name1 The first state variable name, one of "T","D","H",etc.
+    /// @param Prop1 Pointer to the N values of the first state variable
+    /// @param Name2 The second state variable name, one of "T","D","H",etc.
+    /// @param Prop2 Pointer to the N values of the second state variable
+    /// @param N The number of points
+    /// @param FluidName The fluid name, or names seperated by '&' if a mixture
+    /// @param z The mole or mass fractions depending on the requirements of the backend; may be empty for a pure fluid or a predefined mixture
+    /// @param out Pointer to a buffer of N*Outputs.size() values that will be filled row by row, the output j of point i is out[i*Outputs.size()+j]
+    void PropsSImulti(const std::vector<std::string> &Outputs, const std::string &Name1, const double *Prop1, const std::string &Name2, const double *Prop2, std::size_t N, const std::string &FluidName, const std::vector<double> &z, double *out);
+    /// Evaluate several outputs for many states, with exactly one flash calculation per state
+    /// @param Outputs The output parameters, each one of "T","D","H",etc. or a string representation of a derivative
+    /// @param Name1 The first state variable name, one of "T","D","H",etc.
+    /// @param Prop1 The values of the first state variable
+    /// @param Name2 The second state variable name, one of "T","D","H",etc.
+    /// @param Prop2 The values of the second state variable
+    /// @param FluidName The fluid name, or names seperated by '&' if a mixture
+    /// @param z The mole or mass fractions depending on the requirements of the backend; may be empty for a pure fluid or a predefined mixture
+    /// @returns A matrix with one row per state and one column per output
+    std::vector<std::vector<double> > PropsSImulti(const std::vector<std::string> &Outputs, const std::string &Name1, const std::vector<double> &Prop1, const std::string &Name2, const std::vector<double> &Prop2, const std::string &FluidName, const std::vector<double> &z);
+
     /**
     \overload 
     \sa PropsSI(std::string &Output, std::string &Name1, double Prop1, std::string &Name2, double Prop2, std::string &FluidName, const std::vector<double> &x);
@@ -73,10 +119,10 @@ You might want to start by looking at CoolProp.h
     /// @param level The level of the verbosity for the debugging output (0-10) 0: no debgging output
     void set_debug_level(int level);
 
-    /// Set the global error string 
+    /// Set the error string of the calling thread
     /// @param error The error string to use
     void set_error_string(std::string error);
-    /// An internal function to set the global warning string
+    /// An internal function to set the warning string of the calling thread
     /// @param warning The string to set as the warning string
     void set_warning_string(std::string warning);
     
@@ -93,6 +139,7 @@ You might want to start by looking at CoolProp.h
     /// Get a globally-defined string
     /// @param ParamName A string, one of "version", "errstring", "warnstring", "gitrevision", "FluidsList", "fluids_list", "parameter_list","predefined_mixtures"
     /// @returns str The string, or an error message if not valid input
+    /// \note "errstring" and "warnstring" return (and clear) the last error or warning of the calling thread
     std::string get_global_param_string(std::string ParamName);
 
     /*/// Get a long that represents the fluid type
@@ -179,7 +226,20 @@ You might want to start by looking at CoolProp.h
     /// @param z The mole or mass fractions depending on the requirements of the backend
     /// \note Returns empty string if there was an error; use get_global_param_string("errstring") to retrieve the error
     std::string PhaseSI(const std::string &Name1, double Prop1, const std::string &Name2, double Prop2, const std::string &FluidName, const std::vector<double> &z);
-    
+
+    /// Set the maximum number of idle AbstractState instances that are kept for reuse by PropsSI, PropsSIZ and Props1SI
+    /// @param N The number of instances to keep; 0 disables the cache
+    void set_state_cache_size(std::size_t N);
+    /// Get the maximum number of idle AbstractState instances that are kept for reuse
+    std::size_t get_state_cache_size();
+    /// Drop all the cached AbstractState instances and reset the hit/miss counters
+    void flush_state_cache();
+    /// Get the usage statistics of the AbstractState cache
+    /// @param hits The number of calls that reused a cached instance
+    /// @param misses The number of calls that had to construct a new instance
+    /// @param size The number of idle instances currently held in the cache
+    void get_state_cache_stats(unsigned long &hits, unsigned long &misses, std::size_t &size);
+
     } /* namespace CoolProp */
 #endif
 
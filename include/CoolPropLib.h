@@ -140,6 +140,29 @@
      */
     EXPORT_CODE double CONVENTION PropsSIZ(const char *Output, const char *Name1, double Prop1, const char *Name2, double Prop2, const char *FluidName, const double *z, int n);
 
+    /** \brief Evaluate one output for many states in one call, with the inputs and outputs passed as contiguous arrays
+     * \overload
+     * \sa \ref CoolProp::PropsSIbatch
+     * 
+     * @param z The mole or mass fractions, may be NULL (with n = 0) for a pure fluid or a predefined mixture
+     * @param n The number of elements in z
+     * @param out Pre-allocated array of N values that will be filled with the outputs
+     * 
+     * \note If there is an error, a huge value will be stored for that point, you can get the error message by doing something like get_global_param_string("errstring",output)
+     */
+    EXPORT_CODE void CONVENTION PropsSIbatch(const char *Output, const char *Name1, const double *Prop1, const char *Name2, const double *Prop2, long N, const char *FluidName, const double *z, int n, double *out);
+    /** \brief Evaluate several outputs for many states with one flash calculation per state
+     * \overload
+     * \sa \ref CoolProp::PropsSImulti
+     * 
+     * @param Outputs The output parameters separated by commas, for instance "T,D,C,V,L"
+     * @param z The mole or mass fractions, may be NULL (with n = 0) for a pure fluid or a predefined mixture
+     * @param n The number of elements in z
+     * @param out Pre-allocated array of N times the number of outputs values, filled row by row (all the outputs of the first state, then the second state, etc.)
+     * 
+     * \note If there is an error, a huge value will be stored for all the outputs of that point, you can get the error message by doing something like get_global_param_string("errstring",output)
+     */
+    EXPORT_CODE void CONVENTION PropsSImulti(const char *Outputs, const char *Name1, const double *Prop1, const char *Name2, const double *Prop2, long N, const char *FluidName, const double *z, int n, double *out);
     /// Convert from degrees Fahrenheit to Kelvin (useful primarily for testing)
     EXPORT_CODE double CONVENTION F2K(double T_F);
     /// Convert from Kelvin to degrees Fahrenheit (useful primarily for testing)
@@ -174,6 +197,37 @@
      */
     EXPORT_CODE double CONVENTION saturation_ancillary(const char *fluid_name, const char *output, int Q, const char *input, double value);
 
+    // ---------------------------------
+    //        AbstractState cache
+    // ---------------------------------
+
+    /**
+     * \overload
+     * \sa \ref CoolProp::set_state_cache_size
+     */
+    EXPORT_CODE void CONVENTION set_state_cache_size(long N);
+    /**
+     * \overload
+     * \sa \ref CoolProp::get_state_cache_size
+     */
+    EXPORT_CODE long CONVENTION get_state_cache_size();
+    /**
+     * \overload
+     * \sa \ref CoolProp::flush_state_cache
+     */
+    EXPORT_CODE void CONVENTION flush_state_cache();
+    /**
+     * \overload
+     * \sa \ref CoolProp::get_state_cache_stats
+     *
+     * @param hits The number of calls that reused a cached instance
+     * @param misses The number of calls that had to construct a new instance
+     * @param size The number of idle instances currently held in the cache
+     *
+     * Any of the pointers may be NULL, in which case that number is not returned
+     */
+    EXPORT_CODE void CONVENTION get_state_cache_stats(long *hits, long *misses, long *size);
+
     // ---------------------------------
     //        Humid Air Properties
     // ---------------------------------
@@ -213,6 +267,84 @@
     
 
 
+    // ---------------------------------
+    //  Low-level access to AbstractState
+    // ---------------------------------
+
+    /* The functions below give access to an AbstractState instance through an integer handle.  The instance is created once
+     * and keeps its state between calls, so the cost of parsing strings and constructing the backend is only paid once.
+     * Input pairs and output keys are passed as integers; use get_input_pair_index and get_param_index to obtain them.
+     * 
+     * Unless otherwise noted, the functions return 1 if the call succeeded and 0 if there was an error; the error message
+     * can be obtained by doing something like get_global_param_string("errstring",output).  A handle should not be
+     * used by more than one thread at the same time.
+     */
+
+    /** \brief Get the index of an input pair, "PT_INPUTS" for instance
+     * \sa \ref CoolProp::get_input_pair_index
+     * @returns index The index, or -1 if the input pair is not valid
+     */
+    EXPORT_CODE long CONVENTION get_input_pair_index(const char *pair_name);
+    /** \brief Generate an AbstractState instance and return a handle to it
+     * \sa \ref CoolProp::AbstractState::factory
+     * @param backend The backend to be used, "HEOS", "INCOMP", "REFPROP", etc.
+     * @param fluids The fluid(s) to be used, separated by '&' for a mixture
+     * @returns handle The handle to the instance, or -1 if there was an error
+     */
+    EXPORT_CODE long CONVENTION AbstractState_factory(const char *backend, const char *fluids);
+    /// \brief Release the AbstractState instance of a handle; the handle is not valid any more after this call
+    EXPORT_CODE long CONVENTION AbstractState_free(const long handle);
+    /** \brief Set the mole, mass or volume fractions of the components, depending on what the backend uses
+     * @param handle The handle of the instance
+     * @param fractions The array of fractions
+     * @param N The number of elements in fractions; an error is returned if it is negative, or if fractions is NULL and N is not zero
+     */
+    EXPORT_CODE long CONVENTION AbstractState_set_fractions(const long handle, const double *fractions, const long N);
+    /** \brief Update the state of the instance
+     * \sa \ref CoolProp::AbstractState::update
+     * @param handle The handle of the instance
+     * @param input_pair The index of the input pair, from get_input_pair_index
+     * @param value1 The first input value
+     * @param value2 The second input value
+     */
+    EXPORT_CODE long CONVENTION AbstractState_update(const long handle, const long input_pair, const double value1, const double value2);
+    /** \brief Get an output from the current state of the instance
+     * \sa \ref CoolProp::AbstractState::keyed_output
+     * @param handle The handle of the instance
+     * @param param The index of the output, from get_param_index
+     * @returns value The value, or a huge value if there was an error
+     */
+    EXPORT_CODE double CONVENTION AbstractState_keyed_output(const long handle, const long param);
+    /** \brief Update the instance for each of a set of input points and get one output at each point
+     * @param handle The handle of the instance
+     * @param input_pair The index of the input pair, from get_input_pair_index
+     * @param value1 The array of first input values
+     * @param value2 The array of second input values
+     * @param length The number of input points
+     * @param output The index of the output, from get_param_index
+     * @param out Pre-allocated array of length values that will be filled with the outputs
+     * 
+     * \note If a point fails, a huge value is stored for that point and the remaining points are still evaluated; 0 is then returned, and the
+     * error string is that of the first point that failed.  0 is also returned, without evaluating any point, if the handle is not valid,
+     * if length is negative, or if one of the arrays is NULL while length is not zero
+     */
+    EXPORT_CODE long CONVENTION AbstractState_update_and_1_out(const long handle, const long input_pair, const double *value1, const double *value2, const long length, const long output, double *out);
+    /** \brief Update the instance for each of a set of input points and get several outputs at each point, with one update per point
+     * @param handle The handle of the instance
+     * @param input_pair The index of the input pair, from get_input_pair_index
+     * @param value1 The array of first input values
+     * @param value2 The array of second input values
+     * @param length The number of input points
+     * @param outputs The array of indices of the outputs, from get_param_index
+     * @param n_outputs The number of elements in outputs
+     * @param out Pre-allocated array of length*n_outputs values, filled row by row (all the outputs of the first point, then the second point, etc.)
+     * 
+     * \note If a point fails, a huge value is stored for all the outputs of that point and the remaining points are still evaluated; 0 is then
+     * returned, and the error string is that of the first point that failed.  0 is also returned, without evaluating any point, if the handle
+     * is not valid, if length or n_outputs is negative, or if one of the arrays is NULL while length and n_outputs are not zero
+     */
+    EXPORT_CODE long CONVENTION AbstractState_update_and_N_out(const long handle, const long input_pair, const double *value1, const double *value2, const long length, const long *outputs, const long n_outputs, double *out);
+
     // *************************************************************************************
     // *************************************************************************************
     // *****************************  DEPRECATED *******************************************
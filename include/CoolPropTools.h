@@ -11,6 +11,14 @@
     #include <cmath>
     #include "float.h"
 
+    /// The floating point type used by the equations of state, the cached values and the solvers.
+    /// long double unless the library is configured with COOLPROP_REAL=double (which defines COOLPROP_REAL_DOUBLE)
+    #if defined(COOLPROP_REAL_DOUBLE)
+    typedef double CoolPropDbl;
+    #else
+    typedef long double CoolPropDbl;
+    #endif
+
     #ifndef M_PI
     #  define M_PI 3.14159265358979323846
     #endif
@@ -116,6 +124,11 @@
     // Thanks to http://stackoverflow.com/questions/2602013/read-whole-ascii-file-into-c-stdstring
     std::string get_file_contents(const char *filename);
 
+    /// Get the home directory of the user from the environment
+    std::string get_home_dir(void);
+    /// Create a directory and any of its parents that do not exist yet, like mkdir -p
+    void make_dirs(const std::string &path);
+
     // Missing string printf
     std::string format(const char* fmt, ...);
     // Missing string split - like in Python
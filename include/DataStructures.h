@@ -175,7 +175,7 @@ std::string get_csv_parameter_list();
 /// These are constants for the compositions
 enum composition_types{IFRAC_MASS, IFRAC_MOLE, IFRAC_VOLUME, IFRAC_UNDEFINED, IFRAC_PURE};
 
-const long double R_u_CODATA = 8.3144621; ///< The value for the ideal gas constant in J/mol/K according to CODATA 2010.  This value is used to harmonize all the ideal gas constants.  This is especially important in the critical region.
+const CoolPropDbl R_u_CODATA = 8.3144621; ///< The value for the ideal gas constant in J/mol/K according to CODATA 2010.  This value is used to harmonize all the ideal gas constants.  This is especially important in the critical region.
 
 /// These are unit types for the fluid
 enum fluid_types{FLUID_TYPE_PURE, FLUID_TYPE_PSEUDOPURE, FLUID_TYPE_REFPROP, FLUID_TYPE_INCOMPRESSIBLE_LIQUID, FLUID_TYPE_INCOMPRESSIBLE_SOLUTION, FLUID_TYPE_UNDEFINED};
@@ -229,10 +229,10 @@ inline bool match_pair(parameters key1, parameters key2, parameters x1, paramete
     swap = !(key1 == x1);
     return ((key1 == x1 && key2 == x2) || (key2 == x1 && key1 == x2));
 };
-template<class T> CoolProp::input_pairs generate_update_pair(parameters key1, T value1, parameters key2, T value2, T &out1, T &out2)
+/// Get the input pair of the keys, and whether the values of the keys have to be swapped to be in the order of the pair
+inline CoolProp::input_pairs generate_update_pair(parameters key1, parameters key2, bool &swap)
     {
         CoolProp::input_pairs pair;
-        bool swap;
 
         if (match_pair(key1, key2, iQ, iT, swap)){
             pair = QT_INPUTS; ///< Molar quality, Temperature in K
@@ -323,6 +323,12 @@ template<class T> CoolProp::input_pairs generate_update_pair(parameters key1, T
         }
         else
             throw ValueError("Invalid set of inputs to generate_update_pair");
+        return pair;
+    };
+template<class T> CoolProp::input_pairs generate_update_pair(parameters key1, T value1, parameters key2, T value2, T &out1, T &out2)
+    {
+        bool swap;
+        CoolProp::input_pairs pair = generate_update_pair(key1, key2, swap);
 
         if (!swap){
             out1 = value1; out2 = value2;
@@ -339,6 +345,9 @@ std::string get_input_pair_short_desc(int pair);
 /// Return the long description of an input pair key ("Molar density in mol/m^3, Temperature in K" for instance)
 std::string get_input_pair_long_desc(int pair);
 
+/// Return the input pair key from its name ("DmolarT_INPUTS" for instance); the shared short descriptions "QS_INPUTS" and "HQ_INPUTS" give the molar pair
+input_pairs get_input_pair_index(const std::string &input_pair_name);
+
 extern std::string get_mixture_binary_pair_data(const std::string &CAS1, const std::string &CAS2, const std::string &param);
 
 } /* namespace CoolProp */
@@ -44,52 +44,52 @@ public:
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double base(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the first partial derivative of Helmholtz energy term with respect to tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dTau(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the second partial derivative of Helmholtz energy term with respect to tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */ 
-    virtual long double dTau2(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the second mixed partial derivative (delta1,dtau1) of Helmholtz energy term with respect to delta and tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta_dTau(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the first partial derivative of Helmholtz energy term with respect to delta [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the second partial derivative of Helmholtz energy term with respect to delta [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta2(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the third mixed partial derivative (delta2,dtau1) of Helmholtz energy term with respect to delta and tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta2_dTau(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the third mixed partial derivative (delta1,dtau2) of Helmholtz energy term with respect to delta and tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta_dTau2(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the third partial derivative of Helmholtz energy term with respect to tau [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dTau3(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     /// Returns the third partial derivative of Helmholtz energy term with respect to delta [-]
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual long double dDelta3(const long double &tau, const long double &delta) throw() = 0;
+    virtual CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw() = 0;
     
 };
 
@@ -101,6 +101,22 @@ public:
 // #############################################################################
 // #############################################################################
 
+/// Bits that select the derivatives of alphar that are wanted from the all() functions of the residual terms, so that the others can be skipped
+enum alphar_derivative_flags{
+    ALPHAR_BASE = 1, ALPHAR_DDELTA = 2, ALPHAR_DTAU = 4,
+    ALPHAR_DDELTA2 = 8, ALPHAR_DDELTA_DTAU = 16, ALPHAR_DTAU2 = 32,
+    ALPHAR_DDELTA3 = 64, ALPHAR_DDELTA2_DTAU = 128, ALPHAR_DDELTA_DTAU2 = 256, ALPHAR_DTAU3 = 512,
+    ALPHAR_UP_TO_FIRST_ORDER = 7, ALPHAR_UP_TO_SECOND_ORDER = 63, ALPHAR_ALL_DERIVATIVES = 1023
+};
+/// The flag of the derivative of alphar of order nTau in tau and nDelta in delta, or 0 if it is above third order
+inline int alphar_derivative_flag(int nTau, int nDelta)
+{
+    if (nTau < 0 || nDelta < 0 || nTau + nDelta > 3){ return 0; }
+    // The derivatives of each order are in order of decreasing order in delta, after those of the lower orders
+    int order = nTau + nDelta;
+    return 1 << (order*(order+1)/2 + nTau);
+}
+
 struct HelmholtzDerivatives
 {
     double alphar, dalphar_ddelta, dalphar_dtau, d2alphar_ddelta2, d2alphar_dtau2, d2alphar_ddelta_dtau, 
@@ -109,15 +125,27 @@ struct HelmholtzDerivatives
                 d3alphar_ddelta3 = 0; d3alphar_ddelta_dtau2 = 0; d3alphar_ddelta2_dtau = 0; d3alphar_dtau3 = 0;
                 }
     HelmholtzDerivatives(){reset();};
+    /// The ten derivatives in the order of the bits of the ALPHAR_* flags, so that element k is the derivative of the flag 1 << k
+    Eigen::Array<double, 10, 1> values() const
+    {
+        Eigen::Array<double, 10, 1> v;
+        v << alphar, dalphar_ddelta, dalphar_dtau, d2alphar_ddelta2, d2alphar_ddelta_dtau, d2alphar_dtau2,
+             d3alphar_ddelta3, d3alphar_ddelta2_dtau, d3alphar_ddelta_dtau2, d3alphar_dtau3;
+        return v;
+    }
 };
 
+/// A function that adds the derivatives selected by flags of the generalized exponential terms of one equation of state to derivs,
+/// as ResidualHelmholtzGeneralizedExponential::all does; these are generated for some fluids by dev/generate_kernels.py
+typedef void (*ResidualHelmholtzKernel)(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags);
+
 struct ResidualHelmholtzGeneralizedExponentialElement
 {
     /// These variables are for the n*delta^d_i*tau^t_i part
-    long double n,d,t;
+    CoolPropDbl n,d,t;
     /// These variables are for the exp(u) part
     /// u is given by -c*delta^l_i-omega*tau^m_i-eta1*(delta-epsilon1)-eta2*(delta-epsilon2)^2-beta1*(tau-gamma1)-beta2*(tau-gamma2)^2
-    long double c, l_double, omega, m_double, eta1, epsilon1, eta2, epsilon2, beta1, gamma1, beta2, gamma2;
+    CoolPropDbl c, l_double, omega, m_double, eta1, epsilon1, eta2, epsilon2, beta1, gamma1, beta2, gamma2;
     /// If l_i or m_i are integers, we will store them as integers in order to call pow(double, int) rather than pow(double, double)
     int l_int, m_int;
     
@@ -142,16 +170,37 @@ class ResidualHelmholtzGeneralizedExponential : public BaseHelmholtzTerm{
     
 public:
     bool delta_li_in_u, tau_mi_in_u, eta1_in_u, eta2_in_u, beta1_in_u, beta2_in_u, finished;
-    std::vector<long double> s;
     std::size_t N;
     
-    // These variables are for the exp(u) part
+    // The coefficients of the terms as structure of arrays, built by finish() from the elements
     // u is given by -c*delta^l_i-omega*tau^m_i-eta1*(delta-epsilon1)-eta2*(delta-epsilon2)^2-beta1*(tau-gamma1)-beta2*(tau-gamma2)^2
-    std::vector<double> n,d,t,c, l_double, omega, m_double, eta1, epsilon1, eta2, epsilon2, beta1, gamma1, beta2, gamma2;
-    // If l_i or m_i are integers, we will store them as integers in order to call pow(double, int) rather than pow(double, double)
-    std::vector<int> l_int, m_int;
+    // The terms are sorted by the parts of u that they have, so the power terms, the exponential terms, the Gaussian terms, etc.
+    // each form a contiguous group, and a part of u that a term does not have is dropped (l_i or m_i of zero, or zero coefficient)
+    // The coefficients are CoolPropDbl, like the terms of all_scalar(), so that all() has the same precision
+    typedef Eigen::Array<CoolPropDbl, Eigen::Dynamic, 1> CoefficientArray;
+    CoefficientArray n,d,t,c, l_double, omega, m_double, eta1, epsilon1, eta2, epsilon2, beta1, gamma1, beta2, gamma2;
+    
+    /// A group of consecutive terms in the arrays that have the same parts in u
+    struct TermGroup{
+        std::size_t start, N;
+        bool delta_li_in_u, tau_mi_in_u, eta1_in_u, eta2_in_u, beta1_in_u, beta2_in_u;
+    };
+    std::vector<TermGroup> groups;
     
-    Eigen::ArrayXd uE, du_ddeltaE, du_dtauE, d2u_ddelta2E, d2u_dtau2E, d3u_ddelta3E, d3u_dtau3E;
+    /// The values that an exponent takes in the terms, so that the power is evaluated once for all the terms that share a value
+    struct ExponentTable{
+        std::vector<CoolPropDbl> values; ///< The exponents that are evaluated
+        std::vector<int> integers; ///< For each of the values, the value if it is a small enough non-negative integer to be taken from the integer powers, otherwise -1
+        std::vector<int> index; ///< For each term, the index of its exponent in values, or -1 if the term does not have it
+        int max_integer; ///< The largest of the integers, or 0
+        ExponentTable() : max_integer(0) {};
+    };
+    // The exponents d_i and t_i of the terms without repeats, classified by finish()
+    ExponentTable d_exponents, t_exponents;
+    // The pairs (c_i, l_i) of the terms that have c_i*delta^l_i in u, without repeats, so that exp(-c_i*delta^l_i) is evaluated once for each pair;
+    // cl_l holds the l_i of the pairs, so an l_i is there once for each c_i that it goes with, and for each term the index of its pair
+    std::vector<CoolPropDbl> cl_c;
+    ExponentTable cl_l;
         
     std::vector<ResidualHelmholtzGeneralizedExponentialElement> elements;
     // Default Constructor
@@ -169,8 +218,8 @@ public:
 	 * Term of the format
 	 * \f$ \alpha^r=\left\lbrace\begin{array}{cc}\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} & l_i=0\\ \displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} \exp(-\delta^{l_i}) & l_i\neq 0\end{array}\right.\f$
 	 */
-    void add_Power(const std::vector<long double> &n, const std::vector<long double> &d, 
-                   const std::vector<long double> &t, const std::vector<long double> &l)
+    void add_Power(const std::vector<CoolPropDbl> &n, const std::vector<CoolPropDbl> &d, 
+                   const std::vector<CoolPropDbl> &t, const std::vector<CoolPropDbl> &l)
     {
         for (std::size_t i = 0; i < n.size(); ++i)
         {
@@ -187,15 +236,16 @@ public:
             elements.push_back(el);
         }
         delta_li_in_u = true;
+        finished = false;
     };
 	/** \brief Add and convert an old-style exponential term to generalized form
 	 * 
 	 * Term of the format 
 	 * \f$ \alpha^r=\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} \exp(-g_i\delta^{l_i}) \f$
 	 */
-    void add_Exponential(const std::vector<long double> &n, const std::vector<long double> &d, 
-                         const std::vector<long double> &t, const std::vector<long double> &g, 
-                         const std::vector<long double> &l)
+    void add_Exponential(const std::vector<CoolPropDbl> &n, const std::vector<CoolPropDbl> &d, 
+                         const std::vector<CoolPropDbl> &t, const std::vector<CoolPropDbl> &g, 
+                         const std::vector<CoolPropDbl> &l)
     {
         for (std::size_t i = 0; i < n.size(); ++i)
         {
@@ -209,19 +259,20 @@ public:
             elements.push_back(el);
         }
         delta_li_in_u = true;
+        finished = false;
     }
 	/** \brief Add and convert an old-style Gaussian term to generalized form
 	 * 
 	 * Term of the format
 	 * \f$ \alpha^r=\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} \exp(-\eta_i(\delta-\epsilon_i)^2-\beta_i(\tau-\gamma_i)^2)\f$
 	 */
-    void add_Gaussian(const std::vector<long double> &n, 
-                      const std::vector<long double> &d, 
-                      const std::vector<long double> &t, 
-                      const std::vector<long double> &eta, 
-                      const std::vector<long double> &epsilon,
-                      const std::vector<long double> &beta,
-                      const std::vector<long double> &gamma
+    void add_Gaussian(const std::vector<CoolPropDbl> &n, 
+                      const std::vector<CoolPropDbl> &d, 
+                      const std::vector<CoolPropDbl> &t, 
+                      const std::vector<CoolPropDbl> &eta, 
+                      const std::vector<CoolPropDbl> &epsilon,
+                      const std::vector<CoolPropDbl> &beta,
+                      const std::vector<CoolPropDbl> &gamma
                       )
     { 
         for (std::size_t i = 0; i < n.size(); ++i)
@@ -238,19 +289,20 @@ public:
         }
         eta2_in_u = true;
         beta2_in_u = true;
+        finished = false;
     };
 	/** \brief Add and convert an old-style Gaussian term from GERG 2008 natural gas model to generalized form
 	 * 
 	 * Term of the format
 	 * \f$ \alpha^r=\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} \exp(-\eta_i(\delta-\epsilon_i)^2-\beta_i(\delta-\gamma_i))\f$
 	 */
-    void add_GERG2008Gaussian(const std::vector<long double> &n, 
-                              const std::vector<long double> &d, 
-                              const std::vector<long double> &t, 
-                              const std::vector<long double> &eta, 
-                              const std::vector<long double> &epsilon,
-                              const std::vector<long double> &beta,
-                              const std::vector<long double> &gamma)
+    void add_GERG2008Gaussian(const std::vector<CoolPropDbl> &n, 
+                              const std::vector<CoolPropDbl> &d, 
+                              const std::vector<CoolPropDbl> &t, 
+                              const std::vector<CoolPropDbl> &eta, 
+                              const std::vector<CoolPropDbl> &epsilon,
+                              const std::vector<CoolPropDbl> &beta,
+                              const std::vector<CoolPropDbl> &gamma)
     { 
         for (std::size_t i = 0; i < n.size(); ++i)
         {
@@ -266,17 +318,18 @@ public:
         }
         eta2_in_u = true;
         eta1_in_u = true;
+        finished = false;
     };
 	/** \brief Add and convert a term from Lemmon and Jacobsen (2005) used for R125
 	 * 
 	 * Term of the format
 	 * \f$ \alpha^r=\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i} \exp(-\delta^{l_i}-\tau^{m_i})\f$
 	 */
-    void add_Lemmon2005(const std::vector<long double> &n, 
-                        const std::vector<long double> &d, 
-                        const std::vector<long double> &t, 
-                        const std::vector<long double> &l, 
-                        const std::vector<long double> &m)
+    void add_Lemmon2005(const std::vector<CoolPropDbl> &n, 
+                        const std::vector<CoolPropDbl> &d, 
+                        const std::vector<CoolPropDbl> &t, 
+                        const std::vector<CoolPropDbl> &l, 
+                        const std::vector<CoolPropDbl> &m)
     {
         for (std::size_t i = 0; i < n.size(); ++i)
         {
@@ -294,85 +347,59 @@ public:
         }
         delta_li_in_u = true;
         tau_mi_in_u = true;
+        finished = false;
     };
     
-    void finish(){
-        n.resize(elements.size()); d.resize(elements.size());
-        t.resize(elements.size()); c.resize(elements.size());
-        l_double.resize(elements.size()); l_int.resize(elements.size());
-        epsilon2.resize(elements.size()); eta2.resize(elements.size());
-        gamma2.resize(elements.size()); beta2.resize(elements.size());
-        
-        for (std::size_t i = 0; i < elements.size(); ++i){
-            n[i] = elements[i].n;
-            d[i] = elements[i].d;
-            t[i] = elements[i].t;
-            c[i] = elements[i].c;
-            l_double[i] = elements[i].l_double;
-            l_int[i] = elements[i].l_int;
-            epsilon2[i] = elements[i].epsilon2;
-            eta2[i] = elements[i].eta2;
-            gamma2[i] = elements[i].gamma2;
-            beta2[i] = elements[i].beta2;
-        }
-        uE.resize(elements.size());
-        du_ddeltaE.resize(elements.size());
-        du_dtauE.resize(elements.size());
-        d2u_ddelta2E.resize(elements.size());
-        d2u_dtau2E.resize(elements.size());
-        d3u_ddelta3E.resize(elements.size());
-        d3u_dtau3E.resize(elements.size());
-        
-        finished = true;
-    };
+    /// Build the structure of arrays and the groups of terms from the elements; must be called after the terms are added and before all()
+    void finish();
 
     ///< Destructor for the class.  No implementation
     ~ResidualHelmholtzGeneralizedExponential(){};
 
     void to_json(rapidjson::Value &el, rapidjson::Document &doc);
     
-    long double base(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.alphar;};
-    long double dDelta(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_ddelta;};
-    long double dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_dtau;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta2;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta_dtau;};
-    long double dTau2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_dtau2;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta3;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta2_dtau;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta_dtau2;};
-    long double dTau3(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_dtau3;};
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_BASE); return deriv.alphar;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA); return deriv.dalphar_ddelta;};
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DTAU); return deriv.dalphar_dtau;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA2); return deriv.d2alphar_ddelta2;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA_DTAU); return deriv.d2alphar_ddelta_dtau;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DTAU2); return deriv.d2alphar_dtau2;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA3); return deriv.d3alphar_ddelta3;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA2_DTAU); return deriv.d3alphar_ddelta2_dtau;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DDELTA_DTAU2); return deriv.d3alphar_ddelta_dtau2;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv,ALPHAR_DTAU3); return deriv.d3alphar_dtau3;};
     
-    void all(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw();
-    //void allEigen(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw();
+    /// Add the derivatives of the terms selected by flags (alphar_derivative_flags) to derivs, one term at a time with the powers that the terms share
+    void all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags = ALPHAR_ALL_DERIVATIVES) throw();
+    /// The same as all(), one term at a time in CoolPropDbl; kept as the reference for all()
+    void all_scalar(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs) throw();
 };
 
 struct ResidualHelmholtzNonAnalyticElement
 {
-    long double n, a, b, beta, A, B, C, D;
+    CoolPropDbl n, a, b, beta, A, B, C, D;
 };
 class ResidualHelmholtzNonAnalytic : public BaseHelmholtzTerm{
 
 public:
     std::size_t N;
-    std::vector<long double> s;
     std::vector<ResidualHelmholtzNonAnalyticElement> elements;
     /// Default Constructor
     ResidualHelmholtzNonAnalytic(){N = 0;};
     /// Destructor. No implementation
     ~ResidualHelmholtzNonAnalytic(){};
     /// Constructor
-    ResidualHelmholtzNonAnalytic(const std::vector<long double> &n, 
-                                 const std::vector<long double> &a, 
-                                 const std::vector<long double> &b, 
-                                 const std::vector<long double> &beta, 
-                                 const std::vector<long double> &A,
-                                 const std::vector<long double> &B,
-                                 const std::vector<long double> &C,
-                                 const std::vector<long double> &D
+    ResidualHelmholtzNonAnalytic(const std::vector<CoolPropDbl> &n, 
+                                 const std::vector<CoolPropDbl> &a, 
+                                 const std::vector<CoolPropDbl> &b, 
+                                 const std::vector<CoolPropDbl> &beta, 
+                                 const std::vector<CoolPropDbl> &A,
+                                 const std::vector<CoolPropDbl> &B,
+                                 const std::vector<CoolPropDbl> &C,
+                                 const std::vector<CoolPropDbl> &D
                                  )
     {
         N = n.size(); 
-        s.resize(N); 
         for (std::size_t i = 0; i < n.size(); ++i)
         {
             ResidualHelmholtzNonAnalyticElement el;
@@ -390,18 +417,19 @@ public:
 
     void to_json(rapidjson::Value &el, rapidjson::Document &doc);
 
-    long double base(const long double &tau, const long double &delta) throw();
-    long double dDelta(const long double &tau, const long double &delta) throw();
-    long double dTau(const long double &tau, const long double &delta) throw();
-    long double dDelta2(const long double &tau, const long double &delta) throw();
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw();
-    long double dTau2(const long double &tau, const long double &delta) throw();
-    long double dDelta3(const long double &tau, const long double &delta) throw();
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw();
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw();
-    long double dTau3(const long double &tau, const long double &delta) throw();
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
     
-    void all(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw();
+    /// Add the derivatives of the terms selected by flags (alphar_derivative_flags) to derivs
+    void all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags = ALPHAR_ALL_DERIVATIVES) throw();
 };
 
 class ResidualHelmholtzSAFTAssociating : public BaseHelmholtzTerm{
@@ -409,38 +437,40 @@ class ResidualHelmholtzSAFTAssociating : public BaseHelmholtzTerm{
 protected:
     double a, m,epsilonbar, vbarn, kappabar;
 
-    long double Deltabar(const long double &tau, const long double &delta);
-    long double dDeltabar_ddelta__consttau(const long double &tau, const long double &delta);
-    long double d2Deltabar_ddelta2__consttau(const long double &tau, const long double &delta);
-    long double dDeltabar_dtau__constdelta(const long double &tau, const long double &delta);
-    long double d2Deltabar_dtau2__constdelta(const long double &tau, const long double &delta);
-    long double d2Deltabar_ddelta_dtau(const long double &tau, const long double &delta);
-    long double d3Deltabar_dtau3__constdelta(const long double &tau, const long double &delta);
-    long double d3Deltabar_ddelta_dtau2(const long double &tau, const long double &delta);
-    long double d3Deltabar_ddelta3__consttau(const long double &tau, const long double &delta);
-    long double d3Deltabar_ddelta2_dtau(const long double &tau, const long double &delta);
-
-    long double X(const long double &delta, const long double &Deltabar);
-    long double dX_dDeltabar__constdelta(const long double &delta, const long double &Deltabar);
-    long double dX_ddelta__constDeltabar(const long double &delta, const long double &Deltabar);
-    long double dX_dtau(const long double &tau, const long double &delta);
-    long double dX_ddelta(const long double &tau, const long double &delta);
-    long double d2X_dtau2(const long double &tau, const long double &delta);
-    long double d2X_ddeltadtau(const long double &tau, const long double &delta);
-    long double d2X_ddelta2(const long double &tau, const long double &delta);
-
-    long double d3X_dtau3(const long double &tau, const long double &delta);
-    long double d3X_ddelta3(const long double &tau, const long double &delta);
-    long double d3X_ddeltadtau2(const long double &tau, const long double &delta);
-    long double d3X_ddelta2dtau(const long double &tau, const long double &delta);
-
-    long double g(const long double &eta);
-    long double dg_deta(const long double &eta);
-    long double d2g_deta2(const long double &eta);
-    long double d3g_deta3(const long double &eta);
-    long double eta(const long double &delta);
+    CoolPropDbl Deltabar(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl dDeltabar_ddelta__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2Deltabar_ddelta2__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl dDeltabar_dtau__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2Deltabar_dtau2__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2Deltabar_ddelta_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3Deltabar_dtau3__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3Deltabar_ddelta_dtau2(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3Deltabar_ddelta3__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3Deltabar_ddelta2_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+
+    CoolPropDbl X(const CoolPropDbl &delta, const CoolPropDbl &Deltabar);
+    CoolPropDbl dX_dDeltabar__constdelta(const CoolPropDbl &delta, const CoolPropDbl &Deltabar);
+    CoolPropDbl dX_ddelta__constDeltabar(const CoolPropDbl &delta, const CoolPropDbl &Deltabar);
+    CoolPropDbl dX_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl dX_ddelta(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2X_dtau2(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2X_ddeltadtau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d2X_ddelta2(const CoolPropDbl &tau, const CoolPropDbl &delta);
+
+    CoolPropDbl d3X_dtau3(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3X_ddelta3(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3X_ddeltadtau2(const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl d3X_ddelta2dtau(const CoolPropDbl &tau, const CoolPropDbl &delta);
+
+    CoolPropDbl g(const CoolPropDbl &eta);
+    CoolPropDbl dg_deta(const CoolPropDbl &eta);
+    CoolPropDbl d2g_deta2(const CoolPropDbl &eta);
+    CoolPropDbl d3g_deta3(const CoolPropDbl &eta);
+    CoolPropDbl eta(const CoolPropDbl &delta);
 
 public:
+    /// Reads and writes the members for the binary fluid database (see FluidDatabase.h)
+    template<class Archive> friend void serialize(Archive &ar, ResidualHelmholtzSAFTAssociating &term);
     /// Default constructor
     ResidualHelmholtzSAFTAssociating(){ disabled = true; };
     // Constructor
@@ -457,18 +487,18 @@ public:
 
     void to_json(rapidjson::Value &el, rapidjson::Document &doc);
 
-    long double base(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.alphar;};
-    long double dDelta(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_ddelta;};
-    long double dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_dtau;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta2;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta_dtau;};
-    long double dTau2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_dtau2;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta3;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta2_dtau;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta_dtau2;};
-    long double dTau3(const long double &tau, const long double &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_dtau3;};
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.alphar;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_ddelta;};
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.dalphar_dtau;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta2;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_ddelta_dtau;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d2alphar_dtau2;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta3;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta2_dtau;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_ddelta_dtau2;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){HelmholtzDerivatives deriv; all(tau,delta,deriv); return deriv.d3alphar_dtau3;};
     
-    void all(const long double &tau, const long double &delta, HelmholtzDerivatives &deriv) throw();
+    void all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &deriv) throw();
 };
 
 class ResidualHelmholtzContainer
@@ -478,25 +508,35 @@ public:
     ResidualHelmholtzNonAnalytic NonAnalytic;
     ResidualHelmholtzSAFTAssociating SAFT;
     ResidualHelmholtzGeneralizedExponential GenExp; 
+    /// The generated kernel that evaluates the terms of GenExp, or NULL if there is none for this equation of state
+    ResidualHelmholtzKernel GenExpKernel;
+
+    ResidualHelmholtzContainer() : GenExpKernel(NULL) {};
 
-    HelmholtzDerivatives all(const long double tau, const long double delta)
+    /// The derivatives selected by flags (alphar_derivative_flags); the terms may skip the others, which are then not meaningful
+    HelmholtzDerivatives all(const CoolPropDbl tau, const CoolPropDbl delta, int flags = ALPHAR_ALL_DERIVATIVES)
     {
         HelmholtzDerivatives derivs; // zeros out the elements
-        GenExp.all(tau, delta, derivs);
-        NonAnalytic.all(tau, delta, derivs);
+        if (GenExpKernel != NULL){
+            GenExpKernel(tau, delta, derivs, flags);
+        }
+        else{
+            GenExp.all(tau, delta, derivs, flags);
+        }
+        NonAnalytic.all(tau, delta, derivs, flags);
         SAFT.all(tau, delta, derivs);
         return derivs;
     };
-    long double base(long double tau, long double delta) { return all(tau,delta).alphar; };
-    long double dDelta(long double tau, long double delta) { return all(tau,delta).dalphar_ddelta; };
-    long double dTau(long double tau, long double delta) { return all(tau, delta).dalphar_dtau; };
-    long double dDelta2(long double tau, long double delta) {  return all(tau, delta).d2alphar_ddelta2; };
-    long double dDelta_dTau(long double tau, long double delta) { return all(tau, delta).d2alphar_ddelta_dtau; };
-    long double dTau2(long double tau, long double delta) { return all(tau, delta).d2alphar_dtau2; };
-    long double dDelta3(long double tau, long double delta) { return all(tau, delta).d3alphar_ddelta3; };
-    long double dDelta2_dTau(long double tau, long double delta) { return all(tau, delta).d3alphar_ddelta2_dtau; };
-    long double dDelta_dTau2(long double tau, long double delta) { return all(tau, delta).d3alphar_ddelta_dtau2; };
-    long double dTau3(long double tau, long double delta) { return all(tau, delta).d3alphar_dtau3; };
+    CoolPropDbl base(CoolPropDbl tau, CoolPropDbl delta) { return all(tau,delta, ALPHAR_BASE).alphar; };
+    CoolPropDbl dDelta(CoolPropDbl tau, CoolPropDbl delta) { return all(tau,delta, ALPHAR_DDELTA).dalphar_ddelta; };
+    CoolPropDbl dTau(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DTAU).dalphar_dtau; };
+    CoolPropDbl dDelta2(CoolPropDbl tau, CoolPropDbl delta) {  return all(tau, delta, ALPHAR_DDELTA2).d2alphar_ddelta2; };
+    CoolPropDbl dDelta_dTau(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DDELTA_DTAU).d2alphar_ddelta_dtau; };
+    CoolPropDbl dTau2(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DTAU2).d2alphar_dtau2; };
+    CoolPropDbl dDelta3(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DDELTA3).d3alphar_ddelta3; };
+    CoolPropDbl dDelta2_dTau(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DDELTA2_DTAU).d3alphar_ddelta2_dtau; };
+    CoolPropDbl dDelta_dTau2(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DDELTA_DTAU2).d3alphar_ddelta_dtau2; };
+    CoolPropDbl dTau3(CoolPropDbl tau, CoolPropDbl delta) { return all(tau, delta, ALPHAR_DTAU3).d3alphar_dtau3; };
 };
 
 // #############################################################################
@@ -516,14 +556,15 @@ public:
 class IdealHelmholtzLead : public BaseHelmholtzTerm{
 
 private:
-    long double a1, a2;
+    CoolPropDbl a1, a2;
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzLead &term);
     // Default constructor
     IdealHelmholtzLead(){enabled = false;};
 
     // Constructor
-    IdealHelmholtzLead(const long double a1, const long double a2)
+    IdealHelmholtzLead(const CoolPropDbl a1, const CoolPropDbl a2)
     :a1(a1), a2(a2)
     {enabled = true;};
 
@@ -539,31 +580,31 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return log(delta)+a1+a2*tau;
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return 1.0/delta;
     };
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return a2;
     };
-    long double dDelta2(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return -1.0/delta/delta;
     };
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return 2/delta/delta/delta;
     };
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau3(const long double &tau, const long double &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
 };
 
 /// The term in the EOS used to shift the reference state of the fluid
@@ -574,17 +615,18 @@ public:
 */
 class IdealHelmholtzEnthalpyEntropyOffset : public BaseHelmholtzTerm{
 private:
-    long double a1,a2; // Use these variables internally
+    CoolPropDbl a1,a2; // Use these variables internally
     bool enabled;
     std::string reference;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzEnthalpyEntropyOffset &term);
     IdealHelmholtzEnthalpyEntropyOffset(){enabled = false;};
 
     // Constructor
-    IdealHelmholtzEnthalpyEntropyOffset(long double a1, long double a2, std::string reference):a1(a1), a2(a2){this->reference = reference; enabled = true;};
+    IdealHelmholtzEnthalpyEntropyOffset(CoolPropDbl a1, CoolPropDbl a2, std::string reference):a1(a1), a2(a2){this->reference = reference; enabled = true;};
 
     // Set the values in the class
-    void set(long double a1, long double a2, std::string reference){this->a1 = a1; this->a2 = a2; this->reference = reference; enabled = true;}
+    void set(CoolPropDbl a1, CoolPropDbl a2, std::string reference){this->a1 = a1; this->a2 = a2; this->reference = reference; enabled = true;}
 
     //Destructor
     ~IdealHelmholtzEnthalpyEntropyOffset(){};
@@ -598,22 +640,22 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return a1+a2*tau;
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return a2;
     };
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau3(const long double &tau, const long double &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
 };
 
 
@@ -625,15 +667,16 @@ public:
 class IdealHelmholtzLogTau : public BaseHelmholtzTerm
 {
 private:
-    long double a1;
+    CoolPropDbl a1;
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzLogTau &term);
 
     /// Default constructor
     IdealHelmholtzLogTau(){enabled = false;};
 
     // Constructor
-    IdealHelmholtzLogTau(long double a1){this->a1=a1; enabled = true;};
+    IdealHelmholtzLogTau(CoolPropDbl a1){this->a1=a1; enabled = true;};
 
     bool is_enabled(){return enabled;};
 
@@ -646,28 +689,28 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return a1*log(tau);
     };
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return a1/tau;
     };
-    long double dTau2(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return -a1/tau/tau;
     };
-    long double dTau3(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return 2*a1/tau/tau/tau;
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
 };
 
 /**
@@ -678,13 +721,14 @@ public:
 class IdealHelmholtzPower : public BaseHelmholtzTerm{
     
 private:
-    std::vector<long double> n, t; // Use these variables internally
+    std::vector<CoolPropDbl> n, t; // Use these variables internally
     std::size_t N;
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzPower &term);
     IdealHelmholtzPower(){enabled = false;};
     // Constructor
-    IdealHelmholtzPower(const std::vector<long double> &n, const std::vector<long double> &t)
+    IdealHelmholtzPower(const std::vector<CoolPropDbl> &n, const std::vector<CoolPropDbl> &t)
     :n(n), t(t)
     {
         this->N = n.size();
@@ -704,28 +748,28 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*pow(tau, t[i]);} return s;
+        CoolPropDbl s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*pow(tau, t[i]);} return s;
     };
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*pow(tau, t[i]-1);} return s;
+        CoolPropDbl s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*pow(tau, t[i]-1);} return s;
     };
-    long double dTau2(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*(t[i]-1)*pow(tau, t[i]-2);} return s;
+        CoolPropDbl s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*(t[i]-1)*pow(tau, t[i]-2);} return s;
     };
-    long double dTau3(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*(t[i]-1)*(t[i]-2)*pow(tau, t[i]-3);} return s;
+        CoolPropDbl s=0; for (std::size_t i = 0; i<N; ++i){s += n[i]*t[i]*(t[i]-1)*(t[i]-2)*pow(tau, t[i]-3);} return s;
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
 };
 
 /**
@@ -777,13 +821,14 @@ where
 class IdealHelmholtzPlanckEinsteinGeneralized : public BaseHelmholtzTerm{
     
 private:
-    std::vector<long double> n,theta,c,d; // Use these variables internally
+    std::vector<CoolPropDbl> n,theta,c,d; // Use these variables internally
     std::size_t N;
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzPlanckEinsteinGeneralized &term);
     IdealHelmholtzPlanckEinsteinGeneralized(){N = 0; enabled = false;}
     // Constructor with std::vector instances
-    IdealHelmholtzPlanckEinsteinGeneralized(std::vector<long double> n, std::vector<long double> theta, std::vector<long double> c, std::vector<long double> d)
+    IdealHelmholtzPlanckEinsteinGeneralized(std::vector<CoolPropDbl> n, std::vector<CoolPropDbl> theta, std::vector<CoolPropDbl> c, std::vector<CoolPropDbl> d)
     :n(n), theta(theta), c(c), d(d)
     {
         N = n.size();
@@ -794,7 +839,7 @@ public:
     ~IdealHelmholtzPlanckEinsteinGeneralized(){};
 
     // Extend the vectors to allow for multiple instances feeding values to this function
-    void extend(std::vector<long double> n, std::vector<long double> theta, std::vector<long double> c, std::vector<long double> d)
+    void extend(std::vector<CoolPropDbl> n, std::vector<CoolPropDbl> theta, std::vector<CoolPropDbl> c, std::vector<CoolPropDbl> d)
     {
         this->n.insert(this->n.end(), n.begin(), n.end());
         this->theta.insert(this->theta.end(), theta.begin(), theta.end());
@@ -813,32 +858,32 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i=0; i < N; ++i){
+        CoolPropDbl s=0; for (std::size_t i=0; i < N; ++i){
             s += n[i]*log(c[i]+d[i]*exp(theta[i]*tau));
         } 
         return s;
     };
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*theta[i]*d[i]*exp(theta[i]*tau)/(c[i]+d[i]*exp(theta[i]*tau));} 
+        CoolPropDbl s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*theta[i]*d[i]*exp(theta[i]*tau)/(c[i]+d[i]*exp(theta[i]*tau));} 
         return s;
     };
-    long double dTau2(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*pow(theta[i],2)*c[i]*d[i]*exp(theta[i]*tau)/pow(c[i]+d[i]*exp(theta[i]*tau),2);} return s;
+        CoolPropDbl s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*pow(theta[i],2)*c[i]*d[i]*exp(theta[i]*tau)/pow(c[i]+d[i]*exp(theta[i]*tau),2);} return s;
     };
-    long double dTau3(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
-        long double s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*pow(theta[i],3)*c[i]*d[i]*(c[i]-d[i]*exp(theta[i]*tau))*exp(theta[i]*tau)/pow(c[i]+d[i]*exp(theta[i]*tau),3);} return s;
+        CoolPropDbl s=0; for (std::size_t i=0; i < N; ++i){s += n[i]*pow(theta[i],3)*c[i]*d[i]*(c[i]-d[i]*exp(theta[i]*tau))*exp(theta[i]*tau)/pow(c[i]+d[i]*exp(theta[i]*tau),3);} return s;
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0;};
 };
 
 class IdealHelmholtzCP0Constant : public BaseHelmholtzTerm{
@@ -847,11 +892,12 @@ private:
     double cp_over_R,Tc,T0,tau0; // Use these variables internally
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzCP0Constant &term);
     /// Default constructor
     IdealHelmholtzCP0Constant(){enabled = false;};
 
     /// Constructor with just a single double value
-    IdealHelmholtzCP0Constant(long double cp_over_R, long double Tc, long double T0) 
+    IdealHelmholtzCP0Constant(CoolPropDbl cp_over_R, CoolPropDbl Tc, CoolPropDbl T0) 
     : cp_over_R(cp_over_R), Tc(Tc), T0(T0)
     { 
         enabled = true; tau0 = Tc/T0;
@@ -871,42 +917,43 @@ public:
     };
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return cp_over_R-cp_over_R*tau/tau0+cp_over_R*log(tau/tau0);
     };
-    long double dTau(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return cp_over_R/tau-cp_over_R/tau0;
     };
-    long double dTau2(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return -cp_over_R/(tau*tau);
     };
-    long double dTau3(const long double &tau, const long double &delta) throw(){
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){
         if (!enabled){return 0.0;}
         return 2*cp_over_R/(tau*tau*tau);
     };
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
 };
 
 class IdealHelmholtzCP0PolyT : public BaseHelmholtzTerm{
 private:
-    std::vector<long double> c, t;
-    long double Tc, T0, tau0; // Use these variables internally
+    std::vector<CoolPropDbl> c, t;
+    CoolPropDbl Tc, T0, tau0; // Use these variables internally
     std::size_t N;
     bool enabled;
 public:
+    template<class Archive> friend void serialize(Archive &ar, IdealHelmholtzCP0PolyT &term);
     /// Destructor
     IdealHelmholtzCP0PolyT(){N = 0; enabled = false;};
 
     /// Constructor with std::vectors
-    IdealHelmholtzCP0PolyT(const std::vector<long double> &c, const std::vector<long double> &t, double Tc, double T0) 
+    IdealHelmholtzCP0PolyT(const std::vector<CoolPropDbl> &c, const std::vector<CoolPropDbl> &t, double Tc, double T0) 
     : c(c), t(t), Tc(Tc), T0(T0)
     { 
         assert(c.size() == t.size());
@@ -915,7 +962,7 @@ public:
         N = c.size();
     };
 
-    void extend(const std::vector<long double> &c, const std::vector<long double> &t)
+    void extend(const std::vector<CoolPropDbl> &c, const std::vector<CoolPropDbl> &t)
     {
         this->c.insert(this->c.end(), c.begin(), c.end());
         this->t.insert(this->t.end(), t.begin(), t.end());
@@ -930,16 +977,16 @@ public:
     void to_json(rapidjson::Value &el, rapidjson::Document &doc);
 
     // Term and its derivatives
-    long double base(const long double &tau, const long double &delta) throw();
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau(const long double &tau, const long double &delta) throw();
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau2(const long double &tau, const long double &delta) throw();
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau3(const long double &tau, const long double &delta) throw();
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
     
 };
 
@@ -985,14 +1032,14 @@ see also Jaeschke and Schley, 1995, (http://link.springer.com/article/10.1007%2F
 */
 class IdealHelmholtzCP0AlyLee : public BaseHelmholtzTerm{
 private:
-    std::vector<long double> c;
-    long double Tc, tau0, T0; // Use these variables internally
+    std::vector<CoolPropDbl> c;
+    CoolPropDbl Tc, tau0, T0; // Use these variables internally
     bool enabled;
 public:
     IdealHelmholtzCP0AlyLee(){enabled = false;};
 
     /// Constructor with std::vectors
-    IdealHelmholtzCP0AlyLee(std::vector<long double> c, double Tc, double T0)
+    IdealHelmholtzCP0AlyLee(std::vector<CoolPropDbl> c, double Tc, double T0)
     :c(c), Tc(Tc), T0(T0)
     {
         tau0=Tc/T0;
@@ -1024,7 +1071,7 @@ public:
     \displaystyle\int \frac{1}{\tau^2}\frac{c_p^0}{R_u}d\tau = -\frac{a_0}{\tau}+\frac{2a_1a_2}{T_c\left[\exp\left(-\frac{2a_2\tau}{T_c}\right)-1\right]}+\frac{2a_3a_4}{T_c\left[\exp\left(-\frac{2a_4\tau}{T_c}\right)+1\right]}
     \f]
     */
-    long double anti_deriv_cp0_tau2(const long double &tau);
+    CoolPropDbl anti_deriv_cp0_tau2(const CoolPropDbl &tau);
 
     /// The antiderivative given by \f$ \displaystyle\int \frac{1}{\tau}\frac{c_p^0}{R_u}d\tau \f$
     /**
@@ -1059,18 +1106,18 @@ public:
     \displaystyle\int \frac{a_1a_2^2}{T_c^2}\frac{\tau}{\cosh\left(\displaystyle\frac{a_2\tau}{T_c}\right)^2} d\tau = - \frac{a_{3}}{Tc \left(e^{\frac{2 a_{4}}{Tc} \tau} + 1\right)} \left(Tc e^{\frac{2 a_{4}}{Tc} \tau} \log{\left (e^{\frac{2 a_{4}}{Tc} \tau} + 1 \right )} + Tc \log{\left (e^{\frac{2 a_{4}}{Tc} \tau} + 1 \right )} - 2 a_{4} \tau e^{\frac{2 a_{4}}{Tc} \tau}\right)
     \f]
     */
-    long double anti_deriv_cp0_tau(const long double &tau);
-
-    long double base(const long double &tau, const long double &delta) throw();
-    long double dDelta(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau(const long double &tau, const long double &delta) throw();
-    long double dDelta2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau2(const long double &tau, const long double &delta) throw();
-    long double dDelta3(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta2_dTau(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dDelta_dTau2(const long double &tau, const long double &delta) throw(){return 0.0;};
-    long double dTau3(const long double &tau, const long double &delta) throw();
+    CoolPropDbl anti_deriv_cp0_tau(const CoolPropDbl &tau);
+
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw(){return 0.0;};
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw();
     
 };
 
@@ -1088,7 +1135,7 @@ public:
     IdealHelmholtzCP0Constant CP0Constant;
     IdealHelmholtzCP0PolyT CP0PolyT;
 
-    long double base(const long double &tau, const long double &delta)
+    CoolPropDbl base(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.base(tau, delta) + EnthalpyEntropyOffset.base(tau, delta)
                 + EnthalpyEntropyOffsetCore.base(tau, delta)
@@ -1097,7 +1144,7 @@ public:
                 + CP0Constant.base(tau, delta) + CP0PolyT.base(tau, delta)
                 );
     };
-    long double dDelta(const long double &tau, const long double &delta)
+    CoolPropDbl dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dDelta(tau, delta) + EnthalpyEntropyOffset.dDelta(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta(tau, delta)
@@ -1106,7 +1153,7 @@ public:
                 + CP0Constant.dDelta(tau, delta) + CP0PolyT.dDelta(tau, delta)
                 );
     };
-    long double dTau(const long double &tau, const long double &delta)
+    CoolPropDbl dTau(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dTau(tau, delta) + EnthalpyEntropyOffset.dTau(tau, delta)
                 + EnthalpyEntropyOffsetCore.dTau(tau, delta)
@@ -1115,7 +1162,7 @@ public:
                 + CP0Constant.dTau(tau, delta) + CP0PolyT.dTau(tau, delta)
                 );
     };
-    long double dDelta2(const long double &tau, const long double &delta)
+    CoolPropDbl dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dDelta2(tau, delta) + EnthalpyEntropyOffset.dDelta2(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta2(tau, delta)
@@ -1124,7 +1171,7 @@ public:
                 + CP0Constant.dDelta2(tau, delta) + CP0PolyT.dDelta2(tau, delta)
                 );
     };
-    long double dDelta_dTau(const long double &tau, const long double &delta)
+    CoolPropDbl dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dDelta_dTau(tau, delta) + EnthalpyEntropyOffset.dDelta_dTau(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta_dTau(tau, delta)
@@ -1133,7 +1180,7 @@ public:
                 + CP0Constant.dDelta_dTau(tau, delta) + CP0PolyT.dDelta_dTau(tau, delta)
                 );
     };
-    long double dTau2(const long double &tau, const long double &delta)
+    CoolPropDbl dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dTau2(tau, delta) + EnthalpyEntropyOffset.dTau2(tau, delta)
                 + EnthalpyEntropyOffsetCore.dTau2(tau, delta)
@@ -1142,7 +1189,7 @@ public:
                 + CP0Constant.dTau2(tau, delta) + CP0PolyT.dTau2(tau, delta)
                 );
     };
-    long double dDelta3(const long double &tau, const long double &delta) 
+    CoolPropDbl dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) 
     {
         return (Lead.dDelta3(tau, delta) + EnthalpyEntropyOffset.dDelta3(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta3(tau, delta)
@@ -1151,7 +1198,7 @@ public:
                 + CP0Constant.dDelta3(tau, delta) + CP0PolyT.dDelta3(tau, delta)
                 );
     };
-    long double dDelta2_dTau(const long double &tau, const long double &delta)
+    CoolPropDbl dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dDelta2_dTau(tau, delta) + EnthalpyEntropyOffset.dDelta2_dTau(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta2_dTau(tau, delta)
@@ -1160,7 +1207,7 @@ public:
                 + CP0Constant.dDelta2_dTau(tau, delta) + CP0PolyT.dDelta2_dTau(tau, delta)
                 );
     };
-    long double dDelta_dTau2(const long double &tau, const long double &delta)
+    CoolPropDbl dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dDelta_dTau2(tau, delta) + EnthalpyEntropyOffset.dDelta_dTau2(tau, delta)
                 + EnthalpyEntropyOffsetCore.dDelta_dTau2(tau, delta)
@@ -1169,7 +1216,7 @@ public:
                 + CP0Constant.dDelta_dTau2(tau, delta) + CP0PolyT.dDelta_dTau2(tau, delta)
                 );
     };
-    long double dTau3(const long double &tau, const long double &delta)
+    CoolPropDbl dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta)
     {
         return (Lead.dTau3(tau, delta) + EnthalpyEntropyOffset.dTau3(tau, delta)
                 + EnthalpyEntropyOffsetCore.dTau3(tau, delta)
@@ -295,13 +295,13 @@ template <class T> void removeColumn(Eigen::Matrix<T,Eigen::Dynamic,Eigen::Dynam
 /// Templates for printing numbers, vectors and matrices
 static const char* stdFmt = "%8.3f";
 
-///Templates for turning vectors (1D-matrices) into strings
+///Templates for turning vectors (1D-matrices) into strings; the elements are formatted as doubles
 template<class T> std::string vec_to_string(const             std::vector<T>   &a, const char *fmt) {
     if (a.size()<1) return std::string("");
     std::stringstream out;
-    out << "[ " << format(fmt,a[0]);
+    out << "[ " << format(fmt, static_cast<double>(a[0]));
     for (size_t j = 1; j < a.size(); j++) {
-        out << ", " << format(fmt, a[j]);
+        out << ", " << format(fmt, static_cast<double>(a[j]));
     }
     out << " ]";
     return out.str();
@@ -382,7 +382,7 @@ template <class T> std::string mat_to_string(const Eigen::Matrix<T,Eigen::Dynami
 ///// Templates for printing numbers, vectors and matrices
 //static const char* stdFmt = "%8.3f";
 //
-/////Templates for turning vectors (1D-matrices) into strings
+/////Templates for turning vectors (1D-matrices) into strings; the elements are formatted as doubles
 //template<class T> std::string vec_to_string(const             std::vector<T>   &a, const char *fmt) {
 //    if (a.size()<1) return std::string("");
 //    std::stringstream out;
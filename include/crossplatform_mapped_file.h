@@ -0,0 +1,73 @@
+#ifndef CROSSPLATFORM_MAPPED_FILE
+#define CROSSPLATFORM_MAPPED_FILE
+
+#include "PlatformDetermination.h"
+#include "Exceptions.h"
+#include "CoolPropTools.h"
+
+// A read-only memory mapping of a file built on the native calls of the platform
+
+#if defined(__ISWINDOWS__)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace CoolProp {
+
+/// A read-only memory mapping of a file, so that the pages are shared with the other processes that map the same file
+class MappedFile
+{
+private:
+    #if defined(__ISWINDOWS__)
+        HANDLE file, mapping;
+    #endif
+    void *_data;
+    std::size_t _size;
+public:
+    MappedFile(const std::string &path) : _data(NULL), _size(0) {
+        #if defined(__ISWINDOWS__)
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (file == INVALID_HANDLE_VALUE){ throw ValueError(format("Unable to open file [%s]", path.c_str())); }
+            _size = static_cast<std::size_t>(GetFileSize(file, NULL));
+            mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping != NULL){ _data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0); }
+            if (_data == NULL){
+                if (mapping != NULL){ CloseHandle(mapping); }
+                CloseHandle(file);
+                throw ValueError(format("Unable to map file [%s]", path.c_str()));
+            }
+        #else
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0){ throw ValueError(format("Unable to open file [%s]", path.c_str())); }
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0){
+                _size = static_cast<std::size_t>(st.st_size);
+                _data = mmap(NULL, _size, PROT_READ, MAP_SHARED, fd, 0);
+                if (_data == MAP_FAILED){ _data = NULL; }
+            }
+            // The mapping stays valid after the file is closed
+            close(fd);
+            if (_data == NULL){ throw ValueError(format("Unable to map file [%s]", path.c_str())); }
+        #endif
+    };
+    ~MappedFile(){
+        #if defined(__ISWINDOWS__)
+            UnmapViewOfFile(_data); CloseHandle(mapping); CloseHandle(file);
+        #else
+            munmap(_data, _size);
+        #endif
+    };
+    const unsigned char *data(){ return static_cast<const unsigned char *>(_data); };
+    std::size_t size(){ return _size; };
+};
+
+} /* namespace CoolProp */
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef CROSSPLATFORM_MUTEX
+#define CROSSPLATFORM_MUTEX
+
+#include "PlatformDetermination.h"
+
+// A minimal mutex, scoped lock, thread-local storage and thread runner built on the native threading primitives
+// of the platform, so that shared state can be protected without requiring C++11 <mutex>, <thread> or thread_local
+
+#if defined(__ISWINDOWS__)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+    #include <sys/time.h>
+#endif
+#include <vector>
+
+namespace CoolProp {
+
+class Mutex
+{
+private:
+    #if defined(__ISWINDOWS__)
+        CRITICAL_SECTION cs;
+    #else
+        pthread_mutex_t mutex;
+    #endif
+    // Not copyable
+    Mutex(const Mutex &);
+    Mutex &operator=(const Mutex &);
+public:
+    #if defined(__ISWINDOWS__)
+        Mutex(){ InitializeCriticalSection(&cs); };
+        ~Mutex(){ DeleteCriticalSection(&cs); };
+        void lock(){ EnterCriticalSection(&cs); };
+        void unlock(){ LeaveCriticalSection(&cs); };
+    #else
+        Mutex(){ pthread_mutex_init(&mutex, NULL); };
+        ~Mutex(){ pthread_mutex_destroy(&mutex); };
+        void lock(){ pthread_mutex_lock(&mutex); };
+        void unlock(){ pthread_mutex_unlock(&mutex); };
+    #endif
+};
+
+/// Hold the lock on a Mutex for the lifetime of this object
+class ScopedLock
+{
+private:
+    Mutex &m;
+    ScopedLock(const ScopedLock &);
+    ScopedLock &operator=(const ScopedLock &);
+public:
+    ScopedLock(Mutex &mutex) : m(mutex){ m.lock(); };
+    ~ScopedLock(){ m.unlock(); };
+};
+
+/** \brief An int that can be read and written by several threads without a lock
+ *
+ * Everything a thread wrote before it stores a value is visible to a thread that loads that value.
+ */
+class AtomicInt
+{
+private:
+    #if defined(__ISWINDOWS__)
+        volatile LONG value;
+    #else
+        volatile int value;
+    #endif
+    AtomicInt(const AtomicInt &);
+    AtomicInt &operator=(const AtomicInt &);
+public:
+    AtomicInt(int value = 0) : value(value){};
+    #if defined(__ISWINDOWS__)
+        int load(){ return static_cast<int>(InterlockedCompareExchange(&value, 0, 0)); };
+        void store(int v){ InterlockedExchange(&value, v); };
+    #else
+        int load(){ return __sync_fetch_and_add(&value, 0); };
+        void store(int v){ __sync_synchronize(); value = v; __sync_synchronize(); };
+    #endif
+};
+
+/** \brief One instance of T for each thread
+ *
+ * The instance for a thread is default-constructed the first time that thread calls get(), and it is
+ * deleted when the thread exits.
+ */
+template<class T> class ThreadLocal
+{
+private:
+    #if defined(__ISWINDOWS__)
+        DWORD key;
+        static void WINAPI destroy(void *p){ delete static_cast<T*>(p); };
+    #else
+        pthread_key_t key;
+        static void destroy(void *p){ delete static_cast<T*>(p); };
+    #endif
+    ThreadLocal(const ThreadLocal &);
+    ThreadLocal &operator=(const ThreadLocal &);
+public:
+    #if defined(__ISWINDOWS__)
+        ThreadLocal(){ key = FlsAlloc(&destroy); };
+        ~ThreadLocal(){ FlsFree(key); };
+        T &get(){
+            T *p = static_cast<T*>(FlsGetValue(key));
+            if (p == NULL){ p = new T(); FlsSetValue(key, p); }
+            return *p;
+        };
+    #else
+        ThreadLocal(){ pthread_key_create(&key, &destroy); };
+        ~ThreadLocal(){ pthread_key_delete(key); };
+        T &get(){
+            T *p = static_cast<T*>(pthread_getspecific(key));
+            if (p == NULL){ p = new T(); pthread_setspecific(key, p); }
+            return *p;
+        };
+    #endif
+};
+
+/// The number of processors that are online, at least 1
+inline int get_number_of_processors()
+{
+    #if defined(__ISWINDOWS__)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        int N = static_cast<int>(info.dwNumberOfProcessors);
+    #else
+        int N = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    #endif
+    return (N > 0) ? N : 1;
+}
+
+/// The time in s since an arbitrary start, to time work done by several threads (clock() adds up the processor time of all of them)
+inline double get_wall_time()
+{
+    #if defined(__ISWINDOWS__)
+        LARGE_INTEGER count, frequency;
+        QueryPerformanceCounter(&count);
+        QueryPerformanceFrequency(&frequency);
+        return static_cast<double>(count.QuadPart)/static_cast<double>(frequency.QuadPart);
+    #else
+        timeval tv;
+        gettimeofday(&tv, NULL);
+        return tv.tv_sec + tv.tv_usec*1e-6;
+    #endif
+}
+
+/// A function to call with one argument in a thread of its own
+template<class T> struct ThreadCall
+{
+    void (*func)(T &);
+    T *arg;
+    #if defined(__ISWINDOWS__)
+        static DWORD WINAPI entry(LPVOID p){ ThreadCall *c = static_cast<ThreadCall*>(p); c->func(*(c->arg)); return 0; };
+    #else
+        static void *entry(void *p){ ThreadCall *c = static_cast<ThreadCall*>(p); c->func(*(c->arg)); return NULL; };
+    #endif
+};
+
+/** \brief Call func(args[i]) for each element of args, each in a thread of its own, and wait for all of them to return
+ *
+ * func must not throw; catch exceptions inside it and pass them back through its argument.
+ */
+template<class T> void run_in_threads(void (*func)(T &), std::vector<T> &args)
+{
+    std::vector<ThreadCall<T> > calls(args.size());
+    for (std::size_t i = 0; i < args.size(); ++i){ calls[i].func = func; calls[i].arg = &(args[i]); }
+    #if defined(__ISWINDOWS__)
+        std::vector<HANDLE> threads(args.size());
+        for (std::size_t i = 0; i < args.size(); ++i){ threads[i] = CreateThread(NULL, 0, &ThreadCall<T>::entry, &(calls[i]), 0, NULL); }
+        for (std::size_t i = 0; i < args.size(); ++i){ WaitForSingleObject(threads[i], INFINITE); CloseHandle(threads[i]); }
+    #else
+        std::vector<pthread_t> threads(args.size());
+        for (std::size_t i = 0; i < args.size(); ++i){ pthread_create(&(threads[i]), NULL, &ThreadCall<T>::entry, &(calls[i])); }
+        for (std::size_t i = 0; i < args.size(); ++i){ pthread_join(threads[i], NULL); }
+    #endif
+}
+
+} /* namespace CoolProp */
+
+#endif
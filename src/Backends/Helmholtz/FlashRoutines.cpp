@@ -46,25 +46,25 @@ void FlashRoutines::PT_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS)
             // Gas solution - bounded between phase envelope temperature and very high temperature
             //
             // Start with a guess value from SRK
-            long double rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_gas);
+            CoolPropDbl rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_gas);
             
             solver_TP_resid resid(HEOS, HEOS._T, HEOS._p);
             std::string errstr;
             HEOS.specify_phase(iphase_gas);
             try{
                 // Try using Newton's method
-                long double rhomolar = Newton(resid, rhomolar_guess, 1e-10, 100, errstr);
+                CoolPropDbl rhomolar = Newton(resid, rhomolar_guess, 1e-10, 100, errstr);
                 // Make sure the solution is within the bounds
-                if (!is_in_closed_range(static_cast<long double>(closest_state.rhomolar), 0.0L, rhomolar)){
+                if (!is_in_closed_range(static_cast<CoolPropDbl>(closest_state.rhomolar), static_cast<CoolPropDbl>(0), rhomolar)){
                     throw ValueError("out of range");
                 }
                 HEOS.update_DmolarT_direct(rhomolar, HEOS._T);
             }
             catch(std::exception &e){
                 // If that fails, try a bounded solver
-                long double rhomolar = Brent(resid, closest_state.rhomolar, 1e-10, DBL_EPSILON, 1e-10, 100, errstr);
+                CoolPropDbl rhomolar = Brent(resid, closest_state.rhomolar, 1e-10, DBL_EPSILON, 1e-10, 100, errstr);
                 // Make sure the solution is within the bounds
-                if (!is_in_closed_range(static_cast<long double>(closest_state.rhomolar), 0.0L, rhomolar)){
+                if (!is_in_closed_range(static_cast<CoolPropDbl>(closest_state.rhomolar), static_cast<CoolPropDbl>(0), rhomolar)){
                     throw ValueError("out of range");
                 }
             }
@@ -79,26 +79,26 @@ void FlashRoutines::PT_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS)
         // Following the strategy of Gernert, 2014
         
         // Step 1 a) Get lnK factors using Wilson
-        std::vector<long double> lnK(HEOS.get_mole_fractions().size());
+        std::vector<CoolPropDbl> lnK(HEOS.get_mole_fractions().size());
         for (std::size_t i = 0; i < lnK.size(); ++i){
             lnK[i] = SaturationSolvers::Wilson_lnK_factor(HEOS, HEOS._T, HEOS._p, i);
         }
         
         // Use Rachford-Rice to check whether you are in a homogeneous phase
-        long double g_RR_0 = g_RachfordRice(HEOS.get_const_mole_fractions(), lnK, 0.0L);
+        CoolPropDbl g_RR_0 = g_RachfordRice(HEOS.get_const_mole_fractions(), lnK, static_cast<CoolPropDbl>(0));
         if (g_RR_0 < 0){
             // Subcooled liquid - done
-            long double rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_liquid);
+            CoolPropDbl rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_liquid);
             HEOS.specify_phase(iphase_liquid);
             HEOS.update_TP_guessrho(HEOS._T, HEOS._p, rhomolar_guess);
             HEOS.unspecify_phase();
             return;
         }
         else{
-            long double g_RR_1 = g_RachfordRice(HEOS.get_const_mole_fractions(), lnK, 1.0L);
+            CoolPropDbl g_RR_1 = g_RachfordRice(HEOS.get_const_mole_fractions(), lnK, static_cast<CoolPropDbl>(1));
             if (g_RR_1 > 0){
                 // Superheated vapor - done
-                long double rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_gas);
+                CoolPropDbl rhomolar_guess = HEOS.solver_rho_Tp_SRK(HEOS._T, HEOS._p, iphase_gas);
                 HEOS.specify_phase(iphase_gas);
                 HEOS.update_TP_guessrho(HEOS._T, HEOS._p, rhomolar_guess);
                 HEOS.unspecify_phase();
@@ -137,11 +137,11 @@ void FlashRoutines::PT_flash(HelmholtzEOSMixtureBackend &HEOS)
         }
     }
     
-    // Find density
-    HEOS._rhomolar = HEOS.solver_rho_Tp(HEOS._T, HEOS._p);
+    // Find density; the density solver leaves the state at the solution (with update_DmolarT_direct), which clears anything cached by the phase determination
+    HEOS.solver_rho_Tp(HEOS._T, HEOS._p);
     HEOS._Q = -1;
 }
-void FlashRoutines::HQ_flash(HelmholtzEOSMixtureBackend &HEOS, long double Tguess)
+void FlashRoutines::HQ_flash(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl Tguess)
 {
     SaturationSolvers::saturation_PHSU_pure_options options;
     options.use_logdelta = false;
@@ -214,15 +214,15 @@ void FlashRoutines::QS_flash(HelmholtzEOSMixtureBackend &HEOS)
 }
 void FlashRoutines::QT_flash(HelmholtzEOSMixtureBackend &HEOS)
 {
-    long double T = HEOS._T;
+    CoolPropDbl T = HEOS._T;
     if (HEOS.is_pure_or_pseudopure)
     {
         // The maximum possible saturation temperature
         // Critical point for pure fluids, slightly different for pseudo-pure, very different for mixtures
-        long double Tmax_sat = HEOS.calc_Tmax_sat() + 1e-13;
+        CoolPropDbl Tmax_sat = HEOS.calc_Tmax_sat() + 1e-13;
         
         // Check what the minimum limits for the equation of state are
-        long double Tmin_satL, Tmin_satV, Tmin_sat;
+        CoolPropDbl Tmin_satL, Tmin_satV, Tmin_sat;
         HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
         Tmin_sat = std::max(Tmin_satL, Tmin_satV) - 1e-13;
         
@@ -237,7 +237,7 @@ void FlashRoutines::QT_flash(HelmholtzEOSMixtureBackend &HEOS)
              HEOS._p = 0.5*HEOS.SatV->p() + 0.5*HEOS.SatL->p();
         }
         else if (!is_in_closed_range(Tmin_sat, Tmax_sat, T)){
-            throw ValueError(format("Temperature to QT_flash [%0.8Lg K] must be in range [%0.8Lg K, %0.8Lg K]", T, Tmin_sat, Tmax_sat));
+            throw ValueError(format("Temperature to QT_flash [%0.8g K] must be in range [%0.8g K, %0.8g K]", static_cast<double>(T), static_cast<double>(Tmin_sat), static_cast<double>(Tmax_sat)));
         }
         else if (get_config_bool(CRITICAL_SPLINES_ENABLED) && splines.enabled && HEOS._T > splines.T_min){
             double rhoL = _HUGE, rhoV = _HUGE;
@@ -262,9 +262,9 @@ void FlashRoutines::QT_flash(HelmholtzEOSMixtureBackend &HEOS)
         }
         else{
             // Pseudo-pure fluid
-            long double rhoLanc = _HUGE, rhoVanc = _HUGE, rhoLsat = _HUGE, rhoVsat = _HUGE;
-            long double psatLanc = HEOS.components[0]->ancillaries.pL.evaluate(HEOS._T); // These ancillaries are used explicitly
-            long double psatVanc = HEOS.components[0]->ancillaries.pV.evaluate(HEOS._T); // These ancillaries are used explicitly
+            CoolPropDbl rhoLanc = _HUGE, rhoVanc = _HUGE, rhoLsat = _HUGE, rhoVsat = _HUGE;
+            CoolPropDbl psatLanc = HEOS.components[0]->ancillaries.pL.evaluate(HEOS._T); // These ancillaries are used explicitly
+            CoolPropDbl psatVanc = HEOS.components[0]->ancillaries.pV.evaluate(HEOS._T); // These ancillaries are used explicitly
             try{
                 rhoLanc = HEOS.components[0]->ancillaries.rhoL.evaluate(HEOS._T);
                 rhoVanc = HEOS.components[0]->ancillaries.rhoV.evaluate(HEOS._T);
@@ -307,7 +307,7 @@ void FlashRoutines::QT_flash(HelmholtzEOSMixtureBackend &HEOS)
             options.Nstep_max = 20;
 
             // Get an extremely rough guess by interpolation of ln(p) v. T curve where the limits are mole-fraction-weighted
-            long double pguess = SaturationSolvers::saturation_preconditioner(HEOS, HEOS._T, SaturationSolvers::imposed_T, HEOS.mole_fractions);
+            CoolPropDbl pguess = SaturationSolvers::saturation_preconditioner(HEOS, HEOS._T, SaturationSolvers::imposed_T, HEOS.mole_fractions);
 
             // Use Wilson iteration to obtain updated guess for pressure
             pguess = SaturationSolvers::saturation_Wilson(HEOS, HEOS._Q, HEOS._T, SaturationSolvers::imposed_T, HEOS.mole_fractions, pguess);
@@ -335,8 +335,8 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend &HEOS)
             HEOS._TLanc = HEOS.components[0]->ancillaries.pL.invert(HEOS._p);
             HEOS._TVanc = HEOS.components[0]->ancillaries.pV.invert(HEOS._p);
             // Get guesses for the ancillaries for density
-            long double rhoL = HEOS.components[0]->ancillaries.rhoL.evaluate(HEOS._TLanc);
-            long double rhoV = HEOS.components[0]->ancillaries.rhoV.evaluate(HEOS._TVanc);
+            CoolPropDbl rhoL = HEOS.components[0]->ancillaries.rhoL.evaluate(HEOS._TLanc);
+            CoolPropDbl rhoV = HEOS.components[0]->ancillaries.rhoV.evaluate(HEOS._TVanc);
             // Solve for the density
             HEOS.SatL->update_TP_guessrho(HEOS._TLanc, HEOS._p, rhoL);
             HEOS.SatV->update_TP_guessrho(HEOS._TVanc, HEOS._p, rhoV);
@@ -349,15 +349,15 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend &HEOS)
         }
         else{
             // Critical point for pure fluids, slightly different for pseudo-pure, very different for mixtures
-            long double pmax_sat = HEOS.calc_pmax_sat();
+            CoolPropDbl pmax_sat = HEOS.calc_pmax_sat();
             
             // Check what the minimum limits for the equation of state are
-            long double pmin_satL, pmin_satV, pmin_sat;
+            CoolPropDbl pmin_satL, pmin_satV, pmin_sat;
             HEOS.calc_pmin_sat(pmin_satL, pmin_satV);
             pmin_sat = std::max(pmin_satL, pmin_satV);
             
             // Check for being AT the critical point
-            if (is_in_closed_range(pmax_sat*(1-1e-10), pmax_sat*(1+1e-10), static_cast<long double>(HEOS._p))){
+            if (is_in_closed_range(pmax_sat*(1-1e-10), pmax_sat*(1+1e-10), static_cast<CoolPropDbl>(HEOS._p))){
                 // Load the outputs
                 HEOS._phase = iphase_critical_point;
                 HEOS._p = HEOS.p_critical();
@@ -367,8 +367,8 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend &HEOS)
             }
             
             // Check limits
-            if (!is_in_closed_range(pmin_sat*0.999999, pmax_sat*1.000001, static_cast<long double>(HEOS._p))){
-                throw ValueError(format("Pressure to PQ_flash [%6g Pa] must be in range [%8Lg Pa, %8Lg Pa]",HEOS._p, pmin_sat, pmax_sat));
+            if (!is_in_closed_range(pmin_sat*0.999999, pmax_sat*1.000001, static_cast<CoolPropDbl>(HEOS._p))){
+                throw ValueError(format("Pressure to PQ_flash [%6g Pa] must be in range [%8g Pa, %8g Pa]",HEOS._p, static_cast<double>(pmin_sat), static_cast<double>(pmax_sat)));
             }
             // ------------------
             // It is a pure fluid
@@ -426,7 +426,7 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend &HEOS)
             io.Nstep_max = 10;
 
             // Get an extremely rough guess by interpolation of ln(p) v. T curve where the limits are mole-fraction-weighted
-            long double Tguess = SaturationSolvers::saturation_preconditioner(HEOS, HEOS._p, SaturationSolvers::imposed_p, HEOS.mole_fractions);
+            CoolPropDbl Tguess = SaturationSolvers::saturation_preconditioner(HEOS, HEOS._p, SaturationSolvers::imposed_p, HEOS.mole_fractions);
 
             // Use Wilson iteration to obtain updated guess for temperature
             Tguess = SaturationSolvers::saturation_Wilson(HEOS, HEOS._Q, HEOS._p, SaturationSolvers::imposed_p, HEOS.mole_fractions, Tguess);
@@ -443,7 +443,7 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend &HEOS)
     }
 }
 
-void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parameters other, long double value)
+void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parameters other, CoolPropDbl value)
 {
     
     // Find the intersections in the phase envelope
@@ -494,14 +494,14 @@ void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parame
                 IO.p = HEOS._p;
                 IO.imposed_variable = SaturationSolvers::newton_raphson_saturation_options::P_IMPOSED;
                 // p -> rhomolar_vap
-                IO.rhomolar_vap = CubicInterp(env.p, env.rhomolar_vap, imax-1, imax, imax+1, imax+2, static_cast<long double>(IO.p));
+                IO.rhomolar_vap = CubicInterp(env.p, env.rhomolar_vap, imax-1, imax, imax+1, imax+2, static_cast<CoolPropDbl>(IO.p));
                 IO.T = CubicInterp(env.rhomolar_vap, env.T, imax-1, imax, imax+1, imax+2, IO.rhomolar_vap);
             }
             else if (other == iT){
                 IO.T = HEOS._T;
                 IO.imposed_variable = SaturationSolvers::newton_raphson_saturation_options::T_IMPOSED;
                 // T -> rhomolar_vap
-                IO.rhomolar_vap = CubicInterp(env.T, env.rhomolar_vap, imax-1, imax, imax+1, imax+2, static_cast<long double>(IO.T));
+                IO.rhomolar_vap = CubicInterp(env.T, env.rhomolar_vap, imax-1, imax, imax+1, imax+2, static_cast<CoolPropDbl>(IO.T));
                 IO.p = CubicInterp(env.rhomolar_vap, env.p, imax-1, imax, imax+1, imax+2, IO.rhomolar_vap);
             }
             IO.rhomolar_liq = CubicInterp(env.rhomolar_vap, env.rhomolar_liq, imax-1, imax, imax+1, imax+2, IO.rhomolar_vap);
@@ -565,7 +565,7 @@ void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parame
         SaturationSolvers::newton_raphson_twophase_options IO;
         IO.beta = HEOS._Q;
         
-        long double rhomolar_vap_sat_vap, T_sat_vap, rhomolar_liq_sat_vap, rhomolar_liq_sat_liq, T_sat_liq, rhomolar_vap_sat_liq, p_sat_liq, p_sat_vap;
+        CoolPropDbl rhomolar_vap_sat_vap, T_sat_vap, rhomolar_liq_sat_vap, rhomolar_liq_sat_liq, T_sat_liq, rhomolar_vap_sat_liq, p_sat_liq, p_sat_vap;
 
         if (other == iP){
             IO.p = HEOS._p;
@@ -573,12 +573,12 @@ void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parame
             IO.imposed_variable = SaturationSolvers::newton_raphson_twophase_options::P_IMPOSED;
             
             // Calculate the interpolated values for beta = 0 and beta = 1
-            rhomolar_vap_sat_vap = CubicInterp(env.p, env.rhomolar_vap, ivap-1, ivap, ivap+1, ivap+2, static_cast<long double>(IO.p));
+            rhomolar_vap_sat_vap = CubicInterp(env.p, env.rhomolar_vap, ivap-1, ivap, ivap+1, ivap+2, static_cast<CoolPropDbl>(IO.p));
             T_sat_vap = CubicInterp(env.rhomolar_vap, env.T, ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
             rhomolar_liq_sat_vap = CubicInterp(env.rhomolar_vap, env.rhomolar_liq, ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
             
             // Phase inversion for liquid solution (liquid is vapor and vice versa)
-            rhomolar_liq_sat_liq = CubicInterp(env.p, env.rhomolar_vap, iliq-1, iliq, iliq+1, iliq+2, static_cast<long double>(IO.p)); 
+            rhomolar_liq_sat_liq = CubicInterp(env.p, env.rhomolar_vap, iliq-1, iliq, iliq+1, iliq+2, static_cast<CoolPropDbl>(IO.p)); 
             T_sat_liq = CubicInterp(env.rhomolar_vap, env.T, iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
             rhomolar_vap_sat_liq = CubicInterp(env.rhomolar_vap, env.rhomolar_liq, iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
         }
@@ -588,12 +588,12 @@ void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parame
             IO.imposed_variable = SaturationSolvers::newton_raphson_twophase_options::T_IMPOSED;
             
             // Calculate the interpolated values for beta = 0 and beta = 1
-            rhomolar_vap_sat_vap = CubicInterp(env.T, env.rhomolar_vap, ivap-1, ivap, ivap+1, ivap+2, static_cast<long double>(IO.T));
+            rhomolar_vap_sat_vap = CubicInterp(env.T, env.rhomolar_vap, ivap-1, ivap, ivap+1, ivap+2, static_cast<CoolPropDbl>(IO.T));
             p_sat_vap = CubicInterp(env.rhomolar_vap, env.p, ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
             rhomolar_liq_sat_vap = CubicInterp(env.rhomolar_vap, env.rhomolar_liq, ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
             
             // Phase inversion for liquid solution (liquid is vapor and vice versa)
-            rhomolar_liq_sat_liq = CubicInterp(env.T, env.rhomolar_vap, iliq-1, iliq, iliq+1, iliq+2, static_cast<long double>(IO.T)); 
+            rhomolar_liq_sat_liq = CubicInterp(env.T, env.rhomolar_vap, iliq-1, iliq, iliq+1, iliq+2, static_cast<CoolPropDbl>(IO.T)); 
             p_sat_liq = CubicInterp(env.rhomolar_vap, env.p, iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
             rhomolar_vap_sat_liq = CubicInterp(env.rhomolar_vap, env.rhomolar_liq, iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
         }
@@ -613,33 +613,33 @@ void FlashRoutines::PT_Q_flash_mixtures(HelmholtzEOSMixtureBackend &HEOS, parame
         
         for (std::size_t i = 0; i < IO.x.size()-1; ++i) // First N-1 elements
         {
-            long double x_sat_vap = CubicInterp(env.rhomolar_vap, env.x[i], ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
-            long double y_sat_vap = CubicInterp(env.rhomolar_vap, env.y[i], ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
+            CoolPropDbl x_sat_vap = CubicInterp(env.rhomolar_vap, env.x[i], ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
+            CoolPropDbl y_sat_vap = CubicInterp(env.rhomolar_vap, env.y[i], ivap-1, ivap, ivap+1, ivap+2, rhomolar_vap_sat_vap);
             
-            long double x_sat_liq = CubicInterp(env.rhomolar_vap, env.y[i], iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
-            long double y_sat_liq = CubicInterp(env.rhomolar_vap, env.x[i], iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
+            CoolPropDbl x_sat_liq = CubicInterp(env.rhomolar_vap, env.y[i], iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
+            CoolPropDbl y_sat_liq = CubicInterp(env.rhomolar_vap, env.x[i], iliq-1, iliq, iliq+1, iliq+2, rhomolar_liq_sat_liq);
             
             IO.x[i] = IO.beta*x_sat_vap + (1-IO.beta)*x_sat_liq;
             IO.y[i] = IO.beta*y_sat_vap + (1-IO.beta)*y_sat_liq;
         }
         IO.x[IO.x.size()-1] = 1 - std::accumulate(IO.x.begin(), IO.x.end()-1, 0.0);
         IO.y[IO.y.size()-1] = 1 - std::accumulate(IO.y.begin(), IO.y.end()-1, 0.0);
-        std::vector<long double> &XX = IO.x;
-        std::vector<long double> &YY = IO.y;
+        std::vector<CoolPropDbl> &XX = IO.x;
+        std::vector<CoolPropDbl> &YY = IO.y;
         NR.call(HEOS, IO);
     }
 }
-void FlashRoutines::HSU_D_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, long double rhomolar_spec, parameters other, long double value)
+void FlashRoutines::HSU_D_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl rhomolar_spec, parameters other, CoolPropDbl value)
 {
     class Residual : public FuncWrapper1D
     {
         
     public:
         HelmholtzEOSMixtureBackend &HEOS;
-        long double rhomolar_spec, Qd, Qo;
+        CoolPropDbl rhomolar_spec, Qd, Qo;
 		parameters other;
-		long double value;
-        Residual(HelmholtzEOSMixtureBackend &HEOS, long double rhomolar_spec, parameters other, long double value) : HEOS(HEOS), rhomolar_spec(rhomolar_spec), other(other), value(value){};
+		CoolPropDbl value;
+        Residual(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl rhomolar_spec, parameters other, CoolPropDbl value) : HEOS(HEOS), rhomolar_spec(rhomolar_spec), other(other), value(value){};
         double call(double T){
             HEOS.update(QT_INPUTS, 0, T);
             HelmholtzEOSMixtureBackend &SatL = HEOS.get_SatL(),
@@ -655,10 +655,10 @@ void FlashRoutines::HSU_D_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, long
     
     std::string errstr;
     // Critical point for pure fluids, slightly different for pseudo-pure, very different for mixtures
-    long double Tmax_sat = HEOS.calc_Tmax_sat() - 1e-13;
+    CoolPropDbl Tmax_sat = HEOS.calc_Tmax_sat() - 1e-13;
     
     // Check what the minimum limits for the equation of state are
-    long double Tmin_satL, Tmin_satV, Tmin_sat;
+    CoolPropDbl Tmin_satL, Tmin_satV, Tmin_sat;
     HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
     Tmin_sat = std::max(Tmin_satL, Tmin_satV) - 1e-13;
         
@@ -673,10 +673,10 @@ void FlashRoutines::PHSU_D_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
     public:
 
         HelmholtzEOSMixtureBackend *HEOS;
-        long double r, eos, rhomolar, value, T;
+        CoolPropDbl r, eos, rhomolar, value, T;
         int other;
 
-        solver_resid(HelmholtzEOSMixtureBackend *HEOS, long double rhomolar, long double value, int other) : HEOS(HEOS), rhomolar(rhomolar), value(value), other(other){};
+        solver_resid(HelmholtzEOSMixtureBackend *HEOS, CoolPropDbl rhomolar, CoolPropDbl value, int other) : HEOS(HEOS), rhomolar(rhomolar), value(value), other(other){};
         double call(double T){
             this->T = T;
             switch(other)
@@ -712,14 +712,14 @@ void FlashRoutines::PHSU_D_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
             CoolPropFluid * component = HEOS.components[0];
 
             shared_ptr<HelmholtzEOSMixtureBackend> Sat;
-            long double rhoLtriple = component->triple_liquid.rhomolar;
-            long double rhoVtriple = component->triple_vapor.rhomolar;
+            CoolPropDbl rhoLtriple = component->triple_liquid.rhomolar;
+            CoolPropDbl rhoVtriple = component->triple_vapor.rhomolar;
             // Check if in the "normal" region
             if (HEOS._rhomolar >= rhoVtriple && HEOS._rhomolar <= rhoLtriple)
             {
-                long double yL, yV, value, y_solid;
-                long double TLtriple = component->triple_liquid.T; ///TODO: separate TL and TV for ppure
-                long double TVtriple = component->triple_vapor.T;
+                CoolPropDbl yL, yV, value, y_solid;
+                CoolPropDbl TLtriple = component->triple_liquid.T; ///TODO: separate TL and TV for ppure
+                CoolPropDbl TVtriple = component->triple_vapor.T;
 
                 // First check if solid (below the line connecting the triple point values) - this is an error for now
                 switch (other)
@@ -799,8 +799,8 @@ void FlashRoutines::PHSU_D_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
             // Check if vapor/solid region below triple point vapor density
             else if (HEOS._rhomolar < component->triple_vapor.rhomolar)
             {
-                long double y, value;
-                long double TVtriple = component->triple_vapor.T; //TODO: separate TL and TV for ppure
+                CoolPropDbl y, value;
+                CoolPropDbl TVtriple = component->triple_vapor.T; //TODO: separate TL and TV for ppure
 
                 // If value is above the value calculated from X(Ttriple, _rhomolar), it is vapor
                 switch (other)
@@ -833,8 +833,8 @@ void FlashRoutines::PHSU_D_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
             // Check in the liquid/solid region above the triple point density
             else
             {
-                long double y, value;
-                long double TLtriple = component->pEOS->Ttriple;
+                CoolPropDbl y, value;
+                CoolPropDbl TLtriple = component->pEOS->Ttriple;
 
                 // If value is above the value calculated from X(Ttriple, _rhomolar), it is vapor
                 switch (other)
@@ -869,16 +869,16 @@ void FlashRoutines::PHSU_D_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
     }
 }
 
-void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend &HEOS, parameters other, long double T0, long double rhomolar0)
+void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend &HEOS, parameters other, CoolPropDbl T0, CoolPropDbl rhomolar0)
 {
     double A[2][2], B[2][2];
-    long double y = _HUGE;
+    CoolPropDbl y = _HUGE;
     HelmholtzEOSMixtureBackend _HEOS(HEOS.get_components());
     _HEOS.update(DmolarT_INPUTS, rhomolar0, T0);
-    long double Tc = HEOS.calc_T_critical();
-    long double rhoc = HEOS.calc_rhomolar_critical();
-    long double R = HEOS.gas_constant();
-    long double p = HEOS.p();
+    CoolPropDbl Tc = HEOS.calc_T_critical();
+    CoolPropDbl rhoc = HEOS.calc_rhomolar_critical();
+    CoolPropDbl R = HEOS.gas_constant();
+    CoolPropDbl p = HEOS.p();
     switch (other)
     {
         case iHmolar: y = HEOS.hmolar(); break;
@@ -886,31 +886,31 @@ void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend &H
         default: throw ValueError("other is invalid in HSU_P_flash_singlephase_Newton");
     }
     
-    long double worst_error = 999;
+    CoolPropDbl worst_error = 999;
     int iter = 0;
     bool failed = false;
-    long double omega = 1.0, f2, df2_dtau, df2_ddelta;
-    long double tau = _HEOS.tau(), delta = _HEOS.delta();
+    CoolPropDbl omega = 1.0, f2, df2_dtau, df2_ddelta;
+    CoolPropDbl tau = _HEOS.tau(), delta = _HEOS.delta();
     while (worst_error>1e-6 && failed == false)
     {
         
         // All the required partial derivatives
-        long double a0 = _HEOS.calc_alpha0_deriv_nocache(0,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
-        long double da0_ddelta = _HEOS.calc_alpha0_deriv_nocache(0,1,HEOS.mole_fractions, tau, delta,Tc,rhoc);
-        long double da0_dtau = _HEOS.calc_alpha0_deriv_nocache(1,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
-        long double d2a0_dtau2 = _HEOS.calc_alpha0_deriv_nocache(2,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
-        long double d2a0_ddelta_dtau = 0.0;
+        CoolPropDbl a0 = _HEOS.calc_alpha0_deriv_nocache(0,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
+        CoolPropDbl da0_ddelta = _HEOS.calc_alpha0_deriv_nocache(0,1,HEOS.mole_fractions, tau, delta,Tc,rhoc);
+        CoolPropDbl da0_dtau = _HEOS.calc_alpha0_deriv_nocache(1,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
+        CoolPropDbl d2a0_dtau2 = _HEOS.calc_alpha0_deriv_nocache(2,0,HEOS.mole_fractions, tau, delta,Tc,rhoc);
+        CoolPropDbl d2a0_ddelta_dtau = 0.0;
         
-        long double ar = _HEOS.calc_alphar_deriv_nocache(0,0,HEOS.mole_fractions, tau, delta);
-        long double dar_dtau = _HEOS.calc_alphar_deriv_nocache(1,0,HEOS.mole_fractions, tau, delta);
-        long double dar_ddelta = _HEOS.calc_alphar_deriv_nocache(0,1,HEOS.mole_fractions, tau, delta);
-        long double d2ar_ddelta_dtau = _HEOS.calc_alphar_deriv_nocache(1,1,HEOS.mole_fractions, tau, delta);
-        long double d2ar_ddelta2 = _HEOS.calc_alphar_deriv_nocache(0,2,HEOS.mole_fractions, tau, delta);
-        long double d2ar_dtau2 = _HEOS.calc_alphar_deriv_nocache(2,0,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl ar = _HEOS.calc_alphar_deriv_nocache(0,0,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl dar_dtau = _HEOS.calc_alphar_deriv_nocache(1,0,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl dar_ddelta = _HEOS.calc_alphar_deriv_nocache(0,1,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl d2ar_ddelta_dtau = _HEOS.calc_alphar_deriv_nocache(1,1,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl d2ar_ddelta2 = _HEOS.calc_alphar_deriv_nocache(0,2,HEOS.mole_fractions, tau, delta);
+        CoolPropDbl d2ar_dtau2 = _HEOS.calc_alphar_deriv_nocache(2,0,HEOS.mole_fractions, tau, delta);
 
-        long double f1 = delta/tau*(1+delta*dar_ddelta)-p/(rhoc*R*Tc);
-        long double df1_dtau = (1+delta*dar_ddelta)*(-delta/tau/tau)+delta/tau*(delta*d2ar_ddelta_dtau);
-        long double df1_ddelta = (1.0/tau)*(1+2.0*delta*dar_ddelta+delta*delta*d2ar_ddelta2);
+        CoolPropDbl f1 = delta/tau*(1+delta*dar_ddelta)-p/(rhoc*R*Tc);
+        CoolPropDbl df1_dtau = (1+delta*dar_ddelta)*(-delta/tau/tau)+delta/tau*(delta*d2ar_ddelta_dtau);
+        CoolPropDbl df1_ddelta = (1.0/tau)*(1+2.0*delta*dar_ddelta+delta*delta*d2ar_ddelta2);
         switch (other)
         {
             case iHmolar:
@@ -962,7 +962,7 @@ void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend &H
     
     HEOS.update(DmolarT_INPUTS, rhoc*delta, Tc/tau);
 }
-void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend &HEOS, parameters other, long double value, long double Tmin, long double Tmax)
+void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend &HEOS, parameters other, CoolPropDbl value, CoolPropDbl Tmin, CoolPropDbl Tmax)
 {
     if (!ValidNumber(HEOS._p)){throw ValueError("value for p in HSU_P_flash_singlephase_Brent is invalid");};
     if (!ValidNumber(value)){throw ValueError("value for other in HSU_P_flash_singlephase_Brent is invalid");};
@@ -971,11 +971,11 @@ void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend &HE
     public:
 
         HelmholtzEOSMixtureBackend *HEOS;
-        long double r, eos, p, value, T, rhomolar;
+        CoolPropDbl r, eos, p, value, T, rhomolar;
         int other;
         int iter;
-        long double r0, r1, T1, T0, eos0, eos1, pp;
-        solver_resid(HelmholtzEOSMixtureBackend *HEOS, long double p, long double value, int other) : 
+        CoolPropDbl r0, r1, T1, T0, eos0, eos1, pp;
+        solver_resid(HelmholtzEOSMixtureBackend *HEOS, CoolPropDbl p, CoolPropDbl value, int other) : 
                 HEOS(HEOS), p(p), value(value), other(other)
                 {
                     iter = 0;
@@ -1030,14 +1030,14 @@ void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend &HE
         
         // Determine why you were out of range if you can
         // 
-        long double eos0 = resid.eos0, eos1 = resid.eos1;
+        CoolPropDbl eos0 = resid.eos0, eos1 = resid.eos1;
         std::string name = get_parameter_information(other,"short");
         std::string units = get_parameter_information(other,"units");
         if (eos1 > eos0 && value > eos1){
-            throw ValueError(format("HSU_P_flash_singlephase_Brent could not find a solution because %s [%Lg %s] is above the maximum value of %0.12Lg %s", name.c_str(), value, units.c_str(), eos1, units.c_str()));
+            throw ValueError(format("HSU_P_flash_singlephase_Brent could not find a solution because %s [%g %s] is above the maximum value of %0.12g %s", name.c_str(), static_cast<double>(value), units.c_str(), static_cast<double>(eos1), units.c_str()));
         }
         if (eos1 > eos0 && value < eos0){
-            throw ValueError(format("HSU_P_flash_singlephase_Brent could not find a solution because %s [%Lg %s] is below the minimum value of %0.12Lg %s", name.c_str(), value, units.c_str(), eos0, units.c_str()));
+            throw ValueError(format("HSU_P_flash_singlephase_Brent could not find a solution because %s [%g %s] is below the minimum value of %0.12g %s", name.c_str(), static_cast<double>(value), units.c_str(), static_cast<double>(eos0), units.c_str()));
         }
         throw;
     }
@@ -1047,7 +1047,7 @@ void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend &HE
 void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend &HEOS, parameters other)
 {
     bool saturation_called = false;
-    long double value;
+    CoolPropDbl value;
     if (HEOS.imposed_phase_index != iphase_not_imposed)
     {
         // Use the phase defined by the imposed phase
@@ -1077,7 +1077,7 @@ void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend &HEOS, parameters oth
             {
                 // Now we use the single-phase solver to find T,rho given P,Y using a 
                 // bounded 1D solver by adjusting T and using given value of p
-                long double Tmin, Tmax;
+                CoolPropDbl Tmin, Tmax;
                 switch(HEOS._phase)
                 {
                     case iphase_gas:
@@ -1120,7 +1120,7 @@ void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend &HEOS, parameters oth
                     HSU_P_flash_singlephase_Brent(HEOS, other, value, Tmin, Tmax);
                 }
                 catch(std::exception &e){
-                    throw ValueError(format("unable to solve 1phase PY flash with Tmin=%Lg, Tmax=%Lg due to error: %s",Tmin, Tmax, e.what()));
+                    throw ValueError(format("unable to solve 1phase PY flash with Tmin=%g, Tmax=%g due to error: %s",static_cast<double>(Tmin), static_cast<double>(Tmax), e.what()));
                 }
                 HEOS._Q = -1;
             }
@@ -1140,7 +1140,7 @@ void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend &HEOS, parameters oth
                 if (!twophase){
                     PY_singlephase_flash_resid resid(HEOS, HEOS._p, other, value);
                     // If that fails, try a bounded solver
-                    long double rhomolar = Brent(resid, closest_state.T+10, 1000, DBL_EPSILON, 1e-10, 100, errstr);
+                    CoolPropDbl rhomolar = Brent(resid, closest_state.T+10, 1000, DBL_EPSILON, 1e-10, 100, errstr);
                     HEOS.unspecify_phase();
                 }
                 else{
@@ -1209,15 +1209,15 @@ void FlashRoutines::DHSU_T_flash(HelmholtzEOSMixtureBackend &HEOS, parameters ot
     // Update the state for conditions where the state was guessed
     
 }
-void FlashRoutines::HS_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, long double hmolar_spec, long double smolar_spec, HS_flash_twophaseOptions &options)
+void FlashRoutines::HS_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl hmolar_spec, CoolPropDbl smolar_spec, HS_flash_twophaseOptions &options)
 {
     class Residual : public FuncWrapper1D
     {
         
     public:
         HelmholtzEOSMixtureBackend &HEOS;
-        long double hmolar, smolar, Qs, Qh;
-        Residual(HelmholtzEOSMixtureBackend &HEOS, long double hmolar_spec, long double smolar_spec) : HEOS(HEOS), hmolar(hmolar_spec), smolar(smolar_spec){};
+        CoolPropDbl hmolar, smolar, Qs, Qh;
+        Residual(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl hmolar_spec, CoolPropDbl smolar_spec) : HEOS(HEOS), hmolar(hmolar_spec), smolar(smolar_spec){};
         double call(double T){
             HEOS.update(QT_INPUTS, 0, T);
             HelmholtzEOSMixtureBackend &SatL = HEOS.get_SatL(),
@@ -1233,16 +1233,16 @@ void FlashRoutines::HS_flash_twophase(HelmholtzEOSMixtureBackend &HEOS, long dou
     
     std::string errstr;
     // Critical point for pure fluids, slightly different for pseudo-pure, very different for mixtures
-    long double Tmax_sat = HEOS.calc_Tmax_sat() - 1e-13;
+    CoolPropDbl Tmax_sat = HEOS.calc_Tmax_sat() - 1e-13;
     
     // Check what the minimum limits for the equation of state are
-    long double Tmin_satL, Tmin_satV, Tmin_sat;
+    CoolPropDbl Tmin_satL, Tmin_satV, Tmin_sat;
     HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
     Tmin_sat = std::max(Tmin_satL, Tmin_satV) - 1e-13;
         
     Brent(resid, Tmin_sat, Tmax_sat-0.01, DBL_EPSILON, 1e-12, 20, errstr);
 }
-void FlashRoutines::HS_flash_singlephase(HelmholtzEOSMixtureBackend &HEOS, long double hmolar_spec, long double smolar_spec, HS_flash_singlephaseOptions &options)
+void FlashRoutines::HS_flash_singlephase(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl hmolar_spec, CoolPropDbl smolar_spec, HS_flash_singlephaseOptions &options)
 {
     int iter = 0;
     double resid = 9e30, resid_old = 9e30;
@@ -1458,6 +1458,31 @@ TEST_CASE("PD with T very large should yield error","[PDflash]")
 	HEOS->update(DmassT_INPUTS, 1.1, 1.5*Tc);
 	CHECK_THROWS(HEOS->update(DmassP_INPUTS, 2, 5*HEOS->p()));
 }
+TEST_CASE("Saturated states are only constructed when they are needed","[SatL_SatV]")
+{
+    SECTION("pure fluid"){
+        shared_ptr<HelmholtzEOSBackend> HEOS(new HelmholtzEOSBackend("Water"));
+        HEOS->update(PT_INPUTS, 101325, 300);
+        HEOS->update(DmolarT_INPUTS, 1000, 700);
+        CHECK(!HEOS->SatL.is_constructed());
+        CHECK(!HEOS->SatV.is_constructed());
+        HEOS->update(QT_INPUTS, 0.5, 373);
+        CHECK(HEOS->SatL.is_constructed());
+        CHECK(HEOS->SatV.is_constructed());
+        CHECK(HEOS->SatL->T() == 373);
+        CHECK(HEOS->SatL->rhomolar() > HEOS->SatV->rhomolar());
+    }
+    SECTION("mixture"){
+        std::vector<std::string> names(2); names[0] = "Methane"; names[1] = "Ethane";
+        shared_ptr<HelmholtzEOSMixtureBackend> HEOS(new HelmholtzEOSMixtureBackend(names));
+        HEOS->set_mole_fractions(std::vector<CoolPropDbl>(2, 0.5));
+        HEOS->update(PT_INPUTS, 101325, 300);
+        CHECK(!HEOS->SatL.is_constructed());
+        HEOS->update(PQ_INPUTS, 101325, 0);
+        REQUIRE(HEOS->SatL.is_constructed());
+        CHECK(HEOS->SatL->get_mole_fractions().size() == 2);
+    }
+}
 #endif
 
 } /* namespace CoolProp */
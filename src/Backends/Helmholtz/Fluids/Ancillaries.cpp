@@ -46,7 +46,6 @@ SaturationAncillaryFunction::SaturationAncillaryFunction(rapidjson::Value &json_
     else
         this->type = TYPE_EXPONENTIAL;
     this->N = n.size();
-    s = n;
 };
     
 double SaturationAncillaryFunction::evaluate(double T)
@@ -64,11 +63,11 @@ double SaturationAncillaryFunction::evaluate(double T)
     {
         double THETA = 1-T/T_r;
 
+        double summer = 0;
         for (std::size_t i = 0; i < N; ++i)
         {
-            s[i] = n[i]*pow(THETA, t[i]);
+            summer += n[i]*pow(THETA, t[i]);
         }
-        double summer = std::accumulate(s.begin(), s.end(), 0.0);
 
         if (type == TYPE_NOT_EXPONENTIAL)
         {
@@ -94,9 +93,9 @@ double SaturationAncillaryFunction::invert(double value, double min_bound, doubl
     public:
         int other;
         SaturationAncillaryFunction *anc;
-        long double T, value, r, current_value;
+        CoolPropDbl T, value, r, current_value;
 
-        solver_resid(SaturationAncillaryFunction *anc, long double value) : anc(anc), value(value){};
+        solver_resid(SaturationAncillaryFunction *anc, CoolPropDbl value) : anc(anc), value(value){};
 
         double call(double T){
             this->T = T;
@@ -164,7 +163,7 @@ void MeltingLineVariables::set_limits(void)
     }
 }
 
-long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
+CoolPropDbl MeltingLineVariables::evaluate(int OF, int GIVEN, CoolPropDbl value)
 {
     if (type == MELTING_LINE_NOT_SET){throw ValueError("Melting line curve not set");}
     if (OF == iP_max){ return pmax;}
@@ -172,7 +171,7 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
     else if (OF == iT_max){ return Tmax;}
     else if (OF == iT_min){ return Tmin;}
     else if (OF == iP && GIVEN == iT){
-        long double T = value;
+        CoolPropDbl T = value;
         if (type == MELTING_LINE_SIMON_TYPE){
             // Need to find the right segment
             for (std::size_t i = 0; i < simon.parts.size(); ++i){
@@ -213,12 +212,12 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
             for (std::size_t i = 0; i < simon.parts.size(); ++i){
                 MeltingLinePiecewiseSimonSegment &part = simon.parts[i];
                 //  p = part.p_0 + part.a*(pow(T/part.T_0,part.c)-1);
-                long double T = pow((value-part.p_0)/part.a+1,1/part.c)*part.T_0;
+                CoolPropDbl T = pow((value-part.p_0)/part.a+1,1/part.c)*part.T_0;
                 if (T >= part.T_0 && T <= part.T_max){
                     return T;
                 }
             }
-            throw ValueError(format("unable to calculate melting line T(p) for Simon curve for p=%Lg; bounds are %Lg,%Lg Pa", value, pmin, pmax));
+            throw ValueError(format("unable to calculate melting line T(p) for Simon curve for p=%g; bounds are %g,%g Pa", static_cast<double>(value), static_cast<double>(pmin), static_cast<double>(pmax)));
         }
         else if (type == MELTING_LINE_POLYNOMIAL_IN_TR_TYPE)
         {
@@ -226,8 +225,8 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
             {
             public:
                 MeltingLinePiecewisePolynomialInTrSegment *part;
-                long double r, given_p, calc_p, T;
-                solver_resid(MeltingLinePiecewisePolynomialInTrSegment *part, long double p) : part(part), given_p(p){};
+                CoolPropDbl r, given_p, calc_p, T;
+                solver_resid(MeltingLinePiecewisePolynomialInTrSegment *part, CoolPropDbl p) : part(part), given_p(p){};
                 double call(double T){
 
                     this->T = T;
@@ -251,7 +250,7 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
                     return T;
                 }
             }
-            throw ValueError(format("unable to calculate melting line T(p) for polynomial_in_Theta curve for p=%Lg; bounds are %Lg,%Lg Pa", value, pmin, pmax));
+            throw ValueError(format("unable to calculate melting line T(p) for polynomial_in_Theta curve for p=%g; bounds are %g,%g Pa", static_cast<double>(value), static_cast<double>(pmin), static_cast<double>(pmax)));
         }
         else if (type == MELTING_LINE_POLYNOMIAL_IN_THETA_TYPE)
         {
@@ -260,8 +259,8 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
             {
             public:
                 MeltingLinePiecewisePolynomialInThetaSegment *part;
-                long double r, given_p, calc_p, T;
-                solver_resid(MeltingLinePiecewisePolynomialInThetaSegment *part, long double p) : part(part), given_p(p){};
+                CoolPropDbl r, given_p, calc_p, T;
+                solver_resid(MeltingLinePiecewisePolynomialInThetaSegment *part, CoolPropDbl p) : part(part), given_p(p){};
                 double call(double T){
 
                     this->T = T;
@@ -286,7 +285,7 @@ long double MeltingLineVariables::evaluate(int OF, int GIVEN, long double value)
                 }
             }
             
-            throw ValueError(format("unable to calculate melting line T(p) for polynomial_in_Theta curve for p=%Lg; bounds are %Lg,%Lg Pa", value, pmin, pmax));
+            throw ValueError(format("unable to calculate melting line T(p) for polynomial_in_Theta curve for p=%g; bounds are %g,%g Pa", static_cast<double>(value), static_cast<double>(pmin), static_cast<double>(pmax)));
         }
         else{
             throw ValueError(format("Invalid melting line type T(p) [%d]",type));
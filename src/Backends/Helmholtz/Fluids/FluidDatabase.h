@@ -0,0 +1,452 @@
+#ifndef FLUIDDATABASE_H
+#define FLUIDDATABASE_H
+
+#include "CoolPropFluid.h"
+#include <cstring>
+
+namespace CoolProp{
+
+/// The version of the layout of the binary fluid database; it must be increased whenever the members that are serialized below change
+const int FLUID_DATABASE_VERSION = 1;
+
+/**
+The binary fluid database holds the fully parsed fluids, so that they can be read without parsing the JSON of the fluids.
+It is laid out as (with native byte order, since the database is written by the build for the machine that uses it)
+
+    char[8]           "CPFLUIDS"
+    uint32            FLUID_DATABASE_VERSION
+    uint32            sizeof(CoolPropDbl)
+    uint32            hash of the JSON the fluids were parsed from (see fluid_database_hash), so that a database that is
+                      older than the JSON in the library is not used
+    uint32            number of fluids N
+    uint32[N][2]      offset from the beginning of the database and length of the record of each fluid
+    char[]            the records
+
+The record of a fluid holds the members of the CoolPropFluid, written by the serialize functions below.  It begins with the
+name, CAS number and aliases, so that the library can index the fluids without reading the rest of their records.
+
+There is one serialize function for each type, used both to write the database (with FluidDatabaseWriter) and to read it
+(with FluidDatabaseReader), so that both always have the same layout.  A member is only written if the parser sets it: the
+data of a term that is disabled or of a transport model of another type are skipped, so that the record of a fluid only
+depends on its coefficients.  The members that are derived from the coefficients (the arrays of the generalized exponential
+terms, the limits of the melting line, ...) are rebuilt when the fluid is read.
+*/
+
+/// Writes the members of the fluids to a buffer
+class FluidDatabaseWriter
+{
+public:
+    static const bool reading = false;
+    std::string buffer;
+    void bytes(const void *p, std::size_t n){ buffer.append(static_cast<const char*>(p), n); };
+    void check_count(std::size_t){};
+};
+
+/// Reads the members of the fluids back from a database, checking that they do not run past its end
+class FluidDatabaseReader
+{
+    const unsigned char *pos, *end;
+public:
+    static const bool reading = true;
+    FluidDatabaseReader(const unsigned char *data, std::size_t size) : pos(data), end(data + size) {};
+    void bytes(void *p, std::size_t n){
+        if (static_cast<std::size_t>(end - pos) < n){ throw ValueError("Fluid database is truncated"); }
+        memcpy(p, pos, n);
+        pos += n;
+    };
+    /// Check the number of elements of an array before it is allocated; each element takes at least one byte
+    void check_count(std::size_t n){
+        if (static_cast<std::size_t>(end - pos) < n){ throw ValueError("Fluid database is truncated"); }
+    };
+};
+
+/// A 32-bit FNV-1a hash of the JSON that the fluids of a database are parsed from
+inline unsigned int fluid_database_hash(const std::string &JSON)
+{
+    unsigned int hash = 2166136261u;
+    for (std::size_t i = 0; i < JSON.size(); ++i){
+        hash ^= static_cast<unsigned char>(JSON[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// The values are only assigned when they are read, so that writing a fluid never modifies it, even if other threads are using it
+
+template<class Archive> void serialize(Archive &ar, int &x){ ar.bytes(&x, sizeof(x)); }
+template<class Archive> void serialize(Archive &ar, unsigned int &x){ ar.bytes(&x, sizeof(x)); }
+template<class Archive> void serialize(Archive &ar, double &x){ ar.bytes(&x, sizeof(x)); }
+template<class Archive> void serialize(Archive &ar, bool &x)
+{
+    unsigned char c = x ? 1 : 0;
+    ar.bytes(&c, 1);
+    if (Archive::reading){ x = (c != 0); }
+}
+template<class Archive> void serialize(Archive &ar, long double &x)
+{
+    // The padding bytes of a long double are undefined, so it is stored exactly as the sum of two doubles
+    double hi = static_cast<double>(x), lo = ValidNumber(hi) ? static_cast<double>(x - hi) : 0;
+    serialize(ar, hi);
+    serialize(ar, lo);
+    // The low part is only added if it is not zero, so that -0 stays -0
+    if (Archive::reading){ x = static_cast<long double>(hi); if (lo != 0){ x += lo; } }
+}
+template<class Archive, class Enum> void serialize_enum(Archive &ar, Enum &x)
+{
+    int i = static_cast<int>(x);
+    serialize(ar, i);
+    if (Archive::reading){ x = static_cast<Enum>(i); }
+}
+template<class Archive> void serialize(Archive &ar, std::string &s)
+{
+    unsigned int n = static_cast<unsigned int>(s.size());
+    serialize(ar, n);
+    ar.check_count(n);
+    if (Archive::reading){ s.resize(n); }
+    if (n > 0){ ar.bytes(&(s[0]), n); }
+}
+template<class Archive, class T> void serialize(Archive &ar, std::vector<T> &v)
+{
+    unsigned int n = static_cast<unsigned int>(v.size());
+    serialize(ar, n);
+    ar.check_count(n);
+    if (Archive::reading){ v.resize(n); }
+    for (std::size_t i = 0; i < n; ++i){ serialize(ar, v[i]); }
+}
+template<class Archive> void serialize(Archive &ar, Eigen::MatrixXd &m)
+{
+    unsigned int rows = static_cast<unsigned int>(m.rows()), cols = static_cast<unsigned int>(m.cols());
+    serialize(ar, rows);
+    serialize(ar, cols);
+    ar.check_count(static_cast<std::size_t>(rows)*cols*sizeof(double));
+    if (Archive::reading){ m.resize(rows, cols); }
+    if (rows*cols > 0){ ar.bytes(m.data(), static_cast<std::size_t>(rows)*cols*sizeof(double)); }
+}
+template<class Archive> void serialize(Archive &ar, SimpleState &s)
+{
+    serialize(ar, s.rhomolar); serialize(ar, s.T); serialize(ar, s.p); serialize(ar, s.hmolar); serialize(ar, s.smolar);
+    serialize(ar, s.umolar); serialize(ar, s.Q);
+}
+
+// ------------------------------
+//  Equation of state
+// ------------------------------
+
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzGeneralizedExponentialElement &el)
+{
+    serialize(ar, el.n); serialize(ar, el.d); serialize(ar, el.t); serialize(ar, el.c); serialize(ar, el.l_double);
+    serialize(ar, el.omega); serialize(ar, el.m_double); serialize(ar, el.eta1); serialize(ar, el.epsilon1);
+    serialize(ar, el.eta2); serialize(ar, el.epsilon2); serialize(ar, el.beta1); serialize(ar, el.gamma1);
+    serialize(ar, el.beta2); serialize(ar, el.gamma2); serialize(ar, el.l_int); serialize(ar, el.m_int);
+}
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzGeneralizedExponential &term)
+{
+    serialize(ar, term.delta_li_in_u); serialize(ar, term.tau_mi_in_u); serialize(ar, term.eta1_in_u);
+    serialize(ar, term.eta2_in_u); serialize(ar, term.beta1_in_u); serialize(ar, term.beta2_in_u);
+    serialize(ar, term.elements);
+    if (Archive::reading){ term.finish(); }
+}
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzNonAnalyticElement &el)
+{
+    serialize(ar, el.n); serialize(ar, el.a); serialize(ar, el.b); serialize(ar, el.beta);
+    serialize(ar, el.A); serialize(ar, el.B); serialize(ar, el.C); serialize(ar, el.D);
+}
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzNonAnalytic &term)
+{
+    serialize(ar, term.elements);
+    if (Archive::reading){ term.N = term.elements.size(); }
+}
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzSAFTAssociating &term)
+{
+    serialize(ar, term.disabled);
+    if (term.disabled){ return; }
+    serialize(ar, term.a); serialize(ar, term.m); serialize(ar, term.epsilonbar); serialize(ar, term.vbarn); serialize(ar, term.kappabar);
+}
+template<class Archive> void serialize(Archive &ar, ResidualHelmholtzContainer &alphar)
+{
+    // The generated kernel of the generalized exponential terms is looked up by the library once the fluid is read
+    serialize(ar, alphar.GenExp);
+    serialize(ar, alphar.NonAnalytic);
+    serialize(ar, alphar.SAFT);
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzLead &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.a1); serialize(ar, term.a2);
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzEnthalpyEntropyOffset &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.a1); serialize(ar, term.a2); serialize(ar, term.reference);
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzLogTau &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.a1);
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzPower &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.n); serialize(ar, term.t);
+    if (Archive::reading){ term.N = term.n.size(); }
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzPlanckEinsteinGeneralized &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.n); serialize(ar, term.theta); serialize(ar, term.c); serialize(ar, term.d);
+    if (Archive::reading){ term.N = term.n.size(); }
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzCP0Constant &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.cp_over_R); serialize(ar, term.Tc); serialize(ar, term.T0); serialize(ar, term.tau0);
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzCP0PolyT &term)
+{
+    serialize(ar, term.enabled);
+    if (!term.enabled){ return; }
+    serialize(ar, term.c); serialize(ar, term.t); serialize(ar, term.Tc); serialize(ar, term.T0); serialize(ar, term.tau0);
+    if (Archive::reading){ term.N = term.c.size(); }
+}
+template<class Archive> void serialize(Archive &ar, IdealHelmholtzContainer &alpha0)
+{
+    serialize(ar, alpha0.Lead); serialize(ar, alpha0.EnthalpyEntropyOffsetCore); serialize(ar, alpha0.EnthalpyEntropyOffset);
+    serialize(ar, alpha0.LogTau); serialize(ar, alpha0.Power); serialize(ar, alpha0.PlanckEinstein);
+    serialize(ar, alpha0.CP0Constant); serialize(ar, alpha0.CP0PolyT);
+}
+template<class Archive> void serialize(Archive &ar, CriticalRegionSplines &splines)
+{
+    serialize(ar, splines.enabled);
+    if (!splines.enabled){ return; }
+    serialize(ar, splines.T_min); serialize(ar, splines.T_max); serialize(ar, splines.rhomolar_min); serialize(ar, splines.rhomolar_max);
+    serialize(ar, splines.cL); serialize(ar, splines.cV);
+}
+template<class Archive> void serialize(Archive &ar, EquationOfState &EOS)
+{
+    serialize(ar, EOS.reduce); serialize(ar, EOS.sat_min_liquid); serialize(ar, EOS.sat_min_vapor);
+    serialize(ar, EOS.hs_anchor); serialize(ar, EOS.max_sat_T); serialize(ar, EOS.max_sat_p);
+    // The parser does not set limits.rhomax
+    serialize(ar, EOS.limits.Tmin); serialize(ar, EOS.limits.Tmax); serialize(ar, EOS.limits.pmax);
+    serialize(ar, EOS.R_u); serialize(ar, EOS.molar_mass); serialize(ar, EOS.accentric); serialize(ar, EOS.Ttriple); serialize(ar, EOS.ptriple);
+    serialize(ar, EOS.pseudo_pure);
+    serialize(ar, EOS.alphar);
+    serialize(ar, EOS.alpha0);
+    serialize(ar, EOS.BibTeX_EOS); serialize(ar, EOS.BibTeX_CP0);
+    serialize(ar, EOS.critical_region_splines);
+}
+
+// ------------------------------
+//  Ancillaries
+// ------------------------------
+
+template<class Archive> void serialize(Archive &ar, SaturationAncillaryFunction &function)
+{
+    serialize_enum(ar, function.type);
+    if (function.type == SaturationAncillaryFunction::TYPE_RATIONAL_POLYNOMIAL){
+        serialize(ar, function.num_coeffs); serialize(ar, function.den_coeffs); serialize(ar, function.max_abs_error);
+        serialize(ar, function.Tmin); serialize(ar, function.Tmax);
+    }
+    else if (function.type != SaturationAncillaryFunction::TYPE_NOT_SET){
+        serialize(ar, function.n); serialize(ar, function.t); serialize(ar, function.Tmin); serialize(ar, function.Tmax);
+        serialize(ar, function.reducing_value); serialize(ar, function.using_tau_r); serialize(ar, function.T_r);
+    }
+    if (Archive::reading){ function.N = function.n.size(); }
+}
+template<class Archive> void serialize(Archive &ar, MeltingLinePiecewiseSimonSegment &part)
+{
+    serialize(ar, part.T_0); serialize(ar, part.a); serialize(ar, part.c); serialize(ar, part.p_0); serialize(ar, part.T_max); serialize(ar, part.T_min);
+}
+template<class Archive> void serialize(Archive &ar, MeltingLinePiecewisePolynomialInTrSegment &part)
+{
+    serialize(ar, part.a); serialize(ar, part.t); serialize(ar, part.T_0); serialize(ar, part.p_0); serialize(ar, part.T_max); serialize(ar, part.T_min);
+}
+template<class Archive> void serialize(Archive &ar, MeltingLinePiecewisePolynomialInThetaSegment &part)
+{
+    serialize(ar, part.a); serialize(ar, part.t); serialize(ar, part.T_0); serialize(ar, part.p_0); serialize(ar, part.T_max); serialize(ar, part.T_min);
+}
+template<class Archive> void serialize(Archive &ar, MeltingLineVariables &melting_line)
+{
+    serialize(ar, melting_line.BibTeX); serialize(ar, melting_line.T_m);
+    serialize(ar, melting_line.type);
+    if (!melting_line.enabled()){ return; }
+    serialize(ar, melting_line.simon.parts); serialize(ar, melting_line.polynomial_in_Tr.parts); serialize(ar, melting_line.polynomial_in_Theta.parts);
+    // The pressures at the ends of the parts and the limits of the curve
+    if (Archive::reading){ melting_line.set_limits(); }
+}
+template<class Archive> void serialize(Archive &ar, SurfaceTensionCorrelation &surface_tension)
+{
+    serialize(ar, surface_tension.a); serialize(ar, surface_tension.n);
+    if (!surface_tension.a.empty()){
+        serialize(ar, surface_tension.Tc); serialize(ar, surface_tension.BibTeX);
+    }
+    if (Archive::reading){ surface_tension.N = surface_tension.n.size(); }
+}
+template<class Archive> void serialize(Archive &ar, Ancillaries &ancillaries)
+{
+    serialize(ar, ancillaries.pL); serialize(ar, ancillaries.pV); serialize(ar, ancillaries.rhoL); serialize(ar, ancillaries.rhoV);
+    serialize(ar, ancillaries.hL); serialize(ar, ancillaries.hLV); serialize(ar, ancillaries.sL); serialize(ar, ancillaries.sLV);
+    serialize(ar, ancillaries.melting_line);
+    serialize(ar, ancillaries.surface_tension);
+}
+
+// ------------------------------
+//  Transport properties
+// ------------------------------
+
+template<class Archive> void serialize(Archive &ar, ViscosityDiluteVariables &dilute)
+{
+    serialize_enum(ar, dilute.type);
+    switch (dilute.type){
+        case ViscosityDiluteVariables::VISCOSITY_DILUTE_COLLISION_INTEGRAL:{
+            ViscosityDiluteGasCollisionIntegralData &data = dilute.collision_integral;
+            serialize(ar, data.molar_mass); serialize(ar, data.C); serialize(ar, data.a); serialize(ar, data.t);
+            break;
+        }
+        case ViscosityDiluteVariables::VISCOSITY_DILUTE_COLLISION_INTEGRAL_POWERS_OF_TSTAR:{
+            ViscosityDiluteCollisionIntegralPowersOfTstarData &data = dilute.collision_integral_powers_of_Tstar;
+            serialize(ar, data.T_reducing); serialize(ar, data.C); serialize(ar, data.a); serialize(ar, data.t);
+            break;
+        }
+        case ViscosityDiluteVariables::VISCOSITY_DILUTE_POWERS_OF_T:
+            serialize(ar, dilute.powers_of_T.a); serialize(ar, dilute.powers_of_T.t);
+            break;
+        default:
+            break;
+    }
+}
+template<class Archive> void serialize(Archive &ar, ViscosityInitialDensityVariables &initial)
+{
+    serialize_enum(ar, initial.type);
+    if (initial.type == ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_RAINWATER_FRIEND){
+        serialize(ar, initial.rainwater_friend.b); serialize(ar, initial.rainwater_friend.t);
+    }
+    else if (initial.type == ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_EMPIRICAL){
+        ViscosityInitialDensityEmpiricalData &data = initial.empirical;
+        serialize(ar, data.n); serialize(ar, data.d); serialize(ar, data.t); serialize(ar, data.T_reducing); serialize(ar, data.rhomolar_reducing);
+    }
+}
+template<class Archive> void serialize(Archive &ar, ViscosityHigherOrderVariables &higher)
+{
+    serialize_enum(ar, higher.type);
+    if (higher.type == ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_BATSCHINKI_HILDEBRAND){
+        ViscosityModifiedBatschinskiHildebrandData &data = higher.modified_Batschinski_Hildebrand;
+        serialize(ar, data.a); serialize(ar, data.d1); serialize(ar, data.d2); serialize(ar, data.t1); serialize(ar, data.t2);
+        serialize(ar, data.f); serialize(ar, data.g); serialize(ar, data.h); serialize(ar, data.p); serialize(ar, data.q);
+        serialize(ar, data.gamma); serialize(ar, data.l); serialize(ar, data.T_reduce); serialize(ar, data.rhomolar_reduce);
+    }
+    else if (higher.type == ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_FRICTION_THEORY){
+        // The parser does not set rhomolar_reduce of the friction theory
+        ViscosityFrictionTheoryData &data = higher.friction_theory;
+        serialize(ar, data.Aa); serialize(ar, data.Aaa); serialize(ar, data.Aaaa); serialize(ar, data.Ar); serialize(ar, data.Arr);
+        serialize(ar, data.Adrdr); serialize(ar, data.Arrr); serialize(ar, data.Ai); serialize(ar, data.Aii); serialize(ar, data.AdrAdr);
+        serialize(ar, data.Na); serialize(ar, data.Naa); serialize(ar, data.Nr); serialize(ar, data.Nrr);
+        if (!data.Aaaa.empty()){
+            serialize(ar, data.Naaa); serialize(ar, data.Nrrr); serialize(ar, data.Nii);
+        }
+        serialize(ar, data.c1); serialize(ar, data.c2); serialize(ar, data.T_reduce);
+    }
+}
+template<class Archive> void serialize(Archive &ar, ConductivityDiluteVariables &dilute)
+{
+    serialize(ar, dilute.type);
+    if (dilute.type == ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_RATIO_POLYNOMIALS){
+        // The parser does not set p_reducing
+        ConductivityDiluteRatioPolynomialsData &data = dilute.ratio_polynomials;
+        serialize(ar, data.T_reducing); serialize(ar, data.A); serialize(ar, data.B); serialize(ar, data.n); serialize(ar, data.m);
+    }
+    else if (dilute.type == ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_ETA0_AND_POLY){
+        serialize(ar, dilute.eta0_and_poly.A); serialize(ar, dilute.eta0_and_poly.t);
+    }
+}
+template<class Archive> void serialize(Archive &ar, ConductivityResidualVariables &residual)
+{
+    serialize(ar, residual.type);
+    if (residual.type == ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL){
+        ConductivityResidualPolynomialData &data = residual.polynomials;
+        serialize(ar, data.T_reducing); serialize(ar, data.rhomass_reducing); serialize(ar, data.B); serialize(ar, data.t); serialize(ar, data.d);
+    }
+    else if (residual.type == ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL_AND_EXPONENTIAL){
+        // The parser does not set T_reducing and rhomass_reducing
+        ConductivityResidualPolynomialAndExponentialData &data = residual.polynomial_and_exponential;
+        serialize(ar, data.A); serialize(ar, data.t); serialize(ar, data.d); serialize(ar, data.gamma); serialize(ar, data.l);
+    }
+}
+template<class Archive> void serialize(Archive &ar, ConductivityCriticalVariables &critical)
+{
+    serialize(ar, critical.type);
+    if (critical.type == ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_SIMPLIFIED_OLCHOWY_SENGERS){
+        // The parser does not set T_reducing and p_reducing
+        ConductivityCriticalSimplifiedOlchowySengersData &data = critical.Olchowy_Sengers;
+        serialize(ar, data.k); serialize(ar, data.R0); serialize(ar, data.gamma); serialize(ar, data.nu); serialize(ar, data.qD);
+        serialize(ar, data.zeta0); serialize(ar, data.GAMMA); serialize(ar, data.T_ref);
+    }
+}
+template<class Archive> void serialize(Archive &ar, TransportPropertyData &transport)
+{
+    serialize(ar, transport.BibTeX_viscosity); serialize(ar, transport.BibTeX_conductivity);
+    serialize(ar, transport.viscosity_model_provided); serialize(ar, transport.conductivity_model_provided);
+    serialize(ar, transport.sigma_eta); serialize(ar, transport.epsilon_over_k);
+    serialize_enum(ar, transport.hardcoded_viscosity); serialize_enum(ar, transport.hardcoded_conductivity);
+
+    serialize(ar, transport.viscosity_using_ECS);
+    if (transport.viscosity_using_ECS){
+        ViscosityECSVariables &ecs = transport.viscosity_ecs;
+        serialize(ar, ecs.reference_fluid); serialize(ar, ecs.psi_rhomolar_reducing); serialize(ar, ecs.psi_a); serialize(ar, ecs.psi_t);
+    }
+    serialize(ar, transport.viscosity_dilute);
+    serialize(ar, transport.viscosity_initial);
+    serialize(ar, transport.viscosity_higher_order);
+
+    serialize(ar, transport.conductivity_using_ECS);
+    if (transport.conductivity_using_ECS){
+        ConductivityECSVariables &ecs = transport.conductivity_ecs;
+        serialize(ar, ecs.reference_fluid); serialize(ar, ecs.psi_rhomolar_reducing); serialize(ar, ecs.f_int_T_reducing);
+        serialize(ar, ecs.psi_a); serialize(ar, ecs.psi_t); serialize(ar, ecs.f_int_a); serialize(ar, ecs.f_int_t);
+    }
+    serialize(ar, transport.conductivity_dilute);
+    serialize(ar, transport.conductivity_residual);
+    serialize(ar, transport.conductivity_critical);
+}
+
+// ------------------------------
+//  Fluid
+// ------------------------------
+
+template<class Archive> void serialize(Archive &ar, BibTeXKeysStruct &keys)
+{
+    serialize(ar, keys.EOS); serialize(ar, keys.CP0); serialize(ar, keys.VISCOSITY); serialize(ar, keys.CONDUCTIVITY);
+    serialize(ar, keys.ECS_LENNARD_JONES); serialize(ar, keys.ECS_FITS); serialize(ar, keys.SURFACE_TENSION);
+}
+template<class Archive> void serialize(Archive &ar, EnvironmentalFactorsStruct &environment)
+{
+    serialize(ar, environment.GWP20); serialize(ar, environment.GWP100); serialize(ar, environment.GWP500); serialize(ar, environment.ODP);
+    serialize(ar, environment.HH); serialize(ar, environment.PH); serialize(ar, environment.FH); serialize(ar, environment.ASHRAE34);
+}
+template<class Archive> void serialize(Archive &ar, CoolPropFluid &fluid)
+{
+    // The name, CAS number and aliases begin the record, so that JSONFluidLibrary::add_database can index the fluid
+    serialize(ar, fluid.name); serialize(ar, fluid.CAS); serialize(ar, fluid.aliases);
+    serialize(ar, fluid.REFPROPname);
+    serialize(ar, fluid.crit); serialize(ar, fluid.triple_liquid); serialize(ar, fluid.triple_vapor);
+    serialize(ar, fluid.EOSVector);
+    // The index of the equation of state that is used
+    unsigned int iEOS = Archive::reading ? 0 : static_cast<unsigned int>(fluid.pEOS - &(fluid.EOSVector[0]));
+    serialize(ar, iEOS);
+    if (Archive::reading){
+        if (iEOS >= fluid.EOSVector.size()){ throw ValueError(format("Fluid [%s] in the fluid database has no equation of state", fluid.name.c_str())); }
+        fluid.pEOS = &(fluid.EOSVector[iEOS]);
+    }
+    serialize(ar, fluid.ancillaries);
+    serialize(ar, fluid.transport);
+    serialize(ar, fluid.BibTeXKeys);
+    serialize(ar, fluid.environment);
+}
+
+} /* namespace CoolProp */
+#endif
@@ -1,36 +1,201 @@
 
 #include "FluidLibrary.h"
 #include "all_fluids_JSON.h" // Makes a std::string variable called all_fluids_JSON
+#include "crossplatform_mapped_file.h"
+#include <fstream>
+
+#if defined(ENABLE_CATCH)
+    #include "catch.hpp"
+#endif
 
 namespace CoolProp{
 
+/// The fluid database from the ALTERNATIVE_FLUIDS_DATABASE_PATH configuration key, if it is used; the library points into it
+static shared_ptr<MappedFile> fluid_database;
 static JSONFluidLibrary library;
+static Mutex library_load_mutex;
+static AtomicInt library_loaded(0);
 
 void load()
 {
-    rapidjson::Document dd;
-    // This json formatted string comes from the all_fluids_JSON.h header which is a C++-escaped version of the JSON file
-    dd.Parse<0>(all_fluids_JSON.c_str());
-    if (dd.HasParseError()){
-        throw ValueError("Unable to load all_fluids.json");
-    } else{
-        try{library.add_many(dd);}catch(std::exception &e){std::cout << e.what() << std::endl;}
+    // The fluids are read from the binary database written by write_fluid_database, if there is one for the fluids of this build.
+    // Only the names, CAS numbers and aliases are read here; each fluid is read the first time it is requested from the library.
+    std::string path = get_config_string(ALTERNATIVE_FLUIDS_DATABASE_PATH);
+    if (!path.empty()){
+        try{
+            shared_ptr<MappedFile> file(new MappedFile(path));
+            library.add_database(file->data(), file->size(), fluid_database_hash(all_fluids_JSON));
+            fluid_database = file;
+            return;
+        }
+        catch (std::exception &e){
+            if (get_debug_level() > 0){ std::cout << format("Unable to load fluid database [%s] due to error: %s; parsing the fluids instead\n", path.c_str(), e.what()); }
+        }
     }
+    // This json formatted string comes from the all_fluids_JSON.h header which is a C++-escaped version of the JSON file.
+    // Each fluid is parsed the first time it is requested from the library.
+    library.add_many_lazily(all_fluids_JSON.c_str());
 }
 
-JSONFluidLibrary & get_library(void){
+std::string write_fluid_database(void)
+{
+    // The fluids are parsed afresh, so that the fluids that have been replaced in the library are written as they are built in
+    JSONFluidLibrary built_in;
+    built_in.add_many_lazily(all_fluids_JSON.c_str());
+    return built_in.write_database(fluid_database_hash(all_fluids_JSON));
+}
+
+// Load the library the first time it is needed; if several threads get here at the same time, only one of them loads it.
+// The library is never unloaded, so once it has been loaded the lock is not taken any more.
+static void load_once()
+{
+    if (library_loaded.load()){ return; }
+    ScopedLock lock(library_load_mutex);
     if (library.is_empty()){ load(); }
+    library_loaded.store(1);
+}
+
+JSONFluidLibrary & get_library(void){
+    load_once();
     return library;
 }
 
 CoolPropFluid& get_fluid(std::string fluid_string){
-    if (library.is_empty()){ load(); }
+    load_once();
     return library.get(fluid_string);
 }
 
 std::string get_fluid_list(void){
-    if (library.is_empty()){ load(); }
+    load_once();
     return library.get_fluid_list();
 };
 
+#if defined(ENABLE_CATCH)
+TEST_CASE("Indexing of the fluids without parsing them", "[fluid_library]")
+{
+    SECTION("index of a small listing"){
+        std::string JSON = "[{\"NAME\": \"A\", \"X\": [1, {\"NAME\": \"not A\"}, null], \"CAS\": \"1-2-3\", \"ALIASES\": [\"a\", \"AA\"], \"Y\": {\"ALIASES\": [\"c\"]}},"
+                           " {\"ALIASES\": [], \"CAS\": \"4-5-6\", \"NAME\": \"B\"}]";
+        rapidjson::StringStream stream(JSON.c_str());
+        FluidIndexHandler handler(stream);
+        rapidjson::Reader reader;
+        REQUIRE(reader.Parse<0>(stream, handler));
+        REQUIRE(handler.entries.size() == 2);
+        CHECK(handler.entries[0].name == "A");
+        CHECK(handler.entries[0].CAS == "1-2-3");
+        REQUIRE(handler.entries[0].aliases.size() == 2);
+        CHECK(handler.entries[0].aliases[1] == "AA");
+        CHECK(handler.entries[1].name == "B");
+        CHECK(handler.entries[1].CAS == "4-5-6");
+        CHECK(handler.entries[1].aliases.size() == 0);
+        // The location of each fluid is its complete JSON object
+        rapidjson::Document dd;
+        dd.Parse<0>(JSON.substr(handler.entries[1].begin, handler.entries[1].length).c_str());
+        REQUIRE(!dd.HasParseError());
+        CHECK(std::string(dd["NAME"].GetString()) == "B");
+    }
+    SECTION("a fluid that cannot be parsed is not added"){
+        rapidjson::Document dd;
+        dd.Parse<0>("{\"NAME\": \"A\"}");
+        JSONFluidLibrary lib;
+        CHECK_THROWS(lib.add_one(dd));
+        CHECK(lib.get_fluid_list() == "");
+        CHECK_THROWS(lib.get("A"));
+    }
+    SECTION("fluids are found by name, CAS number and alias"){
+        CoolPropFluid *byname = &(get_library().get("Water"));
+        CHECK(byname == &(get_library().get(byname->CAS)));
+        for (std::size_t i = 0; i < byname->aliases.size(); ++i){
+            CHECK(byname == &(get_library().get(byname->aliases[i])));
+            CHECK(byname == &(get_library().get(upper(byname->aliases[i]))));
+        }
+        CHECK_THROWS(get_library().get("NotAFluid"));
+    }
+}
+TEST_CASE("Binary fluid database", "[fluid_library]")
+{
+    std::string DB = write_fluid_database();
+    const unsigned char *data = reinterpret_cast<const unsigned char *>(DB.c_str());
+    unsigned int hash = fluid_database_hash(all_fluids_JSON);
+    JSONFluidLibrary parsed, read;
+    parsed.add_many_lazily(all_fluids_JSON.c_str());
+    read.add_database(data, DB.size(), hash);
+
+    SECTION("the fluids are written again exactly as they were read"){
+        CHECK(read.get_fluid_list() == parsed.get_fluid_list());
+        CHECK(read.write_database(hash) == DB);
+    }
+    SECTION("the fluids that are read evaluate like the parsed ones"){
+        std::vector<std::string> fluids = strsplit(parsed.get_fluid_list(), ',');
+        double states[3][2] = {{0.5, 1e-3}, {1.3, 0.7}, {0.9, 1.05}}; // tau, delta
+        for (std::size_t i = 0; i < fluids.size(); ++i){
+            CAPTURE(fluids[i]);
+            CoolPropFluid &p = parsed.get(fluids[i]), &r = read.get(fluids[i]);
+            CHECK(r.pEOS - &(r.EOSVector[0]) == p.pEOS - &(p.EOSVector[0]));
+            CHECK(r.pEOS->alphar.GenExpKernel == p.pEOS->alphar.GenExpKernel);
+            for (std::size_t k = 0; k < 3; ++k){
+                CoolPropDbl tau = states[k][0], delta = states[k][1];
+                Eigen::Array<double, 10, 1> ar = r.pEOS->alphar.all(tau, delta).values(), ap = p.pEOS->alphar.all(tau, delta).values();
+                for (int m = 0; m < 10; ++m){ CHECK(ar[m] == ap[m]); }
+                CHECK(r.pEOS->alpha0.base(tau, delta) == p.pEOS->alpha0.base(tau, delta));
+                CHECK(r.pEOS->alpha0.dTau(tau, delta) == p.pEOS->alpha0.dTau(tau, delta));
+                CHECK(r.pEOS->alpha0.dTau2(tau, delta) == p.pEOS->alpha0.dTau2(tau, delta));
+            }
+            double T = 0.5*(p.ancillaries.pL.get_Tmin() + p.ancillaries.pL.get_Tmax());
+            CHECK(r.ancillaries.pL.evaluate(T) == p.ancillaries.pL.evaluate(T));
+            CHECK(r.ancillaries.rhoV.evaluate(T) == p.ancillaries.rhoV.evaluate(T));
+            if (p.ancillaries.melting_line.enabled()){
+                CHECK(r.ancillaries.melting_line.pmax == p.ancillaries.melting_line.pmax);
+            }
+        }
+    }
+    SECTION("a database from a file"){
+        std::string path = get_home_dir() + "/.CoolProp/test_fluid_database.cpdb";
+        make_dirs(get_home_dir() + "/.CoolProp");
+        std::ofstream(path.c_str(), std::ios::binary).write(DB.c_str(), DB.size());
+        MappedFile file(path);
+        JSONFluidLibrary lib;
+        lib.add_database(file.data(), file.size(), hash);
+        CHECK(lib.get("Water").pEOS->reduce.T == parsed.get("Water").pEOS->reduce.T);
+    }
+    SECTION("nothing is added from a database that cannot be used"){
+        JSONFluidLibrary stale, truncated, short_index, other_version;
+        CHECK_THROWS(stale.add_database(data, DB.size(), hash + 1));
+        CHECK(stale.is_empty());
+        CHECK_THROWS(truncated.add_database(data, DB.size() - 1, hash));
+        CHECK(truncated.is_empty());
+        CHECK_THROWS(short_index.add_database(data, 100, hash));
+        CHECK(short_index.is_empty());
+        std::string DB2 = DB;
+        DB2[8] = static_cast<char>(FLUID_DATABASE_VERSION + 1);
+        CHECK_THROWS(other_version.add_database(reinterpret_cast<const unsigned char *>(DB2.c_str()), DB2.size(), hash));
+        CHECK(other_version.is_empty());
+    }
+}
+TEST_CASE("Generalized exponential terms of all the fluids in groups against one term at a time", "[fluid_library],[helmholtz]")
+{
+    std::vector<std::string> fluids = strsplit(get_fluid_list(), ',');
+    double states[4][2] = {{0.5, 1e-3}, {1.3, 0.7}, {0.9, 1.05}, {2.5, 3.0}}; // tau, delta
+    for (std::size_t i = 0; i < fluids.size(); ++i){
+        CAPTURE(fluids[i]);
+        std::vector<EquationOfState> &EOS = get_library().get(fluids[i]).EOSVector;
+        for (std::size_t j = 0; j < EOS.size(); ++j){
+            ResidualHelmholtzGeneralizedExponential &GenExp = EOS[j].alphar.GenExp;
+            for (std::size_t k = 0; k < 4; ++k){
+                HelmholtzDerivatives grouped, scalar;
+                GenExp.all(states[k][0], states[k][1], grouped);
+                GenExp.all_scalar(states[k][0], states[k][1], scalar);
+                Eigen::Array<double, 10, 1> g = grouped.values(), s = scalar.values();
+                for (int m = 0; m < 10; ++m){
+                    CAPTURE(m);
+                    CAPTURE(g[m]);
+                    CAPTURE(s[m]);
+                    CHECK(std::abs(g[m] - s[m]) <= 1e-11*std::max(std::abs(s[m]), 1.0));
+                }
+            }
+        }
+    }
+}
+#endif
+
 } /* namespace CoolProp */
\ No newline at end of file
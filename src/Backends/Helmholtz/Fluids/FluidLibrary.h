@@ -3,31 +3,112 @@
 #define FLUIDLIBRARY_H
 
 #include "CoolPropFluid.h"
+#include "SpecializedKernels.h"
+#include "FluidDatabase.h"
 
 #include "rapidjson/rapidjson_include.h"
 
 #include <map>
 #include <algorithm>
 #include "Configuration.h"
+#include "crossplatform_shared_ptr.h"
+#include "crossplatform_mutex.h"
 
 namespace CoolProp{
 
 // Forward declaration of the necessary debug function to avoid including the whole header
 extern int get_debug_level();
 
+/// Handler for the rapidjson SAX reader that collects the name, CAS number, aliases and the location in the JSON text of each fluid in a listing
+class FluidIndexHandler
+{
+public:
+    struct entry{
+        std::string name, CAS;
+        std::vector<std::string> aliases;
+        std::size_t begin, length;
+    };
+    std::vector<entry> entries;
+private:
+    rapidjson::StringStream &stream;
+    int depth; ///< The number of enclosing objects and arrays; the members of a fluid are at depth 2
+    bool expect_key, in_aliases;
+    std::string key;
+    void end_value(){ if (depth == 2){ expect_key = true; } };
+public:
+    FluidIndexHandler(rapidjson::StringStream &stream) : stream(stream), depth(0), expect_key(false), in_aliases(false) {};
+    void Null(){ end_value(); };
+    void Bool(bool){ end_value(); };
+    void Int(int){ end_value(); };
+    void Uint(unsigned){ end_value(); };
+    void Int64(int64_t){ end_value(); };
+    void Uint64(uint64_t){ end_value(); };
+    void Double(double){ end_value(); };
+    void String(const char *str, rapidjson::SizeType length, bool){
+        if (depth == 2 && expect_key){
+            key = std::string(str, length); expect_key = false;
+        }
+        else if (depth == 2){
+            if (!key.compare("NAME")){ entries.back().name = std::string(str, length); }
+            else if (!key.compare("CAS")){ entries.back().CAS = std::string(str, length); }
+            end_value();
+        }
+        else if (depth == 3 && in_aliases){
+            entries.back().aliases.push_back(std::string(str, length));
+        }
+    };
+    void StartObject(){
+        if (depth == 1){
+            // The reader has just consumed the opening brace of the fluid
+            entries.push_back(entry());
+            entries.back().begin = stream.Tell() - 1;
+            expect_key = true;
+        }
+        depth++;
+    };
+    void EndObject(rapidjson::SizeType){
+        depth--;
+        if (depth == 1){ entries.back().length = stream.Tell() - entries.back().begin; }
+        end_value();
+    };
+    void StartArray(){
+        if (depth == 2 && !key.compare("ALIASES")){ in_aliases = true; }
+        depth++;
+    };
+    void EndArray(rapidjson::SizeType){
+        depth--;
+        in_aliases = false;
+        end_value();
+    };
+};
+
 /// A container for the fluid parameters for the CoolProp fluids
 /**
 This container holds copies of all of the fluid instances for the fluids that are loaded in CoolProp.
 New fluids can be added by passing in a rapidjson::Value instance to the add_one function, or
 a rapidjson array of fluids to the add_many function.
+
+Fluids can also be indexed from a JSON string with add_many_lazily; then only the name, CAS number and aliases are read
+up front, and the rest of the fluid is parsed the first time it is requested with get.  Likewise, fluids can be indexed
+from a binary fluid database of parsed fluids (see FluidDatabase.h) with add_database, and each fluid is then read from
+the database rather than parsed from JSON.
+
+Once a fluid has been added it is never modified, so that it can be shared by backends running in several threads.
+To change a fluid (the reference state for instance), a modified copy is obtained from get_copy and is
+then swapped in with replace.
 */
 class JSONFluidLibrary
 {
     /// Map from CAS code to JSON instance.  For pseudo-pure fluids, use name in place of CAS code since no CASE number is defined for mixtures
-    std::map<std::size_t, CoolPropFluid> fluid_map;
+    std::map<std::size_t, shared_ptr<CoolPropFluid> > fluid_map;
+    /// Map from index to the JSON text of the fluids that have been indexed but not yet parsed
+    std::map<std::size_t, std::pair<const char*, std::size_t> > unparsed_map;
+    /// Map from index to the records in a binary fluid database of the fluids that have been indexed but not yet read
+    std::map<std::size_t, std::pair<const unsigned char*, std::size_t> > unread_map;
     std::vector<std::string> name_vector;
     std::map<std::string, std::size_t> string_to_index_map;
     bool _is_empty;
+    Mutex mutex; ///< Protects the maps when fluids are added, looked up or replaced from several threads
 protected:
 
     /// Parse the contributions to the residual Helmholtz energy
@@ -43,10 +124,10 @@ protected:
 
             if (!type.compare("ResidualHelmholtzPower"))
             {
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> d = cpjson::get_long_double_array(contribution["d"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
-                std::vector<long double> l = cpjson::get_long_double_array(contribution["l"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> d = cpjson::get_long_double_array(contribution["d"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> l = cpjson::get_long_double_array(contribution["l"]);
                 assert(n.size() == d.size());
                 assert(n.size() == t.size());
                 assert(n.size() == l.size());
@@ -55,13 +136,13 @@ protected:
             }
             else if (!type.compare("ResidualHelmholtzGaussian"))
             {
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> d = cpjson::get_long_double_array(contribution["d"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
-                std::vector<long double> eta = cpjson::get_long_double_array(contribution["eta"]);
-                std::vector<long double> epsilon = cpjson::get_long_double_array(contribution["epsilon"]);
-                std::vector<long double> beta = cpjson::get_long_double_array(contribution["beta"]);
-                std::vector<long double> gamma = cpjson::get_long_double_array(contribution["gamma"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> d = cpjson::get_long_double_array(contribution["d"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> eta = cpjson::get_long_double_array(contribution["eta"]);
+                std::vector<CoolPropDbl> epsilon = cpjson::get_long_double_array(contribution["epsilon"]);
+                std::vector<CoolPropDbl> beta = cpjson::get_long_double_array(contribution["beta"]);
+                std::vector<CoolPropDbl> gamma = cpjson::get_long_double_array(contribution["gamma"]);
                 assert(n.size() == d.size());
                 assert(n.size() == t.size());
                 assert(n.size() == eta.size());
@@ -73,14 +154,14 @@ protected:
             else if (!type.compare("ResidualHelmholtzNonAnalytic"))
             {
                 if (EOS.alphar.NonAnalytic.N > 0){throw ValueError("Cannot add ");}
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> a = cpjson::get_long_double_array(contribution["a"]);
-                std::vector<long double> b = cpjson::get_long_double_array(contribution["b"]);
-                std::vector<long double> beta = cpjson::get_long_double_array(contribution["beta"]);
-                std::vector<long double> A = cpjson::get_long_double_array(contribution["A"]);
-                std::vector<long double> B = cpjson::get_long_double_array(contribution["B"]);
-                std::vector<long double> C = cpjson::get_long_double_array(contribution["C"]);
-                std::vector<long double> D = cpjson::get_long_double_array(contribution["D"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> a = cpjson::get_long_double_array(contribution["a"]);
+                std::vector<CoolPropDbl> b = cpjson::get_long_double_array(contribution["b"]);
+                std::vector<CoolPropDbl> beta = cpjson::get_long_double_array(contribution["beta"]);
+                std::vector<CoolPropDbl> A = cpjson::get_long_double_array(contribution["A"]);
+                std::vector<CoolPropDbl> B = cpjson::get_long_double_array(contribution["B"]);
+                std::vector<CoolPropDbl> C = cpjson::get_long_double_array(contribution["C"]);
+                std::vector<CoolPropDbl> D = cpjson::get_long_double_array(contribution["D"]);
                 assert(n.size() == a.size());
                 assert(n.size() == b.size());
                 assert(n.size() == beta.size());
@@ -92,11 +173,11 @@ protected:
             }
             else if (!type.compare("ResidualHelmholtzLemmon2005"))
             {
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> d = cpjson::get_long_double_array(contribution["d"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
-                std::vector<long double> l = cpjson::get_long_double_array(contribution["l"]);
-                std::vector<long double> m = cpjson::get_long_double_array(contribution["m"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> d = cpjson::get_long_double_array(contribution["d"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> l = cpjson::get_long_double_array(contribution["l"]);
+                std::vector<CoolPropDbl> m = cpjson::get_long_double_array(contribution["m"]);
                 assert(n.size() == d.size());
                 assert(n.size() == t.size());
                 assert(n.size() == l.size());
@@ -105,11 +186,11 @@ protected:
             }
             else if (!type.compare("ResidualHelmholtzExponential"))
             {
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> d = cpjson::get_long_double_array(contribution["d"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
-                std::vector<long double> g = cpjson::get_long_double_array(contribution["g"]);
-                std::vector<long double> l = cpjson::get_long_double_array(contribution["l"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> d = cpjson::get_long_double_array(contribution["d"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> g = cpjson::get_long_double_array(contribution["g"]);
+                std::vector<CoolPropDbl> l = cpjson::get_long_double_array(contribution["l"]);
                 assert(n.size() == d.size());
                 assert(n.size() == t.size());
                 assert(n.size() == g.size());
@@ -119,11 +200,11 @@ protected:
             else if (!type.compare("ResidualHelmholtzAssociating"))
             {
                 if (EOS.alphar.SAFT.disabled == false){throw ValueError("Cannot add ");}
-                long double a = cpjson::get_double(contribution,"a");
-                long double m = cpjson::get_double(contribution,"m");
-                long double epsilonbar = cpjson::get_double(contribution,"epsilonbar");
-                long double vbarn = cpjson::get_double(contribution,"vbarn");
-                long double kappabar = cpjson::get_double(contribution,"kappabar");
+                CoolPropDbl a = cpjson::get_double(contribution,"a");
+                CoolPropDbl m = cpjson::get_double(contribution,"m");
+                CoolPropDbl epsilonbar = cpjson::get_double(contribution,"epsilonbar");
+                CoolPropDbl vbarn = cpjson::get_double(contribution,"vbarn");
+                CoolPropDbl kappabar = cpjson::get_double(contribution,"kappabar");
                 EOS.alphar.SAFT = ResidualHelmholtzSAFTAssociating(a,m,epsilonbar,vbarn,kappabar);
             }
             else
@@ -151,34 +232,34 @@ protected:
             if (!type.compare("IdealGasHelmholtzLead"))
             {
                 if (EOS.alpha0.Lead.is_enabled() == true){throw ValueError("Cannot add ");}
-                long double a1 = cpjson::get_double(contribution,"a1");
-                long double a2 = cpjson::get_double(contribution,"a2");
+                CoolPropDbl a1 = cpjson::get_double(contribution,"a1");
+                CoolPropDbl a2 = cpjson::get_double(contribution,"a2");
                 
                 EOS.alpha0.Lead = IdealHelmholtzLead(a1, a2);
             }
             else if (!type.compare("IdealGasHelmholtzPower"))
             {
                 if (EOS.alpha0.Power.is_enabled() == true){throw ValueError("Cannot add ");}
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
                 
                 EOS.alpha0.Power = IdealHelmholtzPower(n, t);
             }
             else if (!type.compare("IdealGasHelmholtzLogTau"))
             {
                 if (EOS.alpha0.LogTau.is_enabled() == true){throw ValueError("Cannot add ");}
-                long double a = cpjson::get_double(contribution,"a");
+                CoolPropDbl a = cpjson::get_double(contribution,"a");
                 
                 EOS.alpha0.LogTau = IdealHelmholtzLogTau(a);
             }
             else if (!type.compare("IdealGasHelmholtzPlanckEinsteinGeneralized"))
             {
                 // Retrieve the values
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
 
-                std::vector<long double> c = cpjson::get_long_double_array(contribution["c"]);
-                std::vector<long double> d = cpjson::get_long_double_array(contribution["d"]);
+                std::vector<CoolPropDbl> c = cpjson::get_long_double_array(contribution["c"]);
+                std::vector<CoolPropDbl> d = cpjson::get_long_double_array(contribution["d"]);
                 
                 if (EOS.alpha0.PlanckEinstein.is_enabled() == true){
                     EOS.alpha0.PlanckEinstein.extend(n, t, c, d);
@@ -190,12 +271,12 @@ protected:
             else if (!type.compare("IdealGasHelmholtzPlanckEinstein"))
             {
                 // Retrieve the values
-                std::vector<long double> n = cpjson::get_long_double_array(contribution["n"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
+                std::vector<CoolPropDbl> n = cpjson::get_long_double_array(contribution["n"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
                 // Flip the sign of theta
                 for (std::size_t i = 0; i < t.size(); ++i){ t[i] *= -1;}
-                std::vector<long double> c(n.size(), 1);
-                std::vector<long double> d(c.size(), -1);
+                std::vector<CoolPropDbl> c(n.size(), 1);
+                std::vector<CoolPropDbl> d(c.size(), -1);
                 
                 if (EOS.alpha0.PlanckEinstein.is_enabled() == true){
                     EOS.alpha0.PlanckEinstein.extend(n, t, c, d);
@@ -207,30 +288,30 @@ protected:
             else if (!type.compare("IdealGasHelmholtzCP0Constant"))
             {
                 if (EOS.alpha0.CP0Constant.is_enabled() == true){throw ValueError("Cannot add ");}
-                long double cp_over_R = cpjson::get_double(contribution, "cp_over_R");
-                long double Tc = cpjson::get_double(contribution, "Tc");
-                long double T0 = cpjson::get_double(contribution, "T0");
+                CoolPropDbl cp_over_R = cpjson::get_double(contribution, "cp_over_R");
+                CoolPropDbl Tc = cpjson::get_double(contribution, "Tc");
+                CoolPropDbl T0 = cpjson::get_double(contribution, "T0");
                 EOS.alpha0.CP0Constant = IdealHelmholtzCP0Constant(cp_over_R, Tc, T0);
             }
             else if (!type.compare("IdealGasHelmholtzCP0PolyT"))
             {
                 if (EOS.alpha0.CP0PolyT.is_enabled() == true){throw ValueError("Cannot add ");}
-                std::vector<long double> c = cpjson::get_long_double_array(contribution["c"]);
-                std::vector<long double> t = cpjson::get_long_double_array(contribution["t"]);
-                long double Tc = cpjson::get_double(contribution, "Tc");
-                long double T0 = cpjson::get_double(contribution, "T0");
+                std::vector<CoolPropDbl> c = cpjson::get_long_double_array(contribution["c"]);
+                std::vector<CoolPropDbl> t = cpjson::get_long_double_array(contribution["t"]);
+                CoolPropDbl Tc = cpjson::get_double(contribution, "Tc");
+                CoolPropDbl T0 = cpjson::get_double(contribution, "T0");
                 EOS.alpha0.CP0PolyT = IdealHelmholtzCP0PolyT(c, t, Tc, T0);
             }
             else if (!type.compare("IdealGasHelmholtzCP0AlyLee"))
             {
 
-                std::vector<long double> constants = cpjson::get_long_double_array(contribution["c"]);
-                long double Tc = cpjson::get_double(contribution, "Tc");
-                long double T0 = cpjson::get_double(contribution, "T0");
+                std::vector<CoolPropDbl> constants = cpjson::get_long_double_array(contribution["c"]);
+                CoolPropDbl Tc = cpjson::get_double(contribution, "Tc");
+                CoolPropDbl T0 = cpjson::get_double(contribution, "T0");
 
                 // Take the constant term if nonzero and set it as a polyT term
                 if (std::abs(constants[0]) > 1e-14){
-                    std::vector<long double> c(1,constants[0]), t(1,0);
+                    std::vector<CoolPropDbl> c(1,constants[0]), t(1,0);
                     if (EOS.alpha0.CP0PolyT.is_enabled() == true){
                         EOS.alpha0.CP0PolyT.extend(c,t);
                     }
@@ -238,7 +319,7 @@ protected:
                         EOS.alpha0.CP0PolyT = IdealHelmholtzCP0PolyT(c, t, Tc, T0);
                     }
                 }
-                std::vector<long double> n, c, d, t;
+                std::vector<CoolPropDbl> n, c, d, t;
                 if (std::abs(constants[1]) > 1e-14){
                     // sinh term can be converted by setting  a_k = C, b_k = 2*D, c_k = -1, d_k = 1
                     n.push_back(constants[1]);
@@ -262,8 +343,8 @@ protected:
             }
             else if (!type.compare("IdealGasHelmholtzEnthalpyEntropyOffset"))
             {
-                long double a1 = cpjson::get_double(contribution, "a1");
-                long double a2 = cpjson::get_double(contribution, "a2");
+                CoolPropDbl a1 = cpjson::get_double(contribution, "a1");
+                CoolPropDbl a2 = cpjson::get_double(contribution, "a2");
                 std::string reference = cpjson::get_string(contribution, "reference");
                 EOS.alpha0.EnthalpyEntropyOffsetCore = IdealHelmholtzEnthalpyEntropyOffset(a1, a2, reference);
             }
@@ -871,9 +952,9 @@ protected:
         // Use the method of Chung to approximate the values for epsilon_over_k and sigma_eta
         // Chung, T.-H.; Ajlan, M.; Lee, L. L.; Starling, K. E. Generalized Multiparameter Correlation for Nonpolar and Polar Fluid Transport Properties. Ind. Eng. Chem. Res. 1988, 27, 671-679.
         // rhoc needs to be in mol/L to yield a sigma in nm,
-        long double rho_crit_molar = fluid.pEOS->reduce.rhomolar/1000.0;// [mol/m3 to mol/L]
-        long double Tc = fluid.pEOS->reduce.T;
-        fluid.transport.sigma_eta = 0.809/pow(rho_crit_molar, static_cast<long double>(1.0/3.0))/1e9; // 1e9 is to convert from nm to m
+        CoolPropDbl rho_crit_molar = fluid.pEOS->reduce.rhomolar/1000.0;// [mol/m3 to mol/L]
+        CoolPropDbl Tc = fluid.pEOS->reduce.T;
+        fluid.transport.sigma_eta = 0.809/pow(rho_crit_molar, static_cast<CoolPropDbl>(1.0/3.0))/1e9; // 1e9 is to convert from nm to m
         fluid.transport.epsilon_over_k = Tc/1.3593; // [K]
     }
 
@@ -1059,21 +1140,195 @@ public:
             add_one(*itr);
         }
     };
+    /// Add the fluid passed in
     void add_one(rapidjson::Value &fluid_json)
     {
+        // Create an instance of the fluid; nothing is added to the library if it cannot be parsed
+        shared_ptr<CoolPropFluid> fluid(new CoolPropFluid());
+        parse_fluid(fluid_json, *fluid);
+
+        ScopedLock lock(mutex);
         _is_empty = false;
 
         // Get the next index for this fluid
-        std::size_t index = fluid_map.size();
+        std::size_t index = name_vector.size();
 
         // Add index->fluid mapping
-        fluid_map[index] = CoolPropFluid();
+        fluid_map[index] = fluid;
+        name_vector.push_back(fluid->name);
+
+        // If the fluid is ok, add the mappings to it
+        add_to_index(index, fluid->name, fluid->CAS, fluid->aliases);
+    };
+    /// Index all the fluid entries in a JSON string without parsing them
+    /**
+    Only the name, CAS number and aliases of each fluid are read; the rest of the fluid is parsed the first time that it is
+    requested with get.
+    @param JSON The JSON-formatted listing of fluids.  The string is not copied, so it must remain valid as long as this library is in use.
+    */
+    void add_many_lazily(const char *JSON)
+    {
+        rapidjson::StringStream stream(JSON);
+        FluidIndexHandler handler(stream);
+        rapidjson::Reader reader;
+        if (!reader.Parse<0>(stream, handler)){
+            throw ValueError(format("Unable to index fluids due to error: %s at offset %d", reader.GetParseError(), reader.GetErrorOffset()));
+        }
+        ScopedLock lock(mutex);
+        for (std::size_t i = 0; i < handler.entries.size(); ++i)
+        {
+            const FluidIndexHandler::entry &e = handler.entries[i];
+            std::size_t index = name_vector.size();
+            name_vector.push_back(e.name);
+            unparsed_map[index] = std::pair<const char*, std::size_t>(JSON + e.begin, e.length);
+            add_to_index(index, e.name, e.CAS, e.aliases);
+            _is_empty = false;
+        }
+    };
+    /// Index all the fluids in a binary fluid database without reading them
+    /**
+    Only the name, CAS number and aliases of each fluid are read; the rest of the fluid is read the first time that it is
+    requested with get.  Nothing is added if the database does not have the current FLUID_DATABASE_VERSION and size of
+    CoolPropDbl, if it was written from other JSON than the one with the hash source_hash, or if it is truncated.
+    @param DB The database, written by write_database.  It is not copied, so it must remain valid as long as this library is in use.
+    @param size The size of the database in bytes
+    @param source_hash The fluid_database_hash of the JSON that the fluids come from
+    */
+    void add_database(const unsigned char *DB, std::size_t size, unsigned int source_hash)
+    {
+        FluidDatabaseReader header(DB, size);
+        char magic[8];
+        unsigned int version = 0, real_size = 0, hash = 0, N = 0;
+        header.bytes(magic, 8);
+        if (memcmp(magic, "CPFLUIDS", 8) != 0){ throw ValueError("This is not a fluid database"); }
+        serialize(header, version);
+        if (static_cast<int>(version) != FLUID_DATABASE_VERSION){
+            throw ValueError(format("The fluid database has version %d, but version %d is required", version, FLUID_DATABASE_VERSION));
+        }
+        serialize(header, real_size);
+        if (real_size != sizeof(CoolPropDbl)){
+            throw ValueError(format("The fluid database was written with a CoolPropDbl of %d bytes, but it has %d bytes", real_size, static_cast<int>(sizeof(CoolPropDbl))));
+        }
+        serialize(header, hash);
+        if (hash != source_hash){ throw ValueError("The fluid database was not written from the current fluids"); }
+        serialize(header, N);
+        header.check_count(8*static_cast<std::size_t>(N));
+
+        // Read the whole index before anything is added, so that nothing is added if it is truncated
+        std::vector<FluidIndexHandler::entry> entries(N);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            FluidIndexHandler::entry &e = entries[i];
+            unsigned int offset = 0, length = 0;
+            serialize(header, offset);
+            serialize(header, length);
+            if (offset > size || length > size - offset){ throw ValueError("Fluid database is truncated"); }
+            e.begin = offset;
+            e.length = length;
+            // The record of a fluid begins with these (see serialize of CoolPropFluid)
+            FluidDatabaseReader record(DB + offset, length);
+            serialize(record, e.name);
+            serialize(record, e.CAS);
+            serialize(record, e.aliases);
+        }
+        ScopedLock lock(mutex);
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            const FluidIndexHandler::entry &e = entries[i];
+            std::size_t index = name_vector.size();
+            name_vector.push_back(e.name);
+            unread_map[index] = std::pair<const unsigned char*, std::size_t>(DB + e.begin, e.length);
+            add_to_index(index, e.name, e.CAS, e.aliases);
+            _is_empty = false;
+        }
+    };
+    /// Write all the fluids in this library to a binary fluid database, in the order in which they were added
+    /**
+    The fluids that have not been parsed yet are parsed first.  The fluids are written as they are now, so a fluid that has
+    been replaced is written as it was replaced.
+    @param source_hash The fluid_database_hash of the JSON that the fluids come from, which add_database checks
+    */
+    std::string write_database(unsigned int source_hash)
+    {
+        ScopedLock lock(mutex);
+        std::vector<std::string> records(name_vector.size());
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            FluidDatabaseWriter record;
+            serialize(record, get_parsed(i));
+            records[i].swap(record.buffer);
+        }
+        FluidDatabaseWriter DB;
+        unsigned int version = FLUID_DATABASE_VERSION, real_size = sizeof(CoolPropDbl), hash = source_hash, N = static_cast<unsigned int>(records.size());
+        DB.bytes("CPFLUIDS", 8);
+        serialize(DB, version); serialize(DB, real_size); serialize(DB, hash); serialize(DB, N);
+        unsigned int offset = 24 + 8*N;
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            unsigned int length = static_cast<unsigned int>(records[i].size());
+            serialize(DB, offset);
+            serialize(DB, length);
+            offset += length;
+        }
+        for (std::size_t i = 0; i < records.size(); ++i){ DB.buffer += records[i]; }
+        return DB.buffer;
+    };
+protected:
+    /// Add the mappings from the CAS number, name and aliases to the index of the fluid
+    void add_to_index(std::size_t index, const std::string &name, const std::string &CAS, const std::vector<std::string> &aliases)
+    {
+        // Add CAS->index mapping
+        string_to_index_map[CAS] = index;
+
+        // Add name->index mapping
+        string_to_index_map[name] = index;
 
-        // Create an instance of the fluid
-        CoolPropFluid &fluid = fluid_map[index];
+        // Add the aliases
+        for (std::size_t i = 0; i < aliases.size(); ++i)
+        {
+            string_to_index_map[aliases[i]] = index;
 
+            // Add uppercase alias for EES compatibility
+            string_to_index_map[upper(aliases[i])] = index;
+        }
+    };
+    /// Return the fluid at the given index, parsing or reading it first if it has only been indexed so far.  The mutex must be held by the caller.
+    CoolPropFluid& get_parsed(std::size_t index)
+    {
+        std::map<std::size_t, std::pair<const unsigned char*, std::size_t> >::iterator rit = unread_map.find(index);
+        if (rit != unread_map.end()){
+            shared_ptr<CoolPropFluid> fluid(new CoolPropFluid());
+            try{
+                FluidDatabaseReader reader(rit->second.first, rit->second.second);
+                serialize(reader, *fluid);
+            }
+            catch (const std::exception &e){
+                throw ValueError(format("Unable to load fluid [%s] from the fluid database due to error: %s", name_vector[index].c_str(), e.what()));
+            }
+            // The kernel is not part of the record, since it is a function of the build
+            fluid->pEOS->alphar.GenExpKernel = get_specialized_residual_kernel(fluid->name, fluid->pEOS->alphar.GenExp);
+            fluid_map[index] = fluid;
+            unread_map.erase(rit);
+        }
+        std::map<std::size_t, std::pair<const char*, std::size_t> >::iterator it = unparsed_map.find(index);
+        if (it != unparsed_map.end()){
+            rapidjson::Document dd;
+            dd.Parse<0>(std::string(it->second.first, it->second.second).c_str());
+            if (dd.HasParseError()){
+                throw ValueError(format("Unable to load fluid [%s] due to error: %s", name_vector[index].c_str(), dd.GetParseError()));
+            }
+            shared_ptr<CoolPropFluid> fluid(new CoolPropFluid());
+            parse_fluid(dd, *fluid);
+            fluid_map[index] = fluid;
+            unparsed_map.erase(it);
+        }
+        return *fluid_map[index];
+    };
+    /// Parse the JSON entry of a fluid into the fluid instance
+    void parse_fluid(rapidjson::Value &fluid_json, CoolPropFluid &fluid)
+    {
         // Fluid name
-        fluid.name = fluid_json["NAME"].GetString(); name_vector.push_back(fluid.name);
+        fluid.name = fluid_json["NAME"].GetString();
 
         try{
             // CAS number
@@ -1087,7 +1342,7 @@ public:
             parse_states(fluid_json["STATES"], fluid);
 
             if (get_debug_level() > 5){
-                std::cout << format("Loading fluid %s with CAS %s; %d fluids loaded\n", fluid.name.c_str(), fluid.CAS.c_str(), index);
+                std::cout << format("Loading fluid %s with CAS %s\n", fluid.name.c_str(), fluid.CAS.c_str());
             }
 
             // Aliases
@@ -1095,6 +1350,9 @@ public:
 
             // EOS
             parse_EOS_listing(fluid_json["EOS"], fluid);
+            
+            // Evaluate the generalized exponential terms of the default EOS with the kernel generated for the fluid, if there is one
+            fluid.pEOS->alphar.GenExpKernel = get_specialized_residual_kernel(fluid.name, fluid.pEOS->alphar.GenExp);
 
             // Validate the fluid
             validate(fluid);
@@ -1141,23 +1399,6 @@ public:
                 parse_transport(fluid_json["TRANSPORT"], fluid);
             }
 
-            // If the fluid is ok...
-
-            // Add CAS->index mapping
-            string_to_index_map[fluid.CAS] = index;
-
-            // Add name->index mapping
-            string_to_index_map[fluid.name] = index;
-
-            // Add the aliases
-            for (std::size_t i = 0; i < fluid.aliases.size(); ++i)
-            {
-                string_to_index_map[fluid.aliases[i]] = index;
-                
-                // Add uppercase alias for EES compatibility
-                string_to_index_map[upper(fluid.aliases[i])] = index;
-            }
-
             if (get_debug_level() > 5){ std::cout << format("Loaded.\n"); }
 
         }
@@ -1165,18 +1406,32 @@ public:
             throw ValueError(format("Unable to load fluid [%s] due to error: %s",fluid.name.c_str(),e.what()));
         }
     };
+public:
     /// Get a CoolPropFluid instance stored in this library
     /**
+    The reference is only valid until the fluid is replaced (see replace), since the library then releases its share of the fluid;
+    it must not be used while another thread might call replace, through set_reference_stateS for instance.  Use get_shared to
+    keep the fluid alive instead.
     @param key Either a CAS number or the name (CAS number should be preferred)
     */
     CoolPropFluid& get(std::string key)
     {
+        return *get_shared(key);
+    };
+    /// Get a CoolPropFluid instance stored in this library, shared with the library so that it outlives a replacement of the fluid
+    /**
+    @param key Either a CAS number or the name (CAS number should be preferred)
+    */
+    shared_ptr<CoolPropFluid> get_shared(std::string key)
+    {
+        ScopedLock lock(mutex);
         std::map<std::string, std::size_t>::iterator it;
         // Try to find it
         it = string_to_index_map.find(key);
         // If it is found
         if (it != string_to_index_map.end()){
-            return get(it->second);
+            get_parsed(it->second);
+            return fluid_map[it->second];
         }
         else{
             throw ValueError(format("key [%s] was not found in string_to_index_map in JSONFluidLibrary",key.c_str()));
@@ -1184,24 +1439,52 @@ public:
     };
     /// Get a CoolPropFluid instance stored in this library
     /**
+    The reference is only valid until the fluid is replaced, as for get(std::string)
     @param key The index of the fluid in the map
     */
     CoolPropFluid& get(std::size_t key)
     {
-        std::map<std::size_t,CoolPropFluid>::iterator it;
-        // Try to find it
-        it = fluid_map.find(key);
+        ScopedLock lock(mutex);
         // If it is found
-        if (it != fluid_map.end()){
-            return it->second;
+        if (key < name_vector.size()){
+            return get_parsed(key);
         }
         else{
             throw ValueError(format("key [%d] was not found in JSONFluidLibrary",key));
         }
     };
+    /// Get a copy of a fluid stored in this library that can be modified without affecting the backends that use the fluid
+    /**
+    @param key Either a CAS number or the name (CAS number should be preferred)
+    */
+    shared_ptr<CoolPropFluid> get_copy(std::string key)
+    {
+        // The share of the fluid keeps it alive while it is copied, even if another thread replaces it
+        shared_ptr<CoolPropFluid> fluid = get_shared(key);
+        shared_ptr<CoolPropFluid> copy(new CoolPropFluid(*fluid));
+        // The EOS pointer of the copy must point into its own vector of equations of state
+        copy->pEOS = &(copy->EOSVector[0]) + (fluid->pEOS - &(fluid->EOSVector[0]));
+        return copy;
+    };
+    /// Replace the fluid that has the same name as the fluid passed in
+    /**
+    The backends that were constructed before the replacement keep using the old fluid; they share it (see get_shared), so it is
+    deleted with the last of them.  Backends that are constructed afterwards use the new one.
+    @param fluid The fluid, usually a modified copy obtained from get_copy
+    */
+    void replace(shared_ptr<CoolPropFluid> fluid)
+    {
+        ScopedLock lock(mutex);
+        std::map<std::string, std::size_t>::iterator it = string_to_index_map.find(fluid->name);
+        if (it == string_to_index_map.end()){
+            throw ValueError(format("fluid [%s] was not found in JSONFluidLibrary",fluid->name.c_str()));
+        }
+        fluid_map[it->second] = fluid;
+    };
     /// Return a comma-separated list of fluid names
     std::string get_fluid_list(void)
     {
+        ScopedLock lock(mutex);
         return strjoin(name_vector, ",");
     };
 };
@@ -1212,7 +1495,11 @@ JSONFluidLibrary & get_library(void);
 /// Get a comma-separated-list of fluids that are included
 std::string get_fluid_list(void);
 
-/// Get the fluid structure returned as a reference
+/// Write the fluids that are built into the library to a binary fluid database, which can be loaded instead of the JSON
+/// of the fluids with the ALTERNATIVE_FLUIDS_DATABASE_PATH configuration key
+std::string write_fluid_database(void);
+
+/// Get the fluid structure returned as a reference, which is only valid until the fluid is replaced; see JSONFluidLibrary::get
 CoolPropFluid& get_fluid(std::string fluid_string);
 
 } /* namespace CoolProp */
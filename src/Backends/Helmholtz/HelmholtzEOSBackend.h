@@ -29,17 +29,19 @@ public:
             
             components.resize(fluids.size());
             for (unsigned int i = 0; i < components.size(); ++i){
-                components[i] = &(get_library().get(fluids[i]));
+                library_components.push_back(get_library().get_shared(fluids[i]));
+                components[i] = library_components.back().get();
             }
         }
         else{
-            components = std::vector<CoolPropFluid*>(1,&(get_library().get(name)));
+            library_components.push_back(get_library().get_shared(name));
+            components = std::vector<CoolPropFluid*>(1, library_components.back().get());
             mole_fractions = std::vector<double>(1,1);
         }
         // Set the components
         set_components(components);
         // Set the mole fractions
-        set_mole_fractions(std::vector<long double>(mole_fractions.begin(), mole_fractions.end()));
+        set_mole_fractions(std::vector<CoolPropDbl>(mole_fractions.begin(), mole_fractions.end()));
     };
     virtual ~HelmholtzEOSBackend(){};
 };
@@ -14,18 +14,49 @@
 namespace CoolProp {
 
 class FlashRoutines;
+class HelmholtzEOSMixtureBackend;
+
+/** \brief The saturated liquid or vapor state held by a HelmholtzEOSMixtureBackend
+ *
+ * The state is only constructed the first time it is used (by the flash and saturation routines), so that states that
+ * are only ever used in the single-phase region do not pay for constructing and storing it.  It is used like a
+ * shared_ptr<HelmholtzEOSMixtureBackend>.
+ */
+class SaturationStateHolder
+{
+private:
+    std::vector<CoolPropFluid*> components;
+    phases phase;
+    bool enabled;
+    mutable shared_ptr<HelmholtzEOSMixtureBackend> state;
+    void construct() const;
+public:
+    SaturationStateHolder() : phase(iphase_not_imposed), enabled(false) {};
+    /// Allow the state to be constructed, with the given components, and imposed phase
+    void enable(const std::vector<CoolPropFluid*> &components, phases phase){
+        this->components = components; this->phase = phase; enabled = true; state.reset();
+    };
+    /// True if the state has been constructed already
+    bool is_constructed() const { return state.get() != NULL; };
+    /// Get a pointer to the state, constructing it if needed; NULL if the state is not enabled
+    HelmholtzEOSMixtureBackend *get() const { if (enabled && state.get() == NULL){ construct(); } return state.get(); };
+    HelmholtzEOSMixtureBackend *operator->() const { return get(); };
+    HelmholtzEOSMixtureBackend &operator*() const { return *get(); };
+    operator shared_ptr<HelmholtzEOSMixtureBackend>() const { get(); return state; };
+};
 
 class HelmholtzEOSMixtureBackend : public AbstractState {
     
 private:
-    void pre_update(CoolProp::input_pairs &input_pair, long double &value1, long double &value2 );
+    void pre_update(CoolProp::input_pairs &input_pair, CoolPropDbl &value1, CoolPropDbl &value2 );
     void post_update();
 protected:
     std::vector<CoolPropFluid*> components; ///< The components that are in use
+    std::vector<shared_ptr<CoolPropFluid> > library_components; ///< The components from the fluid library, if they were given by name; they are kept alive if they are replaced in the library
 
     bool is_pure_or_pseudopure; ///< A flag for whether the substance is a pure or pseudo-pure fluid (true) or a mixture (false)
-    std::vector<long double> mole_fractions; ///< The bulk mole fractions of the mixture
-    std::vector<long double> K, ///< The K factors for the components
+    std::vector<CoolPropDbl> mole_fractions; ///< The bulk mole fractions of the mixture
+    std::vector<CoolPropDbl> K, ///< The K factors for the components
                              lnK; ///< The natural logarithms of the K factors of the components
 
     SimpleState _crit;
@@ -56,20 +87,20 @@ public:
     bool using_volu_fractions(){return false;}
     bool is_pure(){ return is_pure_or_pseudopure; }
     bool has_melting_line(){ return is_pure_or_pseudopure && components[0]->ancillaries.melting_line.enabled();};
-    long double calc_melting_line(int param, int given, long double value);
+    CoolPropDbl calc_melting_line(int param, int given, CoolPropDbl value);
     phases calc_phase(void){return _phase;};
     void calc_specify_phase(phases phase){ specify_phase(phase); }
     void calc_unspecify_phase(){ unspecify_phase(); }
-    long double calc_saturation_ancillary(parameters param, int Q, parameters given, double value);
+    CoolPropDbl calc_saturation_ancillary(parameters param, int Q, parameters given, double value);
     void calc_ssat_max(void);
     void calc_hsat_max(void);
-    long double calc_GWP20();
-    long double calc_GWP500();
-    long double calc_GWP100();
-    long double calc_ODP();
+    CoolPropDbl calc_GWP20();
+    CoolPropDbl calc_GWP500();
+    CoolPropDbl calc_GWP100();
+    CoolPropDbl calc_ODP();
 	
-	long double calc_first_saturation_deriv(parameters Of1, parameters Wrt1);
-	long double calc_second_saturation_deriv(parameters Of1, parameters Wrt1, parameters Of2, parameters Wrt2);
+	CoolPropDbl calc_first_saturation_deriv(parameters Of1, parameters Wrt1);
+	CoolPropDbl calc_second_saturation_deriv(parameters Of1, parameters Wrt1, parameters Of2, parameters Wrt2);
     
 	/// Calculate the phase once the state is fully calculated but you aren't sure if it is liquid or gas or ...
 	void recalculate_singlephase_phase();
@@ -77,18 +108,18 @@ public:
     const CoolProp::SimpleState &calc_state(const std::string &state);
 
     const std::vector<CoolPropFluid*> &get_components(){return components;};
-    std::vector<long double> &get_K(){return K;};
-    std::vector<long double> &get_lnK(){return lnK;};
+    std::vector<CoolPropDbl> &get_K(){return K;};
+    std::vector<CoolPropDbl> &get_lnK(){return lnK;};
     HelmholtzEOSMixtureBackend &get_SatL(){return *SatL;};
     HelmholtzEOSMixtureBackend &get_SatV(){return *SatV;};
     
-    std::vector<long double> calc_mole_fractions_liquid(void){return SatL->get_mole_fractions();};
-    std::vector<long double> calc_mole_fractions_vapor(void){return SatV->get_mole_fractions();};
+    std::vector<CoolPropDbl> calc_mole_fractions_liquid(void){return SatL->get_mole_fractions();};
+    std::vector<CoolPropDbl> calc_mole_fractions_vapor(void){return SatV->get_mole_fractions();};
     
     const CoolProp::PhaseEnvelopeData &calc_phase_envelope_data(){return PhaseEnvelope;};
 
     void resize(unsigned int N);
-    shared_ptr<HelmholtzEOSMixtureBackend> SatL, SatV; ///<
+    SaturationStateHolder SatL, SatV; ///< The saturated liquid and vapor states, constructed on first use
 
     /** \brief The standard update function
      * @param input_pair The pair of inputs that will be provided
@@ -106,9 +137,9 @@ public:
      * @param p Pressure in Pa
      * @param rho_guess Density in mol/m^3 guessed
      */
-    void update_TP_guessrho(long double T, long double p, long double rho_guess);
-    void update_DmolarT_direct(long double rhomolar, long double T);
-    void update_HmolarQ_with_guessT(long double hmolar, long double Q, long double Tguess);
+    void update_TP_guessrho(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rho_guess);
+    void update_DmolarT_direct(CoolPropDbl rhomolar, CoolPropDbl T);
+    void update_HmolarQ_with_guessT(CoolPropDbl hmolar, CoolPropDbl Q, CoolPropDbl Tguess);
 
     /** \brief Set the components of the mixture
      * 
@@ -135,112 +166,114 @@ public:
      * 
      * @param mole_fractions The vector of mole fractions of the components
      */
-    void set_mole_fractions(const std::vector<long double> &mole_fractions);
+    void set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions);
 
-    std::vector<long double> &get_mole_fractions(){return mole_fractions;};
-    const std::vector<long double> &get_const_mole_fractions(){return mole_fractions;};
+    std::vector<CoolPropDbl> &get_mole_fractions(){return mole_fractions;};
+    const std::vector<CoolPropDbl> &get_const_mole_fractions(){return mole_fractions;};
 
     /** \brief Set the mass fractions
      * 
      * @param mass_fractions The vector of mass fractions of the components
      */
-    void set_mass_fractions(const std::vector<long double> &mass_fractions){throw std::exception();};
-
-    long double calc_molar_mass(void);
-    long double calc_gas_constant(void);
-
-    long double calc_Bvirial(void);
-    long double calc_Cvirial(void);
-    long double calc_dBvirial_dT(void);
-    long double calc_dCvirial_dT(void);
-
-    long double calc_pressure(void);
-    long double calc_cvmolar(void);
-    long double calc_cpmolar(void);
-    long double calc_gibbsmolar(void);
-    long double calc_cpmolar_idealgas(void);
-    long double calc_pressure_nocache(long double T, long double rhomolar);
-    long double calc_smolar(void);
-    long double calc_smolar_nocache(long double T, long double rhomolar);
+    void set_mass_fractions(const std::vector<CoolPropDbl> &mass_fractions){throw std::exception();};
+
+    CoolPropDbl calc_molar_mass(void);
+    CoolPropDbl calc_gas_constant(void);
+
+    CoolPropDbl calc_Bvirial(void);
+    CoolPropDbl calc_Cvirial(void);
+    CoolPropDbl calc_dBvirial_dT(void);
+    CoolPropDbl calc_dCvirial_dT(void);
+
+    CoolPropDbl calc_pressure(void);
+    CoolPropDbl calc_cvmolar(void);
+    CoolPropDbl calc_cpmolar(void);
+    CoolPropDbl calc_gibbsmolar(void);
+    CoolPropDbl calc_cpmolar_idealgas(void);
+    CoolPropDbl calc_pressure_nocache(CoolPropDbl T, CoolPropDbl rhomolar);
+    CoolPropDbl calc_smolar(void);
+    CoolPropDbl calc_smolar_nocache(CoolPropDbl T, CoolPropDbl rhomolar);
     
-    long double calc_hmolar(void);
-    long double calc_hmolar_nocache(long double T, long double rhomolar);
+    CoolPropDbl calc_hmolar(void);
+    CoolPropDbl calc_hmolar_nocache(CoolPropDbl T, CoolPropDbl rhomolar);
     
-    long double calc_umolar_nocache(long double T, long double rhomolar);
-    long double calc_umolar(void);
-    long double calc_speed_sound(void);
+    CoolPropDbl calc_umolar_nocache(CoolPropDbl T, CoolPropDbl rhomolar);
+    CoolPropDbl calc_umolar(void);
+    CoolPropDbl calc_speed_sound(void);
     /** \brief The phase identification parameter of Venkatarathnam et al., FPE, 2011
      * 
      * 
      */
-    long double calc_fugacity_coefficient(int i);
-    long double calc_phase_identification_parameter(void);
+    CoolPropDbl calc_fugacity_coefficient(int i);
+    CoolPropDbl calc_phase_identification_parameter(void);
 
 	/// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r\f$ (dimensionless)
-    long double calc_alphar(void);
+    CoolPropDbl calc_alphar(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta}\f$ (dimensionless)
-	long double calc_dalphar_dDelta(void);
+	CoolPropDbl calc_dalphar_dDelta(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau}\f$ (dimensionless)
-	long double calc_dalphar_dTau(void);
+	CoolPropDbl calc_dalphar_dTau(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta}\f$ (dimensionless)
-	long double calc_d2alphar_dDelta2(void);
+	CoolPropDbl calc_d2alphar_dDelta2(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\tau}\f$ (dimensionless)
-	long double calc_d2alphar_dDelta_dTau(void);
+	CoolPropDbl calc_d2alphar_dDelta_dTau(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau\tau}\f$ (dimensionless)
-	long double calc_d2alphar_dTau2(void);    
+	CoolPropDbl calc_d2alphar_dTau2(void);    
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta\delta}\f$ (dimensionless)
-	long double calc_d3alphar_dDelta3(void);
+	CoolPropDbl calc_d3alphar_dDelta3(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dDelta2_dTau(void);
+	CoolPropDbl calc_d3alphar_dDelta2_dTau(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\tau\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dDelta_dTau2(void);
+	CoolPropDbl calc_d3alphar_dDelta_dTau2(void);
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau\tau\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dTau3(void);
-
-    long double calc_alpha0(void);
-    long double calc_dalpha0_dDelta(void);
-    long double calc_dalpha0_dTau(void);
-    long double calc_d2alpha0_dDelta2(void);
-    long double calc_d2alpha0_dDelta_dTau(void);
-    long double calc_d2alpha0_dTau2(void);
-    long double calc_d3alpha0_dDelta3(void);
-    long double calc_d3alpha0_dDelta2_dTau(void);
-    long double calc_d3alpha0_dDelta_dTau2(void);
-    long double calc_d3alpha0_dTau3(void);
-
-    long double calc_surface_tension(void);
-    long double calc_viscosity(void);
-    long double calc_viscosity_dilute(void);
-    long double calc_viscosity_background(void);
-    long double calc_viscosity_background(long double eta_dilute);
-    long double calc_conductivity(void);
-    long double calc_conductivity_background(void);
-
-    long double calc_saturated_liquid_keyed_output(parameters key) { return SatL->keyed_output(key); }
-    long double calc_saturated_vapor_keyed_output(parameters key) { return SatV->keyed_output(key); }
-
-    long double calc_Tmin(void);
-    long double calc_Tmax(void);
-    long double calc_pmax(void);
-    long double calc_Ttriple(void);
-    long double calc_p_triple(void);
-    long double calc_pmax_sat(void);
-    long double calc_Tmax_sat(void);
-    void calc_Tmin_sat(long double &Tmin_satL, long double &Tmin_satV);
-    void calc_pmin_sat(long double &pmin_satL, long double &pmin_satV);
+	CoolPropDbl calc_d3alphar_dTau3(void);
+
+    CoolPropDbl calc_alpha0(void);
+    CoolPropDbl calc_dalpha0_dDelta(void);
+    CoolPropDbl calc_dalpha0_dTau(void);
+    CoolPropDbl calc_d2alpha0_dDelta2(void);
+    CoolPropDbl calc_d2alpha0_dDelta_dTau(void);
+    CoolPropDbl calc_d2alpha0_dTau2(void);
+    CoolPropDbl calc_d3alpha0_dDelta3(void);
+    CoolPropDbl calc_d3alpha0_dDelta2_dTau(void);
+    CoolPropDbl calc_d3alpha0_dDelta_dTau2(void);
+    CoolPropDbl calc_d3alpha0_dTau3(void);
+
+    CoolPropDbl calc_surface_tension(void);
+    CoolPropDbl calc_viscosity(void);
+    CoolPropDbl calc_viscosity_dilute(void);
+    CoolPropDbl calc_viscosity_background(void);
+    CoolPropDbl calc_viscosity_background(CoolPropDbl eta_dilute);
+    CoolPropDbl calc_conductivity(void);
+    CoolPropDbl calc_conductivity_background(void);
+
+    CoolPropDbl calc_saturated_liquid_keyed_output(parameters key) { return SatL->keyed_output(key); }
+    CoolPropDbl calc_saturated_vapor_keyed_output(parameters key) { return SatV->keyed_output(key); }
+
+    CoolPropDbl calc_Tmin(void);
+    CoolPropDbl calc_Tmax(void);
+    CoolPropDbl calc_pmax(void);
+    CoolPropDbl calc_Ttriple(void);
+    CoolPropDbl calc_p_triple(void);
+    CoolPropDbl calc_pmax_sat(void);
+    CoolPropDbl calc_Tmax_sat(void);
+    void calc_Tmin_sat(CoolPropDbl &Tmin_satL, CoolPropDbl &Tmin_satV);
+    void calc_pmin_sat(CoolPropDbl &pmin_satL, CoolPropDbl &pmin_satV);
 	
-    long double calc_T_critical(void);
-    long double calc_p_critical(void);
-    long double calc_rhomolar_critical(void);
+    CoolPropDbl calc_T_critical(void);
+    CoolPropDbl calc_p_critical(void);
+    CoolPropDbl calc_rhomolar_critical(void);
 	
-	long double calc_T_reducing(void){return get_reducing_state().T;};
-    long double calc_rhomolar_reducing(void){return get_reducing_state().rhomolar;};
+	CoolPropDbl calc_T_reducing(void){return get_reducing_state().T;};
+    CoolPropDbl calc_rhomolar_reducing(void){return get_reducing_state().rhomolar;};
 
     std::string calc_name(void);
 	std::vector<std::string> calc_fluid_names(void);
 
-    void calc_all_alphar_deriv_cache(const std::vector<long double> &mole_fractions, const long double &tau, const long double &delta);
-    long double calc_alphar_deriv_nocache(const int nTau, const int nDelta, const std::vector<long double> & mole_fractions, const long double &tau, const long double &delta);
+    void calc_all_alphar_deriv_cache(const std::vector<CoolPropDbl> &mole_fractions, const CoolPropDbl &tau, const CoolPropDbl &delta);
+    /// The derivatives of alphar selected by flags (alphar_derivative_flags), skipping the work of the others
+    HelmholtzDerivatives calc_alphar_derivs_nocache(int flags, const std::vector<CoolPropDbl> &mole_fractions, const CoolPropDbl &tau, const CoolPropDbl &delta);
+    CoolPropDbl calc_alphar_deriv_nocache(const int nTau, const int nDelta, const std::vector<CoolPropDbl> & mole_fractions, const CoolPropDbl &tau, const CoolPropDbl &delta);
 
     /**
     \brief Take derivatives of the ideal-gas part of the Helmholtz energy, don't use any cached values, or store any cached values
@@ -266,28 +299,28 @@ public:
 
     \sa Table B5, GERG 2008 from Kunz Wagner, JCED, 2012
     */
-    long double calc_alpha0_deriv_nocache(const int nTau, const int nDelta, const std::vector<long double> & mole_fractions, const long double &tau, const long double &delta, const long double &Tr, const long double &rhor);
+    CoolPropDbl calc_alpha0_deriv_nocache(const int nTau, const int nDelta, const std::vector<CoolPropDbl> & mole_fractions, const CoolPropDbl &tau, const CoolPropDbl &delta, const CoolPropDbl &Tr, const CoolPropDbl &rhor);
 
     void calc_reducing_state(void);
-    SimpleState calc_reducing_state_nocache(const std::vector<long double> & mole_fractions);
+    SimpleState calc_reducing_state_nocache(const std::vector<CoolPropDbl> & mole_fractions);
 
     const CoolProp::SimpleState & get_reducing_state(){calc_reducing_state(); return _reducing;};
 
     void update_states();
     
-    long double calc_compressibility_factor(void){return 1+delta()*dalphar_dDelta();};
+    CoolPropDbl calc_compressibility_factor(void){return 1+delta()*dalphar_dDelta();};
     
     void calc_phase_envelope(const std::string &type);
     
-    void mass_to_molar_inputs(CoolProp::input_pairs &input_pair, long double &value1, long double &value2);
+    void mass_to_molar_inputs(CoolProp::input_pairs &input_pair, CoolPropDbl &value1, CoolPropDbl &value2);
 
     // ***************************************************************
     // ***************************************************************
     // *************  PHASE DETERMINATION ROUTINES  ******************
     // ***************************************************************
     // ***************************************************************
-    void T_phase_determination_pure_or_pseudopure(int other, long double value);
-    void p_phase_determination_pure_or_pseudopure(int other, long double value, bool &saturation_called);
+    void T_phase_determination_pure_or_pseudopure(int other, CoolPropDbl value);
+    void p_phase_determination_pure_or_pseudopure(int other, CoolPropDbl value, bool &saturation_called);
     void DmolarP_phase_determination();
     
 
@@ -297,9 +330,10 @@ public:
     // ***************************************************************
     // ***************************************************************
 
-    long double solver_rho_Tp(long double T, long double p, long double rho_guess = -1);
-    long double solver_rho_Tp_SRK(long double T, long double p, int phase);
-    long double solver_for_rho_given_T_oneof_HSU(long double T, long double value, int other);
+    /// The density at T and p; the state is updated to the solution (with update_DmolarT_direct) whichever of the solvers finds it
+    CoolPropDbl solver_rho_Tp(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rho_guess = -1);
+    CoolPropDbl solver_rho_Tp_SRK(CoolPropDbl T, CoolPropDbl p, int phase);
+    CoolPropDbl solver_for_rho_given_T_oneof_HSU(CoolPropDbl T, CoolPropDbl value, int other);
 
 };
 
@@ -33,7 +33,7 @@ class PhaseEnvelopeRoutines{
      * @param iInput The key for the variable type that is to be checked
      * @param value The value associated with iInput
      */
-    static std::vector<std::pair<std::size_t, std::size_t> > find_intersections(HelmholtzEOSMixtureBackend &HEOS, parameters iInput, long double value);
+    static std::vector<std::pair<std::size_t, std::size_t> > find_intersections(HelmholtzEOSMixtureBackend &HEOS, parameters iInput, CoolPropDbl value);
     
     /** \brief Determine whether a pair of inputs is inside or outside the phase envelope
      * 
@@ -45,7 +45,7 @@ class PhaseEnvelopeRoutines{
      * @param iclosest The index of the phase envelope for the closest point
      * @param closest_state A SimpleState corresponding to the closest point found on the phase envelope
      */
-    static bool is_inside(HelmholtzEOSMixtureBackend &HEOS, parameters iInput1, long double value1, parameters iInput2, long double value2, std::size_t &iclosest, SimpleState &closest_state);
+    static bool is_inside(HelmholtzEOSMixtureBackend &HEOS, parameters iInput1, CoolPropDbl value1, parameters iInput2, CoolPropDbl value2, std::size_t &iclosest, SimpleState &closest_state);
 };
     
 } /* namespace CoolProp */
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "SpecializedKernels.h"
+#include <math.h>
+#include <limits>
+
+#if defined(COOLPROP_SPECIALIZED_KERNELS)
+#include "specialized_residual_kernels.h" // Generated by dev/generate_kernels.py; defines the kernels and the array specialized_residual_kernels
+#endif
+
+namespace CoolProp{
+
+#if defined(COOLPROP_SPECIALIZED_KERNELS)
+static bool same_coefficient(CoolPropDbl x, CoolPropDbl y)
+{
+    return x == y;
+}
+#endif
+
+ResidualHelmholtzKernel get_specialized_residual_kernel(const std::string &name, const ResidualHelmholtzGeneralizedExponential &GenExp)
+{
+#if defined(COOLPROP_SPECIALIZED_KERNELS)
+    for (std::size_t i = 0; i < sizeof(specialized_residual_kernels)/sizeof(specialized_residual_kernels[0]); ++i)
+    {
+        const SpecializedResidualKernel &k = specialized_residual_kernels[i];
+        if (name.compare(k.name) != 0 || GenExp.elements.size() != k.N){ continue; }
+        // The fluid might have been replaced by one with other terms; the terms are in the order of the JSON file in both, and the
+        // generator writes the numbers that rapidjson parses from the JSON, so every coefficient has to be the same
+        const CoolPropDbl *generated[] = {k.n, k.d, k.t, k.c, k.l, k.omega, k.m, k.eta1, k.epsilon1, k.eta2, k.epsilon2, k.beta1, k.gamma1, k.beta2, k.gamma2};
+        for (std::size_t j = 0; j < k.N; ++j){
+            const ResidualHelmholtzGeneralizedExponentialElement &el = GenExp.elements[j];
+            const CoolPropDbl coefficients[] = {el.n, el.d, el.t, el.c, el.l_double, el.omega, el.m_double, el.eta1, el.epsilon1,
+                                                el.eta2, el.epsilon2, el.beta1, el.gamma1, el.beta2, el.gamma2};
+            for (std::size_t q = 0; q < sizeof(coefficients)/sizeof(coefficients[0]); ++q){
+                if (!same_coefficient(coefficients[q], generated[q][j])){ return NULL; }
+            }
+        }
+        return k.kernel;
+    }
+#else
+    (void)name; (void)GenExp;
+#endif
+    return NULL;
+}
+
+} /* namespace CoolProp */
+
+#if defined(ENABLE_CATCH) && defined(COOLPROP_SPECIALIZED_KERNELS)
+#include "catch.hpp"
+#include "Fluids/FluidLibrary.h"
+
+TEST_CASE("Generated kernels give the same derivatives as the generalized exponential terms", "[specialized_kernels]")
+{
+    // Both sides sum the same terms with the same coefficients in CoolPropDbl, and with the same exp() and log() of double, in a
+    // different order, so they differ by the round-off of the sums, which grows with the cancellation among the terms, and by the
+    // rounding to the doubles of HelmholtzDerivatives.  The terms of the third derivatives cancel the most, by up to about 2e4 for
+    // CO2 at its critical point
+    const double eps = static_cast<double>(std::numeric_limits<CoolPropDbl>::epsilon()), eps_double = std::numeric_limits<double>::epsilon();
+    const double K_FIRST_SECOND = 1e3, K_THIRD = 1e4;
+    for (std::size_t i = 0; i < sizeof(CoolProp::specialized_residual_kernels)/sizeof(CoolProp::specialized_residual_kernels[0]); ++i)
+    {
+        const CoolProp::SpecializedResidualKernel &k = CoolProp::specialized_residual_kernels[i];
+        CoolProp::EquationOfState &EOS = *CoolProp::get_library().get(k.name).pEOS;
+        CAPTURE(k.name);
+        CHECK(EOS.alphar.GenExpKernel == k.kernel);
+        double taus[] = {0.5, 1.0, 1.5, 2.5}, deltas[] = {1e-5, 0.1, 1.0, 2.5};
+        for (std::size_t j = 0; j < sizeof(taus)/sizeof(taus[0]); ++j){
+            for (std::size_t m = 0; m < sizeof(deltas)/sizeof(deltas[0]); ++m){
+                CoolProp::HelmholtzDerivatives generated, generic;
+                k.kernel(taus[j], deltas[m], generated, CoolProp::ALPHAR_ALL_DERIVATIVES);
+                EOS.alphar.GenExp.all(taus[j], deltas[m], generic);
+                Eigen::Array<double, 10, 1> g = generated.values(), r = generic.values();
+                for (std::size_t q = 0; q < 10; ++q){
+                    CAPTURE(taus[j]);
+                    CAPTURE(deltas[m]);
+                    CAPTURE(q);
+                    CAPTURE(g[q]);
+                    CAPTURE(r[q]);
+                    double tolerance = ((q < 6) ? K_FIRST_SECOND : K_THIRD)*eps + 2*eps_double;
+                    CHECK(std::abs(g[q] - r[q]) <= tolerance*std::abs(r[q]));
+                }
+            }
+        }
+    }
+}
+
+#endif
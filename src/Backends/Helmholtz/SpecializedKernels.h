@@ -0,0 +1,86 @@
+#ifndef SPECIALIZED_KERNELS_H
+#define SPECIALIZED_KERNELS_H
+
+#include "Helmholtz.h"
+#include "CoolPropTools.h"
+#include <string>
+
+namespace CoolProp{
+
+/** \brief A kernel generated by dev/generate_kernels.py for the generalized exponential terms of a fluid
+ *
+ * All the coefficients of the terms that are written into the kernel are kept, in the order of the elements of
+ * ResidualHelmholtzGeneralizedExponential, so that the kernel is only used for an equation of state with the same terms
+ */
+struct SpecializedResidualKernel
+{
+    const char *name;
+    ResidualHelmholtzKernel kernel;
+    std::size_t N;
+    const CoolPropDbl *n, *d, *t, *c, *l, *omega, *m, *eta1, *epsilon1, *eta2, *epsilon2, *beta1, *gamma1, *beta2, *gamma2;
+};
+
+/// The sums of the terms of a generated kernel, in CoolPropDbl like the sums of ResidualHelmholtzGeneralizedExponential::all
+struct SpecializedResidualSums
+{
+    CoolPropDbl alphar, dalphar_ddelta, dalphar_dtau, d2alphar_ddelta2, d2alphar_dtau2, d2alphar_ddelta_dtau,
+                d3alphar_ddelta3, d3alphar_dtau3, d3alphar_ddelta2_dtau, d3alphar_ddelta_dtau2;
+    SpecializedResidualSums() : alphar(0), dalphar_ddelta(0), dalphar_dtau(0), d2alphar_ddelta2(0), d2alphar_dtau2(0), d2alphar_ddelta_dtau(0),
+                                d3alphar_ddelta3(0), d3alphar_dtau3(0), d3alphar_ddelta2_dtau(0), d3alphar_ddelta_dtau2(0) {};
+};
+
+/// The kernel for the generalized exponential terms of the fluid, or NULL if none was generated for it or if its terms are not those of GenExp
+ResidualHelmholtzKernel get_specialized_residual_kernel(const std::string &name, const ResidualHelmholtzGeneralizedExponential &GenExp);
+
+/** \brief Add a term of the generated kernels to the sums of the derivatives
+ *
+ * The sums are those of ResidualHelmholtzGeneralizedExponential::all, in which the derivatives are multiplied by delta^i*tau^j; the arguments are
+ * \f$ n\delta^d\tau^t\exp(u) \f$ and the derivatives of u, which are constants in the generated code wherever the term does not have the part of u
+ */
+inline void add_specialized_residual_term(SpecializedResidualSums &sums, int flags, CoolPropDbl delta, CoolPropDbl tau, CoolPropDbl d, CoolPropDbl t, CoolPropDbl ndteu,
+                                          CoolPropDbl du_ddelta, CoolPropDbl d2u_ddelta2, CoolPropDbl d3u_ddelta3, CoolPropDbl du_dtau, CoolPropDbl d2u_dtau2, CoolPropDbl d3u_dtau3)
+{
+    CoolPropDbl B_delta = 0, B_tau = 0, B_delta2 = 0, B_tau2 = 0;
+    if (flags & (ALPHAR_DDELTA|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA_DTAU2)){ B_delta = delta*du_ddelta + d; }
+    if (flags & (ALPHAR_DTAU|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA2_DTAU)){ B_tau = tau*du_dtau + t; }
+    if (flags & (ALPHAR_DDELTA2|ALPHAR_DDELTA2_DTAU)){ B_delta2 = POW2(delta)*(d2u_ddelta2 + POW2(du_ddelta)) + 2*d*delta*du_ddelta + d*(d-1); }
+    if (flags & (ALPHAR_DTAU2|ALPHAR_DDELTA_DTAU2)){ B_tau2 = POW2(tau)*(d2u_dtau2 + POW2(du_dtau)) + 2*t*tau*du_dtau + t*(t-1); }
+
+    if (flags & ALPHAR_BASE){ sums.alphar += ndteu; }
+    if (flags & ALPHAR_DDELTA){ sums.dalphar_ddelta += ndteu*B_delta; }
+    if (flags & ALPHAR_DTAU){ sums.dalphar_dtau += ndteu*B_tau; }
+    if (flags & ALPHAR_DDELTA2){ sums.d2alphar_ddelta2 += ndteu*B_delta2; }
+    if (flags & ALPHAR_DTAU2){ sums.d2alphar_dtau2 += ndteu*B_tau2; }
+    if (flags & ALPHAR_DDELTA_DTAU){ sums.d2alphar_ddelta_dtau += ndteu*B_delta*B_tau; }
+    if (flags & ALPHAR_DDELTA3){
+        CoolPropDbl B_delta3 = POW3(delta)*d3u_ddelta3 + 3*d*POW2(delta)*d2u_ddelta2 + 3*POW3(delta)*d2u_ddelta2*du_ddelta + 3*d*POW2(delta*du_ddelta)
+                          + 3*d*(d-1)*delta*du_ddelta + d*(d-1)*(d-2) + POW3(delta*du_ddelta);
+        sums.d3alphar_ddelta3 += ndteu*B_delta3;
+    }
+    if (flags & ALPHAR_DTAU3){
+        CoolPropDbl B_tau3 = POW3(tau)*d3u_dtau3 + 3*t*POW2(tau)*d2u_dtau2 + 3*POW3(tau)*d2u_dtau2*du_dtau + 3*t*POW2(tau*du_dtau)
+                        + 3*t*(t-1)*tau*du_dtau + t*(t-1)*(t-2) + POW3(tau*du_dtau);
+        sums.d3alphar_dtau3 += ndteu*B_tau3;
+    }
+    if (flags & ALPHAR_DDELTA2_DTAU){ sums.d3alphar_ddelta2_dtau += ndteu*B_delta2*B_tau; }
+    if (flags & ALPHAR_DDELTA_DTAU2){ sums.d3alphar_ddelta_dtau2 += ndteu*B_delta*B_tau2; }
+}
+
+/// Add the sums of the generated kernels to derivs, dividing out the powers of delta and tau as ResidualHelmholtzGeneralizedExponential::all does
+inline void add_specialized_residual_sums(const SpecializedResidualSums &sums, CoolPropDbl one_over_delta, CoolPropDbl one_over_tau, HelmholtzDerivatives &derivs)
+{
+    derivs.alphar                += sums.alphar;
+    derivs.dalphar_ddelta        += sums.dalphar_ddelta*one_over_delta;
+    derivs.dalphar_dtau          += sums.dalphar_dtau*one_over_tau;
+    derivs.d2alphar_ddelta2      += sums.d2alphar_ddelta2*POW2(one_over_delta);
+    derivs.d2alphar_dtau2        += sums.d2alphar_dtau2*POW2(one_over_tau);
+    derivs.d2alphar_ddelta_dtau  += sums.d2alphar_ddelta_dtau*one_over_delta*one_over_tau;
+
+    derivs.d3alphar_ddelta3      += sums.d3alphar_ddelta3*POW3(one_over_delta);
+    derivs.d3alphar_dtau3        += sums.d3alphar_dtau3*POW3(one_over_tau);
+    derivs.d3alphar_ddelta2_dtau += sums.d3alphar_ddelta2_dtau*POW2(one_over_delta)*one_over_tau;
+    derivs.d3alphar_ddelta_dtau2 += sums.d3alphar_ddelta_dtau2*one_over_delta*POW2(one_over_tau);
+}
+
+} /* namespace CoolProp */
+#endif
@@ -4,18 +4,18 @@
 
 namespace CoolProp{
 
-long double TransportRoutines::viscosity_dilute_kinetic_theory(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_kinetic_theory(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
-        long double Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k;
-        long double sigma_nm = HEOS.components[0]->transport.sigma_eta*1e9; // 1e9 to convert from m to nm
-        long double molar_mass_kgkmol = HEOS.molar_mass()*1000; // 1000 to convert from kg/mol to kg/kmol
+        CoolPropDbl Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k;
+        CoolPropDbl sigma_nm = HEOS.components[0]->transport.sigma_eta*1e9; // 1e9 to convert from m to nm
+        CoolPropDbl molar_mass_kgkmol = HEOS.molar_mass()*1000; // 1000 to convert from kg/mol to kg/kmol
 
         // The nondimensional empirical collision integral from Neufeld
         // Neufeld, P. D.; Janzen, A. R.; Aziz, R. A. Empirical Equations to Calculate 16 of the Transport Collision Integrals (l,s)*
         // for the Lennard-Jones (12-6) Potential. J. Chem. Phys. 1972, 57, 1100-1102
-        long double OMEGA22 = 1.16145*pow(Tstar, static_cast<long double>(-0.14874))+0.52487*exp(-0.77320*Tstar)+2.16178*exp(-2.43787*Tstar);
+        CoolPropDbl OMEGA22 = 1.16145*pow(Tstar, static_cast<CoolPropDbl>(-0.14874))+0.52487*exp(-0.77320*Tstar)+2.16178*exp(-2.43787*Tstar);
 
         // The dilute gas component -
         return 26.692e-9*sqrt(molar_mass_kgkmol*HEOS.T())/(pow(sigma_nm, 2)*OMEGA22); // Pa-s
@@ -25,25 +25,25 @@ long double TransportRoutines::viscosity_dilute_kinetic_theory(HelmholtzEOSMixtu
     }
 }
 
-long double TransportRoutines::viscosity_dilute_collision_integral(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_collision_integral(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ViscosityDiluteGasCollisionIntegralData &data = HEOS.components[0]->transport.viscosity_dilute.collision_integral;
-        const std::vector<long double> &a = data.a, &t = data.t;
-        const long double C = data.C, molar_mass = data.molar_mass;
+        const std::vector<CoolPropDbl> &a = data.a, &t = data.t;
+        const CoolPropDbl C = data.C, molar_mass = data.molar_mass;
 
-        long double S;
+        CoolPropDbl S;
         // Unit conversions and variable definitions
-        const long double Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k;
-        const long double sigma_nm = HEOS.components[0]->transport.sigma_eta*1e9; // 1e9 to convert from m to nm
-        const long double molar_mass_kgkmol = molar_mass*1000; // 1000 to convert from kg/mol to kg/kmol
+        const CoolPropDbl Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k;
+        const CoolPropDbl sigma_nm = HEOS.components[0]->transport.sigma_eta*1e9; // 1e9 to convert from m to nm
+        const CoolPropDbl molar_mass_kgkmol = molar_mass*1000; // 1000 to convert from kg/mol to kg/kmol
 
         /// Both the collision integral \f$\mathfrak{S}^*\f$ and effective cross section \f$\Omega^{(2,2)}\f$ have the same form,
         /// in general we don't care which is used.  The are related through \f$\Omega^{(2,2)} = (5/4)\mathfrak{S}^*\f$
         /// see Vesovic(JPCRD, 1990) for CO\f$_2\f$ for further information
-        long double summer = 0, lnTstar = log(Tstar);
+        CoolPropDbl summer = 0, lnTstar = log(Tstar);
         for (std::size_t i = 0; i < a.size(); ++i)
         {
             summer += a[i]*pow(lnTstar,t[i]);
@@ -58,15 +58,15 @@ long double TransportRoutines::viscosity_dilute_collision_integral(HelmholtzEOSM
     }
 }
 
-long double TransportRoutines::viscosity_dilute_powers_of_T(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_powers_of_T(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ViscosityDiluteGasPowersOfT &data = HEOS.components[0]->transport.viscosity_dilute.powers_of_T;
-        const std::vector<long double> &a = data.a, &t = data.t;
+        const std::vector<CoolPropDbl> &a = data.a, &t = data.t;
 
-        long double summer = 0, T = HEOS.T();
+        CoolPropDbl summer = 0, T = HEOS.T();
         for (std::size_t i = 0; i < a.size(); ++i)
         {
             summer += a[i]*pow(T, t[i]);
@@ -78,15 +78,15 @@ long double TransportRoutines::viscosity_dilute_powers_of_T(HelmholtzEOSMixtureB
     }
 }
 
-long double TransportRoutines::viscosity_dilute_collision_integral_powers_of_T(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_collision_integral_powers_of_T(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ViscosityDiluteCollisionIntegralPowersOfTstarData &data = HEOS.components[0]->transport.viscosity_dilute.collision_integral_powers_of_Tstar;
-        const std::vector<long double> &a = data.a, &t = data.t;
+        const std::vector<CoolPropDbl> &a = data.a, &t = data.t;
 
-        long double summer = 0, Tstar = HEOS.T()/data.T_reducing;
+        CoolPropDbl summer = 0, Tstar = HEOS.T()/data.T_reducing;
         for (std::size_t i = 0; i < a.size(); ++i)
         {
             summer += a[i]*pow(Tstar, t[i]);
@@ -98,36 +98,36 @@ long double TransportRoutines::viscosity_dilute_collision_integral_powers_of_T(H
     }
 
 }
-long double TransportRoutines::viscosity_higher_order_modified_Batschinski_Hildebrand(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_higher_order_modified_Batschinski_Hildebrand(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         CoolProp::ViscosityModifiedBatschinskiHildebrandData &HO = HEOS.components[0]->transport.viscosity_higher_order.modified_Batschinski_Hildebrand;
 
-        long double delta = HEOS.rhomolar()/HO.rhomolar_reduce, tau = HO.T_reduce/HEOS.T();
+        CoolPropDbl delta = HEOS.rhomolar()/HO.rhomolar_reduce, tau = HO.T_reduce/HEOS.T();
 
         // The first term that is formed of powers of tau (Tc/T) and delta (rho/rhoc)
-        long double S = 0;
+        CoolPropDbl S = 0;
         for (unsigned int i = 0; i < HO.a.size(); ++i){
             S += HO.a[i]*pow(delta, HO.d1[i])*pow(tau, HO.t1[i])*exp(HO.gamma[i]*pow(delta, HO.l[i]));
         }
 
         // For the terms that multiplies the bracketed term with delta and delta0
-        long double F = 0;
+        CoolPropDbl F = 0;
         for (unsigned int i = 0; i < HO.f.size(); ++i){
             F += HO.f[i]*pow(delta, HO.d2[i])*pow(tau, HO.t2[i]);
         }
 
         // for delta_0
-        long double summer_numer = 0;
+        CoolPropDbl summer_numer = 0;
         for (unsigned int i = 0; i < HO.g.size(); ++i){
             summer_numer += HO.g[i]*pow(tau, HO.h[i]);
         }
-        long double summer_denom = 0;
+        CoolPropDbl summer_denom = 0;
         for (unsigned int i = 0; i < HO.p.size(); ++i){
             summer_denom += HO.p[i]*pow(tau, HO.q[i]);
         }
-        long double delta0 = summer_numer/summer_denom;
+        CoolPropDbl delta0 = summer_numer/summer_denom;
 
         // The higher-order-term component
         return S + F*(1/(delta0-delta)-1/delta0); // Pa-s
@@ -137,19 +137,19 @@ long double TransportRoutines::viscosity_higher_order_modified_Batschinski_Hilde
     }
 }
 
-long double TransportRoutines::viscosity_initial_density_dependence_Rainwater_Friend(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_initial_density_dependence_Rainwater_Friend(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ViscosityRainWaterFriendData &data = HEOS.components[0]->transport.viscosity_initial.rainwater_friend;
-        const std::vector<long double> &b = data.b, &t = data.t;
+        const std::vector<CoolPropDbl> &b = data.b, &t = data.t;
 
-        long double B_eta, B_eta_star;
-        long double Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k; // [no units]
-        long double sigma = HEOS.components[0]->transport.sigma_eta; // [m]
+        CoolPropDbl B_eta, B_eta_star;
+        CoolPropDbl Tstar = HEOS.T()/HEOS.components[0]->transport.epsilon_over_k; // [no units]
+        CoolPropDbl sigma = HEOS.components[0]->transport.sigma_eta; // [m]
 
-        long double summer = 0;
+        CoolPropDbl summer = 0;
         for (unsigned int i = 0; i < b.size(); ++i){
             summer += b[i]*pow(Tstar, t[i]);
         }
@@ -162,19 +162,19 @@ long double TransportRoutines::viscosity_initial_density_dependence_Rainwater_Fr
     }
 }
 
-long double TransportRoutines::viscosity_initial_density_dependence_empirical(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_initial_density_dependence_empirical(HelmholtzEOSMixtureBackend &HEOS)
 {
     // Inspired by the form from Tariq, JPCRD, 2014
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ViscosityInitialDensityEmpiricalData &data = HEOS.components[0]->transport.viscosity_initial.empirical;
-        const std::vector<long double> &n = data.n, &d = data.d, &t = data.t;
+        const std::vector<CoolPropDbl> &n = data.n, &d = data.d, &t = data.t;
 
-        long double tau = data.T_reducing/HEOS.T(); // [no units]
-        long double delta = HEOS.rhomolar()/data.rhomolar_reducing; // [no units]
+        CoolPropDbl tau = data.T_reducing/HEOS.T(); // [no units]
+        CoolPropDbl delta = HEOS.rhomolar()/data.rhomolar_reducing; // [no units]
 
-        long double summer = 0;
+        CoolPropDbl summer = 0;
         for (unsigned int i = 0; i < n.size(); ++i){
             summer += n[i]*pow(delta, d[i])*pow(tau, t[i]);
         }
@@ -187,7 +187,7 @@ long double TransportRoutines::viscosity_initial_density_dependence_empirical(He
 
 static void visc_Helper(double Tbar, double rhobar, double *mubar_0, double *mubar_1)
 {
-    std::vector<std::vector<long double> > H(6,std::vector<long double>(7,0));
+    std::vector<std::vector<CoolPropDbl> > H(6,std::vector<CoolPropDbl>(7,0));
     double sum;
     int i,j;
 
@@ -243,7 +243,7 @@ static void visc_Helper(double Tbar, double rhobar, double *mubar_0, double *mub
     }
     *mubar_1=exp(rhobar*sum);
 }
-long double TransportRoutines::viscosity_water_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_water_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
     double x_mu=0.068,qc=1/1.9,qd=1/1.1,nu=0.630,gamma=1.239,zeta_0=0.13,LAMBDA_0=0.06,Tbar_R=1.5, pstar, Tstar, rhostar;
     double delta,tau,mubar_0,mubar_1,mubar_2,drhodp,drhodp_R,DeltaChibar,zeta,w,L,Y,psi_D,Tbar,rhobar;
@@ -295,45 +295,45 @@ long double TransportRoutines::viscosity_water_hardcoded(HelmholtzEOSMixtureBack
 
     return (mubar_0*mubar_1*mubar_2)/1e6;
 }
-long double TransportRoutines::viscosity_hydrogen_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_hydrogen_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
-    long double Tr = HEOS.T()/33.145, rhor = HEOS.keyed_output(CoolProp::iDmass)*0.011;
-    long double c[] = {0, 6.43449673e-6, 4.56334068e-2, 2.32797868e-1, 9.58326120e-1, 1.27941189e-1, 3.63576595e-1};
+    CoolPropDbl Tr = HEOS.T()/33.145, rhor = HEOS.keyed_output(CoolProp::iDmass)*0.011;
+    CoolPropDbl c[] = {0, 6.43449673e-6, 4.56334068e-2, 2.32797868e-1, 9.58326120e-1, 1.27941189e-1, 3.63576595e-1};
     return c[1]*pow(rhor,2)*exp(c[2]*Tr+c[3]/Tr+c[4]*pow(rhor,2)/(c[5]+Tr)+c[6]*pow(rhor,6));
 }
-long double TransportRoutines::viscosity_benzene_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_benzene_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
-    long double Tr = HEOS.T()/562.02, rhor = HEOS.rhomass()/304.792;
-    long double c[] = {-9.98945, 86.06260, 2.74872, 1.11130, -1.0, -134.1330, -352.473, 6.60989, 88.4174};
-    return 1e-6*pow(rhor,static_cast<long double>(2.0/3.0))*sqrt(Tr)*(c[0]*pow(rhor,2) + c[1]*rhor/(c[2]+c[3]*Tr+c[4]*rhor) + (c[5]*rhor+c[6]*pow(rhor,2))/(c[7]+c[8]*pow(rhor,2)));
+    CoolPropDbl Tr = HEOS.T()/562.02, rhor = HEOS.rhomass()/304.792;
+    CoolPropDbl c[] = {-9.98945, 86.06260, 2.74872, 1.11130, -1.0, -134.1330, -352.473, 6.60989, 88.4174};
+    return 1e-6*pow(rhor,static_cast<CoolPropDbl>(2.0/3.0))*sqrt(Tr)*(c[0]*pow(rhor,2) + c[1]*rhor/(c[2]+c[3]*Tr+c[4]*rhor) + (c[5]*rhor+c[6]*pow(rhor,2))/(c[7]+c[8]*pow(rhor,2)));
 }
-long double TransportRoutines::viscosity_hexane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_hexane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
 
-    long double Tr = HEOS.T()/507.82, rhor = HEOS.keyed_output(CoolProp::iDmass)/233.182;
+    CoolPropDbl Tr = HEOS.T()/507.82, rhor = HEOS.keyed_output(CoolProp::iDmass)/233.182;
 
     // Output is in Pa-s
     double c[] = {2.53402335/1e6, -9.724061002/1e6, 0.469437316, 158.5571631, 72.42916856/1e6, 10.60751253, 8.628373915, -6.61346441, -2.212724566};
-    return pow(rhor,static_cast<long double>(2.0/3.0))*sqrt(Tr)*(c[0]/Tr+c[1]/(c[2]+Tr+c[3]*rhor*rhor)+c[4]*(1+rhor)/(c[5]+c[6]*Tr+c[7]*rhor+rhor*rhor+c[8]*rhor*Tr));
+    return pow(rhor,static_cast<CoolPropDbl>(2.0/3.0))*sqrt(Tr)*(c[0]/Tr+c[1]/(c[2]+Tr+c[3]*rhor*rhor)+c[4]*(1+rhor)/(c[5]+c[6]*Tr+c[7]*rhor+rhor*rhor+c[8]*rhor*Tr));
 }
 
-long double TransportRoutines::viscosity_heptane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_heptane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
     /// From Michailidou-JPCRD-2014-Heptane
-    long double Tr = HEOS.T()/540.13, rhor = HEOS.rhomass()/232;
+    CoolPropDbl Tr = HEOS.T()/540.13, rhor = HEOS.rhomass()/232;
 
     // Output is in Pa-s
     double c[] = {0, 22.15000/1e6, -15.00870/1e6, 3.71791/1e6, 77.72818/1e6, 9.73449, 9.51900, -6.34076, -2.51909};
     return pow(rhor,2.0L/3.0L)*sqrt(Tr)*(c[1]*rhor+c[2]*pow(rhor,2)+c[3]*pow(rhor,3)+c[4]*rhor/(c[5]+c[6]*Tr+c[7]*rhor+rhor*rhor+c[8]*rhor*Tr));
 }
 
-long double TransportRoutines::viscosity_higher_order_friction_theory(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_higher_order_friction_theory(HelmholtzEOSMixtureBackend &HEOS)
 {
     if (HEOS.is_pure_or_pseudopure)
     {
         CoolProp::ViscosityFrictionTheoryData &F = HEOS.components[0]->transport.viscosity_higher_order.friction_theory;
 
-        long double tau = F.T_reduce/HEOS.T(), kii, krrr, kaaa, krr, kdrdr;
+        CoolPropDbl tau = F.T_reduce/HEOS.T(), kii, krrr, kaaa, krr, kdrdr;
 
         double psi1 = exp(tau)-F.c1;
         double psi2 = exp(pow(tau,2))-F.c2;
@@ -378,7 +378,7 @@ long double TransportRoutines::viscosity_higher_order_friction_theory(HelmholtzE
     }
 }
 
-long double TransportRoutines::viscosity_helium_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_helium_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
     double eta_0,eta_0_slash, eta_E_slash, B,C,D,ln_eta,x;
     //
@@ -390,7 +390,7 @@ long double TransportRoutines::viscosity_helium_hardcoded(HelmholtzEOSMixtureBac
     // Report is not clear on viscosity, referring to REFPROP source code for clarity
 
     // Correlation wants density in g/cm^3; kg/m^3 --> g/cm^3, divide by 1000
-    long double rho = HEOS.keyed_output(CoolProp::iDmass)/1000.0, T = HEOS.T();
+    CoolPropDbl rho = HEOS.keyed_output(CoolProp::iDmass)/1000.0, T = HEOS.T();
 
     if (T <= 300){
         x = log(T);
@@ -414,74 +414,74 @@ long double TransportRoutines::viscosity_helium_hardcoded(HelmholtzEOSMixtureBac
     else
     {
         ln_eta = eta_0_slash + eta_E_slash;
-        eta_0 = 196*pow(T,static_cast<long double>(0.71938))*exp(12.451/T-295.67/T/T-4.1249);
+        eta_0 = 196*pow(T,static_cast<CoolPropDbl>(0.71938))*exp(12.451/T-295.67/T/T-4.1249);
         // Correlation yields viscosity in micro g/(cm-s); to get Pa-s, divide by 10 to get micro Pa-s, then another 1e6 to get Pa-s
         return (exp(ln_eta)+eta_0-exp(eta_0_slash))/10.0/1e6;
     }
 }
 
-long double TransportRoutines::viscosity_methanol_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_methanol_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
-    long double B_eta, C_eta,
+    CoolPropDbl B_eta, C_eta,
                 epsilon_over_k = 577.87, /* [K]*/
                 sigma0 = 0.3408e-9, /* [m] */
                 delta = 0.4575, /* NOT the reduced density, that is rhor here*/
                 N_A = 6.02214129e23,
                 M = 32.04216, /* kg/kmol */
                 T = HEOS.T();
-    long double rhomolar = HEOS.rhomolar();
+    CoolPropDbl rhomolar = HEOS.rhomolar();
     
-    long double B_eta_star, C_eta_star;
-    long double Tstar = T/epsilon_over_k; // [no units]
-    long double rhor = HEOS.rhomass()/273;
-    long double Tr = T/512.6;
+    CoolPropDbl B_eta_star, C_eta_star;
+    CoolPropDbl Tstar = T/epsilon_over_k; // [no units]
+    CoolPropDbl rhor = HEOS.rhomass()/273;
+    CoolPropDbl Tr = T/512.6;
 
     // Rainwater-Friend initial density terms
     { // Scoped here so that we can re-use the b variable
-        long double b[9] = {-19.572881, 219.73999, -1015.3226, 2471.01251, -3375.1717, 2491.6597, -787.26086, 14.085455, -0.34664158};
-        long double t[9] = {0, -0.25, -0.5, -0.75, -1.0, -1.25, -1.5, -2.5, -5.5};
-        long double summer = 0;
+        CoolPropDbl b[9] = {-19.572881, 219.73999, -1015.3226, 2471.01251, -3375.1717, 2491.6597, -787.26086, 14.085455, -0.34664158};
+        CoolPropDbl t[9] = {0, -0.25, -0.5, -0.75, -1.0, -1.25, -1.5, -2.5, -5.5};
+        CoolPropDbl summer = 0;
         for (unsigned int i = 0; i < 9; ++i){
             summer += b[i]*pow(Tstar, t[i]);
         }
         B_eta_star = summer; // [no units]
         B_eta = N_A*pow(sigma0, 3)*B_eta_star; // [m^3/mol]
         
-        long double c[2] = {1.86222085e-3, 9.990338};
-        C_eta_star = c[0]*pow(Tstar, 3)*exp(c[1]*pow(Tstar,static_cast<long double>(-0.5))); // [no units]
+        CoolPropDbl c[2] = {1.86222085e-3, 9.990338};
+        C_eta_star = c[0]*pow(Tstar, 3)*exp(c[1]*pow(Tstar,static_cast<CoolPropDbl>(-0.5))); // [no units]
         C_eta = pow(N_A*pow(sigma0, 3), 2)*C_eta_star; // [m^6/mol^2]
     }
     
-    long double eta_g = 1 + B_eta*rhomolar + C_eta*rhomolar*rhomolar;
-    long double a[13] = {1.16145, -0.14874, 0.52487, -0.77320, 2.16178, -2.43787, 0.95976e-3, 0.10225, -0.97346, 0.10657, -0.34528, -0.44557, -2.58055};
-    long double d[7] = {-1.181909, 0.5031030, -0.6268461, 0.5169312, -0.2351349, 5.3980235e-2, -4.9069617e-3};
-    long double e[10] = {0, 4.018368, -4.239180, 2.245110, -0.5750698, 2.3021026e-2, 2.5696775e-2, -6.8372749e-3, 7.2707189e-4, -2.9255711e-5}; 
-
-    long double OMEGA_22_star_LJ = a[0]*pow(Tstar,a[1])+a[2]*exp(a[3]*Tstar)+a[4]*exp(a[5]*Tstar);
-    long double OMEGA_22_star_delta = a[7]*pow(Tstar,a[8]) + a[9]*exp(a[10]*Tstar) + a[11]*exp(a[12]*Tstar);
-    long double OMEGA_22_star_SM = OMEGA_22_star_LJ*(1+pow(delta,2)/(1+a[6]*pow(delta,6))*OMEGA_22_star_delta);
-    long double eta_0 = 2.66957e-26*sqrt(M*T)/(pow(sigma0,2)*OMEGA_22_star_SM);
+    CoolPropDbl eta_g = 1 + B_eta*rhomolar + C_eta*rhomolar*rhomolar;
+    CoolPropDbl a[13] = {1.16145, -0.14874, 0.52487, -0.77320, 2.16178, -2.43787, 0.95976e-3, 0.10225, -0.97346, 0.10657, -0.34528, -0.44557, -2.58055};
+    CoolPropDbl d[7] = {-1.181909, 0.5031030, -0.6268461, 0.5169312, -0.2351349, 5.3980235e-2, -4.9069617e-3};
+    CoolPropDbl e[10] = {0, 4.018368, -4.239180, 2.245110, -0.5750698, 2.3021026e-2, 2.5696775e-2, -6.8372749e-3, 7.2707189e-4, -2.9255711e-5}; 
+
+    CoolPropDbl OMEGA_22_star_LJ = a[0]*pow(Tstar,a[1])+a[2]*exp(a[3]*Tstar)+a[4]*exp(a[5]*Tstar);
+    CoolPropDbl OMEGA_22_star_delta = a[7]*pow(Tstar,a[8]) + a[9]*exp(a[10]*Tstar) + a[11]*exp(a[12]*Tstar);
+    CoolPropDbl OMEGA_22_star_SM = OMEGA_22_star_LJ*(1+pow(delta,2)/(1+a[6]*pow(delta,6))*OMEGA_22_star_delta);
+    CoolPropDbl eta_0 = 2.66957e-26*sqrt(M*T)/(pow(sigma0,2)*OMEGA_22_star_SM);
     
-    long double summerd = 0;
+    CoolPropDbl summerd = 0;
     for (int i = 0; i < 7; ++i){
         summerd += d[i]/pow(Tr, i);
     }
     for (int j = 1; j < 10; ++j){
         summerd += e[j]*pow(rhor, j);
     }
-    long double sigmac = 0.7193422e-9; // [m]
-    long double sigma_HS = summerd*sigmac; // [m]
-    long double b = 2*M_PI*N_A*pow(sigma_HS,3)/3; // [m^3/mol]
-    long double zeta = b*rhomolar/4; // [-]
-    long double g_sigma_HS = (1 - 0.5*zeta)/pow(1 - zeta, 3); // [-]
-    long double eta_E = 1/g_sigma_HS + 0.8*b*rhomolar + 0.761*g_sigma_HS*pow(b*rhomolar,2); // [-]
+    CoolPropDbl sigmac = 0.7193422e-9; // [m]
+    CoolPropDbl sigma_HS = summerd*sigmac; // [m]
+    CoolPropDbl b = 2*M_PI*N_A*pow(sigma_HS,3)/3; // [m^3/mol]
+    CoolPropDbl zeta = b*rhomolar/4; // [-]
+    CoolPropDbl g_sigma_HS = (1 - 0.5*zeta)/pow(1 - zeta, 3); // [-]
+    CoolPropDbl eta_E = 1/g_sigma_HS + 0.8*b*rhomolar + 0.761*g_sigma_HS*pow(b*rhomolar,2); // [-]
     
-    long double f = 1/(1+exp(5*(rhor-1)));
+    CoolPropDbl f = 1/(1+exp(5*(rhor-1)));
     return eta_0*(f*eta_g + (1-f)*eta_E);
 
 }
 
-long double TransportRoutines::viscosity_R23_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_R23_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
     double C1 = 1.3163, //
            C2 = 0.1832,
@@ -511,7 +511,7 @@ long double TransportRoutines::viscosity_R23_hardcoded(HelmholtzEOSMixtureBacken
     return (pow((rhoL-rhobar)/rhoL,C1)*eta_DG+pow(rhobar/rhoL,C1)*eta_L+DELTAeta_c)/1e6;
 }
 
-long double TransportRoutines::viscosity_dilute_ethane(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_ethane(HelmholtzEOSMixtureBackend &HEOS)
 {
     double C[] = {0, -3.0328138281, 16.918880086, -37.189364917, 41.288861858, -24.615921140, 8.9488430959, -1.8739245042, 0.20966101390, -9.6570437074e-3};
     double OMEGA_2_2 = 0, e_k = 245, Tstar;
@@ -524,14 +524,14 @@ long double TransportRoutines::viscosity_dilute_ethane(HelmholtzEOSMixtureBacken
 
     return 12.0085*sqrt(Tstar)*OMEGA_2_2/1e6; //[Pa-s]
 }
-long double TransportRoutines::viscosity_dilute_cyclohexane(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_dilute_cyclohexane(HelmholtzEOSMixtureBackend &HEOS)
 {
     // From Tariq, JPCRD, 2014
-    long double T = HEOS.T();
-    long double S_eta = exp(-1.5093 + 364.87/T - 39537/pow(T, 2)); //[nm^2]
+    CoolPropDbl T = HEOS.T();
+    CoolPropDbl S_eta = exp(-1.5093 + 364.87/T - 39537/pow(T, 2)); //[nm^2]
     return 0.19592*sqrt(T)/S_eta/1e6; //[Pa-s]
 }
-long double TransportRoutines::viscosity_ethane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
+CoolPropDbl TransportRoutines::viscosity_ethane_higher_order_hardcoded(HelmholtzEOSMixtureBackend &HEOS)
 {
     double r[] = {0,1,1,2,2,2,3,3,4,4,1,1};
     double s[] = {0,0,1,0,1,1.5,0,2,0,1,0,1};
@@ -548,13 +548,13 @@ long double TransportRoutines::viscosity_ethane_higher_order_hardcoded(Helmholtz
     return 15.977*sum1/(1+sum2)/1e6;
 }
 
-long double TransportRoutines::conductivity_dilute_ratio_polynomials(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_dilute_ratio_polynomials(HelmholtzEOSMixtureBackend &HEOS){
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ConductivityDiluteRatioPolynomialsData &data = HEOS.components[0]->transport.conductivity_dilute.ratio_polynomials;
 
-        long double summer1 = 0, summer2 = 0, Tr = HEOS.T()/data.T_reducing;
+        CoolPropDbl summer1 = 0, summer2 = 0, Tr = HEOS.T()/data.T_reducing;
         for (std::size_t i = 0; i < data.A.size(); ++i)
         {
             summer1 += data.A[i]*pow(Tr, data.n[i]);
@@ -571,13 +571,13 @@ long double TransportRoutines::conductivity_dilute_ratio_polynomials(HelmholtzEO
     }
 };
 
-long double TransportRoutines::conductivity_residual_polynomial(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_residual_polynomial(HelmholtzEOSMixtureBackend &HEOS){
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ConductivityResidualPolynomialData &data = HEOS.components[0]->transport.conductivity_residual.polynomials;
 
-        long double summer = 0, tau = data.T_reducing/HEOS.T(), delta = HEOS.keyed_output(CoolProp::iDmass)/data.rhomass_reducing;
+        CoolPropDbl summer = 0, tau = data.T_reducing/HEOS.T(), delta = HEOS.keyed_output(CoolProp::iDmass)/data.rhomass_reducing;
         for (std::size_t i = 0; i < data.B.size(); ++i)
         {
             summer += data.B[i]*pow(tau, data.t[i])*pow(delta, data.d[i]);
@@ -589,13 +589,13 @@ long double TransportRoutines::conductivity_residual_polynomial(HelmholtzEOSMixt
     }
 };
 
-long double TransportRoutines::conductivity_residual_polynomial_and_exponential(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_residual_polynomial_and_exponential(HelmholtzEOSMixtureBackend &HEOS){
     if (HEOS.is_pure_or_pseudopure)
     {
         // Retrieve values from the state class
         CoolProp::ConductivityResidualPolynomialAndExponentialData &data = HEOS.components[0]->transport.conductivity_residual.polynomial_and_exponential;
 
-        long double summer = 0, tau = HEOS.tau(), delta = HEOS.delta();
+        CoolPropDbl summer = 0, tau = HEOS.tau(), delta = HEOS.delta();
         for (std::size_t i = 0; i < data.A.size(); ++i)
         {
             summer += data.A[i]*pow(tau, data.t[i])*pow(delta, data.d[i])*exp(-data.gamma[i]*pow(delta,data.l[i]));
@@ -607,7 +607,7 @@ long double TransportRoutines::conductivity_residual_polynomial_and_exponential(
     }
 };
 
-long double TransportRoutines::conductivity_critical_simplified_Olchowy_Sengers(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_critical_simplified_Olchowy_Sengers(HelmholtzEOSMixtureBackend &HEOS){
     if (HEOS.is_pure_or_pseudopure)
     {
         // Olchowy and Sengers cross-over term
@@ -666,26 +666,26 @@ long double TransportRoutines::conductivity_critical_simplified_Olchowy_Sengers(
     }
 };
 
-long double TransportRoutines::conductivity_critical_hardcoded_R123(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_critical_hardcoded_R123(HelmholtzEOSMixtureBackend &HEOS){
     double a13 = 0.486742e-2, a14 = -100, a15 = -7.08535;
     return a13*exp(a14*pow(HEOS.tau()-1,4)+a15*pow(HEOS.delta()-1,2));
 };
 
-long double TransportRoutines::conductivity_critical_hardcoded_CO2_ScalabrinJPCRD2006(HelmholtzEOSMixtureBackend &HEOS){
-    long double nc = 0.775547504e-3*4.81384, Tr = HEOS.T()/304.1282, alpha, rhor = HEOS.keyed_output(iDmass)/467.6;
-    static long double a[] = {0.0, 3.0, 6.70697, 0.94604, 0.30, 0.30, 0.39751, 0.33791, 0.77963, 0.79857, 0.90, 0.02, 0.20};
+CoolPropDbl TransportRoutines::conductivity_critical_hardcoded_CO2_ScalabrinJPCRD2006(HelmholtzEOSMixtureBackend &HEOS){
+    CoolPropDbl nc = 0.775547504e-3*4.81384, Tr = HEOS.T()/304.1282, alpha, rhor = HEOS.keyed_output(iDmass)/467.6;
+    static CoolPropDbl a[] = {0.0, 3.0, 6.70697, 0.94604, 0.30, 0.30, 0.39751, 0.33791, 0.77963, 0.79857, 0.90, 0.02, 0.20};
 
     // Equation 6 from Scalabrin
     alpha = 1-a[10]*acosh(1+a[11]*pow(pow(1-Tr,2),a[12]));
 
     // Equation 5 from Scalabrin
-    long double numer = rhor*exp(-pow(rhor,a[1])/a[1]-pow(a[2]*(Tr-1),2)-pow(a[3]*(rhor-1),2));
-    long double braced = (1-1/Tr)+a[4]*pow(pow(rhor-1,2),0.5/a[5]);
-    long double denom = pow(pow(pow(braced, 2), a[6]) + pow(pow(a[7]*(rhor-alpha), 2), a[8]),a[9]);
+    CoolPropDbl numer = rhor*exp(-pow(rhor,a[1])/a[1]-pow(a[2]*(Tr-1),2)-pow(a[3]*(rhor-1),2));
+    CoolPropDbl braced = (1-1/Tr)+a[4]*pow(pow(rhor-1,2),0.5/a[5]);
+    CoolPropDbl denom = pow(pow(pow(braced, 2), a[6]) + pow(pow(a[7]*(rhor-alpha), 2), a[8]),a[9]);
     return nc*numer/denom;
 }
 
-long double TransportRoutines::conductivity_dilute_hardcoded_CO2(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_dilute_hardcoded_CO2(HelmholtzEOSMixtureBackend &HEOS){
 
     double e_k = 251.196, Tstar;
     double b[] = {0.4226159, 0.6280115, -0.5387661, 0.6735941, 0, 0, -0.4362677, 0.2255388};
@@ -717,7 +717,7 @@ long double TransportRoutines::conductivity_dilute_hardcoded_CO2(HelmholtzEOSMix
     return lambda_0;
 }
 
-long double TransportRoutines::conductivity_dilute_hardcoded_ethane(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_dilute_hardcoded_ethane(HelmholtzEOSMixtureBackend &HEOS){
 
     double e_k = 245.0;
     double tau = 305.33/HEOS.T(), Tstar = HEOS.T()/e_k;
@@ -727,7 +727,7 @@ long double TransportRoutines::conductivity_dilute_hardcoded_ethane(HelmholtzEOS
     return lambda_0;
 }
 
-long double TransportRoutines::conductivity_dilute_eta0_and_poly(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_dilute_eta0_and_poly(HelmholtzEOSMixtureBackend &HEOS){
 
     if (HEOS.is_pure_or_pseudopure)
     {
@@ -736,7 +736,7 @@ long double TransportRoutines::conductivity_dilute_eta0_and_poly(HelmholtzEOSMix
         double eta0_uPas = HEOS.calc_viscosity_dilute()*1e6; // [uPa-s]
         double summer = E.A[0]*eta0_uPas;
         for (std::size_t i=1; i < E.A.size(); ++i)
-            summer += E.A[i]*pow(static_cast<long double>(HEOS.tau()), E.t[i]);
+            summer += E.A[i]*pow(static_cast<CoolPropDbl>(HEOS.tau()), E.t[i]);
         return summer;
     }
     else{
@@ -744,7 +744,7 @@ long double TransportRoutines::conductivity_dilute_eta0_and_poly(HelmholtzEOSMix
     }
 }
 
-long double TransportRoutines::conductivity_hardcoded_water(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_hardcoded_water(HelmholtzEOSMixtureBackend &HEOS){
 
     double L[5][6] = {{1.60397357,-0.646013523,0.111443906,0.102997357,-0.0504123634,0.00609859258},
                 {2.33771842,-2.78843778,1.53616167,-0.463045512,0.0832827019,-0.00719201245},
@@ -803,7 +803,7 @@ long double TransportRoutines::conductivity_hardcoded_water(HelmholtzEOSMixtureB
     return (lambdabar_0*lambdabar_1+lambdabar_2)*lambdastar;
 }
 
-long double TransportRoutines::conductivity_hardcoded_R23(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_hardcoded_R23(HelmholtzEOSMixtureBackend &HEOS){
 
     double B1 = -2.5370, // [mW/m/K]
            B2 = 0.05366, // [mW/m/K^2]
@@ -830,7 +830,7 @@ long double TransportRoutines::conductivity_hardcoded_R23(HelmholtzEOSMixtureBac
     return (pow((rhoL-rhobar)/rhoL,C1)*lambda_DG+pow(rhobar/rhoL,C1)*lambda_L+DELTAlambda_c)/1e3;
 }
 
-long double TransportRoutines::conductivity_critical_hardcoded_ammonia(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_critical_hardcoded_ammonia(HelmholtzEOSMixtureBackend &HEOS){
 
     /*
     From "Thermal Conductivity of Ammonia in a Large
@@ -864,7 +864,7 @@ long double TransportRoutines::conductivity_critical_hardcoded_ammonia(Helmholtz
     return DELTA_lambda;
 }
 
-long double TransportRoutines::conductivity_hardcoded_helium(HelmholtzEOSMixtureBackend &HEOS){
+CoolPropDbl TransportRoutines::conductivity_hardcoded_helium(HelmholtzEOSMixtureBackend &HEOS){
     /*
     What an incredibly annoying formulation!  Implied coefficients?? Not cool.
     */
@@ -932,20 +932,20 @@ long double TransportRoutines::conductivity_hardcoded_helium(HelmholtzEOSMixture
     return lambda_0+lambda_e+lambda_c;
 }
 
-void TransportRoutines::conformal_state_solver(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference, long double &T0, long double &rhomolar0)
+void TransportRoutines::conformal_state_solver(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference, CoolPropDbl &T0, CoolPropDbl &rhomolar0)
 {
     int iter = 0;
     double resid = 9e30, resid_old = 9e30;
-    long double alphar = HEOS.alphar();
-    long double Z = HEOS.keyed_output(iZ);
+    CoolPropDbl alphar = HEOS.alphar();
+    CoolPropDbl Z = HEOS.keyed_output(iZ);
     
     Eigen::Vector2d r;
     Eigen::Matrix2d J;
     // Update the reference fluid with the conformal state
     HEOS_Reference.update_DmolarT_direct(rhomolar0, T0);
     do{
-        long double dtau_dT = -HEOS_Reference.T_critical()/(T0*T0);
-        long double ddelta_drho = 1/HEOS_Reference.rhomolar_critical();
+        CoolPropDbl dtau_dT = -HEOS_Reference.T_critical()/(T0*T0);
+        CoolPropDbl ddelta_drho = 1/HEOS_Reference.rhomolar_critical();
         // Independent variables are T0 and rhomolar0, residuals are matching alphar and Z
         r(0) = HEOS_Reference.alphar() - alphar;
         r(1) = HEOS_Reference.keyed_output(iZ) - Z;
@@ -993,10 +993,10 @@ void TransportRoutines::conformal_state_solver(HelmholtzEOSMixtureBackend &HEOS,
     while(std::abs(resid) > 1e-9);
 }
 
-long double TransportRoutines::viscosity_ECS(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference)
+CoolPropDbl TransportRoutines::viscosity_ECS(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference)
 {
     // Collect some parameters
-    long double M = HEOS.molar_mass(),
+    CoolPropDbl M = HEOS.molar_mass(),
                 M0 = HEOS_Reference.molar_mass(),
                 Tc = HEOS.T_critical(),
                 Tc0 = HEOS_Reference.T_critical(),
@@ -1013,21 +1013,21 @@ long double TransportRoutines::viscosity_ECS(HelmholtzEOSMixtureBackend &HEOS, H
     }
 
     // The dilute gas portion for the fluid of interest [Pa-s]
-    long double eta_dilute = viscosity_dilute_kinetic_theory(HEOS);
+    CoolPropDbl eta_dilute = viscosity_dilute_kinetic_theory(HEOS);
 
     // ************************************
     // Start with a guess for theta and phi
     // ************************************
-    long double theta = 1;
-    long double phi = 1;
+    CoolPropDbl theta = 1;
+    CoolPropDbl phi = 1;
 
     // The equivalent substance reducing ratios
-    long double f = Tc/Tc0*theta;
-    long double h = rhocmolar0/rhocmolar*phi; // Must be the ratio of MOLAR densities!!
+    CoolPropDbl f = Tc/Tc0*theta;
+    CoolPropDbl h = rhocmolar0/rhocmolar*phi; // Must be the ratio of MOLAR densities!!
 
     // To be solved for
-    long double T0 = HEOS.T()/f;
-    long double rhomolar0 = HEOS.rhomolar()*h;
+    CoolPropDbl T0 = HEOS.T()/f;
+    CoolPropDbl rhomolar0 = HEOS.rhomolar()*h;
     
     // **************************
     // Solver for conformal state
@@ -1050,21 +1050,21 @@ long double TransportRoutines::viscosity_ECS(HelmholtzEOSMixtureBackend &HEOS, H
     // **********************
     
     // The reference fluid's contribution to the viscosity [Pa-s]
-    long double eta_resid = HEOS_Reference.calc_viscosity_background();
+    CoolPropDbl eta_resid = HEOS_Reference.calc_viscosity_background();
 
     // The F factor
-    long double F_eta = sqrt(f)*pow(h, -2.0L/3.0L)*sqrt(M/M0);
+    CoolPropDbl F_eta = sqrt(f)*pow(h, -2.0L/3.0L)*sqrt(M/M0);
 
     // The total viscosity considering the contributions of the fluid of interest and the reference fluid [Pa-s]
-    long double eta = eta_dilute + eta_resid*F_eta;
+    CoolPropDbl eta = eta_dilute + eta_resid*F_eta;
 
     return eta;
 }
 
-long double TransportRoutines::conductivity_ECS(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference)
+CoolPropDbl TransportRoutines::conductivity_ECS(HelmholtzEOSMixtureBackend &HEOS, HelmholtzEOSMixtureBackend &HEOS_Reference)
 {
     // Collect some parameters
-    long double M = HEOS.molar_mass(),
+    CoolPropDbl M = HEOS.molar_mass(),
                 M_kmol = M*1000,
                 M0 = HEOS_Reference.molar_mass(),
                 Tc = HEOS.T_critical(),
@@ -1091,31 +1091,31 @@ long double TransportRoutines::conductivity_ECS(HelmholtzEOSMixtureBackend &HEOS
     }
 
     // The dilute gas density for the fluid of interest [uPa-s]
-    long double eta_dilute = viscosity_dilute_kinetic_theory(HEOS)*1e6;
+    CoolPropDbl eta_dilute = viscosity_dilute_kinetic_theory(HEOS)*1e6;
 
     // The mass specific ideal gas constant-pressure specific heat [J/kg/K]
-    long double cp0 = HEOS.calc_cpmolar_idealgas()/HEOS.molar_mass();
+    CoolPropDbl cp0 = HEOS.calc_cpmolar_idealgas()/HEOS.molar_mass();
 
     // The internal contribution to the thermal conductivity [W/m/K]
-    long double lambda_int = fint*eta_dilute*(cp0 - 2.5*R)/1e3;
+    CoolPropDbl lambda_int = fint*eta_dilute*(cp0 - 2.5*R)/1e3;
 
     // The dilute gas contribution to the thermal conductivity [W/m/K]
-    long double lambda_dilute = 15.0e-3/4.0*R_kJkgK*eta_dilute;
+    CoolPropDbl lambda_dilute = 15.0e-3/4.0*R_kJkgK*eta_dilute;
 
     // ************************************
     // Start with a guess for theta and phi
     // ************************************
     
-    long double theta = 1;
-    long double phi = 1;
+    CoolPropDbl theta = 1;
+    CoolPropDbl phi = 1;
 
     // The equivalent substance reducing ratios
-    long double f = Tc/Tc0*theta;
-    long double h = rhocmolar0/rhocmolar*phi; // Must be the ratio of MOLAR densities!!
+    CoolPropDbl f = Tc/Tc0*theta;
+    CoolPropDbl h = rhocmolar0/rhocmolar*phi; // Must be the ratio of MOLAR densities!!
 
     // Initial values for the conformal state
-    long double T0 = HEOS.T()/f;
-    long double rhomolar0 = HEOS.rhomolar()*h;
+    CoolPropDbl T0 = HEOS.T()/f;
+    CoolPropDbl rhomolar0 = HEOS.rhomolar()*h;
     
     // **************************
     // Solver for conformal state
@@ -1131,16 +1131,16 @@ long double TransportRoutines::conductivity_ECS(HelmholtzEOSMixtureBackend &HEOS
     h = rhomolar0/HEOS.rhomolar(); // Must be the ratio of MOLAR densities!!
 
     // The reference fluid's contribution to the conductivity [W/m/K]
-    long double lambda_resid = HEOS_Reference.calc_conductivity_background();
+    CoolPropDbl lambda_resid = HEOS_Reference.calc_conductivity_background();
 
     // The F factor
-    long double F_lambda = sqrt(f)*pow(h, static_cast<long double>(-2.0/3.0))*sqrt(M0/M);
+    CoolPropDbl F_lambda = sqrt(f)*pow(h, static_cast<CoolPropDbl>(-2.0/3.0))*sqrt(M0/M);
 
     // The critical contribution from the fluid of interest [W/m/K]
-    long double lambda_critical = conductivity_critical_simplified_Olchowy_Sengers(HEOS);
+    CoolPropDbl lambda_critical = conductivity_critical_simplified_Olchowy_Sengers(HEOS);
 
     // The total thermal conductivity considering the contributions of the fluid of interest and the reference fluid [Pa-s]
-    long double lambda = lambda_int + lambda_dilute + lambda_resid*F_lambda + lambda_critical;
+    CoolPropDbl lambda = lambda_int + lambda_dilute + lambda_resid*F_lambda + lambda_critical;
 
     return lambda;
 }
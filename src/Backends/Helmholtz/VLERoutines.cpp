@@ -6,20 +6,20 @@
 
 namespace CoolProp {
     
-void SaturationSolvers::saturation_critical(HelmholtzEOSMixtureBackend &HEOS, parameters ykey, long double y){
+void SaturationSolvers::saturation_critical(HelmholtzEOSMixtureBackend &HEOS, parameters ykey, CoolPropDbl y){
     
     class inner_resid : public FuncWrapper1D{
         public:
         HelmholtzEOSMixtureBackend *HEOS;
-        long double T, desired_p, rhomolar_liq, calc_p, rhomolar_crit;
+        CoolPropDbl T, desired_p, rhomolar_liq, calc_p, rhomolar_crit;
         
-        inner_resid(HelmholtzEOSMixtureBackend *HEOS, long double T, long double desired_p)
+        inner_resid(HelmholtzEOSMixtureBackend *HEOS, CoolPropDbl T, CoolPropDbl desired_p)
             : HEOS(HEOS), T(T), desired_p(desired_p){};
         double call(double rhomolar_liq){
             this->rhomolar_liq = rhomolar_liq;
             HEOS->SatL->update(DmolarT_INPUTS, rhomolar_liq, T);
             calc_p = HEOS->SatL->p();
-            std::cout << format("inner p: %0.16Lg; res: %0.16Lg", calc_p, calc_p - desired_p) << std::endl;
+            std::cout << format("inner p: %0.16g; res: %0.16g", static_cast<double>(calc_p), static_cast<double>(calc_p - desired_p)) << std::endl;
             return calc_p - desired_p;
         }
     };
@@ -32,11 +32,11 @@ void SaturationSolvers::saturation_critical(HelmholtzEOSMixtureBackend &HEOS, pa
 
         HelmholtzEOSMixtureBackend *HEOS;
         parameters ykey;
-        long double y;
-        long double r, T, rhomolar_liq, rhomolar_vap, value, p, gL, gV, rhomolar_crit;
+        CoolPropDbl y;
+        CoolPropDbl r, T, rhomolar_liq, rhomolar_vap, value, p, gL, gV, rhomolar_crit;
         int other;
 
-        outer_resid(HelmholtzEOSMixtureBackend &HEOS, CoolProp::parameters ykey, long double y) 
+        outer_resid(HelmholtzEOSMixtureBackend &HEOS, CoolProp::parameters ykey, CoolPropDbl y) 
             : HEOS(&HEOS), ykey(ykey), y(y){
                 rhomolar_crit = HEOS.rhomolar_critical();
             };
@@ -48,7 +48,7 @@ void SaturationSolvers::saturation_critical(HelmholtzEOSMixtureBackend &HEOS, pa
                 T = y;
                 HEOS->SatV->update(DmolarT_INPUTS, rhomolar_vap, y);
                 this->p = HEOS->SatV->p();
-                std::cout << format("outer p: %0.16Lg",this->p) << std::endl;
+                std::cout << format("outer p: %0.16g",static_cast<double>(this->p)) << std::endl;
                 inner_resid inner(HEOS, T, p);
                 std::string errstr2;
                 rhomolar_liq = Brent(inner, rhomolar_crit*1.5, rhomolar_crit*(1+1e-8), LDBL_EPSILON, 1e-10, 100, errstr2);
@@ -74,7 +74,7 @@ void SaturationSolvers::saturation_critical(HelmholtzEOSMixtureBackend &HEOS, pa
     Brent(&resid, rhomolar_crit*(1-1e-8), rhomolar_crit*0.5, DBL_EPSILON, 1e-9, 20, errstr);
 }
 
-void SaturationSolvers::saturation_T_pure_1D_P(HelmholtzEOSMixtureBackend &HEOS, long double T, saturation_T_pure_options &options)
+void SaturationSolvers::saturation_T_pure_1D_P(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl T, saturation_T_pure_options &options)
 {
     
     // Define the residual to be driven to zero
@@ -83,10 +83,10 @@ void SaturationSolvers::saturation_T_pure_1D_P(HelmholtzEOSMixtureBackend &HEOS,
     public:
 
         HelmholtzEOSMixtureBackend *HEOS;
-        long double r, T, rhomolar_liq, rhomolar_vap, value, p, gL, gV;
+        CoolPropDbl r, T, rhomolar_liq, rhomolar_vap, value, p, gL, gV;
         int other;
 
-        solver_resid(HelmholtzEOSMixtureBackend &HEOS, long double T, long double rhomolar_liq_guess, long double rhomolar_vap_guess) 
+        solver_resid(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl T, CoolPropDbl rhomolar_liq_guess, CoolPropDbl rhomolar_vap_guess) 
             : HEOS(&HEOS), T(T), rhomolar_liq(rhomolar_liq_guess), rhomolar_vap(rhomolar_vap_guess){};
         double call(double p){
             this->p = p;
@@ -106,22 +106,22 @@ void SaturationSolvers::saturation_T_pure_1D_P(HelmholtzEOSMixtureBackend &HEOS,
     };
     solver_resid resid(HEOS, T, options.rhoL, options.rhoV);
     
-    if (!ValidNumber(options.p)){throw ValueError(format("options.p is not valid in saturation_T_pure_1D_P for T = %Lg",T));};
-    if (!ValidNumber(options.rhoL)){throw ValueError(format("options.rhoL is not valid in saturation_T_pure_1D_P for T = %Lg",T));};
-    if (!ValidNumber(options.rhoV)){throw ValueError(format("options.rhoV is not valid in saturation_T_pure_1D_P for T = %Lg",T));};
+    if (!ValidNumber(options.p)){throw ValueError(format("options.p is not valid in saturation_T_pure_1D_P for T = %g",static_cast<double>(T)));};
+    if (!ValidNumber(options.rhoL)){throw ValueError(format("options.rhoL is not valid in saturation_T_pure_1D_P for T = %g",static_cast<double>(T)));};
+    if (!ValidNumber(options.rhoV)){throw ValueError(format("options.rhoV is not valid in saturation_T_pure_1D_P for T = %g",static_cast<double>(T)));};
     
     std::string errstr;
     try{
         Secant(resid, options.p, options.p*1.1, 1e-10, 100, errstr);
     }
     catch(std::exception &){
-        long double pmax = std::min(options.p*1.03, static_cast<long double>(HEOS.p_critical()+1e-6));
-        long double pmin = std::max(options.p*0.97, static_cast<long double>(HEOS.p_triple()-1e-6));
+        CoolPropDbl pmax = std::min(options.p*1.03, static_cast<CoolPropDbl>(HEOS.p_critical()+1e-6));
+        CoolPropDbl pmin = std::max(options.p*0.97, static_cast<CoolPropDbl>(HEOS.p_triple()-1e-6));
         Brent(resid, pmin, pmax, LDBL_EPSILON, 1e-8, 100, errstr);
     }
 }
 
-void SaturationSolvers::saturation_P_pure_1D_T(HelmholtzEOSMixtureBackend &HEOS, long double p, saturation_PHSU_pure_options &options){
+void SaturationSolvers::saturation_P_pure_1D_T(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl p, saturation_PHSU_pure_options &options){
     
     // Define the residual to be driven to zero
     class solver_resid : public FuncWrapper1D
@@ -129,10 +129,10 @@ void SaturationSolvers::saturation_P_pure_1D_T(HelmholtzEOSMixtureBackend &HEOS,
     public:
 
         HelmholtzEOSMixtureBackend *HEOS;
-        long double r, p, rhomolar_liq, rhomolar_vap, value, T, gL, gV;
+        CoolPropDbl r, p, rhomolar_liq, rhomolar_vap, value, T, gL, gV;
         int other;
 
-        solver_resid(HelmholtzEOSMixtureBackend &HEOS, long double p, long double rhomolar_liq_guess, long double rhomolar_vap_guess) 
+        solver_resid(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl p, CoolPropDbl rhomolar_liq_guess, CoolPropDbl rhomolar_vap_guess) 
             : HEOS(&HEOS), p(p), rhomolar_liq(rhomolar_liq_guess), rhomolar_vap(rhomolar_vap_guess){};
         double call(double T){
             this->T = T;
@@ -157,12 +157,12 @@ void SaturationSolvers::saturation_P_pure_1D_T(HelmholtzEOSMixtureBackend &HEOS,
     if (!ValidNumber(options.rhoV)){throw ValueError("options.rhoV is not valid in saturation_P_pure_1D_T");};
     
     std::string errstr;
-    long double Tmax = std::min(options.T + 2, static_cast<long double>(HEOS.T_critical()-1e-6));
-    long double Tmin = std::max(options.T - 2, static_cast<long double>(HEOS.Ttriple()+1e-6));
+    CoolPropDbl Tmax = std::min(options.T + 2, static_cast<CoolPropDbl>(HEOS.T_critical()-1e-6));
+    CoolPropDbl Tmin = std::max(options.T - 2, static_cast<CoolPropDbl>(HEOS.Ttriple()+1e-6));
     Brent(resid, Tmin, Tmax, LDBL_EPSILON, 1e-11, 100, errstr);
 }
     
-void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, long double specified_value, saturation_PHSU_pure_options &options)
+void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl specified_value, saturation_PHSU_pure_options &options)
 {
     /*
     This function is inspired by the method of Akasaka:
@@ -173,8 +173,8 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
 
     Ancillary equations are used to get a sensible starting point
     */
-    std::vector<long double> negativer(3,_HUGE), v;
-    std::vector<std::vector<long double> > J(3, std::vector<long double>(3,_HUGE));
+    std::vector<CoolPropDbl> negativer(3,_HUGE), v;
+    std::vector<std::vector<CoolPropDbl> > J(3, std::vector<CoolPropDbl>(3,_HUGE));
 
     HEOS.calc_reducing_state();
     const SimpleState & reduce = HEOS.get_reducing_state();
@@ -182,8 +182,8 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
     shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL,
                                            SatV = HEOS.SatV;
 
-    long double T, rhoL, rhoV, pL, pV, hL, sL, hV, sV;
-    long double deltaL=0, deltaV=0, tau=0, error;
+    CoolPropDbl T, rhoL, rhoV, pL, pV, hL, sL, hV, sV;
+    CoolPropDbl deltaL=0, deltaV=0, tau=0, error;
     int iter=0, specified_parameter;
 
     // Use the density ancillary function as the starting point for the solver
@@ -222,7 +222,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
                     this->h = h;
                 }
                 double call(double T){
-                    long double h_liq = component->ancillaries.hL.evaluate(T) + component->pEOS->hs_anchor.hmolar;
+                    CoolPropDbl h_liq = component->ancillaries.hL.evaluate(T) + component->pEOS->hs_anchor.hmolar;
                     return h_liq + component->ancillaries.hLV.evaluate(T) - h;
                 };
             };
@@ -230,7 +230,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
             
             // Ancillary is deltah = h - hs_anchor.h
             std::string errstr;
-            long double Tmin_satL, Tmin_satV;
+            CoolPropDbl Tmin_satL, Tmin_satV;
             HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
             double Tmin = Tmin_satL;
             double Tmax = HEOS.calc_Tmax_sat();
@@ -253,7 +253,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
                 T = std::max(0.99*crit.T, crit.T-0.1);
             }
             else{
-                long double Tmin, Tmax, Tmin_satV;
+                CoolPropDbl Tmin, Tmax, Tmin_satV;
                 HEOS.calc_Tmin_sat(Tmin, Tmin_satV);
                 Tmax = HEOS.calc_Tmax_sat();
                 // Ancillary is deltas = s - hs_anchor.s
@@ -272,7 +272,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
                             T = Tmax - 0.1;
                         }
                         else{
-                            throw ValueError(format("Unable to invert ancillary equation for sL for value %Lg with Tminval %g and Tmaxval %g ", specified_value - hs_anchor.smolar, vmin, vmax));
+                            throw ValueError(format("Unable to invert ancillary equation for sL for value %g with Tminval %g and Tmaxval %g ", static_cast<double>(specified_value - hs_anchor.smolar), vmin, vmax));
                         }
                     }
                 }
@@ -293,8 +293,8 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
                     this->s = s;
                 }
                 double call(double T){
-                    long double s_liq = component->ancillaries.sL.evaluate(T) + component->pEOS->hs_anchor.smolar;
-                    long double resid = s_liq + component->ancillaries.sLV.evaluate(T) - s;
+                    CoolPropDbl s_liq = component->ancillaries.sL.evaluate(T) + component->pEOS->hs_anchor.smolar;
+                    CoolPropDbl resid = s_liq + component->ancillaries.sLV.evaluate(T) - s;
                     
                     return resid;
                 };
@@ -303,7 +303,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
             
             // Ancillary is deltas = s - hs_anchor.s
             std::string errstr;
-            long double Tmin_satL, Tmin_satV;
+            CoolPropDbl Tmin_satL, Tmin_satV;
             HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
             double Tmin = Tmin_satL;
             double Tmax = HEOS.calc_Tmax_sat();
@@ -311,7 +311,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
                 T = Brent(resid, Tmin-3, Tmax, DBL_EPSILON, 1e-10, 50, errstr);
             }
             catch(std::exception &e){
-                long double vmax = resid.call(Tmax);
+                CoolPropDbl vmax = resid.call(Tmax);
                 // If near the critical point, use a near critical guess value for T
                 if (std::abs(specified_value - hs_anchor.smolar) < std::abs(vmax)){
                     T = std::max(0.99*crit.T, crit.T-0.1);
@@ -330,7 +330,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
         }
         // If T from the ancillaries is above the critical temp, this will cause failure 
         // in ancillaries for rhoV and rhoL, decrease if needed
-        T = std::min(T, static_cast<long double>(HEOS.T_critical()-0.1));
+        T = std::min(T, static_cast<CoolPropDbl>(HEOS.T_critical()-0.1));
 
         // Evaluate densities from the ancillary equations
         rhoV = HEOS.get_components()[0]->ancillaries.rhoV.evaluate(T);
@@ -373,16 +373,16 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
         sV = SatV->smolar();
 
         // These derivatives are needed for both cases
-        long double alpharL = SatL->alphar();
-        long double alpharV = SatV->alphar();
-        long double dalphar_dtauL = SatL->dalphar_dTau();
-        long double dalphar_dtauV = SatV->dalphar_dTau();
-        long double d2alphar_ddelta_dtauL = SatL->d2alphar_dDelta_dTau();
-        long double d2alphar_ddelta_dtauV = SatV->d2alphar_dDelta_dTau();
-        long double dalphar_ddeltaL = SatL->dalphar_dDelta();
-        long double dalphar_ddeltaV = SatV->dalphar_dDelta();
-        long double d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
-        long double d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
+        CoolPropDbl alpharL = SatL->alphar();
+        CoolPropDbl alpharV = SatV->alphar();
+        CoolPropDbl dalphar_dtauL = SatL->dalphar_dTau();
+        CoolPropDbl dalphar_dtauV = SatV->dalphar_dTau();
+        CoolPropDbl d2alphar_ddelta_dtauL = SatL->d2alphar_dDelta_dTau();
+        CoolPropDbl d2alphar_ddelta_dtauV = SatV->d2alphar_dDelta_dTau();
+        CoolPropDbl dalphar_ddeltaL = SatL->dalphar_dDelta();
+        CoolPropDbl dalphar_ddeltaV = SatV->dalphar_dDelta();
+        CoolPropDbl d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
+        CoolPropDbl d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
 
         // -r_1 (equate the pressures)
         negativer[0] = -(deltaV*(1+deltaV*dalphar_ddeltaV)-deltaL*(1+deltaL*dalphar_ddeltaL));
@@ -558,12 +558,12 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend &HEOS, l
             options.rhoL = rhoL; options.rhoV = rhoV; options.T = T;
             // Error out
             std::string info = get_parameter_information(specified_parameter, "short");
-            throw SolutionError(format("saturation_PHSU_pure solver did not converge after 50 iterations for %s=%Lg current error is %Lg", info.c_str(), specified_value, error));
+            throw SolutionError(format("saturation_PHSU_pure solver did not converge after 50 iterations for %s=%g current error is %g", info.c_str(), static_cast<double>(specified_value), static_cast<double>(error)));
         }
     }
     while (error > 1e-9);
 }
-void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long double rhomolar, saturation_D_pure_options &options)
+void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl rhomolar, saturation_D_pure_options &options)
 {
     /*
     This function is inspired by the method of Akasaka:
@@ -574,16 +574,16 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long
 
     Ancillary equations are used to get a sensible starting point
     */
-    std::vector<long double> r(2,_HUGE), v;
-    std::vector<std::vector<long double> > J(2, std::vector<long double>(2,_HUGE));
+    std::vector<CoolPropDbl> r(2,_HUGE), v;
+    std::vector<std::vector<CoolPropDbl> > J(2, std::vector<CoolPropDbl>(2,_HUGE));
 
     HEOS.calc_reducing_state();
     const SimpleState & reduce = HEOS.get_reducing_state();
     shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL,
                                            SatV = HEOS.SatV;
 
-    long double T, rhoL,rhoV;
-    long double deltaL=0, deltaV=0, tau=0, error, p_error;
+    CoolPropDbl T, rhoL,rhoV;
+    CoolPropDbl deltaL=0, deltaV=0, tau=0, error, p_error;
     int iter=0;
 
     // Use the density ancillary function as the starting point for the solver
@@ -628,18 +628,18 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long
         SatL->update(DmolarT_INPUTS, rhoL, T);
         SatV->update(DmolarT_INPUTS, rhoV, T);
 
-        long double pL = SatL->p();
-        long double pV = SatV->p();
+        CoolPropDbl pL = SatL->p();
+        CoolPropDbl pV = SatV->p();
 
         // These derivatives are needed for both cases
-        long double dalphar_dtauL = SatL->dalphar_dTau();
-        long double dalphar_dtauV = SatV->dalphar_dTau();
-        long double d2alphar_ddelta_dtauL = SatL->d2alphar_dDelta_dTau();
-        long double d2alphar_ddelta_dtauV = SatV->d2alphar_dDelta_dTau();
-        long double alpharL = SatL->alphar();
-        long double alpharV = SatV->alphar();
-        long double dalphar_ddeltaL = SatL->dalphar_dDelta();
-        long double dalphar_ddeltaV = SatV->dalphar_dDelta();
+        CoolPropDbl dalphar_dtauL = SatL->dalphar_dTau();
+        CoolPropDbl dalphar_dtauV = SatV->dalphar_dTau();
+        CoolPropDbl d2alphar_ddelta_dtauL = SatL->d2alphar_dDelta_dTau();
+        CoolPropDbl d2alphar_ddelta_dtauV = SatV->d2alphar_dDelta_dTau();
+        CoolPropDbl alpharL = SatL->alphar();
+        CoolPropDbl alpharV = SatV->alphar();
+        CoolPropDbl dalphar_ddeltaL = SatL->dalphar_dDelta();
+        CoolPropDbl dalphar_ddeltaV = SatV->dalphar_dDelta();
 
         // -r_1
         r[0] = -(deltaV*(1+deltaV*dalphar_ddeltaV)-deltaL*(1+deltaL*dalphar_ddeltaL));
@@ -653,7 +653,7 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long
 
         if (options.imposed_rho == saturation_D_pure_options::IMPOSED_RHOL)
         {
-            long double d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
+            CoolPropDbl d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
             if (options.use_logdelta)
             {
                 J[0][1] = deltaV+2*pow(deltaV,2)*dalphar_ddeltaV+pow(deltaV,3)*d2alphar_ddelta2V;
@@ -667,7 +667,7 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long
         }
         else if (options.imposed_rho == saturation_D_pure_options::IMPOSED_RHOV)
         {
-            long double d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
+            CoolPropDbl d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
             if (options.use_logdelta)
             {
                 J[0][1] = -deltaL-2*pow(deltaL,2)*dalphar_ddeltaL-pow(deltaL,3)*d2alphar_ddelta2L;
@@ -718,12 +718,12 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend &HEOS, long
         }
     }
     while (error > 1e-9);
-    long double p_error_limit = 1e-3;
+    CoolPropDbl p_error_limit = 1e-3;
     if (std::abs(p_error) > p_error_limit){
-        throw SolutionError(format("saturation_D_pure solver abs error on p [%Lg] > limit [%Lg]", p_error, p_error_limit));
+        throw SolutionError(format("saturation_D_pure solver abs error on p [%g] > limit [%g]", static_cast<double>(p_error), static_cast<double>(p_error_limit)));
     }
 }
-void SaturationSolvers::saturation_T_pure(HelmholtzEOSMixtureBackend &HEOS, long double T, saturation_T_pure_options &options)
+void SaturationSolvers::saturation_T_pure(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl T, saturation_T_pure_options &options)
 {
     // Set some imput options
     SaturationSolvers::saturation_T_pure_Akasaka_options _options;
@@ -749,7 +749,7 @@ void SaturationSolvers::saturation_T_pure(HelmholtzEOSMixtureBackend &HEOS, long
         }
     }
 }
-void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HEOS, long double T, saturation_T_pure_Akasaka_options &options)
+void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl T, saturation_T_pure_Akasaka_options &options)
 {
     // Start with the method of Akasaka
 
@@ -765,12 +765,12 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HE
 
     HEOS.calc_reducing_state();
     const SimpleState & reduce = HEOS.get_reducing_state();
-    long double R_u = HEOS.gas_constant();
+    CoolPropDbl R_u = HEOS.gas_constant();
     shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL,
                                            SatV = HEOS.SatV;
 
-    long double rhoL = _HUGE, rhoV = _HUGE,JL,JV,KL,KV,dJL,dJV,dKL,dKV;
-    long double DELTA, deltaL=0, deltaV=0, error, PL, PV, stepL, stepV;
+    CoolPropDbl rhoL = _HUGE, rhoV = _HUGE,JL,JV,KL,KV,dJL,dJV,dKL,dKV;
+    CoolPropDbl DELTA, deltaL=0, deltaV=0, error, PL, PV, stepL, stepV;
     int iter=0;
     
     try
@@ -838,12 +838,12 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HE
         // Calculate once to save on calls to EOS
         SatL->update(DmolarT_INPUTS, rhoL, T);
         SatV->update(DmolarT_INPUTS, rhoV, T);
-        long double alpharL = SatL->alphar();
-        long double alpharV = SatV->alphar();
-        long double dalphar_ddeltaL = SatL->dalphar_dDelta();
-        long double dalphar_ddeltaV = SatV->dalphar_dDelta();
-        long double d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
-        long double d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
+        CoolPropDbl alpharL = SatL->alphar();
+        CoolPropDbl alpharV = SatV->alphar();
+        CoolPropDbl dalphar_ddeltaL = SatL->dalphar_dDelta();
+        CoolPropDbl dalphar_ddeltaV = SatV->dalphar_dDelta();
+        CoolPropDbl d2alphar_ddelta2L = SatL->d2alphar_dDelta2();
+        CoolPropDbl d2alphar_ddelta2V = SatV->d2alphar_dDelta2();
 
         JL = deltaL * (1 + deltaL*dalphar_ddeltaL);
         JV = deltaV * (1 + deltaV*dalphar_ddeltaV);
@@ -867,7 +867,7 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HE
         stepL = options.omega/DELTA*( (KV-KL)*dJV-(JV-JL)*dKV);
         stepV = options.omega/DELTA*( (KV-KL)*dJL-(JV-JL)*dKL);
 
-        long double deltaL0 = deltaL, deltaV0 = deltaV;
+        CoolPropDbl deltaL0 = deltaL, deltaV0 = deltaV;
         // Conditions for an acceptable step are:
         // a) rhoL > rhoV or deltaL > deltaV
         for (double omega_local = 1.0; omega_local > 0.1; omega_local /= 1.1)
@@ -889,8 +889,8 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HE
     }
     while (error > 1e-10 && std::abs(stepL) > 10*DBL_EPSILON*std::abs(stepL) && std::abs(stepV) > 10*DBL_EPSILON*std::abs(stepV));
     
-    long double p_error_limit = 1e-3;
-    long double p_error = (PL - PV)/PL;
+    CoolPropDbl p_error_limit = 1e-3;
+    CoolPropDbl p_error = (PL - PV)/PL;
     if (std::abs(p_error) > p_error_limit){
         options.pL = PL;
         options.pV = PV;
@@ -900,7 +900,7 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend &HE
     }
 }
 
-long double sign(long double x)
+CoolPropDbl sign(CoolPropDbl x)
 {
     if (x > 0){
         return 1;
@@ -910,7 +910,7 @@ long double sign(long double x)
     }
 }
 
-void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HEOS, long double T, saturation_T_pure_Akasaka_options &options)
+void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HEOS, CoolPropDbl T, saturation_T_pure_Akasaka_options &options)
 {
 
     /*
@@ -923,7 +923,7 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
     shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL,
                                            SatV = HEOS.SatV;
     CoolProp::SimpleState &crit = HEOS.get_components()[0]->crit;
-    long double rhoL = _HUGE, rhoV = _HUGE, error = 999, DeltavL, DeltavV, pL, pV, p, rhoL0, rhoV0;
+    CoolPropDbl rhoL = _HUGE, rhoV = _HUGE, error = 999, DeltavL, DeltavV, pL, pV, p, rhoL0, rhoV0;
     int iter=0, small_step_count = 0;
     
     try
@@ -971,7 +971,7 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
                     SatL->update_DmolarT_direct(rhoL, T);
                     SatV->update_DmolarT_direct(rhoV, T);
                 }
-                if (get_debug_level() > 0){ std::cout << format("[Maxwell] ancillaries T: %0.16Lg rhoL: %0.16Lg rhoV: %0.16Lg pL: %g pV: %g\n", T, rhoL, rhoV, SatL->p(), SatV->p());}
+                if (get_debug_level() > 0){ std::cout << format("[Maxwell] ancillaries T: %0.16g rhoL: %0.16g rhoV: %0.16g pL: %g pV: %g\n", static_cast<double>(T), static_cast<double>(rhoL), static_cast<double>(rhoV), SatL->p(), SatV->p());}
                 
                 // Update the guess for liquid density using density solver with vapor pressure 
                 // and liquid density guess from ancillaries, but only if the pressures are not 
@@ -979,10 +979,10 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
                 if (std::abs((SatL->p()-p)/p) > 0.1){
                     for (int iii = 0; iii < 6; ++iii){
                         // Use Halley's method to update the liquid density (http://en.wikipedia.org/wiki/Halley%27s_method)
-                        long double f = SatL->p()-SatV->p();
-                        long double dpdrho = SatL->first_partial_deriv(iP,iDmolar,iT);
-                        long double d2pdrho2 = SatL->second_partial_deriv(iP,iDmolar,iT,iDmolar,iT);
-                        long double deltarhoLHalley = -(2*f*dpdrho)/(2*POW2(dpdrho)-f*d2pdrho2);
+                        CoolPropDbl f = SatL->p()-SatV->p();
+                        CoolPropDbl dpdrho = SatL->first_partial_deriv(iP,iDmolar,iT);
+                        CoolPropDbl d2pdrho2 = SatL->second_partial_deriv(iP,iDmolar,iT,iDmolar,iT);
+                        CoolPropDbl deltarhoLHalley = -(2*f*dpdrho)/(2*POW2(dpdrho)-f*d2pdrho2);
                         rhoL += deltarhoLHalley;
                         if (std::abs(deltarhoLHalley/rhoL) < DBL_EPSILON){
                             break;
@@ -1017,31 +1017,31 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
 
     SatL->update_DmolarT_direct(rhoL, T);
     SatV->update_DmolarT_direct(rhoV, T);
-    if (get_debug_level() > 0){ std::cout << format("[Maxwell] starting T: %0.16Lg rhoL: %Lg rhoV: %Lg pL: %Lg pV: %g\n", T, rhoL, rhoV, SatL->p(), SatV->p());}
+    if (get_debug_level() > 0){ std::cout << format("[Maxwell] starting T: %0.16g rhoL: %g rhoV: %g pL: %g pV: %g\n", static_cast<double>(T), static_cast<double>(rhoL), static_cast<double>(rhoV), static_cast<double>(SatL->p()), SatV->p());}
     do{
         pL = SatL->p(); pV = SatV->p();
-        long double vL = 1/SatL->rhomolar(), vV = 1/SatV->rhomolar();
-        long double gL = SatL->gibbsmolar(), gV = SatV->gibbsmolar();
+        CoolPropDbl vL = 1/SatL->rhomolar(), vV = 1/SatV->rhomolar();
+        CoolPropDbl gL = SatL->gibbsmolar(), gV = SatV->gibbsmolar();
         // Get alpha, the pressure derivative with volume at constant T
         // Given by (dp/drho|T)*drhodv
-        long double alphaL = SatL->first_partial_deriv(iP, iDmolar, iT)*(-POW2(SatL->rhomolar()));
-        long double alphaV = SatV->first_partial_deriv(iP, iDmolar, iT)*(-POW2(SatV->rhomolar()));
+        CoolPropDbl alphaL = SatL->first_partial_deriv(iP, iDmolar, iT)*(-POW2(SatL->rhomolar()));
+        CoolPropDbl alphaV = SatV->first_partial_deriv(iP, iDmolar, iT)*(-POW2(SatV->rhomolar()));
         
         // Total helmholtz energy for liquid and vapor
-        long double RT = SatL->gas_constant()*T;
-        long double helmholtzL = (SatL->calc_alpha0() + SatL->calc_alphar())*RT;
-        long double helmholtzV = (SatV->calc_alpha0() + SatV->calc_alphar())*RT;
+        CoolPropDbl RT = SatL->gas_constant()*T;
+        CoolPropDbl helmholtzL = (SatL->calc_alpha0() + SatL->calc_alphar())*RT;
+        CoolPropDbl helmholtzV = (SatV->calc_alpha0() + SatV->calc_alphar())*RT;
         
         // Calculate the mean pressure
-        long double pM = (helmholtzL - helmholtzV)/(vV - vL);
+        CoolPropDbl pM = (helmholtzL - helmholtzV)/(vV - vL);
         
         // Coefficients for the quadratic in the step
-        long double A = 0.5*alphaL*(alphaL - alphaV);
-        long double B = alphaL*(pL - pV - alphaV*(vL - vV));
-        long double C = alphaV*(vL - vV)*(pM - pL) + 0.5*POW2(pL - pV);
+        CoolPropDbl A = 0.5*alphaL*(alphaL - alphaV);
+        CoolPropDbl B = alphaL*(pL - pV - alphaV*(vL - vV));
+        CoolPropDbl C = alphaV*(vL - vV)*(pM - pL) + 0.5*POW2(pL - pV);
         
         // Argument to square root
-        long double sqrt_arg = std::abs(B*B/(4*A*A)-C/A);
+        CoolPropDbl sqrt_arg = std::abs(B*B/(4*A*A)-C/A);
         
         // If the argument to sqrt is very small, we multiply it by a large factor to make it 
         // larger, and then also divide the sqrt by the sqrt of the factor
@@ -1050,7 +1050,7 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
         }
         else{
             // Scale the argument to sqrt() function to make it about 1.0, and divide by sqrt(factor) to yield a factor of 1
-            long double powerfactor = -log10(sqrt_arg);
+            CoolPropDbl powerfactor = -log10(sqrt_arg);
             DeltavL = -0.5*B/A + sign((alphaL - alphaV)/alphaV)*sqrt(sqrt_arg*powerfactor)/sqrt(powerfactor);
         }
         DeltavV = (pL - pV + alphaL*DeltavL)/alphaV;
@@ -1070,7 +1070,7 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
         // Calculate the error (here the relative error in pressure)
         error = std::abs((SatL->p() - SatV->p())/SatL->p());
 
-        if (get_debug_level() > 0){ std::cout << format("[Maxwell] rhoL: %0.16Lg rhoV: %0.16Lg error: %Lg dvL/vL: %Lg dvV/vV: %Lg pL: %Lg pV: %Lg\n", rhoL, rhoV, error, DeltavL/vL, DeltavV/vV, pL, pV);}
+        if (get_debug_level() > 0){ std::cout << format("[Maxwell] rhoL: %0.16g rhoV: %0.16g error: %g dvL/vL: %g dvV/vV: %g pL: %g pV: %g\n", static_cast<double>(rhoL), static_cast<double>(rhoV), static_cast<double>(error), static_cast<double>(DeltavL/vL), static_cast<double>(DeltavV/vV), static_cast<double>(pL), static_cast<double>(pV));}
 
         // If the step size is small, start a counter to allow the other density 
         // to be corrected a few times
@@ -1080,14 +1080,14 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend &HE
         
         iter++;
         if (iter > 30){
-            throw SolutionError(format("Maxwell solver did not converge after 30 iterations;  rhoL: %0.16Lg rhoV: %0.16Lg error: %Lg dvL/vL: %Lg dvV/vV: %Lg pL: %Lg pV: %Lg\n", rhoL, rhoV, error, DeltavL/vL, DeltavV/vV, pL, pV));
+            throw SolutionError(format("Maxwell solver did not converge after 30 iterations;  rhoL: %0.16g rhoV: %0.16g error: %g dvL/vL: %g dvV/vV: %g pL: %g pV: %g\n", static_cast<double>(rhoL), static_cast<double>(rhoV), static_cast<double>(error), static_cast<double>(DeltavL/vL), static_cast<double>(DeltavV/vV), static_cast<double>(pL), static_cast<double>(pV)));
         }
     }
     while ((SatL->p() < 0) || (error > 1e-5 && small_step_count < 4));
     if (get_debug_level() > 0){ std::cout << format("[Maxwell] pL: %g pV: %g\n", SatL->p(), SatV->p());}
 }
 
-void SaturationSolvers::x_and_y_from_K(long double beta, const std::vector<long double> &K, const std::vector<long double> &z, std::vector<long double> &x, std::vector<long double> &y)
+void SaturationSolvers::x_and_y_from_K(CoolPropDbl beta, const std::vector<CoolPropDbl> &K, const std::vector<CoolPropDbl> &z, std::vector<CoolPropDbl> &x, std::vector<CoolPropDbl> &y)
 {
     for (unsigned int i=0; i < K.size(); i++)
     {
@@ -1097,16 +1097,16 @@ void SaturationSolvers::x_and_y_from_K(long double beta, const std::vector<long
     }
 }
 
-void SaturationSolvers::successive_substitution(HelmholtzEOSMixtureBackend &HEOS, const long double beta, long double T, long double p, const std::vector<long double> &z,
-                                                       std::vector<long double> &K, mixture_VLE_IO &options)
+void SaturationSolvers::successive_substitution(HelmholtzEOSMixtureBackend &HEOS, const CoolPropDbl beta, CoolPropDbl T, CoolPropDbl p, const std::vector<CoolPropDbl> &z,
+                                                       std::vector<CoolPropDbl> &K, mixture_VLE_IO &options)
 {
     int iter = 1;
-    long double change, f, df, deriv_liq, deriv_vap;
+    CoolPropDbl change, f, df, deriv_liq, deriv_vap;
     std::size_t N = z.size();
-    std::vector<long double> ln_phi_liq, ln_phi_vap;
+    std::vector<CoolPropDbl> ln_phi_liq, ln_phi_vap;
     ln_phi_liq.resize(N); ln_phi_vap.resize(N);
 
-    std::vector<long double> &x = HEOS.SatL->get_mole_fractions(), &y = HEOS.SatV->get_mole_fractions();
+    std::vector<CoolPropDbl> &x = HEOS.SatL->get_mole_fractions(), &y = HEOS.SatV->get_mole_fractions();
     x_and_y_from_K(beta, K, z, x, y);
 
     HEOS.SatL->specify_phase(iphase_liquid);
@@ -1119,8 +1119,8 @@ void SaturationSolvers::successive_substitution(HelmholtzEOSMixtureBackend &HEOS
     HEOS.SatV->set_mole_fractions(y);
     HEOS.SatL->calc_reducing_state();
     HEOS.SatV->calc_reducing_state();
-    long double rhomolar_liq = HEOS.SatL->solver_rho_Tp_SRK(T, p, iphase_liquid); // [mol/m^3]
-    long double rhomolar_vap = HEOS.SatV->solver_rho_Tp_SRK(T, p, iphase_gas); // [mol/m^3]
+    CoolPropDbl rhomolar_liq = HEOS.SatL->solver_rho_Tp_SRK(T, p, iphase_liquid); // [mol/m^3]
+    CoolPropDbl rhomolar_vap = HEOS.SatV->solver_rho_Tp_SRK(T, p, iphase_gas); // [mol/m^3]
 
     HEOS.SatL->update_TP_guessrho(T, p, rhomolar_liq*1.5);
     HEOS.SatV->update_TP_guessrho(T, p, rhomolar_vap);
@@ -1208,7 +1208,7 @@ void SaturationSolvers::newton_raphson_saturation::resize(unsigned int N)
     else if (imposed_variable == newton_raphson_saturation_options::P_IMPOSED || imposed_variable == newton_raphson_saturation_options::T_IMPOSED){
         r.resize(N);
         negative_r.resize(N);
-        J.resize(N, std::vector<long double>(N, 0));
+        J.resize(N, std::vector<CoolPropDbl>(N, 0));
         err_rel.resize(N);
     }
     else{
@@ -1224,11 +1224,11 @@ void SaturationSolvers::newton_raphson_saturation::check_Jacobian()
     build_arrays();
 
     // Make copies of the base
-    long double T0 = T;
-    std::vector<long double> r0 = r, x0 = x;
+    CoolPropDbl T0 = T;
+    std::vector<CoolPropDbl> r0 = r, x0 = x;
     STLMatrix J0 = J;
-    long double rhomolar_liq0 = rSatL.rhomolar();
-    long double rhomolar_vap0 = rSatV.rhomolar();
+    CoolPropDbl rhomolar_liq0 = rSatL.rhomolar();
+    CoolPropDbl rhomolar_vap0 = rSatV.rhomolar();
     
     {
         // Derivatives with respect to T
@@ -1237,20 +1237,20 @@ void SaturationSolvers::newton_raphson_saturation::check_Jacobian()
         this->rhomolar_liq = rhomolar_liq0;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays();
-        std::vector<long double> r1 = r;
+        std::vector<CoolPropDbl> r1 = r;
         this->T = T2;
         this->rhomolar_liq = rhomolar_liq0;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays();
-        std::vector<long double> r2 = r;
+        std::vector<CoolPropDbl> r2 = r;
         
-        std::vector<long double> diffn(N+1, _HUGE);
+        std::vector<CoolPropDbl> diffn(N+1, _HUGE);
         for (std::size_t i = 0; i < N+1; ++i){
             diffn[i] = (r1[i]-r2[i])/(2*dT);
         }
         std::cout << format("For T\n");
-        std::cout << "numerical: " << vec_to_string(diffn, "%0.11Lg") << std::endl;
-        std::cout << "analytic: " << vec_to_string(get_col(J0, N-1), "%0.11Lg") << std::endl;
+        std::cout << "numerical: " << vec_to_string(diffn, "%0.11g") << std::endl;
+        std::cout << "analytic: " << vec_to_string(get_col(J0, N-1), "%0.11g") << std::endl;
     }
     {
         // Derivatives with respect to rho'
@@ -1259,20 +1259,20 @@ void SaturationSolvers::newton_raphson_saturation::check_Jacobian()
         this->rhomolar_liq = rhomolar_liq0+drho;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays();
-        std::vector<long double> rr1 = r;
+        std::vector<CoolPropDbl> rr1 = r;
         this->T = T0;
         this->rhomolar_liq = rhomolar_liq0-drho;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays();
-        std::vector<long double> rr2 = r;
+        std::vector<CoolPropDbl> rr2 = r;
         
-        std::vector<long double> difffn(N+1, _HUGE);
+        std::vector<CoolPropDbl> difffn(N+1, _HUGE);
         for (std::size_t i = 0; i < N+1; ++i){
             difffn[i] = (rr1[i]-rr2[i])/(2*drho);
         }
         std::cout << format("For rho\n");
-        std::cout << "numerical: " << vec_to_string(difffn, "%0.11Lg") << std::endl;
-        std::cout << "analytic: " << vec_to_string(get_col(J0, N), "%0.11Lg") << std::endl;
+        std::cout << "numerical: " << vec_to_string(difffn, "%0.11g") << std::endl;
+        std::cout << "analytic: " << vec_to_string(get_col(J0, N), "%0.11g") << std::endl;
     }
     for (std::size_t i = 0; i < x.size()-1;  ++i)
     {
@@ -1284,7 +1284,7 @@ void SaturationSolvers::newton_raphson_saturation::check_Jacobian()
         this->rhomolar_liq = rhomolar_liq0;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays(); 
-        std::vector<long double> r1 = this->r;
+        std::vector<CoolPropDbl> r1 = this->r;
     
         this->x = x0; 
         this->x[i] -= dx; this->x[x.size()-1] += dx;
@@ -1292,18 +1292,18 @@ void SaturationSolvers::newton_raphson_saturation::check_Jacobian()
         this->rhomolar_liq = rhomolar_liq0;
         this->rhomolar_vap = rhomolar_vap0;
         build_arrays(); 
-        std::vector<long double> r2 = this->r;
+        std::vector<CoolPropDbl> r2 = this->r;
     
-        std::vector<long double> diffn(N+1, _HUGE);
+        std::vector<CoolPropDbl> diffn(N+1, _HUGE);
         for (std::size_t j = 0; j < N+1; ++j){
             diffn[j] = (r1[j]-r2[j])/(2*dx);
         }
         std::cout << format("For x%d N %d\n", i, N);
-        std::cout << "numerical: " << vec_to_string(diffn, "%0.11Lg") << std::endl;
-        std::cout << "analytic: " << vec_to_string(get_col(J0, i), "%0.11Lg") << std::endl;
+        std::cout << "numerical: " << vec_to_string(diffn, "%0.11g") << std::endl;
+        std::cout << "analytic: " << vec_to_string(get_col(J0, i), "%0.11g") << std::endl;
     }
 }
-void SaturationSolvers::newton_raphson_saturation::call(HelmholtzEOSMixtureBackend &HEOS, const std::vector<long double> &z, std::vector<long double> &z_incipient, newton_raphson_saturation_options &IO)
+void SaturationSolvers::newton_raphson_saturation::call(HelmholtzEOSMixtureBackend &HEOS, const std::vector<CoolPropDbl> &z, std::vector<CoolPropDbl> &z_incipient, newton_raphson_saturation_options &IO)
 {
     int iter = 0;
     
@@ -1344,7 +1344,7 @@ void SaturationSolvers::newton_raphson_saturation::call(HelmholtzEOSMixtureBacke
 
         // Solve for the step; v is the step with the contents
         // [delta(x_0), delta(x_1), ..., delta(x_{N-2}), delta(spec)]
-        std::vector<long double> v = linsolve(J, negative_r);
+        std::vector<CoolPropDbl> v = linsolve(J, negative_r);
         
         if (bubble_point){
             for (unsigned int i = 0; i < N-1; ++i){
@@ -1373,7 +1373,7 @@ void SaturationSolvers::newton_raphson_saturation::call(HelmholtzEOSMixtureBacke
         else{
             throw ValueError("invalid imposed_variable");
         }
-        //std::cout << format("\t%Lg ", this->error_rms) << T << " " << rhomolar_liq << " " << rhomolar_vap << " v " << vec_to_string(v, "%0.10Lg")  << " x " << vec_to_string(x, "%0.10Lg") << " r " << vec_to_string(r, "%0.10Lg") << std::endl;
+        //std::cout << format("\t%Lg ", this->error_rms) << T << " " << rhomolar_liq << " " << rhomolar_vap << " v " << vec_to_string(v, "%0.10g")  << " x " << vec_to_string(x, "%0.10g") << " r " << vec_to_string(r, "%0.10g") << std::endl;
         
         min_rel_change = min_abs_value(err_rel);
         iter++;
@@ -1415,8 +1415,8 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
         rSatL.set_mole_fractions(x);
         rSatV.set_mole_fractions(y);
     }
-    std::vector<long double> &x = rSatL.get_mole_fractions();
-    std::vector<long double> &y = rSatV.get_mole_fractions();
+    std::vector<CoolPropDbl> &x = rSatL.get_mole_fractions();
+    std::vector<CoolPropDbl> &y = rSatV.get_mole_fractions();
     if (imposed_variable == newton_raphson_saturation_options::RHOV_IMPOSED){
         rSatL.update(DmolarT_INPUTS, rhomolar_liq, T);
         rSatV.update(DmolarT_INPUTS, rhomolar_vap, T);
@@ -1430,8 +1430,8 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
     }
     
     // For diagnostic purposes calculate the pressures (no derivatives are evaluated)
-    long double p_liq = rSatL.p();
-    long double p_vap = rSatV.p();
+    CoolPropDbl p_liq = rSatL.p();
+    CoolPropDbl p_vap = rSatV.p();
     p = 0.5*(p_liq + p_vap);
     
     // Step 2:
@@ -1445,8 +1445,8 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
         for (std::size_t i = 0; i < N; ++i)
         {
             // Equate the liquid and vapor fugacities
-            long double ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
-            long double ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
+            CoolPropDbl ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
+            CoolPropDbl ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
             r[i] = ln_f_liq - ln_f_vap;
             
             for (std::size_t j = 0; j < N-1; ++j){ // j from 0 to N-2
@@ -1478,8 +1478,8 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
         for (std::size_t i = 0; i < N; ++i)
         {
             // Equate the liquid and vapor fugacities
-            long double ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
-            long double ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
+            CoolPropDbl ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
+            CoolPropDbl ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
             r[i] = ln_f_liq - ln_f_vap;
             
             for (std::size_t j = 0; j < N-1; ++j){ // j from 0 to N-2
@@ -1500,8 +1500,8 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
         for (std::size_t i = 0; i < N; ++i)
         {
             // Equate the liquid and vapor fugacities
-            long double ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
-            long double ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
+            CoolPropDbl ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
+            CoolPropDbl ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
             r[i] = ln_f_liq - ln_f_vap;
             
             for (std::size_t j = 0; j < N-1; ++j){ // j from 0 to N-2
@@ -1531,7 +1531,7 @@ void SaturationSolvers::newton_raphson_saturation::build_arrays()
     
     // Calculate derivatives along phase boundary;
     // Gernert thesis 3.96 and 3.97
-    long double dQ_dPsat = 0, dQ_dTsat = 0;
+    CoolPropDbl dQ_dPsat = 0, dQ_dTsat = 0;
     for (std::size_t i = 0; i < N; ++i)
     {
         dQ_dPsat += x[i]*(MixtureDerivatives::dln_fugacity_coefficient_dp__constT_n(rSatL, i, xN_flag) - MixtureDerivatives::dln_fugacity_coefficient_dp__constT_n(rSatV, i, xN_flag));
@@ -1565,7 +1565,7 @@ void SaturationSolvers::newton_raphson_twophase::call(HelmholtzEOSMixtureBackend
     y.resize(N);
     r.resize(2*N-1);
     negative_r.resize(2*N-1);
-    J.resize(2*N-1, std::vector<long double>(2*N-1, 0));
+    J.resize(2*N-1, std::vector<CoolPropDbl>(2*N-1, 0));
     err_rel.resize(2*N-1);
     
     // Hold a pointer to the backend
@@ -1580,10 +1580,10 @@ void SaturationSolvers::newton_raphson_twophase::call(HelmholtzEOSMixtureBackend
         // [delta(x_0), delta(x_1), ..., delta(x_{N-2}), delta(spec)]
         
         // Uncomment to see Jacobian and residual at every step
-        // std::cout << vec_to_string(J, "%0.12Lg") << std::endl;
-        // std::cout << vec_to_string(negative_r, "%0.12Lg") << std::endl;
+        // std::cout << vec_to_string(J, "%0.12g") << std::endl;
+        // std::cout << vec_to_string(negative_r, "%0.12g") << std::endl;
         
-        std::vector<long double> v = linsolve(J, negative_r);
+        std::vector<CoolPropDbl> v = linsolve(J, negative_r);
         for (unsigned int i = 0; i < N-1; ++i){
             err_rel[i] = v[i]/x[i];
             x[i] += v[i];
@@ -1602,7 +1602,7 @@ void SaturationSolvers::newton_raphson_twophase::call(HelmholtzEOSMixtureBackend
         else{
             throw ValueError("invalid imposed_variable");
         }
-        //std::cout << format("\t%Lg ", this->error_rms) << T << " " << rhomolar_liq << " " << rhomolar_vap << " v " << vec_to_string(v, "%0.10Lg")  << " x " << vec_to_string(x, "%0.10Lg") << " r " << vec_to_string(r, "%0.10Lg") << std::endl;
+        //std::cout << format("\t%Lg ", this->error_rms) << T << " " << rhomolar_liq << " " << rhomolar_vap << " v " << vec_to_string(v, "%0.10g")  << " x " << vec_to_string(x, "%0.10g") << " r " << vec_to_string(r, "%0.10g") << std::endl;
         
         min_rel_change = min_abs_value(err_rel);
         iter++;
@@ -1637,15 +1637,15 @@ void SaturationSolvers::newton_raphson_twophase::build_arrays()
     rSatL.set_mole_fractions(x);
     rSatV.set_mole_fractions(y);
 
-    //std::vector<long double> &x = rSatL.get_mole_fractions();
-    //std::vector<long double> &y = rSatV.get_mole_fractions();
+    //std::vector<CoolPropDbl> &x = rSatL.get_mole_fractions();
+    //std::vector<CoolPropDbl> &y = rSatV.get_mole_fractions();
 
     rSatL.update_TP_guessrho(T, p, rhomolar_liq); rhomolar_liq = rSatL.rhomolar();
     rSatV.update_TP_guessrho(T, p, rhomolar_vap); rhomolar_vap = rSatV.rhomolar();
     
     // For diagnostic purposes calculate the pressures (no derivatives are evaluated)
-    long double p_liq = rSatL.p();
-    long double p_vap = rSatV.p();
+    CoolPropDbl p_liq = rSatL.p();
+    CoolPropDbl p_vap = rSatV.p();
     p = 0.5*(p_liq + p_vap);
     
     // Step 2:
@@ -1658,8 +1658,8 @@ void SaturationSolvers::newton_raphson_twophase::build_arrays()
     for (std::size_t i = 0; i < N; ++i)
     {
         // Equate the liquid and vapor fugacities
-        long double ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
-        long double ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
+        CoolPropDbl ln_f_liq = log(MixtureDerivatives::fugacity_i(rSatL, i, xN_flag));
+        CoolPropDbl ln_f_vap = log(MixtureDerivatives::fugacity_i(rSatV, i, xN_flag));
         r[i] = ln_f_liq - ln_f_vap; // N of these
     
         if (i != N-1){
@@ -118,7 +118,7 @@ void IncompressibleBackend::update(CoolProp::input_pairs input_pair, double valu
 /**
 @param fractions The vector of fractions of the components converted to the correct input
 */
-void IncompressibleBackend::set_fractions(const std::vector<long double> &fractions){
+void IncompressibleBackend::set_fractions(const std::vector<CoolPropDbl> &fractions){
     if (get_debug_level()>=10) std::cout << format("Incompressible backend: Called set_fractions with %s ",vec_to_string(fractions).c_str()) << std::endl;
     if (fractions.size()!=1) throw ValueError(format("The incompressible backend only supports one entry in the fraction vector and not %d.",fractions.size()));
     if ( ( this->_fractions.size()!=1 ) ||
@@ -133,18 +133,18 @@ void IncompressibleBackend::set_fractions(const std::vector<long double> &fracti
 /**
 @param mole_fractions The vector of mole fractions of the components
 */
-void IncompressibleBackend::set_mole_fractions(const std::vector<long double> &mole_fractions){
+void IncompressibleBackend::set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions){
     if (get_debug_level()>=10) std::cout << format("Incompressible backend: Called set_mole_fractions with %s ",vec_to_string(mole_fractions).c_str()) << std::endl;
     if (mole_fractions.size()!=1) throw ValueError(format("The incompressible backend only supports one entry in the mole fraction vector and not %d.",mole_fractions.size()));
     if (fluid->getxid()==IFRAC_PURE) {
-        this->set_fractions(std::vector<long double>(1,0));
+        this->set_fractions(std::vector<CoolPropDbl>(1,0));
         if (get_debug_level()>=20) std::cout << format("Incompressible backend: Overwriting fractions for pure fluid with %s -> %s",vec_to_string(mole_fractions).c_str(),vec_to_string(this->_fractions).c_str()) << std::endl;
     } else if (fluid->getxid()==IFRAC_MOLE) {
         this->set_fractions(mole_fractions);
     } else {
-        std::vector<long double> tmp_fractions;
+        std::vector<CoolPropDbl> tmp_fractions;
         for (std::size_t i = 0; i < mole_fractions.size(); i++) {
-            tmp_fractions.push_back((long double) fluid->inputFromMole(0.0, mole_fractions[i]));
+            tmp_fractions.push_back((CoolPropDbl) fluid->inputFromMole(0.0, mole_fractions[i]));
         }
         this->set_fractions(tmp_fractions);
     }
@@ -154,18 +154,18 @@ void IncompressibleBackend::set_mole_fractions(const std::vector<long double> &m
 /**
 @param mass_fractions The vector of mass fractions of the components
 */
-void IncompressibleBackend::set_mass_fractions(const std::vector<long double> &mass_fractions){
+void IncompressibleBackend::set_mass_fractions(const std::vector<CoolPropDbl> &mass_fractions){
     if (get_debug_level()>=10) std::cout << format("Incompressible backend: Called set_mass_fractions with %s ",vec_to_string(mass_fractions).c_str()) << std::endl;
     if (mass_fractions.size()!=1) throw ValueError(format("The incompressible backend only supports one entry in the mass fraction vector and not %d.",mass_fractions.size()));
     if (fluid->getxid()==IFRAC_PURE) {
-        this->set_fractions(std::vector<long double>(1,0));
+        this->set_fractions(std::vector<CoolPropDbl>(1,0));
         if (get_debug_level()>=20) std::cout << format("Incompressible backend: Overwriting fractions for pure fluid with %s -> %s",vec_to_string(mass_fractions).c_str(),vec_to_string(this->_fractions).c_str()) << std::endl;
     } else if (fluid->getxid()==IFRAC_MASS) {
         this->set_fractions(mass_fractions);
     } else {
-        std::vector<long double> tmp_fractions;
+        std::vector<CoolPropDbl> tmp_fractions;
         for (std::size_t i = 0; i < mass_fractions.size(); i++) {
-            tmp_fractions.push_back((long double) fluid->inputFromMass(0.0, mass_fractions[i]));
+            tmp_fractions.push_back((CoolPropDbl) fluid->inputFromMass(0.0, mass_fractions[i]));
         }
         this->set_fractions(tmp_fractions);
     }
@@ -175,18 +175,18 @@ void IncompressibleBackend::set_mass_fractions(const std::vector<long double> &m
 /**
 @param volu_fractions The vector of volume fractions of the components
 */
-void IncompressibleBackend::set_volu_fractions(const std::vector<long double> &volu_fractions){
+void IncompressibleBackend::set_volu_fractions(const std::vector<CoolPropDbl> &volu_fractions){
     if (get_debug_level()>=10) std::cout << format("Incompressible backend: Called set_volu_fractions with %s ",vec_to_string(volu_fractions).c_str()) << std::endl;
     if (volu_fractions.size()!=1) throw ValueError(format("The incompressible backend only supports one entry in the volume fraction vector and not %d.",volu_fractions.size()));
     if (fluid->getxid()==IFRAC_PURE) {
-        this->set_fractions(std::vector<long double>(1,0));
+        this->set_fractions(std::vector<CoolPropDbl>(1,0));
         if (get_debug_level()>=20) std::cout << format("Incompressible backend: Overwriting fractions for pure fluid with %s -> %s",vec_to_string(volu_fractions).c_str(),vec_to_string(this->_fractions).c_str()) << std::endl;
     } else if (fluid->getxid()==IFRAC_VOLUME) {
         this->set_fractions(volu_fractions);
     } else {
-        std::vector<long double> tmp_fractions;
+        std::vector<CoolPropDbl> tmp_fractions;
         for (std::size_t i = 0; i < volu_fractions.size(); i++) {
-            tmp_fractions.push_back((long double) fluid->inputFromVolume(0.0, volu_fractions[i]));
+            tmp_fractions.push_back((CoolPropDbl) fluid->inputFromVolume(0.0, volu_fractions[i]));
         }
         this->set_fractions(tmp_fractions);
     }
@@ -203,7 +203,7 @@ void IncompressibleBackend::check_status() {
 @param p The pressure in Pa
 @returns T The temperature in K
 */
-long double IncompressibleBackend::DmassP_flash(long double rhomass, long double p){
+CoolPropDbl IncompressibleBackend::DmassP_flash(CoolPropDbl rhomass, CoolPropDbl p){
     return fluid->T_rho(rhomass, p, _fractions[0]);
 }
 /// Calculate T given pressure and enthalpy
@@ -212,7 +212,7 @@ long double IncompressibleBackend::DmassP_flash(long double rhomass, long double
 @param p The pressure in Pa
 @returns T The temperature in K
 */
-long double IncompressibleBackend::HmassP_flash(long double hmass, long double p){
+CoolPropDbl IncompressibleBackend::HmassP_flash(CoolPropDbl hmass, CoolPropDbl p){
 
     class HmassP_residual : public FuncWrapper1D {
     protected:
@@ -252,7 +252,7 @@ long double IncompressibleBackend::HmassP_flash(long double hmass, long double p
 @param p The pressure in Pa
 @returns T The temperature in K
 */
-long double IncompressibleBackend::PSmass_flash(long double p, long double smass){
+CoolPropDbl IncompressibleBackend::PSmass_flash(CoolPropDbl p, CoolPropDbl smass){
     return fluid->T_s(smass, p, _fractions[0]);
 }
 
@@ -262,7 +262,7 @@ long double IncompressibleBackend::PSmass_flash(long double p, long double smass
 @param p The pressure in Pa
 @returns T The temperature in K
 */
-long double IncompressibleBackend::PUmass_flash(long double p, long double umass){
+CoolPropDbl IncompressibleBackend::PUmass_flash(CoolPropDbl p, CoolPropDbl umass){
     return fluid->T_u(umass, p, _fractions[0]);
 }
 
@@ -295,7 +295,7 @@ TEST_CASE("Internal consistency checks and example use cases for the incompressi
 
         //void update(long input_pair, double value1, double value2);
 
-        std::vector<long double> fractions;
+        std::vector<CoolPropDbl> fractions;
         fractions.push_back(0.4);
         CHECK_THROWS( backend.set_mole_fractions(fractions) );
         CHECK_NOTHROW( backend.set_mass_fractions(fractions) );
@@ -310,7 +310,7 @@ TEST_CASE("Internal consistency checks and example use cases for the incompressi
         double T   = 273.15+10;
         double p   = 10e5;
         double x   = 0.25;
-        backend.set_mass_fractions(std::vector<long double>(1,x));
+        backend.set_mass_fractions(std::vector<CoolPropDbl>(1,x));
         double val = 0;
         double res = 0;
 
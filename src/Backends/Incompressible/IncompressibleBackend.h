@@ -16,14 +16,14 @@ protected:
     //int Ncomp;
     //static bool _REFPROP_supported;
     //int _fractions_id;
-    std::vector<long double> _fractions;
+    std::vector<CoolPropDbl> _fractions;
     IncompressibleFluid *fluid;
 
     /// Set the fractions
     /**
     @param fractions The vector of fractions of the components converted to the correct input
     */
-    void set_fractions(const std::vector<long double> &fractions);
+    void set_fractions(const std::vector<CoolPropDbl> &fractions);
 
 public:
     IncompressibleBackend();
@@ -59,19 +59,19 @@ public:
     /**
     @param mole_fractions The vector of mole fractions of the components
     */
-    void set_mole_fractions(const std::vector<long double> &mole_fractions);
+    void set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions);
 
     /// Set the mass fractions
     /**
     @param mass_fractions The vector of mass fractions of the components
     */
-    void set_mass_fractions(const std::vector<long double> &mass_fractions);
+    void set_mass_fractions(const std::vector<CoolPropDbl> &mass_fractions);
 
     /// Set the volume fractions
     /**
     @param volu_fractions The vector of volume fractions of the components
     */
-    void set_volu_fractions(const std::vector<long double> &volu_fractions);
+    void set_volu_fractions(const std::vector<CoolPropDbl> &volu_fractions);
 
     /// Check if the mole fractions have been set, etc.
     void check_status();
@@ -82,21 +82,21 @@ public:
     @param p The pressure in Pa
     @returns T The temperature in K
     */
-    long double DmassP_flash(long double rhomass, long double p);
+    CoolPropDbl DmassP_flash(CoolPropDbl rhomass, CoolPropDbl p);
     /// Calculate T given pressure and enthalpy
     /**
     @param hmass The mass enthalpy in J/kg
     @param p The pressure in Pa
     @returns T The temperature in K
     */
-    long double HmassP_flash(long double hmass, long double p);
+    CoolPropDbl HmassP_flash(CoolPropDbl hmass, CoolPropDbl p);
     /// Calculate T given pressure and entropy
     /**
     @param smass The mass entropy in J/kg/K
     @param p The pressure in Pa
     @returns T The temperature in K
     */
-    long double PSmass_flash(long double p, long double smass);
+    CoolPropDbl PSmass_flash(CoolPropDbl p, CoolPropDbl smass);
 
     /// Calculate T given pressure and internal energy
     /**
@@ -104,28 +104,28 @@ public:
     @param p The pressure in Pa
     @returns T The temperature in K
     */
-    long double PUmass_flash(long double p, long double umass);
+    CoolPropDbl PUmass_flash(CoolPropDbl p, CoolPropDbl umass);
 
     /// Get the viscosity [Pa-s]
-    long double calc_viscosity(void){return fluid->visc(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_viscosity(void){return fluid->visc(_T, _p, _fractions[0]);};
     /// Get the thermal conductivity [W/m/K] (based on the temperature and pressure in the state class)
-    long double calc_conductivity(void){return fluid->cond(_T, _p, _fractions[0]);};
-
-    long double calc_rhomass(void){return fluid->rho(_T, _p, _fractions[0]);};
-    long double calc_hmass(void){return fluid->h(_T, _p, _fractions[0]);};
-    long double calc_smass(void){return fluid->s(_T, _p, _fractions[0]);};
-    long double calc_umass(void){return fluid->u(_T, _p, _fractions[0]);};
-    long double calc_cpmass(void){return fluid->cp(_T, _p, _fractions[0]);};
-    long double calc_cvmass(void){return fluid->cv(_T, _p, _fractions[0]);};
-    long double calc_Tmax(void){return fluid->getTmax();};
-    long double calc_Tmin(void){return fluid->getTmin();};
+    CoolPropDbl calc_conductivity(void){return fluid->cond(_T, _p, _fractions[0]);};
+
+    CoolPropDbl calc_rhomass(void){return fluid->rho(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_hmass(void){return fluid->h(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_smass(void){return fluid->s(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_umass(void){return fluid->u(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_cpmass(void){return fluid->cp(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_cvmass(void){return fluid->cv(_T, _p, _fractions[0]);};
+    CoolPropDbl calc_Tmax(void){return fluid->getTmax();};
+    CoolPropDbl calc_Tmin(void){return fluid->getTmin();};
     
-    long double calc_fraction_min(void){return fluid->getxmin();};
-    long double calc_fraction_max(void){return fluid->getxmax();};
-    long double calc_T_freeze(void){
+    CoolPropDbl calc_fraction_min(void){return fluid->getxmin();};
+    CoolPropDbl calc_fraction_max(void){return fluid->getxmax();};
+    CoolPropDbl calc_T_freeze(void){
         return fluid->Tfreeze(_p, _fractions[0]);};
 		
-	long double calc_melting_line(int param, int given, long double value){
+	CoolPropDbl calc_melting_line(int param, int given, CoolPropDbl value){
 		if (param == iT && given == iP){
 			return fluid->Tfreeze(value, _fractions[0]);
 		}
@@ -1,6 +1,7 @@
 #include "IncompressibleLibrary.h"
 #include "MatrixMath.h"
 #include "DataStructures.h"
+#include "crossplatform_mutex.h"
 //#include "crossplatform_shared_ptr.h"
 #include "rapidjson/rapidjson_include.h"
 #include "all_incompressibles_JSON.h" // Makes a std::string variable called all_incompressibles_JSON
@@ -594,6 +595,8 @@ IncompressibleFluid& JSONIncompressibleLibrary::get(std::size_t key) {
 
 
 static JSONIncompressibleLibrary library;
+static Mutex library_load_mutex;
+static AtomicInt library_loaded(0);
 
 void load_incompressible_library()
 {
@@ -609,22 +612,32 @@ void load_incompressible_library()
     //library.add_obj(LiBrSolution());
 }
 
-JSONIncompressibleLibrary & get_incompressible_library(void){
+// Load the library the first time it is needed; if several threads get here at the same time, only one of them loads it.
+// The library is never unloaded, so once it has been loaded the lock is not taken any more.
+static void load_incompressible_library_once()
+{
+    if (library_loaded.load()){ return; }
+    ScopedLock lock(library_load_mutex);
     if (library.is_empty()){ load_incompressible_library(); }
+    library_loaded.store(1);
+}
+
+JSONIncompressibleLibrary & get_incompressible_library(void){
+    load_incompressible_library_once();
     return library;
 }
 
 IncompressibleFluid& get_incompressible_fluid(std::string fluid_string){
-    if (library.is_empty()){ load_incompressible_library(); }
+    load_incompressible_library_once();
     return library.get(fluid_string);
 }
 
 std::string get_incompressible_list_pure(void){
-    if (library.is_empty()){ load_incompressible_library(); }
+    load_incompressible_library_once();
     return library.get_incompressible_list_pure();
 };
 std::string get_incompressible_list_solution(void){
-    if (library.is_empty()){ load_incompressible_library(); }
+    load_incompressible_library_once();
     return library.get_incompressible_list_solution();
 };
 
@@ -26,9 +26,9 @@ protected:
 
 	
 	/// Call the PHIXdll function in the dll
-	long double call_phixdll(long itau, long idelta);
+	CoolPropDbl call_phixdll(long itau, long idelta);
 	/// Call the PHI0dll function in the dll
-	long double call_phi0dll(long itau, long idelta);
+	CoolPropDbl call_phi0dll(long itau, long idelta);
 	
 public:
     REFPROPMixtureBackend(){};
@@ -61,12 +61,12 @@ public:
                 double value2
                 );
 
-    long double calc_molar_mass(void);
+    CoolPropDbl calc_molar_mass(void);
 
     /// Returns true if REFPROP is supported on this platform
     bool REFPROP_supported(void);
 
-    long double calc_cpmolar_idealgas(void);
+    CoolPropDbl calc_cpmolar_idealgas(void);
 
     /// Set the fluids in REFPROP DLL by calling the SETUPdll function
     /**
@@ -78,79 +78,79 @@ public:
     /**
     @param mole_fractions The vector of mole fractions of the components
     */
-    void set_mole_fractions(const std::vector<long double> &mole_fractions);
+    void set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions);
 
     /// Set the mass fractions
     /**
     @param mass_fractions The vector of mass fractions of the components
     */
-    void set_mass_fractions(const std::vector<long double> &mass_fractions);
+    void set_mass_fractions(const std::vector<CoolPropDbl> &mass_fractions);
 
     void calc_phase_envelope(const std::string &type);
 
-    std::vector<long double> calc_mole_fractions_liquid(void){return std::vector<long double>(mole_fractions_liq.begin(), mole_fractions_liq.end());}
-    std::vector<long double> calc_mole_fractions_vapor(void){return std::vector<long double>(mole_fractions_vap.begin(), mole_fractions_vap.end());}
+    std::vector<CoolPropDbl> calc_mole_fractions_liquid(void){return std::vector<CoolPropDbl>(mole_fractions_liq.begin(), mole_fractions_liq.end());}
+    std::vector<CoolPropDbl> calc_mole_fractions_vapor(void){return std::vector<CoolPropDbl>(mole_fractions_vap.begin(), mole_fractions_vap.end());}
 
     /// Check if the mole fractions have been set, etc.
     void check_status();
 
     /// Get the viscosity [Pa-s] (based on the temperature and density in the state class)
-    long double calc_viscosity(void);
+    CoolPropDbl calc_viscosity(void);
     /// Get the thermal conductivity [W/m/K] (based on the temperature and density in the state class)
-    long double calc_conductivity(void);
+    CoolPropDbl calc_conductivity(void);
     /// Get the surface tension [N/m] (based on the temperature in the state class).  Invalid for temperatures above critical point or below triple point temperature
-    long double calc_surface_tension(void);
+    CoolPropDbl calc_surface_tension(void);
 
-    long double calc_fugacity_coefficient(int i);
-    long double calc_melting_line(int param, int given, long double value);
+    CoolPropDbl calc_fugacity_coefficient(int i);
+    CoolPropDbl calc_melting_line(int param, int given, CoolPropDbl value);
     bool has_melting_line(){return true;};
     double calc_melt_Tmax();
-    long double calc_T_critical(void);
-	long double calc_T_reducing(void);
-    long double calc_p_critical(void);
-    long double calc_rhomolar_critical(void);
-	long double calc_rhomolar_reducing(void);
-    long double calc_Ttriple(void);
-	long double calc_gas_constant(void);
+    CoolPropDbl calc_T_critical(void);
+	CoolPropDbl calc_T_reducing(void);
+    CoolPropDbl calc_p_critical(void);
+    CoolPropDbl calc_rhomolar_critical(void);
+	CoolPropDbl calc_rhomolar_reducing(void);
+    CoolPropDbl calc_Ttriple(void);
+	CoolPropDbl calc_gas_constant(void);
 
     /// A wrapper function to calculate the limits for the EOS
     void limits(double &Tmin, double &Tmax, double &rhomolarmax, double &pmax);
     /// Calculate the maximum pressure
-    long double calc_pmax(void);
+    CoolPropDbl calc_pmax(void);
     /// Calculate the maximum temperature
-    long double calc_Tmax(void);
+    CoolPropDbl calc_Tmax(void);
 	
 	/// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r\f$ (dimensionless)
-	long double calc_alphar(void){return call_phixdll(0,0);};
+	CoolPropDbl calc_alphar(void){return call_phixdll(0,0);};
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta}\f$ (dimensionless)
-	long double calc_dalphar_dDelta(void){ return call_phixdll(0,1); };
+	CoolPropDbl calc_dalphar_dDelta(void){ return call_phixdll(0,1); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau}\f$ (dimensionless)
-	long double calc_dalphar_dTau(void){ return call_phixdll(1,0); };
+	CoolPropDbl calc_dalphar_dTau(void){ return call_phixdll(1,0); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta}\f$ (dimensionless)
-	long double calc_d2alphar_dDelta2(void){ return call_phixdll(0,2); };
+	CoolPropDbl calc_d2alphar_dDelta2(void){ return call_phixdll(0,2); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\tau}\f$ (dimensionless)
-	long double calc_d2alphar_dDelta_dTau(void){ return call_phixdll(1,1); };
+	CoolPropDbl calc_d2alphar_dDelta_dTau(void){ return call_phixdll(1,1); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau\tau}\f$ (dimensionless)
-	long double calc_d2alphar_dTau2(void){ return call_phixdll(2,0); };
+	CoolPropDbl calc_d2alphar_dTau2(void){ return call_phixdll(2,0); };
 	/// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta\delta}\f$ (dimensionless)
-    long double calc_d3alphar_dDelta3(void){ return call_phixdll(0,3); };
+    CoolPropDbl calc_d3alphar_dDelta3(void){ return call_phixdll(0,3); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\delta\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dDelta2_dTau(void){ return call_phixdll(1,2); };
+	CoolPropDbl calc_d3alphar_dDelta2_dTau(void){ return call_phixdll(1,2); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\delta\tau\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dDelta_dTau2(void){ return call_phixdll(2,1); };
+	CoolPropDbl calc_d3alphar_dDelta_dTau2(void){ return call_phixdll(2,1); };
     /// Using this backend, calculate the residual Helmholtz energy term \f$\alpha^r_{\tau\tau\tau}\f$ (dimensionless)
-	long double calc_d3alphar_dTau3(void){ return call_phixdll(3,0); };
-
-    long double calc_alpha0(void){ return call_phi0dll(0,0); };
-    long double calc_dalpha0_dDelta(void){ return call_phi0dll(0,1); };
-    long double calc_dalpha0_dTau(void){ return call_phi0dll(1,0); };
-    long double calc_d2alpha0_dDelta2(void){ return call_phi0dll(0,2); };
-    long double calc_d2alpha0_dDelta_dTau(void){ return call_phi0dll(1,1); };
-    long double calc_d2alpha0_dTau2(void){ return call_phi0dll(2,0); };
-    long double calc_d3alpha0_dDelta3(void){ return call_phi0dll(0,3); };
-    long double calc_d3alpha0_dDelta2_dTau(void){ return call_phi0dll(1,2);	};
-    long double calc_d3alpha0_dDelta_dTau2(void){ return call_phi0dll(2,1); };
-    long double calc_d3alpha0_dTau3(void){ return call_phi0dll(3,0); };
+	CoolPropDbl calc_d3alphar_dTau3(void){ return call_phixdll(3,0); };
+
+    CoolPropDbl calc_alpha0(void){ return call_phi0dll(0,0); };
+    CoolPropDbl calc_dalpha0_dDelta(void){ return call_phi0dll(0,1); };
+    CoolPropDbl calc_dalpha0_dTau(void){ return call_phi0dll(1,0); };
+    CoolPropDbl calc_d2alpha0_dDelta2(void){ return call_phi0dll(0,2); };
+    CoolPropDbl calc_d2alpha0_dDelta_dTau(void){ return call_phi0dll(1,1); };
+    CoolPropDbl calc_d2alpha0_dTau2(void){ return call_phi0dll(2,0); };
+    CoolPropDbl calc_d3alpha0_dDelta3(void){ return call_phi0dll(0,3); };
+    CoolPropDbl calc_d3alpha0_dDelta2_dTau(void){ return call_phi0dll(1,2);	};
+    CoolPropDbl calc_d3alpha0_dDelta_dTau2(void){ return call_phi0dll(2,1); };
+    CoolPropDbl calc_d3alpha0_dTau3(void){ return call_phi0dll(3,0); };
 };
 
 } /* namespace CoolProp */
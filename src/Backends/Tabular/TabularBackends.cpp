@@ -1,134 +1,2391 @@
 
 #include "TabularBackends.h"
 #include "CoolProp.h"
+#include "Configuration.h"
+#include "HelmholtzEOSMixtureBackend.h"
+#include "FluidDatabase.h"
+#include "FluidLibrary.h"
+#include "crossplatform_mapped_file.h"
+#include "crossplatform_mutex.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#if defined(ENABLE_CATCH)
+#include "catch.hpp"
+#if !defined(__ISWINDOWS__)
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+#endif
 
 namespace CoolProp{
-    
-void GriddedTableBackend::build_tables(tabular_types type)
-{
-    std::size_t Nx = 20, Ny = 20;
-    long double xmin, xmax, ymin, ymax, x, y;
-    bool logy, logx;
-    
-    parameters xkey, ykey;
-    single_phase.resize(Nx, Ny);
-    
+
+void SinglePhaseGriddedTableData::make_grid(void)
+{
+    xvec.resize(Nx);
+    yvec.resize(Ny);
+    for (std::size_t i = 0; i < Nx; ++i){
+        if (logx){
+            // Log spaced
+            xvec[i] = exp(log(xmin) + (log(xmax) - log(xmin))/(Nx-1)*i);
+        }
+        else{
+            // Linearly spaced
+            xvec[i] = xmin + (xmax - xmin)/(Nx-1)*i;
+        }
+    }
+    for (std::size_t j = 0; j < Ny; ++j){
+        if (logy){
+            // Log spaced
+            yvec[j] = exp(log(ymin) + (log(ymax/ymin))/(Ny-1)*j);
+        }
+        else{
+            // Linearly spaced
+            yvec[j] = ymin + (ymax - ymin)/(Ny-1)*j;
+        }
+    }
+    uniform = true;
+}
+/// Move the interval i of v (with N nodes) found from the spacing of the nodes, which can be off by one from the round-off in the
+/// spacing, to the one that contains value, as the bisection finds it
+static std::size_t correct_cell(const std::vector<double> &v, std::size_t N, double value, std::size_t i)
+{
+    i = std::min(i, N-2);
+    if (i > 0 && value < v[i]){ return i-1; }
+    if (i < N-2 && value >= v[i+1]){ return i+1; }
+    return i;
+}
+/// The index of the interval of v (with N nodes from vmin to vmax) that contains value
+static std::size_t find_cell(const std::vector<double> &v, std::size_t N, double vmin, double vmax, bool logv, bool uniform, double value)
+{
+    std::size_t i;
+    if (uniform){
+        // From the (linear or logarithmic) spacing of the nodes
+        double f = (logv) ? log(value/vmin)/log(vmax/vmin) : (value - vmin)/(vmax - vmin);
+        i = correct_cell(v, N, value, static_cast<std::size_t>(f*(N-1)));
+    }
+    else{
+        i = std::upper_bound(v.begin(), v.end(), value) - v.begin();
+        i = (i > 0) ? i-1 : 0;
+    }
+    return std::min(i, N-2);
+}
+/// The cells of the points of a block of a batch lookup, as find_cell() finds them; the values must be from vmin to vmax
+static void find_cells(const std::vector<double> &v, std::size_t N, double vmin, double vmax, bool logv, bool uniform, const BatchLanes &values, std::size_t *cells)
+{
+    if (!uniform){
+        for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){ cells[k] = find_cell(v, N, vmin, vmax, logv, uniform, values[k]); }
+        return;
+    }
+    // The spacing in SIMD lanes; the logarithms can differ from the scalar ones in the last bit, which correct_cell() takes care of
+    BatchLanes f = (logv) ? BatchLanes((values/vmin).log()*((N-1)/log(vmax/vmin))) : BatchLanes((values - vmin)*((N-1)/(vmax - vmin)));
+    Eigen::Array<int, BATCH_BLOCK_SIZE, 1> i = f.cast<int>();
+    for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){ cells[k] = correct_cell(v, N, values[k], static_cast<std::size_t>(i[k])); }
+}
+std::size_t SinglePhaseGriddedTableData::x_cell(double x)
+{
+    return find_cell(xvec, Nx, xmin, xmax, logx, uniform, x);
+}
+std::size_t SinglePhaseGriddedTableData::y_cell(double y)
+{
+    return find_cell(yvec, Ny, ymin, ymax, logy, uniform, y);
+}
+void AlignedArray::allocate(std::size_t N, double value)
+{
+    // One cache line more than needed, so that the doubles can start at the first cache line boundary in the buffer
+    std::size_t extra = CACHE_LINE_SIZE/sizeof(double);
+    buffer.reset(new std::vector<double>(N + extra, value));
+    mapping.reset();
+    std::size_t address = reinterpret_cast<std::size_t>(&((*buffer)[0]));
+    std::size_t skip = (CACHE_LINE_SIZE - address % CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+    _data = &((*buffer)[0]) + skip/sizeof(double);
+    _size = N;
+}
+void AlignedArray::map(shared_ptr<MappedFile> mapping, std::size_t offset, std::size_t N)
+{
+    if (offset % CACHE_LINE_SIZE != 0 || offset + N*sizeof(double) > mapping->size()){
+        throw ValueError(format("Cannot map %d doubles at offset %d of a file of %d bytes", N, offset, mapping->size()));
+    }
+    this->mapping = mapping;
+    buffer.reset();
+    // The mapping itself starts at a page boundary, so the doubles are aligned
+    _data = const_cast<double*>(reinterpret_cast<const double*>(mapping->data() + offset));
+    _size = N;
+}
+
+void SinglePhaseGriddedTableData::resize(std::size_t Nx, std::size_t Ny)
+{
+    this->Nx = Nx; this->Ny = Ny;
+    nodes.allocate(Nx*Ny*NODE_STRIDE, _HUGE);
+    for (std::size_t i = 0; i < Nx; ++i){
+        for (std::size_t j = 0; j < Ny; ++j){
+            node(i, j)[NODE_PHASE] = iphase_not_imposed;
+            node(i, j)[NODE_CELL_OK] = 0;
+        }
+    }
+}
+/// The variables of the single-phase table, in the order in which they are stored
+static const parameters table_variables[N_TABLE_VARIABLES] = {iT, iP, iDmolar, iHmolar, iSmolar, iCpmolar, iCvmolar, ispeed_sound, iviscosity, iconductivity};
+std::size_t SinglePhaseGriddedTableData::index(parameters key)
+{
+    switch(key){
+        case iT: return 0;
+        case iP: return 1;
+        case iDmolar: return 2;
+        case iHmolar: return 3;
+        case iSmolar: return 4;
+        case iCpmolar: return 5;
+        case iCvmolar: return 6;
+        case ispeed_sound: return 7;
+        case iviscosity: return 8;
+        case iconductivity: return 9;
+        default:
+            throw ValueError(format("The variable [%s] is not in the single-phase table", get_parameter_information(key,"short").c_str()));
+    }
+}
+parameters SinglePhaseGriddedTableData::key(std::size_t index)
+{
+    return table_variables[index];
+}
+
+bool PureFluidSaturationTableData::is_inside(parameters key, double value)
+{
+    if (N < 4){ return false; }
+    std::vector<double> &x = (key == iT) ? T : p;
+    return value >= x[0] && value <= x[N-1];
+}
+std::vector<double> &PureFluidSaturationTableData::get(parameters key, int Q)
+{
+    switch(key){
+        case iT: return T;
+        case iP: return p;
+        case iDmolar: return (Q == 0) ? rhomolarL : rhomolarV;
+        case iHmolar: return (Q == 0) ? hmolarL : hmolarV;
+        case iSmolar: return (Q == 0) ? smolarL : smolarV;
+        default:
+            throw ValueError(format("The variable [%s] is not in the saturation table", get_parameter_information(key,"short").c_str()));
+    }
+}
+double PureFluidSaturationTableData::cubic_interpolation(const std::vector<double> &x, const std::vector<double> &y, double x0, bool logy)
+{
+    std::size_t N = x.size();
+    std::size_t i = std::upper_bound(x.begin(), x.end(), x0) - x.begin();
+    i = std::min(std::max(i, static_cast<std::size_t>(2)), N-2) - 2;
+    double result = 0;
+    for (std::size_t k = i; k < i + 4; ++k){
+        double L = 1;
+        for (std::size_t m = i; m < i + 4; ++m){
+            if (m != k){ L *= (x0 - x[m])/(x[k] - x[m]); }
+        }
+        result += L*((logy) ? log(y[k]) : y[k]);
+    }
+    return result;
+}
+void PureFluidSaturationTableData::cubic_interpolation_range(const std::vector<double> &x, const std::vector<double> &y, double x0min, double x0max, bool logy, double &ymin, double &ymax)
+{
+    std::size_t N = x.size();
+    ymin = _HUGE; ymax = -_HUGE;
+    for (std::size_t k = 0; k < N-1; ++k){
+        double a = std::max(x0min, x[k]), b = std::min(x0max, x[k+1]);
+        if (a > b){ continue; }
+        // The nodes of the cubic that cubic_interpolation uses between x[k] and x[k+1], in Newton form
+        std::size_t i = std::min(std::max(k+1, static_cast<std::size_t>(2)), N-2) - 2;
+        double Y[4], d1 = x[i+1] - x[i], d2 = x[i+2] - x[i];
+        for (int m = 0; m < 4; ++m){ Y[m] = (logy) ? log(y[i+m]) : y[i+m]; }
+        double c1 = (Y[1] - Y[0])/d1, c12 = (Y[2] - Y[1])/(x[i+2] - x[i+1]), c23 = (Y[3] - Y[2])/(x[i+3] - x[i+2]);
+        double c2 = (c12 - c1)/d2, c3 = ((c23 - c12)/(x[i+3] - x[i+1]) - c2)/(x[i+3] - x[i]);
+        // Its extrema are at the ends of [a, b], or where the derivative B + 2*C*s + 3*D*s^2 (with s = x - x[i]) is zero within it
+        double B = c1 - c2*d1 + c3*d1*d2, C = c2 - c3*(d1 + d2), D = c3;
+        double s[4] = {a - x[i], b - x[i], _HUGE, _HUGE};
+        if (std::abs(D) > 0){
+            double disc = C*C - 3*B*D;
+            if (disc >= 0){ s[2] = (-C - sqrt(disc))/(3*D); s[3] = (-C + sqrt(disc))/(3*D); }
+        }
+        else if (std::abs(C) > 0){
+            s[2] = -B/(2*C);
+        }
+        for (int m = 0; m < 4; ++m){
+            if (!(s[m] >= a - x[i] && s[m] <= b - x[i])){ continue; }
+            double z = Y[0] + s[m]*(B + s[m]*(C + s[m]*D));
+            ymin = std::min(ymin, z); ymax = std::max(ymax, z);
+        }
+    }
+    if (logy){ ymin = exp(ymin); ymax = exp(ymax); }
+}
+double PureFluidSaturationTableData::evaluate(parameters output, parameters key, double value, int Q)
+{
+    if (output == key){ return value; }
+    std::vector<double> &x = (key == iT) ? T : logp;
+    double x0 = (key == iT) ? value : log(value);
+    // The pressure and the vapor density vary roughly exponentially along the curve, so their logarithms are interpolated
+    if (output == iP){ return exp(cubic_interpolation(x, logp, x0, false)); }
+    if (output == iDmolar && Q == 1){ return exp(cubic_interpolation(x, rhomolarV, x0, true)); }
+    return cubic_interpolation(x, get(output, Q), x0, false);
+}
+
+void MixtureEnvelopeTableData::build(const PhaseEnvelopeData &env)
+{
+    *this = MixtureEnvelopeTableData();
+    std::size_t N = env.T.size();
+    if (N < 8){ throw ValueError(format("The phase envelope has only %d points", N)); }
+    for (std::size_t i = 0; i < N; ++i){
+        if (i > 0 && !(env.rhomolar_vap[i] > env.rhomolar_vap[i-1])){
+            throw ValueError(format("The density of the phase envelope does not increase at point %d", i));
+        }
+        T.push_back(env.T[i]);
+        logrhomolar.push_back(log(env.rhomolar_vap[i]));
+    }
+    // The critical point is where the bulk phase becomes denser than the incipient phase
+    std::size_t icrit = 0;
+    while (icrit < N && env.rhomolar_vap[icrit] < env.rhomolar_liq[icrit]){ ++icrit; }
+    if (icrit == 0 || icrit == N){ throw ValueError("The phase envelope does not pass through a critical point"); }
+    rhomolar_crit = sqrt(env.rhomolar_vap[icrit-1]*env.rhomolar_vap[icrit]);
+    Tmax = *std::max_element(env.T.begin(), env.T.end());
+    pmax = *std::max_element(env.p.begin(), env.p.end());
+
+    // The dew branch from the start of the envelope, and the bubble branch back from its end
+    for (int Q = 1; Q >= 0; --Q){
+        Branch &b = (Q == 1) ? dew : bubble;
+        for (std::size_t n = 0; n < N; ++n){
+            std::size_t i = (Q == 1) ? n : N-1-n;
+            if ((Q == 1 && i >= icrit) || (Q == 0 && i < icrit)){ break; }
+            if (!b.T.empty() && (env.T[i] <= b.T.back() || env.p[i] <= b.p.back())){ break; }
+            b.T.push_back(env.T[i]); b.p.push_back(env.p[i]); b.logp.push_back(log(env.p[i]));
+            b.rhomolar.push_back(env.rhomolar_vap[i]); b.hmolar.push_back(env.hmolar_vap[i]); b.smolar.push_back(env.smolar_vap[i]);
+        }
+        if (b.T.size() < 4){ throw ValueError(format("The %s branch of the phase envelope has only %d points", (Q == 1) ? "dew" : "bubble", b.T.size())); }
+    }
+}
+phases MixtureEnvelopeTableData::phase(double T, double rhomolar)
+{
+    double logrho = log(rhomolar);
+    std::size_t N = logrhomolar.size();
+    if (logrho <= logrhomolar[0]){
+        if (T < this->T[0]){ return iphase_not_imposed; }
+    }
+    else if (logrho >= logrhomolar[N-1]){
+        if (T < this->T[N-1]){ return iphase_not_imposed; }
+    }
+    else{
+        // Linear interpolation of the temperature of the envelope in log(rhomolar)
+        std::size_t i = std::upper_bound(logrhomolar.begin(), logrhomolar.end(), logrho) - logrhomolar.begin() - 1;
+        double Tenv = this->T[i] + (this->T[i+1] - this->T[i])*(logrho - logrhomolar[i])/(logrhomolar[i+1] - logrhomolar[i]);
+        if (T < Tenv){ return iphase_twophase; }
+    }
+    if (T > Tmax){ return iphase_supercritical; }
+    return (rhomolar < rhomolar_crit) ? iphase_gas : iphase_liquid;
+}
+bool MixtureEnvelopeTableData::is_inside(parameters key, double value, int Q)
+{
+    Branch &b = (Q == 1) ? dew : bubble;
+    if (b.T.size() < 4){ return false; }
+    std::vector<double> &x = (key == iT) ? b.T : b.p;
+    return value >= x.front() && value <= x.back();
+}
+double MixtureEnvelopeTableData::evaluate(parameters output, parameters key, double value, int Q)
+{
+    if (output == key){ return value; }
+    Branch &b = (Q == 1) ? dew : bubble;
+    std::vector<double> &x = (key == iT) ? b.T : b.logp;
+    double x0 = (key == iT) ? value : log(value);
+    switch(output){
+        case iT: return PureFluidSaturationTableData::cubic_interpolation(x, b.T, x0, false);
+        case iP: return exp(PureFluidSaturationTableData::cubic_interpolation(x, b.logp, x0, false));
+        // The density of the gas at the dew point varies roughly exponentially along the branch, like the pressure
+        case iDmolar: return (Q == 1) ? exp(PureFluidSaturationTableData::cubic_interpolation(x, b.rhomolar, x0, true)) : PureFluidSaturationTableData::cubic_interpolation(x, b.rhomolar, x0, false);
+        case iHmolar: return PureFluidSaturationTableData::cubic_interpolation(x, b.hmolar, x0, false);
+        case iSmolar: return PureFluidSaturationTableData::cubic_interpolation(x, b.smolar, x0, false);
+        default:
+            throw ValueError(format("The variable [%s] is not in the phase envelope", get_parameter_information(output,"short").c_str()));
+    }
+}
+
+/// The second-order Taylor expansion of one variable about a node, at (dx, dy) from it
+static double taylor_expansion(const double *v, double dx, double dy)
+{
+    return v[VALUE] + dx*v[DVDX] + dy*v[DVDY] + 0.5*dx*dx*v[D2VDX2] + dx*dy*v[D2VDXDY] + 0.5*dy*dy*v[D2VDY2];
+}
+
+/// Store the value and derivatives of one variable at a node from the state of AS
+static void fill_node(AbstractState &AS, double *v, parameters key, parameters xkey, parameters ykey)
+{
+    v[VALUE] = AS.keyed_output(key);
+    v[DVDX] = AS.first_partial_deriv(key, xkey, ykey);
+    v[DVDY] = AS.first_partial_deriv(key, ykey, xkey);
+    v[D2VDX2] = AS.second_partial_deriv(key, xkey, ykey, xkey, ykey);
+    v[D2VDXDY] = AS.second_partial_deriv(key, xkey, ykey, ykey, xkey);
+    v[D2VDY2] = AS.second_partial_deriv(key, ykey, xkey, ykey, xkey);
+}
+
+/// The channels of the table, which are not state variables, and the number of them that do not need the transport properties
+static const parameters channels[5] = {iCpmolar, iCvmolar, ispeed_sound, iviscosity, iconductivity};
+static const int N_THERMODYNAMIC_CHANNELS = 3;
+
+/// Evaluate the channels at (T, rhomolar) with AS, whose phase is imposed; the transport properties are set to _HUGE if they cannot be calculated
+static void evaluate_channels(AbstractState &AS, double T, double rhomolar, double *values)
+{
+    AS.update(DmolarT_INPUTS, rhomolar, T);
+    for (int c = 0; c < N_THERMODYNAMIC_CHANNELS; ++c){ values[c] = AS.keyed_output(channels[c]); }
+    try{
+        values[3] = AS.viscosity();
+        values[4] = AS.conductivity();
+    }
+    catch(std::exception &){
+        values[3] = _HUGE; values[4] = _HUGE;
+    }
+}
+
+/** Store the values and derivatives of the channels at node (i, j), whose state variables have been filled in from AS
+ *
+ * The derivatives with respect to T and rhomolar are found by central differences about the node, with the phase of the node
+ * imposed on AS so that the states next to the saturation curve are evaluated on the same side of it as the node.  They are then
+ * converted to derivatives with respect to x and y with the chain rule, using the derivatives of T and rhomolar at the node.
+ */
+static void fill_channels(AbstractState &AS, SinglePhaseGriddedTableData &t, std::size_t i, std::size_t j)
+{
+    const double *Tv = t.variable(i, j, iT), *Dv = t.variable(i, j, iDmolar);
+    double T = Tv[VALUE], rho = Dv[VALUE], dT = 1e-4*T, drho = 1e-4*rho;
+
+    // f[a][b] is the value of the channel at (T + (a-1)*dT, rho + (b-1)*drho)
+    double f[3][3][5];
+    bool imposed = true;
+    try{ AS.specify_phase(AS.phase()); } catch(std::exception &){ imposed = false; }
+    try{
+        for (int a = 0; a < 3; ++a){
+            for (int b = 0; b < 3; ++b){
+                evaluate_channels(AS, T + (a-1)*dT, rho + (b-1)*drho, f[a][b]);
+            }
+        }
+    }
+    catch(...){
+        if (imposed){ AS.unspecify_phase(); }
+        throw;
+    }
+    if (imposed){ AS.unspecify_phase(); }
+
+    for (int c = 0; c < 5; ++c){
+        double *v = t.variable(i, j, channels[c]);
+        if (!ValidNumber(f[1][1][c]) || !ValidNumber(f[0][0][c]) || !ValidNumber(f[2][2][c])){
+            // Only the transport properties may be missing
+            v[VALUE] = _HUGE;
+            continue;
+        }
+        double fT = (f[2][1][c] - f[0][1][c])/(2*dT), fD = (f[1][2][c] - f[1][0][c])/(2*drho);
+        double fTT = (f[2][1][c] - 2*f[1][1][c] + f[0][1][c])/(dT*dT), fDD = (f[1][2][c] - 2*f[1][1][c] + f[1][0][c])/(drho*drho);
+        double fTD = (f[2][2][c] - f[2][0][c] - f[0][2][c] + f[0][0][c])/(4*dT*drho);
+        v[VALUE] = f[1][1][c];
+        v[DVDX] = fT*Tv[DVDX] + fD*Dv[DVDX];
+        v[DVDY] = fT*Tv[DVDY] + fD*Dv[DVDY];
+        v[D2VDX2] = fTT*Tv[DVDX]*Tv[DVDX] + 2*fTD*Tv[DVDX]*Dv[DVDX] + fDD*Dv[DVDX]*Dv[DVDX] + fT*Tv[D2VDX2] + fD*Dv[D2VDX2];
+        v[D2VDXDY] = fTT*Tv[DVDX]*Tv[DVDY] + fTD*(Tv[DVDX]*Dv[DVDY] + Tv[DVDY]*Dv[DVDX]) + fDD*Dv[DVDX]*Dv[DVDY] + fT*Tv[D2VDXDY] + fD*Dv[D2VDXDY];
+        v[D2VDY2] = fTT*Tv[DVDY]*Tv[DVDY] + 2*fTD*Tv[DVDY]*Dv[DVDY] + fDD*Dv[DVDY]*Dv[DVDY] + fT*Tv[D2VDY2] + fD*Dv[D2VDY2];
+    }
+}
+
+void GriddedTableBackend::set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions)
+{
+    AS->set_mole_fractions(mole_fractions);
+    // The tables are for one composition only
+    if (mole_fractions != this->mole_fractions){
+        this->mole_fractions = mole_fractions;
+        tables_built = false;
+    }
+}
+
+/// A 32-bit FNV-1a hash of a string, starting from the given offset basis
+static unsigned int fnv1a(const std::string &s, unsigned int hash)
+{
+    for (std::size_t i = 0; i < s.size(); ++i){
+        hash ^= static_cast<unsigned char>(s[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/// The fluid string of a backend, for the factory
+static std::string fluids_string(AbstractState &AS)
+{
+    std::vector<std::string> names = AS.fluid_names();
+    std::string fluids;
+    for (std::size_t i = 0; i < names.size(); ++i){ fluids += (i > 0) ? "&" + names[i] : names[i]; }
+    return fluids;
+}
+
+/// The density at (p, T) in the phase given, by Newton iteration from rhomolar with the phase imposed on AS
+static double solve_rhomolar(AbstractState &AS, double p, double T, phases phase, double rhomolar)
+{
+    AS.specify_phase(phase);
+    try{
+        for (int iter = 0; iter < 50; ++iter){
+            AS.update(DmolarT_INPUTS, rhomolar, T);
+            double dpdrho = AS.first_partial_deriv(iP, iDmolar, iT);
+            if (!(dpdrho > 0)){ break; }
+            // At most 10% at a time, so as not to jump to the other phase
+            double drho = std::max(std::min(-(AS.p() - p)/dpdrho, 0.1*rhomolar), -0.1*rhomolar);
+            rhomolar += drho;
+            if (std::abs(drho) < 1e-12*rhomolar){
+                AS.unspecify_phase();
+                return rhomolar;
+            }
+        }
+    }
+    catch(...){
+        AS.unspecify_phase();
+        throw;
+    }
+    AS.unspecify_phase();
+    throw ValueError(format("Unable to find the density at p = %g Pa and T = %g K", p, T));
+}
+
+void GriddedTableBackend::build_mixture_envelope(void)
+{
+    // Building the envelope leaves the flash routines of the backend that builds it unusable, so it has a backend of its own
+    shared_ptr<AbstractState> HEOS(AbstractState::factory(AS_backend_name, fluids_string(*AS)));
+    HEOS->set_mole_fractions(mole_fractions);
+    try{
+        HEOS->build_phase_envelope("");
+    }
+    catch(std::exception &){
+        // The envelope may be complete even though a later stage of the build failed; it is checked below
+    }
+    const PhaseEnvelopeData &env = HEOS->get_phase_envelope_data();
+    if (!env.built){ throw ValueError(format("Unable to build the phase envelope of %s", fluids_string(*AS).c_str())); }
+    mixture_envelope.build(env);
+}
+
+GriddedTableBackend::tabular_types GriddedTableBackend::get_table_type(const std::string &name)
+{
+    if (name == "LOGPH"){ return LOGPH_TABLE; }
+    else if (name == "LOGPT"){ return LOGPT_TABLE; }
+    else if (name == "LOGDT"){ return LOGDT_TABLE; }
+    else if (name == "LOGPS"){ return LOGPS_TABLE; }
+    else{
+        throw ValueError(format("Invalid table type [%s]; it must be one of LOGPH, LOGPT, LOGDT or LOGPS", name.c_str()));
+    }
+}
+
+void GriddedTableBackend::set_table_limits(tabular_types type)
+{
+    std::size_t Nx = Nx_config, Ny = Ny_config;
+    if (Nx < 2 || Ny < 2){
+        throw ValueError(format("The table must have at least 2 nodes in each direction; TABULAR_NX is %d and TABULAR_NY is %d", Nx, Ny));
+    }
+
+    // The wrapped backend can only be updated with T and rhomolar for mixtures, so they always have a LOGDT table
+    bool mixture = AS->fluid_names().size() > 1;
+    if (mixture){
+        build_mixture_envelope();
+        type = LOGDT_TABLE;
+    }
+
+    single_phase = SinglePhaseGriddedTableData();
+    single_phase.Nx = Nx;
+    single_phase.Ny = Ny;
+
     switch(type){
         case LOGPH_TABLE:
         {
-            xkey = iHmolar;
-            ykey = iP;
-            logy = true;
-            logx = false;
-            
+            table_type_name = "LOGPH";
+            single_phase.xkey = iHmolar;
+            single_phase.ykey = iP;
+            single_phase.logy = true;
+            single_phase.logx = false;
+
             // ---------------------------------
             // Calculate the limits of the table
             // ---------------------------------
-            
+
             // Minimum enthalpy is the saturated liquid enthalpy
             AS->update(QT_INPUTS, 0, AS->Ttriple());
-            xmin = AS->hmolar();
-            ymin = AS->p();
-            
+            single_phase.xmin = AS->hmolar();
+            single_phase.ymin = AS->p();
+
             // Check both the enthalpies at the Tmax isotherm to see whether to use low or high pressure
             AS->update(PT_INPUTS, 1e-10, AS->Tmax());
-            long double xmax1 = AS->hmolar();
+            CoolPropDbl xmax1 = AS->hmolar();
             AS->update(PT_INPUTS, AS->pmax(), AS->Tmax());
-            long double xmax2 = AS->hmolar();
-            xmax = std::min(xmax1, xmax2);
-            
-            ymax = AS->pmax();
-            
+            CoolPropDbl xmax2 = AS->hmolar();
+            single_phase.xmax = std::min(xmax1, xmax2);
+
+            single_phase.ymax = AS->pmax();
+            break;
+        }
+        case LOGPT_TABLE:
+        {
+            table_type_name = "LOGPT";
+            single_phase.xkey = iT;
+            single_phase.ykey = iP;
+            single_phase.logy = true;
+            single_phase.logx = false;
+
+            // From the triple point to the limits of the equation of state; the saturation curve is a line across the table
+            AS->update(QT_INPUTS, 0, AS->Ttriple());
+            single_phase.xmin = AS->Ttriple();
+            single_phase.ymin = AS->p();
+            single_phase.xmax = AS->Tmax();
+            single_phase.ymax = AS->pmax();
+            break;
+        }
+        case LOGDT_TABLE:
+        {
+            table_type_name = "LOGDT";
+            single_phase.xkey = iT;
+            single_phase.ykey = iDmolar;
+            single_phase.logy = true;
+            single_phase.logx = false;
+
+            if (mixture){
+                // As for a pure fluid, with the low-pressure ends of the envelope in place of the triple point
+                MixtureEnvelopeTableData &env = mixture_envelope;
+                double pmin = std::min(env.dew.p[0], env.bubble.p[0]);
+                single_phase.xmin = std::min(env.dew.T[0], env.bubble.T[0]);
+                single_phase.xmax = AS->Tmax();
+                single_phase.ymin = solve_rhomolar(*AS, pmin, single_phase.xmax, iphase_gas, pmin/(AS->gas_constant()*single_phase.xmax));
+                single_phase.ymax = solve_rhomolar(*AS, AS->pmax(), single_phase.xmin, iphase_liquid, env.bubble.rhomolar[0]);
+                break;
+            }
+            // The lowest density is that of the gas at the triple point pressure and Tmax, the highest that of the liquid at
+            // pmax and the triple point temperature; the states in the saturation dome are holes in the table
+            AS->update(QT_INPUTS, 0, AS->Ttriple());
+            double ptriple = AS->p();
+            single_phase.xmin = AS->Ttriple();
+            single_phase.xmax = AS->Tmax();
+            AS->update(PT_INPUTS, ptriple, AS->Tmax());
+            single_phase.ymin = AS->rhomolar();
+            AS->update(PT_INPUTS, AS->pmax(), AS->Ttriple());
+            single_phase.ymax = AS->rhomolar();
+            break;
+        }
+        case LOGPS_TABLE:
+        {
+            table_type_name = "LOGPS";
+            single_phase.xkey = iSmolar;
+            single_phase.ykey = iP;
+            single_phase.logy = true;
+            single_phase.logx = false;
+
+            // Minimum entropy is the saturated liquid entropy
+            AS->update(QT_INPUTS, 0, AS->Ttriple());
+            single_phase.xmin = AS->smolar();
+            single_phase.ymin = AS->p();
+
+            // The entropy varies with log(p) in the gas, so the largest entropy at the Tmax isotherm within the pressure range
+            // of the table is at the lowest pressure
+            AS->update(PT_INPUTS, single_phase.ymin, AS->Tmax());
+            single_phase.xmax = AS->smolar();
+            single_phase.ymax = AS->pmax();
             break;
         }
         default:
         {
-            throw ValueError(format(""));
+            throw ValueError(format("Invalid table type [%d]", type));
+        }
+    }
+    p_critical_table = (mixture) ? mixture_envelope.pmax : AS->p_critical();
+    T_critical_table = (mixture) ? mixture_envelope.Tmax : AS->T_critical();
+    single_phase.make_grid();
+
+    // ----------------------------------------------------------
+    // The key of the tables, made of everything they depend on
+    // ----------------------------------------------------------
+
+    // The equation of state of HEOS is represented by the coefficients of its components, as they are written to the fluid
+    // database (see FluidDatabase.h): all the terms of alphar and alpha0 with the reference state, the reducing state, the
+    // transport models and the rest of the fluid.  Two chained hashes of them are enough, since the tables only need to tell
+    // the fluids apart.
+    std::string coefficients;
+    HelmholtzEOSMixtureBackend *HEOS = dynamic_cast<HelmholtzEOSMixtureBackend*>(AS.get());
+    if (HEOS != NULL){
+        FluidDatabaseWriter writer;
+        const std::vector<CoolPropFluid*> &components = HEOS->get_components();
+        for (std::size_t i = 0; i < components.size(); ++i){ serialize(writer, *components[i]); }
+        // The viscosity and conductivity from extended corresponding states also depend on the reference fluid, which HEOS
+        // takes from the library
+        for (std::size_t i = 0; i < components.size(); ++i){
+            TransportPropertyData &transport = components[i]->transport;
+            if (transport.viscosity_using_ECS){ serialize(writer, *get_library().get_shared(transport.viscosity_ecs.reference_fluid)); }
+            if (transport.conductivity_using_ECS){ serialize(writer, *get_library().get_shared(transport.conductivity_ecs.reference_fluid)); }
+        }
+        unsigned int h1 = fnv1a(writer.buffer, 2166136261u), h2 = fnv1a(writer.buffer, h1);
+        coefficients = format("|%08x%08x", h1, h2);
+    }
+
+    // The coefficients of the other backends cannot be reached, nor can the interaction parameters of the mixtures of HEOS,
+    // so the equation of state is also represented by its outputs at a few states along the Tmax isotherm (the limits of the
+    // table above depend on it too); if any of its coefficients, its reference state or its transport models change, so will these.  Mixtures have
+    // no critical point of their own, so the reducing state and the envelope stand in for it, and their phase is imposed
+    std::vector<double> fingerprint;
+    if (HEOS == NULL || mixture){
+        fingerprint.push_back(AS->molar_mass());
+        fingerprint.push_back(AS->gas_constant());
+        if (mixture){
+            fingerprint.push_back(AS->T_reducing());
+            fingerprint.push_back(AS->rhomolar_reducing());
+            fingerprint.push_back(mixture_envelope.Tmax);
+            fingerprint.push_back(mixture_envelope.pmax);
+            AS->specify_phase(iphase_gas);
+        }
+        else{
+            fingerprint.push_back(AS->T_critical());
+            fingerprint.push_back(AS->p_critical());
+            fingerprint.push_back(AS->rhomolar_critical());
+        }
+        double rho_ref = (mixture) ? AS->rhomolar_reducing() : AS->rhomolar_critical();
+        double reduced_densities[3] = {0.01, 0.5, 1.5};
+        try{
+            for (int k = 0; k < 3; ++k){
+                AS->update(DmolarT_INPUTS, reduced_densities[k]*rho_ref, AS->Tmax());
+                fingerprint.push_back(AS->p());
+                fingerprint.push_back(AS->hmolar());
+                fingerprint.push_back(AS->smolar());
+                fingerprint.push_back(AS->cvmolar());
+                // The transport properties are in the tables too, if the backend has them
+                double transport[2] = {_HUGE, _HUGE};
+                try{
+                    transport[0] = AS->viscosity();
+                    transport[1] = AS->conductivity();
+                }
+                catch(std::exception &){}
+                fingerprint.push_back(transport[0]);
+                fingerprint.push_back(transport[1]);
+            }
+        }
+        catch(...){
+            if (mixture){ AS->unspecify_phase(); }
+            throw;
+        }
+        if (mixture){ AS->unspecify_phase(); }
+    }
+
+    std::string fluids = fluids_string(*AS);
+
+    tables_key = format("CoolProp tables|version %d|%s|%s|%s|%d|%d|%d|%d|%0.17g", TABLES_FORMAT_VERSION, AS_backend_name.c_str(), fluids.c_str(), table_type_name.c_str(),
+                        static_cast<int>(Nx), static_cast<int>(Ny), static_cast<int>(single_phase.logx), static_cast<int>(single_phase.logy),
+                        std::max(refinement_tolerance, 0.0));
+    for (std::size_t i = 0; i < mole_fractions.size(); ++i){ tables_key += format("|%0.17g", static_cast<double>(mole_fractions[i])); }
+    tables_key += format("|%0.17g|%0.17g|%0.17g|%0.17g", single_phase.xmin, single_phase.xmax, single_phase.ymin, single_phase.ymax);
+    tables_key += coefficients;
+    for (std::size_t i = 0; i < fingerprint.size(); ++i){ tables_key += format("|%0.17g", fingerprint[i]); }
+}
+
+/// The parts of a table build that are left, shared by the threads that build them: part 0 is the saturation table (pure fluids
+/// only; it takes the longest, so it goes first) and part k+1 is row k of the single-phase table, to build or to estimate the
+/// errors of, depending on the stage of the build
+struct GriddedTableBackend::BuildQueue
+{
+    Mutex mutex;
+    std::size_t next, N;
+    BuildQueue(std::size_t N, bool saturation) : next(saturation ? 0 : 1), N(N+1) {};
+    /// Take the next part to build; returns false if there are none left
+    bool pop(std::size_t &part){
+        ScopedLock lock(mutex);
+        if (next >= N){ return false; }
+        part = next++;
+        return true;
+    };
+};
+/// One of the threads of a parallel build, with a backend of its own
+struct GriddedTableBackend::BuildThread
+{
+    GriddedTableBackend *backend;
+    BuildQueue *queue;
+    shared_ptr<AbstractState> AS;
+    std::string errstring; ///< The error that stopped the thread, if any
+};
+void GriddedTableBackend::run_build_thread(BuildThread &thread)
+{
+    try{
+        thread.backend->build_from_queue(*(thread.AS), *(thread.queue));
+    }
+    catch(std::exception &e){
+        thread.errstring = e.what();
+    }
+}
+void GriddedTableBackend::build_from_queue(AbstractState &AS, BuildQueue &queue)
+{
+    std::size_t part;
+    while (queue.pop(part)){
+        if (part == 0){
+            build_saturation_table(AS);
+        }
+        else if (build_stage == BUILD_NODES){
+            build_row(AS, part-1);
+        }
+        else{
+            estimate_row(AS, part-1);
         }
     }
+}
+void GriddedTableBackend::run_build(std::vector<BuildThread> &threads, std::size_t Nrows, bool saturation)
+{
+    BuildQueue queue(Nrows, saturation);
+    if (threads.empty()){
+        build_from_queue(*AS, queue);
+        return;
+    }
+    for (std::size_t k = 0; k < threads.size(); ++k){
+        threads[k].queue = &queue;
+        threads[k].errstring.clear();
+    }
+    run_in_threads(&run_build_thread, threads);
+    for (std::size_t k = 0; k < threads.size(); ++k){
+        if (!threads[k].errstring.empty()){
+            throw ValueError(format("Unable to build the tables: %s", threads[k].errstring.c_str()));
+        }
+    }
+}
+
+void GriddedTableBackend::build_tables(void)
+{
+    set_table_limits(table_type);
+    SinglePhaseGriddedTableData &t = single_phase;
+    t.resize(t.Nx, t.Ny);
+    x_new.assign(t.Nx, 1);
+    y_new.assign(t.Ny, 1);
+
     if (get_debug_level() > 5){
         std::cout << format("***********************************************\n");
         std::cout << format(" Single-Phase Table (%s) \n", AS->name().c_str());
         std::cout << format("***********************************************\n");
     }
-    // ------------------------
-    // Actually build the table
-    // ------------------------
-    for (std::size_t i = 0; i < Nx; ++i)
-    {
-        // Calculate the x value
-        if (logx){
-            // Log spaced
-            x = exp(log(xmin) + (log(xmax) - log(xmin))/(Nx-1)*i);
+    // The threads are kept for all the stages of the build; with one thread, AS builds everything
+    std::size_t Nthreads = (Nthreads_config > 0) ? Nthreads_config : static_cast<std::size_t>(get_number_of_processors());
+    Nthreads = std::min(Nthreads, t.Nx + 1);
+    std::vector<BuildThread> threads((Nthreads > 1) ? Nthreads : 0);
+    if (!threads.empty()){
+        std::string fluids = fluids_string(*AS);
+        for (std::size_t k = 0; k < Nthreads; ++k){
+            threads[k].backend = this;
+            threads[k].AS.reset(AbstractState::factory(AS_backend_name, fluids));
+            if (!mole_fractions.empty()){ threads[k].AS->set_mole_fractions(mole_fractions); }
         }
-        else{
-            // Linearly spaced
-            x = xmin + (xmax - xmin)/(Nx-1)*i;
+    }
+    build_stage = BUILD_NODES;
+    run_build(threads, t.Nx, AS->fluid_names().size() == 1);
+
+    std::vector<int> xlevel(t.Nx-1, 0), ylevel(t.Ny-1, 0);
+    for (int pass = 0; refinement_tolerance > 0 && pass < MAX_REFINEMENT_LEVELS; ++pass){
+        build_stage = ESTIMATE_ERRORS;
+        cell_error.assign((t.Nx-1)*(t.Ny-1), 0.0);
+        run_build(threads, t.Nx-1, false);
+        if (!refine_grid(xlevel, ylevel)){ break; }
+        if (get_debug_level() > 0){ std::cout << format("Refined the tables to %d x %d nodes\n", t.Nx, t.Ny); }
+        // Only the nodes in the new columns and rows are built
+        build_stage = BUILD_NODES;
+        run_build(threads, t.Nx, false);
+    }
+    x_new.clear(); y_new.clear(); cell_error.clear();
+    flag_cells();
+    tables_built = true;
+}
+
+phases GriddedTableBackend::update_node_state(AbstractState &AS, double x, double y)
+{
+    if (mixture_envelope.empty()){
+        try{
+            double value1, value2;
+            input_pairs pair = generate_update_pair(single_phase.xkey, x, single_phase.ykey, y, value1, value2);
+            AS.update(pair, value1, value2);
         }
-        for (std::size_t j = 0; j < Ny; ++j)
-        {
-            // Calculate the x value
-            if (logy){
-                // Log spaced
-                y = exp(log(ymin) + (log(ymax/ymin))/(Ny-1)*j);
-            }
-            else{
-                // Linearly spaced
-                y = ymin + (ymax - ymin)/(Ny-1)*j;
-            }
-            
-            if (get_debug_level() > 5){std::cout << "x: " << x << " y: " << y;}
-            
-            if (xkey == iHmolar && ykey == iP)
-            {
-                // --------------------
-                //   Update the state
-                // --------------------
-                try{
-                    AS->update(HmolarP_INPUTS, x, y);
+        catch(std::exception &e){
+            if (get_debug_level() > 5){std::cout << " " << e.what() << std::endl;}
+            return iphase_not_imposed;
+        }
+        return AS.phase();
+    }
+    // Mixtures: the phase comes from the envelope, and is imposed for the update with T and rhomolar
+    phases phase = mixture_envelope.phase(x, y);
+    if (phase == iphase_twophase || phase == iphase_not_imposed){ return phase; }
+    AS.specify_phase(phase);
+    try{
+        AS.update(DmolarT_INPUTS, y, x);
+    }
+    catch(std::exception &e){
+        if (get_debug_level() > 5){std::cout << " " << e.what() << std::endl;}
+        phase = iphase_not_imposed;
+    }
+    AS.unspecify_phase();
+    return phase;
+}
+
+void GriddedTableBackend::estimate_row(AbstractState &AS, std::size_t i)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // The variables compared are the first two of T, rhomolar, p and hmolar that are not variables of the table
+    parameters candidates[4] = {iT, iDmolar, iP, iHmolar}, keys[2];
+    for (int k = 0, n = 0; k < 4 && n < 2; ++k){
+        if (candidates[k] != t.xkey && candidates[k] != t.ykey){ keys[n++] = candidates[k]; }
+    }
+    for (std::size_t j = 0; j < t.Ny-1; ++j){
+        // Cells with corners that are missing or on both sides of the saturation curve are never interpolated; refining them
+        // would only add nodes without making the interpolation more accurate
+        bool ok = true, liquid = false, gas = false, subcritical = false;
+        for (std::size_t ii = i; ii <= i+1; ++ii){
+            for (std::size_t jj = j; jj <= j+1; ++jj){
+                if (!t.valid(ii, jj)){ ok = false; continue; }
+                int phase = t.phase(ii, jj);
+                if (phase == iphase_liquid){ liquid = true; }
+                if (phase == iphase_gas || phase == iphase_supercritical_gas){ gas = true; }
+                if (t.variable(ii, jj, iP)[VALUE] < p_critical_table){ subcritical = true; }
+            }
+        }
+        if (!ok || (liquid && gas && subcritical)){ continue; }
+
+        // The center of the cell, in the same spacing as the nodes
+        double x = (t.logx) ? sqrt(t.xvec[i]*t.xvec[i+1]) : 0.5*(t.xvec[i] + t.xvec[i+1]);
+        double y = (t.logy) ? sqrt(t.yvec[j]*t.yvec[j+1]) : 0.5*(t.yvec[j] + t.yvec[j+1]);
+        phases phase = update_node_state(AS, x, y);
+        if (phase == iphase_not_imposed){ continue; }
+        double &error = cell_error[i*(t.Ny-1) + j];
+        if (phase == iphase_twophase){
+            // The saturation curve cuts the cell although all its corners are on the same side of it
+            error = _HUGE;
+            continue;
+        }
+        // The largest error of the expansions about the four corners, whichever of them TTSE would use
+        for (int k = 0; k < 2; ++k){
+            double exact = AS.keyed_output(keys[k]);
+            for (std::size_t ii = i; ii <= i+1; ++ii){
+                for (std::size_t jj = j; jj <= j+1; ++jj){
+                    double estimate = taylor_expansion(t.variable(ii, jj, keys[k]), x - t.xvec[ii], y - t.yvec[jj]);
+                    error = std::max(error, std::abs(estimate/exact - 1));
                 }
-                catch(std::exception &e){
-                    // That failed for some reason, go to the next pair
-                    if (get_debug_level() > 5){std::cout << " " << e.what() << std::endl;}
-                    continue;
+            }
+        }
+    }
+}
+
+/// Choose the intervals of a grid with errors above the tolerance to split, the worst first, so that the grid has at most Nmax nodes
+static std::vector<char> choose_splits(const std::vector<double> &error, const std::vector<int> &level, double tolerance, std::size_t Nmax)
+{
+    std::vector<std::pair<double, std::size_t> > candidates;
+    for (std::size_t i = 0; i < error.size(); ++i){
+        if (error[i] > tolerance && level[i] < MAX_REFINEMENT_LEVELS){ candidates.push_back(std::pair<double, std::size_t>(-error[i], i)); }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    std::size_t N = error.size() + 1, Nsplit = (Nmax > N) ? std::min(candidates.size(), Nmax - N) : 0;
+    std::vector<char> split(error.size(), 0);
+    for (std::size_t k = 0; k < Nsplit; ++k){ split[candidates[k].second] = 1; }
+    return split;
+}
+/// Insert the midpoints of the intervals of v that are split, keeping track of the old index of each node (or npos for a new one)
+/// and of the level of each interval
+static void split_intervals(const std::vector<double> &v, bool logv, const std::vector<char> &split, std::vector<int> &level,
+                            std::vector<double> &vnew, std::vector<std::size_t> &old)
+{
+    std::vector<int> levelnew;
+    vnew.clear(); old.clear();
+    for (std::size_t i = 0; i < v.size(); ++i){
+        vnew.push_back(v[i]); old.push_back(i);
+        if (i+1 == v.size()){ break; }
+        if (split[i]){
+            vnew.push_back((logv) ? sqrt(v[i]*v[i+1]) : 0.5*(v[i] + v[i+1])); old.push_back(std::string::npos);
+            levelnew.push_back(level[i]+1); levelnew.push_back(level[i]+1);
+        }
+        else{
+            levelnew.push_back(level[i]);
+        }
+    }
+    level = levelnew;
+}
+bool GriddedTableBackend::refine_grid(std::vector<int> &xlevel, std::vector<int> &ylevel)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // The error of a column (row) of cells is the largest of its cells
+    std::vector<double> xerror(t.Nx-1, 0.0), yerror(t.Ny-1, 0.0);
+    for (std::size_t i = 0; i < t.Nx-1; ++i){
+        for (std::size_t j = 0; j < t.Ny-1; ++j){
+            double error = cell_error[i*(t.Ny-1) + j];
+            xerror[i] = std::max(xerror[i], error);
+            yerror[j] = std::max(yerror[j], error);
+        }
+    }
+    std::vector<char> xsplit = choose_splits(xerror, xlevel, refinement_tolerance, MAX_REFINEMENT_GROWTH*Nx_config);
+    std::vector<char> ysplit = choose_splits(yerror, ylevel, refinement_tolerance, MAX_REFINEMENT_GROWTH*Ny_config);
+    if (std::count(xsplit.begin(), xsplit.end(), 1) + std::count(ysplit.begin(), ysplit.end(), 1) == 0){ return false; }
+
+    std::vector<double> xvec, yvec;
+    std::vector<std::size_t> xold, yold;
+    split_intervals(t.xvec, t.logx, xsplit, xlevel, xvec, xold);
+    split_intervals(t.yvec, t.logy, ysplit, ylevel, yvec, yold);
+
+    // The nodes that are already there are copied to the new grid
+    SinglePhaseGriddedTableData old = t;
+    t.xvec = xvec; t.yvec = yvec;
+    t.uniform = false;
+    t.resize(xvec.size(), yvec.size());
+    x_new.assign(t.Nx, 0);
+    y_new.assign(t.Ny, 0);
+    for (std::size_t i = 0; i < t.Nx; ++i){ x_new[i] = (xold[i] == std::string::npos); }
+    for (std::size_t j = 0; j < t.Ny; ++j){ y_new[j] = (yold[j] == std::string::npos); }
+    for (std::size_t i = 0; i < t.Nx; ++i){
+        for (std::size_t j = 0; j < t.Ny; ++j){
+            if (x_new[i] || y_new[j]){ continue; }
+            memcpy(t.node(i, j), old.node(xold[i], yold[j]), NODE_STRIDE*sizeof(double));
+        }
+    }
+    return true;
+}
+
+void GriddedTableBackend::flag_cells(void)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    for (std::size_t i = 0; i < t.Nx-1; ++i){
+        for (std::size_t j = 0; j < t.Ny-1; ++j){
+            // All the corners of the cell must be in the table, and, below the critical pressure, they may not be on
+            // both sides of the saturation curve, otherwise the cell could contain two-phase states
+            bool ok = true, liquid = false, gas = false, subcritical = false, transport = true;
+            for (std::size_t ii = i; ii <= i+1; ++ii){
+                for (std::size_t jj = j; jj <= j+1; ++jj){
+                    if (!t.valid(ii, jj)){ ok = false; continue; }
+                    int phase = t.phase(ii, jj);
+                    if (phase == iphase_liquid){ liquid = true; }
+                    if (phase == iphase_gas || phase == iphase_supercritical_gas){ gas = true; }
+                    if (t.variable(ii, jj, iP)[VALUE] < p_critical_table){ subcritical = true; }
+                    if (!ValidNumber(t.variable(ii, jj, iviscosity)[VALUE]) || !ValidNumber(t.variable(ii, jj, iconductivity)[VALUE])){ transport = false; }
                 }
-                    
-                // Skip two-phase states - they will remain as _HUGE holes in the table
-                if (AS->phase() == iphase_twophase){ 
-                    if (get_debug_level() > 5){std::cout << " 2Phase" << std::endl;}
-                    continue;
-                };
-                
-                // --------------------
-                //   State variables
-                // --------------------
-                single_phase.T[i][j] = AS->T();
-                single_phase.p[i][j] = AS->p();
-                single_phase.rhomolar[i][j] = AS->rhomolar();
-                single_phase.hmolar[i][j] = AS->hmolar();
-                single_phase.smolar[i][j] = AS->smolar();
-                
-                // ----------------------------------------
-                //   First derivatives of state variables
-                // ----------------------------------------
-                single_phase.dTdx[i][j] = AS->first_partial_deriv(iT, xkey, ykey);
-                single_phase.dTdy[i][j] = AS->first_partial_deriv(iT, ykey, xkey);
-                single_phase.dpdx[i][j] = AS->first_partial_deriv(iP, xkey, ykey);
-                single_phase.dpdy[i][j] = AS->first_partial_deriv(iP, ykey, xkey);
-                single_phase.drhomolardx[i][j] = AS->first_partial_deriv(iDmolar, xkey, ykey);
-                single_phase.drhomolardy[i][j] = AS->first_partial_deriv(iDmolar, ykey, xkey);
-                single_phase.dhmolardx[i][j] = AS->first_partial_deriv(iHmolar, xkey, ykey);
-                single_phase.dhmolardy[i][j] = AS->first_partial_deriv(iHmolar, ykey, xkey);
-                single_phase.dsmolardx[i][j] = AS->first_partial_deriv(iSmolar, xkey, ykey);
-                single_phase.dsmolardy[i][j] = AS->first_partial_deriv(iSmolar, ykey, xkey);
-                
-                if (get_debug_level() > 5){std::cout << " OK" << std::endl;}
-            }
-            else{
-                throw ValueError("Cannot construct this type of table (yet)");
-            }
-        }
-    }
-}
-    
-} /* namespace CoolProp */
\ No newline at end of file
+            }
+            ok = ok && !(liquid && gas && subcritical);
+            t.node(i, j)[NODE_CELL_OK] = (ok) ? (CELL_OK | ((transport) ? CELL_TRANSPORT_OK : 0)) : 0;
+        }
+    }
+}
+
+void GriddedTableBackend::flag_saturation_cells(void)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    PureFluidSaturationTableData &sat = pure_saturation;
+    saturation_clear.assign((t.Nx-1)*(t.Ny-1), 1);
+    // As in saturation_region, the saturation table only matters for p or T with one of rhomolar, hmolar or smolar
+    bool sat_x = (t.xkey == iP || t.xkey == iT);
+    parameters sat_key = (sat_x) ? t.xkey : t.ykey, key = (sat_x) ? t.ykey : t.xkey;
+    if (sat.N == 0 || (sat_key != iP && sat_key != iT) || key == iP || key == iT){ return; }
+
+    const std::vector<double> &svec = (sat_x) ? t.xvec : t.yvec, &zvec = (sat_x) ? t.yvec : t.xvec;
+    const std::vector<double> &s_nodes = sat.get(sat_key, 0), &x_nodes = (sat_key == iT) ? sat.T : sat.logp;
+    double s_critical = (sat_key == iP) ? p_critical_table : T_critical_table;
+    // Where saturation_region gives -1, between the end of the saturation table and the critical point
+    double band_min = (sat.N < 4) ? s_nodes[0] : s_nodes[sat.N-1];
+    for (std::size_t ks = 0; ks < svec.size()-1; ++ks){
+        // The points of a cell can be just outside it by the round-off in its nodes
+        double margin = 1e-9*(svec[ks+1] - svec[ks]);
+        double s0 = svec[ks] - margin, s1 = svec[ks+1] + margin;
+        double zmin = _HUGE, zmax = -_HUGE;
+        bool near_critical = (s1 > band_min && s0 < s_critical);
+        if (!near_critical && sat.N >= 4 && s1 >= s_nodes[0] && s0 <= s_nodes[sat.N-1]){
+            // The saturated liquid and vapor values over the part of the cell in the saturation table, between which the states are two-phase
+            double x0 = std::max(s0, s_nodes[0]), x1 = std::min(s1, s_nodes[sat.N-1]);
+            if (sat_key == iP){ x0 = log(x0); x1 = log(x1); }
+            for (int Q = 0; Q <= 1; ++Q){
+                double ymin, ymax;
+                PureFluidSaturationTableData::cubic_interpolation_range(x_nodes, sat.get(key, Q), x0, x1, (key == iDmolar && Q == 1), ymin, ymax);
+                zmin = std::min(zmin, ymin); zmax = std::max(zmax, ymax);
+            }
+            // For the round-off in the interpolation, and in the specific volume that saturation_region compares for the density
+            double zmargin = 1e-9*(std::abs(zmin) + std::abs(zmax));
+            zmin -= zmargin; zmax += zmargin;
+        }
+        for (std::size_t kz = 0; kz < zvec.size()-1; ++kz){
+            double zmargin = 1e-9*(zvec[kz+1] - zvec[kz]);
+            bool clear = !near_critical && (zvec[kz+1] + zmargin < zmin || zvec[kz] - zmargin > zmax);
+            std::size_t i = (sat_x) ? ks : kz, j = (sat_x) ? kz : ks;
+            saturation_clear[i*(t.Ny-1) + j] = clear;
+        }
+    }
+}
+
+void GriddedTableBackend::build_row(AbstractState &AS, std::size_t i)
+{
+    std::size_t Ny = single_phase.Ny;
+    parameters xkey = single_phase.xkey, ykey = single_phase.ykey;
+    double x = single_phase.xvec[i];
+    for (std::size_t j = 0; j < Ny; ++j)
+    {
+        // Nodes that were built before the grid was refined are kept
+        if (!x_new[i] && !y_new[j]){ continue; }
+        double y = single_phase.yvec[j];
+
+        if (get_debug_level() > 5){std::cout << "x: " << x << " y: " << y;}
+
+        // --------------------
+        //   Update the state
+        // --------------------
+        phases phase = update_node_state(AS, x, y);
+
+        // That failed for some reason, go to the next pair
+        if (phase == iphase_not_imposed){ continue; }
+
+        // Skip two-phase states - they will remain as _HUGE holes in the table
+        if (phase == iphase_twophase){
+            if (get_debug_level() > 5){std::cout << " 2Phase" << std::endl;}
+            single_phase.node(i, j)[NODE_PHASE] = iphase_twophase;
+            continue;
+        };
+
+        // ---------------------------------------------------------------
+        //   State variables and their first and second derivatives
+        // ---------------------------------------------------------------
+        try{
+            fill_node(AS, single_phase.variable(i, j, iT), iT, xkey, ykey);
+            fill_node(AS, single_phase.variable(i, j, iP), iP, xkey, ykey);
+            fill_node(AS, single_phase.variable(i, j, iDmolar), iDmolar, xkey, ykey);
+            fill_node(AS, single_phase.variable(i, j, iHmolar), iHmolar, xkey, ykey);
+            fill_node(AS, single_phase.variable(i, j, iSmolar), iSmolar, xkey, ykey);
+            // The channels last, since they move AS away from the state of the node
+            fill_channels(AS, single_phase, i, j);
+        }
+        catch(std::exception &e){
+            // Leave a hole in the table
+            if (get_debug_level() > 5){std::cout << " " << e.what() << std::endl;}
+            single_phase.variable(i, j, iT)[VALUE] = _HUGE;
+            continue;
+        }
+        single_phase.node(i, j)[NODE_PHASE] = phase;
+
+        if (get_debug_level() > 5){std::cout << " OK" << std::endl;}
+    }
+}
+
+std::string GriddedTableBackend::path_to_tables(void)
+{
+    std::string dir = get_config_string(ALTERNATIVE_TABLES_DIRECTORY);
+    if (dir.empty()){ dir = get_home_dir() + "/.CoolProp/Tables"; }
+    // Two chained hashes make collisions of the file names unlikely; the key in the file is checked anyway
+    unsigned int h1 = fnv1a(tables_key, 2166136261u), h2 = fnv1a(tables_key, h1);
+    return dir + format("/%08x%08x.bin", h1, h2);
+}
+
+/*
+The file in the cache is laid out as (with native byte order, since the cache is only used on the machine that wrote it)
+
+    char[8]           "CPTABLES"
+    uint32            TABLES_FORMAT_VERSION
+    uint32            length L of the key
+    char[L]           the key, padded with zeros to a multiple of 8 bytes
+    uint32, uint32    Nx, Ny
+    double[Nx], double[Ny]      xvec and yvec, since the grid may have been refined
+    char[]            zeros up to the next multiple of CACHE_LINE_SIZE bytes
+    double[Nx*Ny*NODE_STRIDE]   the nodes of the single-phase table, exactly as they are laid out in memory, so they are mapped rather than read
+    uint32            number of nodes Nsat of the saturation table (zero for mixtures)
+    double[8][Nsat]   T, p, rhomolarL, rhomolarV, hmolarL, hmolarV, smolarL, smolarV of the saturation table
+*/
+void GriddedTableBackend::load_tables(void)
+{
+    set_table_limits(table_type);
+    std::string path = path_to_tables();
+    shared_ptr<MappedFile> file(new MappedFile(path));
+    const unsigned char *data = file->data();
+    std::size_t size = file->size();
+
+    SinglePhaseGriddedTableData &t = single_phase;
+    std::size_t L = tables_key.size(), padded = (L + 7)/8*8;
+
+    unsigned int version = 0, length = 0, Nx = 0, Ny = 0;
+    if (size >= 16){
+        memcpy(&version, data + 8, 4);
+        memcpy(&length, data + 12, 4);
+    }
+    if (size < 16 || memcmp(data, "CPTABLES", 8) != 0){
+        throw ValueError(format("[%s] is not a file of tables", path.c_str()));
+    }
+    if (static_cast<int>(version) != TABLES_FORMAT_VERSION){
+        throw ValueError(format("The tables in [%s] have version %d, but version %d is required", path.c_str(), version, TABLES_FORMAT_VERSION));
+    }
+    if (length != L || size < 16 + padded + 8 || memcmp(data + 16, tables_key.c_str(), L) != 0){
+        throw ValueError(format("The tables in [%s] are out of date", path.c_str()));
+    }
+    memcpy(&Nx, data + 16 + padded, 4);
+    memcpy(&Ny, data + 16 + padded + 4, 4);
+    // With refinement, the grid can have more nodes than configured
+    if (Nx < t.Nx || Ny < t.Ny || (refinement_tolerance <= 0 && (Nx != t.Nx || Ny != t.Ny))
+        || Nx > MAX_REFINEMENT_GROWTH*t.Nx || Ny > MAX_REFINEMENT_GROWTH*t.Ny){
+        throw ValueError(format("The tables in [%s] have the wrong size", path.c_str()));
+    }
+    std::size_t grid = 16 + padded + 8, N = Nx*Ny*NODE_STRIDE;
+    std::size_t header = (grid + (Nx + Ny)*sizeof(double) + CACHE_LINE_SIZE - 1)/CACHE_LINE_SIZE*CACHE_LINE_SIZE, single_phase_end = header + N*sizeof(double);
+    unsigned int Nsat = 0;
+    if (size >= single_phase_end + 4){ memcpy(&Nsat, data + single_phase_end, 4); }
+    if (size != single_phase_end + 4 + 8*Nsat*sizeof(double)){
+        throw ValueError(format("The tables in [%s] are truncated", path.c_str()));
+    }
+
+    t.Nx = Nx; t.Ny = Ny;
+    t.xvec.resize(Nx); t.yvec.resize(Ny);
+    memcpy(&(t.xvec[0]), data + grid, Nx*sizeof(double));
+    memcpy(&(t.yvec[0]), data + grid + Nx*sizeof(double), Ny*sizeof(double));
+    t.uniform = (refinement_tolerance <= 0);
+    t.nodes.map(file, header, N);
+    const unsigned char *p = data + single_phase_end + 4;
+
+    PureFluidSaturationTableData &sat = pure_saturation;
+    sat = PureFluidSaturationTableData();
+    sat.resize(Nsat);
+    std::vector<double> *saturation_vectors[8] = {&sat.T, &sat.p, &sat.rhomolarL, &sat.rhomolarV, &sat.hmolarL, &sat.hmolarV, &sat.smolarL, &sat.smolarV};
+    for (std::size_t m = 0; m < 8 && Nsat > 0; ++m){
+        memcpy(&((*saturation_vectors[m])[0]), p, Nsat*sizeof(double));
+        p += Nsat*sizeof(double);
+    }
+    for (std::size_t i = 0; i < Nsat; ++i){ sat.logp[i] = log(sat.p[i]); }
+    tables_built = true;
+}
+
+void GriddedTableBackend::write_tables(void)
+{
+    std::string path = path_to_tables();
+    make_dirs(path.substr(0, path.find_last_of("/\\")));
+
+    SinglePhaseGriddedTableData &t = single_phase;
+    std::string contents("CPTABLES");
+    unsigned int version = TABLES_FORMAT_VERSION, length = static_cast<unsigned int>(tables_key.size());
+    unsigned int Nx = static_cast<unsigned int>(t.Nx), Ny = static_cast<unsigned int>(t.Ny);
+    contents.append(reinterpret_cast<const char*>(&version), 4);
+    contents.append(reinterpret_cast<const char*>(&length), 4);
+    contents.append(tables_key);
+    contents.append((8 - tables_key.size() % 8) % 8, '\0');
+    contents.append(reinterpret_cast<const char*>(&Nx), 4);
+    contents.append(reinterpret_cast<const char*>(&Ny), 4);
+    contents.append(reinterpret_cast<const char*>(&(t.xvec[0])), t.Nx*sizeof(double));
+    contents.append(reinterpret_cast<const char*>(&(t.yvec[0])), t.Ny*sizeof(double));
+    contents.append((CACHE_LINE_SIZE - contents.size() % CACHE_LINE_SIZE) % CACHE_LINE_SIZE, '\0');
+    contents.append(reinterpret_cast<const char*>(t.nodes.data()), t.nodes.size()*sizeof(double));
+    PureFluidSaturationTableData &sat = pure_saturation;
+    unsigned int Nsat = static_cast<unsigned int>(sat.N);
+    contents.append(reinterpret_cast<const char*>(&Nsat), 4);
+    std::vector<double> *saturation_vectors[8] = {&sat.T, &sat.p, &sat.rhomolarL, &sat.rhomolarV, &sat.hmolarL, &sat.hmolarV, &sat.smolarL, &sat.smolarV};
+    for (std::size_t m = 0; m < 8 && Nsat > 0; ++m){
+        contents.append(reinterpret_cast<const char*>(&((*saturation_vectors[m])[0])), Nsat*sizeof(double));
+    }
+
+    // Write to a temporary file and then move it into place, so that other processes never see a partly written file; the temporary
+    // file is named for the process and the backend, so that writers that build the same tables at once never share it
+    #if defined(__ISWINDOWS__)
+        unsigned long pid = static_cast<unsigned long>(GetCurrentProcessId());
+    #else
+        unsigned long pid = static_cast<unsigned long>(getpid());
+    #endif
+    std::string tmp = format("%s.%lu.%p.tmp", path.c_str(), pid, static_cast<void*>(this));
+    FILE *fp = fopen(tmp.c_str(), "wb");
+    if (fp == NULL){ throw ValueError(format("Unable to open [%s] for writing", tmp.c_str())); }
+    std::size_t written = fwrite(contents.c_str(), 1, contents.size(), fp);
+    fclose(fp);
+    if (written != contents.size()){
+        remove(tmp.c_str());
+        throw ValueError(format("Unable to write the tables to [%s]", tmp.c_str()));
+    }
+    #if defined(__ISWINDOWS__)
+        remove(path.c_str()); // rename does not replace an existing file on windows
+    #endif
+    if (rename(tmp.c_str(), path.c_str()) != 0){
+        remove(tmp.c_str());
+        throw ValueError(format("Unable to move the tables to [%s]", path.c_str()));
+    }
+}
+
+void GriddedTableBackend::load_or_build_tables(void)
+{
+    try{
+        load_tables();
+    }
+    catch(std::exception &e){
+        if (get_debug_level() > 0){ std::cout << format("Building the tables: %s\n", e.what()); }
+        build_tables();
+        try{
+            write_tables();
+        }
+        catch(std::exception &e){
+            // The tables can still be used, they will just be built again the next time
+            if (get_debug_level() > 0){ std::cout << format("Unable to write the tables to the cache: %s\n", e.what()); }
+        }
+    }
+    flag_saturation_cells();
+    prepare_tables();
+}
+
+void GriddedTableBackend::bounding_curves(void)
+{
+    build_saturation_table(*AS);
+}
+void GriddedTableBackend::build_saturation_table(AbstractState &AS)
+{
+    // The temperatures of the nodes are evenly spaced from the triple point to just below the critical point; the saturation
+    // routines are more consistent for given temperature than for given pressure.  The nodes where they fail are left out.
+    std::size_t N = 1000;
+    double Tmin = AS.Ttriple(), Tmax = AS.T_critical()*(1 - 1e-4);
+
+    PureFluidSaturationTableData &sat = pure_saturation;
+    sat = PureFluidSaturationTableData();
+    sat.resize(N);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < N; ++i){
+        double T = Tmin + (Tmax - Tmin)/(N-1)*i;
+        try{
+            AS.update(QT_INPUTS, 0, T);
+            sat.p[n] = AS.p();
+            sat.rhomolarL[n] = AS.rhomolar();
+            sat.hmolarL[n] = AS.hmolar();
+            sat.smolarL[n] = AS.smolar();
+            AS.update(QT_INPUTS, 1, T);
+            sat.rhomolarV[n] = AS.rhomolar();
+            sat.hmolarV[n] = AS.hmolar();
+            sat.smolarV[n] = AS.smolar();
+        }
+        catch(std::exception &e){
+            if (get_debug_level() > 5){ std::cout << format("Saturation at T=%g failed: %s\n", T, e.what()); }
+            continue;
+        }
+        sat.T[n] = T;
+        sat.logp[n] = log(sat.p[n]);
+        ++n;
+    }
+    sat.resize(n);
+}
+
+bool GriddedTableBackend::locate(double x, double y)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // Written so that NaN inputs are also rejected
+    if (!(x >= t.xmin && x <= t.xmax && y >= t.ymin && y <= t.ymax)){ return false; }
+
+    std::size_t i = t.x_cell(x), j = t.y_cell(y);
+
+    if (!t.cell_ok(i, j)){ return false; }
+
+    cached_i = i; cached_j = j; cached_x = x; cached_y = y;
+    return true;
+}
+
+/// The value and derivatives of a variable at node n of the line of nodes m, which is a row (x varies along it) if along_x is true,
+/// otherwise a column
+static const double *line_variable(SinglePhaseGriddedTableData &t, bool along_x, std::size_t m, std::size_t n, parameters key)
+{
+    return (along_x) ? t.variable(n, m, key) : t.variable(m, n, key);
+}
+bool GriddedTableBackend::invert_single_phase(parameters key, double value, double other, bool solve_x, double &result)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    const std::vector<double> &fixed = (solve_x) ? t.yvec : t.xvec, &free = (solve_x) ? t.xvec : t.yvec;
+    if (!(other >= fixed[0] && other <= fixed[fixed.size()-1])){ return false; }
+
+    // The line of nodes nearest to the value that is fixed, in the spacing of the lines
+    std::size_t m = (solve_x) ? t.y_cell(other) : t.x_cell(other);
+    if (((solve_x) ? t.logy : t.logx) ? (other*other > fixed[m]*fixed[m+1]) : (2*other > fixed[m] + fixed[m+1])){ ++m; }
+
+    // Find the pair of neighbouring nodes in the line that bracket the value
+    std::size_t n, N = free.size();
+    for (n = 0; n < N-1; ++n){
+        const double *v0 = line_variable(t, solve_x, m, n, key), *v1 = line_variable(t, solve_x, m, n+1, key);
+        if (!ValidNumber(v0[VALUE]) || !ValidNumber(v1[VALUE])){ continue; }
+        if ((v0[VALUE] - value)*(v1[VALUE] - value) <= 0){ break; }
+    }
+    if (n == N-1){ return false; }
+
+    // Linear interpolation along the line for the starting value, then Newton iteration with the derivatives of the interpolant
+    double v0 = line_variable(t, solve_x, m, n, key)[VALUE], v1 = line_variable(t, solve_x, m, n+1, key)[VALUE];
+    double w = (v1 == v0) ? free[n] : free[n] + (value - v0)/(v1 - v0)*(free[n+1] - free[n]);
+    double tolerance = 1e-10*(free[n+1] - free[n]);
+    for (int iter = 0; iter < 20; ++iter){
+        if (!((solve_x) ? locate(w, other) : locate(other, w))){ return false; }
+        double dw = -(evaluate_single_phase(key) - value)/evaluate_single_phase_derivative(key, solve_x);
+        if (!ValidNumber(dw)){ return false; }
+        w += dw;
+        if (std::abs(dw) < tolerance){
+            result = w;
+            return (solve_x) ? locate(w, other) : locate(other, w);
+        }
+    }
+    return false;
+}
+
+void GriddedTableBackend::set_tabulated_value(parameters key, double value)
+{
+    switch(key){
+        case iT: _T = value; break;
+        case iP: _p = value; break;
+        case iDmolar: _rhomolar = value; break;
+        case iHmolar: _hmolar = value; break;
+        case iSmolar: _smolar = value; break;
+        default: throw ValueError(format("The variable [%s] is not tabulated", get_parameter_information(key,"short").c_str()));
+    }
+}
+
+void GriddedTableBackend::set_state_from_table(void)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // T, p and rhomolar are always needed; the variables of the table are known exactly
+    parameters keys[3] = {iT, iP, iDmolar};
+    for (int k = 0; k < 3; ++k){
+        if (keys[k] != t.xkey && keys[k] != t.ykey){ set_tabulated_value(keys[k], evaluate_single_phase(keys[k])); }
+    }
+    set_tabulated_value(t.xkey, cached_x);
+    set_tabulated_value(t.ykey, cached_y);
+    _Q = -1;
+    // Phase of the corner of the cell that is nearest to the state
+    std::size_t i = (cached_x - t.xvec[cached_i] < t.xvec[cached_i+1] - cached_x) ? cached_i : cached_i + 1;
+    std::size_t j = (cached_y - t.yvec[cached_j] < t.yvec[cached_j+1] - cached_y) ? cached_j : cached_j + 1;
+    _phase = static_cast<phases>(t.phase(i, j));
+}
+
+void GriddedTableBackend::set_two_phase_state(parameters key, double value, double Q)
+{
+    PureFluidSaturationTableData &sat = pure_saturation;
+    double rhoL = sat.evaluate(iDmolar, key, value, 0), rhoV = sat.evaluate(iDmolar, key, value, 1);
+    double hL = sat.evaluate(iHmolar, key, value, 0), hV = sat.evaluate(iHmolar, key, value, 1);
+    double sL = sat.evaluate(iSmolar, key, value, 0), sV = sat.evaluate(iSmolar, key, value, 1);
+    _T = sat.evaluate(iT, key, value, 0);
+    _p = sat.evaluate(iP, key, value, 0);
+    _Q = Q;
+    _rhomolar = 1/(Q/rhoV + (1-Q)/rhoL);
+    _hmolar = hL + Q*(hV - hL);
+    _smolar = sL + Q*(sV - sL);
+    _phase = iphase_twophase;
+}
+
+void GriddedTableBackend::set_envelope_state(parameters key, double value, int Q)
+{
+    MixtureEnvelopeTableData &env = mixture_envelope;
+    _T = env.evaluate(iT, key, value, Q);
+    _p = env.evaluate(iP, key, value, Q);
+    _rhomolar = env.evaluate(iDmolar, key, value, Q);
+    _hmolar = env.evaluate(iHmolar, key, value, Q);
+    _smolar = env.evaluate(iSmolar, key, value, Q);
+    _Q = Q;
+    _phase = iphase_twophase;
+}
+
+void GriddedTableBackend::update_with_AS(CoolProp::input_pairs input_pair, double Value1, double Value2)
+{
+    AS->update(input_pair, Value1, Value2);
+    _T = AS->T();
+    _p = AS->p();
+    _rhomolar = AS->rhomolar();
+    _Q = AS->Q();
+    _phase = AS->phase();
+    using_AS = true;
+    AS_updated = true;
+}
+
+AbstractState &GriddedTableBackend::state_AS(void)
+{
+    if (!AS_updated){
+        if (mixture_envelope.empty()){
+            AS->update(DmolarT_INPUTS, _rhomolar, _T);
+        }
+        else{
+            // Mixtures need their phase imposed; the bubble and dew points are the saturated liquid and gas
+            AS->specify_phase((_phase != iphase_twophase) ? _phase : ((_Q < 0.5) ? iphase_liquid : iphase_gas));
+            try{
+                AS->update(DmolarT_INPUTS, _rhomolar, _T);
+            }
+            catch(...){
+                AS->unspecify_phase();
+                throw;
+            }
+            AS->unspecify_phase();
+        }
+        AS_updated = true;
+    }
+    return *AS;
+}
+
+/// The variables of an input pair of two of T, p, rhomolar, hmolar and smolar; returns false for any other input pair
+static bool split_input_pair(CoolProp::input_pairs input_pair, parameters &key1, parameters &key2)
+{
+    switch(input_pair){
+        case PT_INPUTS: key1 = iP; key2 = iT; return true;
+        case DmolarT_INPUTS: key1 = iDmolar; key2 = iT; return true;
+        case HmolarT_INPUTS: key1 = iHmolar; key2 = iT; return true;
+        case SmolarT_INPUTS: key1 = iSmolar; key2 = iT; return true;
+        case DmolarP_INPUTS: key1 = iDmolar; key2 = iP; return true;
+        case HmolarP_INPUTS: key1 = iHmolar; key2 = iP; return true;
+        case PSmolar_INPUTS: key1 = iP; key2 = iSmolar; return true;
+        case HmolarSmolar_INPUTS: key1 = iHmolar; key2 = iSmolar; return true;
+        case DmolarHmolar_INPUTS: key1 = iDmolar; key2 = iHmolar; return true;
+        case DmolarSmolar_INPUTS: key1 = iDmolar; key2 = iSmolar; return true;
+        default: return false;
+    }
+}
+
+int GriddedTableBackend::saturation_region(parameters key1, double value1, parameters key2, double value2, parameters &sat_key, double &sat_value, double &Q)
+{
+    // For p or T and one of rhomolar, hmolar or smolar
+    bool first = (key1 == iP || key1 == iT);
+    sat_key = (first) ? key1 : key2;
+    parameters key = (first) ? key2 : key1;
+    sat_value = (first) ? value1 : value2;
+    double z = (first) ? value2 : value1;
+    if (pure_saturation.N == 0 || (sat_key != iP && sat_key != iT) || key == iP || key == iT){ return 0; }
+    if (pure_saturation.is_inside(sat_key, sat_value)){
+        double zL = pure_saturation.evaluate(key, sat_key, sat_value, 0), zV = pure_saturation.evaluate(key, sat_key, sat_value, 1);
+        // The quality is linear in the specific volume rather than in the density
+        if (key == iDmolar){ zL = 1/zL; zV = 1/zV; z = 1/z; }
+        if (z >= zL && z <= zV){ Q = (z - zL)/(zV - zL); return 1; }
+    }
+    else if (sat_value > ((sat_key == iP) ? pure_saturation.p[0] : pure_saturation.T[0])
+             && sat_value < ((sat_key == iP) ? p_critical_table : T_critical_table)){
+        // Too close to the critical point for the saturation table to tell whether the state is two-phase
+        return -1;
+    }
+    return 0;
+}
+
+void GriddedTableBackend::update(CoolProp::input_pairs input_pair, double Value1, double Value2)
+{
+    if (!tables_built){ load_or_build_tables(); }
+
+    clear();
+    using_AS = false;
+    AS_updated = false;
+
+    // Convert mass-based inputs to molar ones
+    switch(input_pair){
+        case HmassP_INPUTS: input_pair = HmolarP_INPUTS; Value1 *= molar_mass(); break;
+        case PSmass_INPUTS: input_pair = PSmolar_INPUTS; Value2 *= molar_mass(); break;
+        case DmassT_INPUTS: input_pair = DmolarT_INPUTS; Value1 /= molar_mass(); break;
+        case DmassP_INPUTS: input_pair = DmolarP_INPUTS; Value1 /= molar_mass(); break;
+        case HmassT_INPUTS: input_pair = HmolarT_INPUTS; Value1 *= molar_mass(); break;
+        case SmassT_INPUTS: input_pair = SmolarT_INPUTS; Value1 *= molar_mass(); break;
+        default: break;
+    }
+
+    switch(input_pair){
+        case PQ_INPUTS:
+            if (pure_saturation.is_inside(iP, Value1) && Value2 >= 0 && Value2 <= 1){ set_two_phase_state(iP, Value1, Value2); return; }
+            if ((Value2 == 0 || Value2 == 1) && mixture_envelope.is_inside(iP, Value1, static_cast<int>(Value2))){ set_envelope_state(iP, Value1, static_cast<int>(Value2)); return; }
+            update_with_AS(input_pair, Value1, Value2);
+            return;
+        case QT_INPUTS:
+            if (pure_saturation.is_inside(iT, Value2) && Value1 >= 0 && Value1 <= 1){ set_two_phase_state(iT, Value2, Value1); return; }
+            if ((Value1 == 0 || Value1 == 1) && mixture_envelope.is_inside(iT, Value2, static_cast<int>(Value1))){ set_envelope_state(iT, Value2, static_cast<int>(Value1)); return; }
+            update_with_AS(input_pair, Value1, Value2);
+            return;
+        default:
+            break;
+    }
+
+    parameters key1, key2;
+    if (!split_input_pair(input_pair, key1, key2)){
+        // Not (yet) supported by the tables
+        update_with_AS(input_pair, Value1, Value2);
+        return;
+    }
+
+    // Two-phase states of pure fluids come from the saturation table
+    parameters sat_key;
+    double sat_value, Q;
+    int region = saturation_region(key1, Value1, key2, Value2, sat_key, sat_value, Q);
+    if (region == 1){ set_two_phase_state(sat_key, sat_value, Q); return; }
+    if (region == -1){ update_with_AS(input_pair, Value1, Value2); return; }
+
+    // Single-phase states, straight from the table for its own variables, otherwise by solving for the other variable of the table
+    SinglePhaseGriddedTableData &t = single_phase;
+    bool key1_in_table = (key1 == t.xkey || key1 == t.ykey);
+    parameters table_key = (key1_in_table) ? key1 : key2, other_key = (key1_in_table) ? key2 : key1;
+    double table_value = (key1_in_table) ? Value1 : Value2, other_value = (key1_in_table) ? Value2 : Value1, result;
+    bool found;
+    if (table_key == t.ykey){
+        found = (other_key == t.xkey) ? locate(other_value, table_value) : invert_single_phase(other_key, other_value, table_value, true, result);
+    }
+    else if (table_key == t.xkey){
+        found = (other_key == t.ykey) ? locate(table_value, other_value) : invert_single_phase(other_key, other_value, table_value, false, result);
+    }
+    else{
+        found = false;
+    }
+    if (!found){ update_with_AS(input_pair, Value1, Value2); return; }
+    set_state_from_table();
+    // A cell of a mixture table whose corners are all on one side of the envelope may still be cut by it
+    if (!mixture_envelope.empty() && mixture_envelope.phase(_T, _rhomolar) == iphase_twophase){ update_with_AS(input_pair, Value1, Value2); return; }
+    // The inputs are kept exactly
+    set_tabulated_value(key1, Value1);
+    set_tabulated_value(key2, Value2);
+}
+
+std::size_t GriddedTableBackend::evaluate_batch(std::size_t N, const double *x, const double *y, const std::vector<parameters> &outputs, const std::vector<double*> &results)
+{
+    if (!tables_built){ load_or_build_tables(); }
+    if (results.size() != outputs.size()){
+        throw ValueError(format("There are %d outputs but %d arrays of results", outputs.size(), results.size()));
+    }
+    bool transport = false;
+    for (std::size_t m = 0; m < outputs.size(); ++m){
+        SinglePhaseGriddedTableData::index(outputs[m]); // Throws if the output is not tabulated
+        if (outputs[m] == iviscosity || outputs[m] == iconductivity){ transport = true; }
+    }
+
+    SinglePhaseGriddedTableData &t = single_phase;
+    std::vector<double> lanes(outputs.size()*BATCH_BLOCK_SIZE);
+    std::vector<double*> values(outputs.size());
+    for (std::size_t m = 0; m < outputs.size(); ++m){ values[m] = &(lanes[m*BATCH_BLOCK_SIZE]); }
+    std::size_t Ninterpolated = 0;
+    for (std::size_t start = 0; start < N; start += BATCH_BLOCK_SIZE){
+        std::size_t Nblock = std::min(BATCH_BLOCK_SIZE, N - start);
+        std::size_t others[BATCH_BLOCK_SIZE], Nothers = 0;
+
+        // Locate the points of the block, as locate() does, with the points outside the table moved to its corner in the meantime
+        BatchLanes X = BatchLanes::Constant(t.xmin), Y = BatchLanes::Constant(t.ymin);
+        X.head(Nblock) = Eigen::Map<const Eigen::ArrayXd>(x + start, Nblock);
+        Y.head(Nblock) = Eigen::Map<const Eigen::ArrayXd>(y + start, Nblock);
+        Eigen::Array<bool, BATCH_BLOCK_SIZE, 1> inside = (X >= t.xmin && X <= t.xmax && Y >= t.ymin && Y <= t.ymax);
+        X = inside.select(X, t.xmin); Y = inside.select(Y, t.ymin);
+        std::size_t icell[BATCH_BLOCK_SIZE], jcell[BATCH_BLOCK_SIZE];
+        find_cells(t.xvec, t.Nx, t.xmin, t.xmax, t.logx, t.uniform, X, icell);
+        find_cells(t.yvec, t.Ny, t.ymin, t.ymax, t.logy, t.uniform, Y, jcell);
+
+        // Keep those that can be interpolated
+        BatchBlock b;
+        b.n = 0;
+        for (std::size_t k = 0; k < Nblock; ++k){
+            std::size_t i = icell[k], j = jcell[k];
+            bool ok = inside[k] && t.cell_ok(i, j) && (!transport || t.transport_ok(i, j));
+            // Mixture tables are in T and rhomolar, so the envelope can be checked straight away
+            if (ok && !mixture_envelope.empty()){ ok = (mixture_envelope.phase(X[k], Y[k]) != iphase_twophase); }
+            // States that update() takes from the saturation table or from the wrapped backend, near the critical point; most
+            // cells are known to have none
+            parameters sat_key;
+            double sat_value, Q;
+            if (ok && !(saturation_clear.size() > 0 && saturation_clear[i*(t.Ny-1) + j])
+                && saturation_region(t.xkey, X[k], t.ykey, Y[k], sat_key, sat_value, Q) != 0){ ok = false; }
+            if (!ok){ others[Nothers++] = k; continue; }
+            b.index[b.n] = k; b.i[b.n] = i; b.j[b.n] = j; b.x[b.n] = X[k]; b.y[b.n] = Y[k];
+            ++b.n;
+        }
+
+        if (b.n > 0){
+            for (std::size_t k = b.n; k < BATCH_BLOCK_SIZE; ++k){
+                b.index[k] = b.index[0]; b.i[k] = b.i[0]; b.j[k] = b.j[0]; b.x[k] = b.x[0]; b.y[k] = b.y[0];
+            }
+            evaluate_block(b, outputs, &(values[0]));
+            for (std::size_t m = 0; m < outputs.size(); ++m){
+                double *r = results[m] + start;
+                for (std::size_t n = 0; n < b.n; ++n){
+                    // The variables of the table are known exactly
+                    if (outputs[m] == t.xkey){ r[b.index[n]] = b.x[n]; }
+                    else if (outputs[m] == t.ykey){ r[b.index[n]] = b.y[n]; }
+                    else{ r[b.index[n]] = values[m][n]; }
+                }
+            }
+            Ninterpolated += b.n;
+        }
+
+        // The rest, one at a time
+        for (std::size_t n = 0; n < Nothers; ++n){
+            std::size_t p = start + others[n];
+            try{
+                double value1, value2;
+                input_pairs pair = generate_update_pair(t.xkey, x[p], t.ykey, y[p], value1, value2);
+                update(pair, value1, value2);
+                for (std::size_t m = 0; m < outputs.size(); ++m){ results[m][p] = keyed_output(outputs[m]); }
+            }
+            catch(std::exception &){
+                for (std::size_t m = 0; m < outputs.size(); ++m){ results[m][p] = _HUGE; }
+            }
+        }
+    }
+    return Ninterpolated;
+}
+
+CoolPropDbl GriddedTableBackend::calc_hmolar(void)
+{
+    return (using_AS) ? AS->hmolar() : evaluate_single_phase(iHmolar);
+}
+CoolPropDbl GriddedTableBackend::calc_smolar(void)
+{
+    return (using_AS) ? AS->smolar() : evaluate_single_phase(iSmolar);
+}
+CoolPropDbl GriddedTableBackend::calc_umolar(void)
+{
+    return (using_AS) ? AS->umolar() : hmolar() - _p/_rhomolar;
+}
+CoolPropDbl GriddedTableBackend::calc_cpmolar(void)
+{
+    if (_phase == iphase_twophase && !using_AS){ return state_AS().cpmolar(); }
+    return (using_AS) ? AS->cpmolar() : evaluate_single_phase(iCpmolar);
+}
+CoolPropDbl GriddedTableBackend::calc_cvmolar(void)
+{
+    if (_phase == iphase_twophase && !using_AS){ return state_AS().cvmolar(); }
+    return (using_AS) ? AS->cvmolar() : evaluate_single_phase(iCvmolar);
+}
+CoolPropDbl GriddedTableBackend::calc_speed_sound(void)
+{
+    if (_phase == iphase_twophase && !using_AS){ return state_AS().speed_sound(); }
+    return (using_AS) ? AS->speed_sound() : evaluate_single_phase(ispeed_sound);
+}
+CoolPropDbl GriddedTableBackend::calc_viscosity(void)
+{
+    if (using_AS || _phase == iphase_twophase || !single_phase.transport_ok(cached_i, cached_j)){ return state_AS().viscosity(); }
+    return evaluate_single_phase(iviscosity);
+}
+CoolPropDbl GriddedTableBackend::calc_conductivity(void)
+{
+    if (using_AS || _phase == iphase_twophase || !single_phase.transport_ok(cached_i, cached_j)){ return state_AS().conductivity(); }
+    return evaluate_single_phase(iconductivity);
+}
+CoolPropDbl GriddedTableBackend::calc_first_partial_deriv(parameters Of, parameters Wrt, parameters Constant)
+{
+    if (using_AS || _phase == iphase_twophase){ return state_AS().first_partial_deriv(Of, Wrt, Constant); }
+
+    // The derivatives of each of the variables with respect to x and y, from which
+    // (dOf/dWrt)_Constant = (dOf/dx*dConstant/dy - dOf/dy*dConstant/dx)/(dWrt/dx*dConstant/dy - dWrt/dy*dConstant/dx)
+    parameters keys[3] = {Of, Wrt, Constant};
+    double ddx[3], ddy[3];
+    for (int k = 0; k < 3; ++k){
+        switch(keys[k]){
+            case iviscosity: case iconductivity:
+                if (!single_phase.transport_ok(cached_i, cached_j)){ return state_AS().first_partial_deriv(Of, Wrt, Constant); }
+                // fall through
+            case iT: case iP: case iDmolar: case iHmolar: case iSmolar: case iCpmolar: case iCvmolar: case ispeed_sound:
+                ddx[k] = evaluate_single_phase_derivative(keys[k], true);
+                ddy[k] = evaluate_single_phase_derivative(keys[k], false);
+                break;
+            case iUmolar:
+            {
+                // u = h - p/rho
+                double rho = _rhomolar, p = _p;
+                ddx[k] = evaluate_single_phase_derivative(iHmolar, true) - (evaluate_single_phase_derivative(iP, true)*rho - p*evaluate_single_phase_derivative(iDmolar, true))/(rho*rho);
+                ddy[k] = evaluate_single_phase_derivative(iHmolar, false) - (evaluate_single_phase_derivative(iP, false)*rho - p*evaluate_single_phase_derivative(iDmolar, false))/(rho*rho);
+                break;
+            }
+            default:
+                // Not tabulated
+                return state_AS().first_partial_deriv(Of, Wrt, Constant);
+        }
+    }
+    return (ddx[0]*ddy[2] - ddy[0]*ddx[2])/(ddx[1]*ddy[2] - ddy[1]*ddx[2]);
+}
+
+CoolPropDbl GriddedTableBackend::calc_saturated_liquid_keyed_output(parameters key)
+{
+    if (!using_AS && _phase == iphase_twophase && pure_saturation.N > 0 && (key == iT || key == iP || key == iDmolar || key == iHmolar || key == iSmolar)){
+        return pure_saturation.evaluate(key, iP, _p, 0);
+    }
+    return state_AS().saturated_liquid_keyed_output(key);
+}
+CoolPropDbl GriddedTableBackend::calc_saturated_vapor_keyed_output(parameters key)
+{
+    if (!using_AS && _phase == iphase_twophase && pure_saturation.N > 0 && (key == iT || key == iP || key == iDmolar || key == iHmolar || key == iSmolar)){
+        return pure_saturation.evaluate(key, iP, _p, 1);
+    }
+    return state_AS().saturated_vapor_keyed_output(key);
+}
+
+void TTSEBackend::nearest_node(std::size_t &i, std::size_t &j, double &dx, double &dy)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    i = (cached_x - t.xvec[cached_i] < t.xvec[cached_i+1] - cached_x) ? cached_i : cached_i + 1;
+    j = (cached_y - t.yvec[cached_j] < t.yvec[cached_j+1] - cached_y) ? cached_j : cached_j + 1;
+    dx = cached_x - t.xvec[i];
+    dy = cached_y - t.yvec[j];
+}
+double TTSEBackend::evaluate_single_phase(parameters key)
+{
+    std::size_t i, j; double dx, dy;
+    nearest_node(i, j, dx, dy);
+    return taylor_expansion(single_phase.variable(i, j, key), dx, dy);
+}
+double TTSEBackend::evaluate_single_phase_derivative(parameters key, bool wrt_x)
+{
+    std::size_t i, j; double dx, dy;
+    nearest_node(i, j, dx, dy);
+    const double *v = single_phase.variable(i, j, key);
+    if (wrt_x){
+        return v[DVDX] + dx*v[D2VDX2] + dy*v[D2VDXDY];
+    }
+    else{
+        return v[DVDY] + dy*v[D2VDY2] + dx*v[D2VDXDY];
+    }
+}
+
+void TTSEBackend::evaluate_block(const BatchBlock &b, const std::vector<parameters> &keys, double **values)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // The nearest node of each point, as in nearest_node(), and the distances to it
+    const double *node[BATCH_BLOCK_SIZE];
+    BatchLanes dx, dy;
+    for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){
+        std::size_t i = (b.x[k] - t.xvec[b.i[k]] < t.xvec[b.i[k]+1] - b.x[k]) ? b.i[k] : b.i[k] + 1;
+        std::size_t j = (b.y[k] - t.yvec[b.j[k]] < t.yvec[b.j[k]+1] - b.y[k]) ? b.j[k] : b.j[k] + 1;
+        dx[k] = b.x[k] - t.xvec[i];
+        dy[k] = b.y[k] - t.yvec[j];
+        node[k] = t.node(i, j);
+    }
+    BatchLanes dx2 = 0.5*dx*dx, dxdy = dx*dy, dy2 = 0.5*dy*dy;
+    for (std::size_t m = 0; m < keys.size(); ++m){
+        // Gather the value and derivatives of the variable into one set of lanes per derivative, then expand them in all the lanes at once
+        std::size_t offset = SinglePhaseGriddedTableData::offset(keys[m]);
+        BatchLanes v[N_GRIDDED_DERIVATIVES];
+        for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){
+            for (int c = 0; c < N_GRIDDED_DERIVATIVES; ++c){ v[c][k] = node[k][offset + c]; }
+        }
+        Eigen::Map<BatchLanes> z(values[m]);
+        z = v[VALUE] + dx*v[DVDX] + dy*v[DVDY] + dx2*v[D2VDX2] + dxdy*v[D2VDXDY] + dy2*v[D2VDY2];
+    }
+}
+
+/// The matrix that gives the 16 coefficients of the bicubic polynomial from the values, x derivatives, y derivatives and cross
+/// derivatives at the corners (0,0), (1,0), (0,1) and (1,1) of the unit cell, in that order
+static const int bicubic_matrix[16][16] = {
+    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    { 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-3, 3, 0, 0,-2,-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    { 2,-2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    { 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+    { 0, 0, 0, 0, 0, 0, 0, 0,-3, 3, 0, 0,-2,-1, 0, 0},
+    { 0, 0, 0, 0, 0, 0, 0, 0, 2,-2, 0, 0, 1, 1, 0, 0},
+    {-3, 0, 3, 0, 0, 0, 0, 0,-2, 0,-1, 0, 0, 0, 0, 0},
+    { 0, 0, 0, 0,-3, 0, 3, 0, 0, 0, 0, 0,-2, 0,-1, 0},
+    { 9,-9,-9, 9, 6, 3,-6,-3, 6,-6, 3,-3, 4, 2, 2, 1},
+    {-6, 6, 6,-6,-3,-3, 3, 3,-4, 4,-2, 2,-2,-2,-1,-1},
+    { 2, 0,-2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0},
+    { 0, 0, 0, 0, 2, 0,-2, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+    {-6, 6, 6,-6,-4,-2, 4, 2,-3, 3,-3, 3,-2,-1,-2,-1},
+    { 4,-4,-4, 4, 2, 2,-2,-2, 2,-2, 2,-2, 1, 1, 1, 1}
+};
+
+void BicubicBackend::prepare_tables(void)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    coeffs.allocate((t.Nx-1)*(t.Ny-1)*N_TABLE_VARIABLES*16, _HUGE);
+    for (std::size_t i = 0; i < t.Nx-1; ++i){
+        for (std::size_t j = 0; j < t.Ny-1; ++j){
+            if (!t.cell_ok(i, j)){ continue; }
+
+            // The derivatives are scaled to the unit cell
+            double dx = t.xvec[i+1] - t.xvec[i], dy = t.yvec[j+1] - t.yvec[j];
+            std::size_t ii[4] = {i, i+1, i, i+1}, jj[4] = {j, j, j+1, j+1};
+            for (std::size_t m = 0; m < N_TABLE_VARIABLES; ++m){
+                parameters key = SinglePhaseGriddedTableData::key(m);
+                if ((key == iviscosity || key == iconductivity) && !t.transport_ok(i, j)){ continue; }
+                double b[16];
+                for (int k = 0; k < 4; ++k){
+                    const double *v = t.variable(ii[k], jj[k], key);
+                    b[k] = v[VALUE];
+                    b[k+4] = v[DVDX]*dx;
+                    b[k+8] = v[DVDY]*dy;
+                    b[k+12] = v[D2VDXDY]*dx*dy;
+                }
+                double *a = coeffs.data() + (i*(t.Ny-1) + j)*N_TABLE_VARIABLES*16 + 16*m;
+                for (int r = 0; r < 16; ++r){
+                    a[r] = 0;
+                    for (int k = 0; k < 16; ++k){
+                        a[r] += bicubic_matrix[r][k]*b[k];
+                    }
+                }
+            }
+        }
+    }
+}
+double BicubicBackend::evaluate_single_phase(parameters key)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    const double *a = get_coeffs(key);
+    double xi = (cached_x - t.xvec[cached_i])/(t.xvec[cached_i+1] - t.xvec[cached_i]);
+    double eta = (cached_y - t.yvec[cached_j])/(t.yvec[cached_j+1] - t.yvec[cached_j]);
+    double z = 0;
+    for (int n = 3; n >= 0; --n){
+        z = z*eta + (((a[3+4*n]*xi + a[2+4*n])*xi + a[1+4*n])*xi + a[4*n]);
+    }
+    return z;
+}
+double BicubicBackend::evaluate_single_phase_derivative(parameters key, bool wrt_x)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    const double *a = get_coeffs(key);
+    double dx = t.xvec[cached_i+1] - t.xvec[cached_i], dy = t.yvec[cached_j+1] - t.yvec[cached_j];
+    double xi = (cached_x - t.xvec[cached_i])/dx, eta = (cached_y - t.yvec[cached_j])/dy;
+    double dz = 0;
+    if (wrt_x){
+        for (int n = 3; n >= 0; --n){
+            dz = dz*eta + ((3*a[3+4*n]*xi + 2*a[2+4*n])*xi + a[1+4*n]);
+        }
+        return dz/dx;
+    }
+    else{
+        for (int n = 3; n >= 1; --n){
+            dz = dz*eta + n*(((a[3+4*n]*xi + a[2+4*n])*xi + a[1+4*n])*xi + a[4*n]);
+        }
+        return dz/dy;
+    }
+}
+void BicubicBackend::evaluate_block(const BatchBlock &b, const std::vector<parameters> &keys, double **values)
+{
+    SinglePhaseGriddedTableData &t = single_phase;
+    // The coordinates of each point in the unit cell
+    const double *cell[BATCH_BLOCK_SIZE];
+    BatchLanes xi, eta;
+    for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){
+        xi[k] = (b.x[k] - t.xvec[b.i[k]])/(t.xvec[b.i[k]+1] - t.xvec[b.i[k]]);
+        eta[k] = (b.y[k] - t.yvec[b.j[k]])/(t.yvec[b.j[k]+1] - t.yvec[b.j[k]]);
+        cell[k] = coeffs.data() + (b.i[k]*(t.Ny-1) + b.j[k])*N_TABLE_VARIABLES*16;
+    }
+    for (std::size_t m = 0; m < keys.size(); ++m){
+        // Gather the coefficients of the variable into one set of lanes per coefficient, then evaluate the polynomials in all the lanes at once
+        std::size_t offset = 16*SinglePhaseGriddedTableData::index(keys[m]);
+        BatchLanes a[16];
+        for (std::size_t k = 0; k < BATCH_BLOCK_SIZE; ++k){
+            for (int c = 0; c < 16; ++c){ a[c][k] = cell[k][offset + c]; }
+        }
+        Eigen::Map<BatchLanes> z(values[m]);
+        z.setZero();
+        for (int n = 3; n >= 0; --n){
+            z = z*eta + (((a[3+4*n]*xi + a[2+4*n])*xi + a[1+4*n])*xi + a[4*n]);
+        }
+    }
+}
+
+#if defined(ENABLE_CATCH)
+
+TablesTestConfiguration::TablesTestConfiguration(double N)
+    : Nx0(get_config_double(TABULAR_NX)), Ny0(get_config_double(TABULAR_NY)), Nthreads0(get_config_double(TABULAR_BUILD_THREADS)),
+      tolerance0(get_config_double(TABULAR_REFINEMENT_TOLERANCE)), type0(get_config_string(TABULAR_TABLE_TYPE)),
+      directory0(get_config_string(ALTERNATIVE_TABLES_DIRECTORY))
+{
+    #if defined(__ISWINDOWS__)
+        char tmp[MAX_PATH + 1];
+        DWORD length = GetTempPathA(MAX_PATH + 1, tmp);
+        if (length == 0 || length > MAX_PATH){ throw ValueError("Unable to find the temporary directory"); }
+        static int counter = 0;
+        directory = format("%sCoolProp_tables_%lu_%d", tmp, static_cast<unsigned long>(GetCurrentProcessId()), counter++);
+        make_dirs(directory);
+    #else
+        const char *tmp = getenv("TMPDIR");
+        std::string pattern = std::string((tmp != NULL && tmp[0] != '\0') ? tmp : "/tmp") + "/CoolProp_tables_XXXXXX";
+        std::vector<char> buffer(pattern.begin(), pattern.end());
+        buffer.push_back('\0');
+        if (mkdtemp(&(buffer[0])) == NULL){
+            throw ValueError(format("Unable to make a temporary directory from [%s]", pattern.c_str()));
+        }
+        directory = &(buffer[0]);
+    #endif
+    set_config_string(ALTERNATIVE_TABLES_DIRECTORY, directory);
+    set_config_double(TABULAR_NX, N);
+    set_config_double(TABULAR_NY, N);
+}
+
+TablesTestConfiguration::~TablesTestConfiguration()
+{
+    set_config_double(TABULAR_NX, Nx0);
+    set_config_double(TABULAR_NY, Ny0);
+    set_config_double(TABULAR_BUILD_THREADS, Nthreads0);
+    set_config_double(TABULAR_REFINEMENT_TOLERANCE, tolerance0);
+    set_config_string(TABULAR_TABLE_TYPE, type0);
+    set_config_string(ALTERNATIVE_TABLES_DIRECTORY, directory0);
+
+    // The tables are written directly into the directory, so there are no subdirectories to remove
+    #if defined(__ISWINDOWS__)
+        WIN32_FIND_DATAA data;
+        HANDLE h = FindFirstFileA((directory + "\\*").c_str(), &data);
+        if (h != INVALID_HANDLE_VALUE){
+            do{
+                if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)){ DeleteFileA((directory + "\\" + data.cFileName).c_str()); }
+            } while (FindNextFileA(h, &data));
+            FindClose(h);
+        }
+        RemoveDirectoryA(directory.c_str());
+    #else
+        DIR *dir = opendir(directory.c_str());
+        if (dir != NULL){
+            for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir)){
+                std::string name = entry->d_name;
+                if (name != "." && name != ".."){ unlink((directory + "/" + name).c_str()); }
+            }
+            closedir(dir);
+        }
+        rmdir(directory.c_str());
+    #endif
+}
+
+#endif
+
+} /* namespace CoolProp */
+
+#if defined(ENABLE_CATCH)
+
+/// Tables of R134a in a temporary directory, and the backend used to build them, updated to one of the reference states:
+/// subcooled liquid, superheated vapor and supercritical.  The tables are only built once per test, so the states are
+/// looped over rather than put in separate sections
+class R134aTablesFixture
+{
+public:
+    enum { N_STATES = 3 };
+    CoolProp::TablesTestConfiguration configuration;
+    shared_ptr<CoolProp::AbstractState> HEOS;
+    R134aTablesFixture(double N) : configuration(N), HEOS(CoolProp::AbstractState::factory("HEOS", "R134a")) {};
+    /// A tabular backend of R134a, for instance "TTSE" or "BICUBIC"
+    shared_ptr<CoolProp::AbstractState> tables(const std::string &backend){
+        return shared_ptr<CoolProp::AbstractState>(CoolProp::AbstractState::factory(backend + "&HEOS", "R134a"));
+    };
+    /// Updates HEOS to the k-th reference state, and returns its pressure and temperature
+    void set_state(int k, double &p, double &T){
+        static const double pT[N_STATES][2] = {{1e6, 280}, {2e5, 300}, {1e7, 400}};
+        p = pT[k][0]; T = pT[k][1];
+        HEOS->update(CoolProp::PT_INPUTS, p, T);
+    };
+};
+
+TEST_CASE("TTSE backend against the backend used to build the tables", "[TTSE]")
+{
+    R134aTablesFixture fixture(50);
+    shared_ptr<CoolProp::AbstractState> TTSE = fixture.tables("TTSE"), HEOS = fixture.HEOS;
+
+    for (int k = 0; k < R134aTablesFixture::N_STATES; ++k){
+        double p, T;
+        fixture.set_state(k, p, T);
+        CAPTURE(p);
+        CAPTURE(T);
+        double h = HEOS->hmolar(), s = HEOS->smolar(), rho = HEOS->rhomolar();
+        TTSE->update(CoolProp::HmolarP_INPUTS, h, p);
+        CHECK(std::abs(TTSE->T()/T-1) < 1e-4);
+        CHECK(std::abs(TTSE->rhomolar()/rho-1) < 1e-4);
+        CHECK(std::abs(TTSE->smolar()/s-1) < 1e-4);
+        CHECK(std::abs(TTSE->cpmolar()/HEOS->cpmolar()-1) < 5e-3);
+        CHECK(std::abs(TTSE->speed_sound()/HEOS->speed_sound()-1) < 5e-3);
+        CHECK(std::abs(TTSE->first_partial_deriv(CoolProp::iDmolar, CoolProp::iP, CoolProp::iHmolar)/HEOS->first_partial_deriv(CoolProp::iDmolar, CoolProp::iP, CoolProp::iHmolar)-1) < 5e-3);
+
+        TTSE->update(CoolProp::PT_INPUTS, p, T);
+        CHECK(TTSE->T() == T);
+        CHECK(std::abs(TTSE->hmolar()/h-1) < 1e-4);
+        CHECK(std::abs(TTSE->rhomolar()/rho-1) < 1e-4);
+
+        TTSE->update(CoolProp::PSmolar_INPUTS, p, s);
+        CHECK(std::abs(TTSE->T()/T-1) < 1e-4);
+        CHECK(std::abs(TTSE->hmolar()/h-1) < 1e-4);
+    }
+
+    // Outside of the table, the state comes from HEOS
+    double p = 2*TTSE->pmax(), T = 300;
+    HEOS->update(CoolProp::PT_INPUTS, p, T);
+    CHECK_NOTHROW(TTSE->update(CoolProp::PT_INPUTS, p, T));
+    CHECK(TTSE->rhomolar() == HEOS->rhomolar());
+    CHECK(TTSE->hmolar() == HEOS->hmolar());
+
+    // Two-phase states come from the saturation table
+    HEOS->update(CoolProp::PQ_INPUTS, 5e5, 0.5);
+    CHECK_NOTHROW(TTSE->update(CoolProp::HmolarP_INPUTS, HEOS->hmolar(), 5e5));
+    CHECK(std::abs(TTSE->Q() - 0.5) < 1e-6);
+    CHECK(TTSE->phase() == CoolProp::iphase_twophase);
+}
+
+TEST_CASE("Two-phase states from the saturation table", "[TTSE],[saturation_table]")
+{
+    CoolProp::TablesTestConfiguration configuration(50);
+    shared_ptr<CoolProp::AbstractState> TTSE(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "R134a"));
+
+    double Ts[4] = {200, 250, 300, 370};
+    for (int k = 0; k < 4; ++k){
+        double T = Ts[k];
+        CAPTURE(T);
+        HEOS->update(CoolProp::QT_INPUTS, 0.3, T);
+        TTSE->update(CoolProp::QT_INPUTS, 0.3, T);
+        CHECK(std::abs(TTSE->p()/HEOS->p()-1) < 1e-6);
+        CHECK(std::abs(TTSE->rhomolar()/HEOS->rhomolar()-1) < 1e-6);
+        CHECK(std::abs(TTSE->hmolar()/HEOS->hmolar()-1) < 1e-6);
+        CHECK(std::abs(TTSE->smolar()/HEOS->smolar()-1) < 1e-6);
+        CHECK(std::abs(TTSE->saturated_vapor_keyed_output(CoolProp::iDmolar)/HEOS->saturated_vapor_keyed_output(CoolProp::iDmolar)-1) < 1e-6);
+
+        double p = HEOS->p(), h = HEOS->hmolar(), s = HEOS->smolar();
+        TTSE->update(CoolProp::PQ_INPUTS, p, 0.3);
+        CHECK(std::abs(TTSE->T()/T-1) < 1e-6);
+        TTSE->update(CoolProp::HmolarP_INPUTS, h, p);
+        CHECK(TTSE->phase() == CoolProp::iphase_twophase);
+        CHECK(std::abs(TTSE->Q()-0.3) < 1e-5);
+        TTSE->update(CoolProp::PSmolar_INPUTS, p, s);
+        CHECK(std::abs(TTSE->Q()-0.3) < 1e-5);
+    }
+}
+
+TEST_CASE("Bicubic backend against the backend used to build the tables", "[BICUBIC]")
+{
+    R134aTablesFixture fixture(50);
+    shared_ptr<CoolProp::AbstractState> BICUBIC = fixture.tables("BICUBIC"), HEOS = fixture.HEOS;
+
+    for (int k = 0; k < R134aTablesFixture::N_STATES; ++k){
+        double p, T;
+        fixture.set_state(k, p, T);
+        CAPTURE(p);
+        CAPTURE(T);
+        double h = HEOS->hmolar(), s = HEOS->smolar(), rho = HEOS->rhomolar();
+        BICUBIC->update(CoolProp::HmolarP_INPUTS, h, p);
+        CHECK(std::abs(BICUBIC->T()/T-1) < 1e-4);
+        CHECK(std::abs(BICUBIC->rhomolar()/rho-1) < 1e-4);
+        CHECK(std::abs(BICUBIC->smolar()/s-1) < 1e-4);
+        CHECK(std::abs(BICUBIC->cpmolar()/HEOS->cpmolar()-1) < 1e-3);
+
+        BICUBIC->update(CoolProp::PT_INPUTS, p, T);
+        CHECK(std::abs(BICUBIC->hmolar()/h-1) < 1e-4);
+        BICUBIC->update(CoolProp::PSmolar_INPUTS, p, s);
+        CHECK(std::abs(BICUBIC->T()/T-1) < 1e-4);
+    }
+
+    // The value and the derivatives are continuous across the boundary between two cells
+    HEOS->update(CoolProp::PT_INPUTS, 1e6, 280);
+    CoolProp::GriddedTableBackend &table = static_cast<CoolProp::GriddedTableBackend&>(*BICUBIC);
+    std::vector<double> &hvec = table.single_phase.xvec;
+    std::size_t i = std::lower_bound(hvec.begin(), hvec.end(), HEOS->hmolar()) - hvec.begin();
+    double hb = hvec[i], eps = 1e-8*std::abs(hb);
+    BICUBIC->update(CoolProp::HmolarP_INPUTS, hb - eps, 1e6);
+    double T1 = BICUBIC->T(), dTdh1 = BICUBIC->first_partial_deriv(CoolProp::iT, CoolProp::iHmolar, CoolProp::iP), dTdp1 = BICUBIC->first_partial_deriv(CoolProp::iT, CoolProp::iP, CoolProp::iHmolar);
+    BICUBIC->update(CoolProp::HmolarP_INPUTS, hb + eps, 1e6);
+    double T2 = BICUBIC->T(), dTdh2 = BICUBIC->first_partial_deriv(CoolProp::iT, CoolProp::iHmolar, CoolProp::iP), dTdp2 = BICUBIC->first_partial_deriv(CoolProp::iT, CoolProp::iP, CoolProp::iHmolar);
+    CHECK(std::abs(T2/T1-1) < 1e-7);
+    CHECK(std::abs(dTdh2/dTdh1-1) < 1e-6);
+    CHECK(std::abs(dTdp2/dTdp1-1) < 1e-6);
+}
+
+/// Puts a fluid back into the library when it goes out of scope, after a test has replaced it, even if a check throws
+struct LibraryFluidRestorer
+{
+    shared_ptr<CoolProp::CoolPropFluid> original;
+    LibraryFluidRestorer(const std::string &name) : original(CoolProp::get_library().get_shared(name)) {};
+    ~LibraryFluidRestorer(){ CoolProp::get_library().replace(original); };
+};
+
+TEST_CASE("Cache of the tables on disk", "[tables_cache]")
+{
+    CoolProp::TablesTestConfiguration configuration(20);
+    shared_ptr<CoolProp::AbstractState> built(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    built->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+    std::string path = static_cast<CoolProp::GriddedTableBackend&>(*built).path_to_tables();
+    CHECK(path.compare(0, configuration.tables_directory().size(), configuration.tables_directory()) == 0);
+
+    SECTION("The tables are loaded from the cache", ""){
+        shared_ptr<CoolProp::AbstractState> loaded(CoolProp::AbstractState::factory("BICUBIC&HEOS", "R134a"));
+        CHECK_NOTHROW(static_cast<CoolProp::GriddedTableBackend&>(*loaded).load_tables());
+        shared_ptr<CoolProp::AbstractState> loaded_TTSE(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        loaded_TTSE->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        CHECK(loaded_TTSE->T() == built->T());
+        CHECK(loaded_TTSE->smolar() == built->smolar());
+    }
+    SECTION("A change of the grid gives different tables", ""){
+        CoolProp::set_config_double(TABULAR_NX, 21.0);
+        shared_ptr<CoolProp::AbstractState> other(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        other->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        std::string other_path = static_cast<CoolProp::GriddedTableBackend&>(*other).path_to_tables();
+        CHECK(other_path != path);
+    }
+    SECTION("A change of the equation of state gives different tables", ""){
+        LibraryFluidRestorer R134a("R134a");
+
+        // Another reference state
+        CoolProp::set_reference_stateS("R134a", "ASHRAE");
+        shared_ptr<CoolProp::AbstractState> other_reference(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        other_reference->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        CHECK(static_cast<CoolProp::GriddedTableBackend&>(*other_reference).path_to_tables() != path);
+
+        // Another coefficient of the residual Helmholtz energy, so small a change that the tables would hardly differ
+        shared_ptr<CoolProp::CoolPropFluid> changed = CoolProp::get_library().get_copy("R134a");
+        changed->pEOS->alpha0 = R134a.original->pEOS->alpha0;
+        changed->pEOS->alphar.GenExp.elements.back().n *= 1 + 1e-12;
+        changed->pEOS->alphar.GenExp.finish();
+        changed->pEOS->alphar.GenExpKernel = NULL;
+        CoolProp::get_library().replace(changed);
+        shared_ptr<CoolProp::AbstractState> other_coefficient(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        other_coefficient->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        std::string other_path = static_cast<CoolProp::GriddedTableBackend&>(*other_coefficient).path_to_tables();
+        CHECK(other_path != path);
+        CHECK(other_path != static_cast<CoolProp::GriddedTableBackend&>(*other_reference).path_to_tables());
+    }
+    SECTION("Damaged tables are built again", ""){
+        FILE *fp = fopen(path.c_str(), "r+b");
+        REQUIRE(fp != NULL);
+        fwrite("XXXXXXXX", 1, 8, fp);
+        fclose(fp);
+        shared_ptr<CoolProp::AbstractState> rebuilt(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        CHECK_NOTHROW(rebuilt->update(CoolProp::HmolarP_INPUTS, 25000, 1e6));
+        CHECK(rebuilt->T() == built->T());
+        shared_ptr<CoolProp::AbstractState> loaded(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        CHECK_NOTHROW(static_cast<CoolProp::GriddedTableBackend&>(*loaded).load_tables());
+    }
+}
+
+TEST_CASE("Cache of the tables with transport properties from extended corresponding states", "[tables_cache]")
+{
+    CoolProp::TablesTestConfiguration configuration(20);
+    // The viscosity and conductivity of R12 are from extended corresponding states with R134a as the reference fluid
+    REQUIRE(CoolProp::get_library().get("R12").transport.viscosity_using_ECS);
+    REQUIRE(CoolProp::get_library().get("R12").transport.viscosity_ecs.reference_fluid == "R134a");
+    shared_ptr<CoolProp::AbstractState> built(CoolProp::AbstractState::factory("TTSE&HEOS", "R12"));
+    built->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+    std::string path = static_cast<CoolProp::GriddedTableBackend&>(*built).path_to_tables();
+
+    SECTION("A change of the transport model of the fluid gives different tables", ""){
+        LibraryFluidRestorer R12("R12");
+        shared_ptr<CoolProp::CoolPropFluid> changed = CoolProp::get_library().get_copy("R12");
+        changed->transport.viscosity_ecs.psi_a.back() *= 1 + 1e-12;
+        CoolProp::get_library().replace(changed);
+        shared_ptr<CoolProp::AbstractState> other(CoolProp::AbstractState::factory("TTSE&HEOS", "R12"));
+        other->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        CHECK(static_cast<CoolProp::GriddedTableBackend&>(*other).path_to_tables() != path);
+    }
+    SECTION("A change of the transport model of the reference fluid gives different tables", ""){
+        LibraryFluidRestorer R134a("R134a");
+        shared_ptr<CoolProp::CoolPropFluid> changed = CoolProp::get_library().get_copy("R134a");
+        changed->transport.epsilon_over_k *= 1 + 1e-12;
+        CoolProp::get_library().replace(changed);
+        shared_ptr<CoolProp::AbstractState> other(CoolProp::AbstractState::factory("TTSE&HEOS", "R12"));
+        other->update(CoolProp::HmolarP_INPUTS, 25000, 1e6);
+        CHECK(static_cast<CoolProp::GriddedTableBackend&>(*other).path_to_tables() != path);
+    }
+}
+
+TEST_CASE("Tables built with several threads", "[tables_parallel]")
+{
+    CoolProp::TablesTestConfiguration configuration(40);
+    CoolProp::set_config_double(TABULAR_BUILD_THREADS, 1.0);
+    shared_ptr<CoolProp::AbstractState> serial(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    CoolProp::GriddedTableBackend &s = static_cast<CoolProp::GriddedTableBackend&>(*serial);
+    s.build_tables();
+
+    int Nthreads_list[] = {2, 4, 8};
+    for (int k = 0; k < 3; ++k){
+        int Nthreads = Nthreads_list[k];
+        CAPTURE(Nthreads);
+        CoolProp::set_config_double(TABULAR_BUILD_THREADS, Nthreads);
+        shared_ptr<CoolProp::AbstractState> parallel(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+        CoolProp::GriddedTableBackend &p = static_cast<CoolProp::GriddedTableBackend&>(*parallel);
+        p.build_tables();
+
+        REQUIRE(p.single_phase.nodes.size() == s.single_phase.nodes.size());
+        CHECK(memcmp(p.single_phase.nodes.data(), s.single_phase.nodes.data(), s.single_phase.nodes.size()*sizeof(double)) == 0);
+        CHECK(p.pure_saturation.T == s.pure_saturation.T);
+        CHECK(p.pure_saturation.p == s.pure_saturation.p);
+        CHECK(p.pure_saturation.rhomolarV == s.pure_saturation.rhomolarV);
+        CHECK(p.pure_saturation.hmolarL == s.pure_saturation.hmolarL);
+        CHECK(p.pure_saturation.smolarV == s.pure_saturation.smolarV);
+    }
+}
+
+TEST_CASE("Caloric and transport properties from the channels of the tables", "[TTSE],[BICUBIC],[table_channels]")
+{
+    R134aTablesFixture fixture(100);
+    shared_ptr<CoolProp::AbstractState> HEOS = fixture.HEOS;
+    const char *backends[2] = {"TTSE", "BICUBIC"};
+    for (int m = 0; m < 2; ++m){
+        shared_ptr<CoolProp::AbstractState> table = fixture.tables(backends[m]);
+        std::string backend = backends[m];
+        CAPTURE(backend);
+
+        for (int k = 0; k < R134aTablesFixture::N_STATES; ++k){
+            double p, T;
+            fixture.set_state(k, p, T);
+            CAPTURE(p);
+            CAPTURE(T);
+            table->update(CoolProp::HmolarP_INPUTS, HEOS->hmolar(), p);
+            CHECK(std::abs(table->cpmolar()/HEOS->cpmolar()-1) < 1e-4);
+            CHECK(std::abs(table->cvmolar()/HEOS->cvmolar()-1) < 1e-4);
+            CHECK(std::abs(table->speed_sound()/HEOS->speed_sound()-1) < 1e-4);
+            CHECK(std::abs(table->viscosity()/HEOS->viscosity()-1) < 1e-4);
+            CHECK(std::abs(table->conductivity()/HEOS->conductivity()-1) < 1e-4);
+
+            // The derivatives of the channels, against central differences of the backend used to build the tables
+            double dT = 1e-3*T, mu_plus, mu_minus;
+            HEOS->update(CoolProp::PT_INPUTS, p, T + dT); mu_plus = HEOS->viscosity();
+            HEOS->update(CoolProp::PT_INPUTS, p, T - dT); mu_minus = HEOS->viscosity();
+            CHECK(std::abs(table->first_partial_deriv(CoolProp::iviscosity, CoolProp::iT, CoolProp::iP)/((mu_plus - mu_minus)/(2*dT))-1) < 1e-3);
+        }
+    }
+}
+
+TEST_CASE("Tables of other variables, and inverse lookups in them", "[TTSE],[table_types]")
+{
+    R134aTablesFixture fixture(60);
+    shared_ptr<CoolProp::AbstractState> HEOS = fixture.HEOS;
+
+    const char *types[3] = {"LOGPT", "LOGDT", "LOGPS"};
+    for (int m = 0; m < 3; ++m){
+        CoolProp::set_config_string(TABULAR_TABLE_TYPE, types[m]);
+        shared_ptr<CoolProp::AbstractState> TTSE = fixture.tables("TTSE");
+        std::string type = types[m];
+        CAPTURE(type);
+
+        // The properties vary more steeply across the cells of these tables near the critical density, so the supercritical
+        // state is less accurate on this coarse grid
+        double tolerances[R134aTablesFixture::N_STATES] = {1e-3, 1e-3, 1e-2};
+        for (int k = 0; k < R134aTablesFixture::N_STATES; ++k){
+            double p, T, tol = tolerances[k];
+            fixture.set_state(k, p, T);
+            CAPTURE(p);
+            CAPTURE(T);
+            double h = HEOS->hmolar(), s = HEOS->smolar(), rho = HEOS->rhomolar();
+            // The native inputs of the table, and inputs that share one variable with it
+            CoolProp::input_pairs pairs[3] = {CoolProp::PT_INPUTS, CoolProp::DmolarT_INPUTS, CoolProp::PSmolar_INPUTS};
+            double values[3][2] = {{p, T}, {rho, T}, {p, s}};
+            for (int n = 0; n < 3; ++n){
+                CAPTURE(n);
+                TTSE->update(pairs[n], values[n][0], values[n][1]);
+                CHECK(std::abs(TTSE->T()/T-1) < tol);
+                CHECK(std::abs(TTSE->p()/p-1) < tol);
+                CHECK(std::abs(TTSE->rhomolar()/rho-1) < tol);
+                CHECK(std::abs(TTSE->hmolar()/h-1) < tol);
+                CHECK(std::abs(TTSE->smolar()/s-1) < tol);
+                // The inputs are kept exactly
+                if (n < 2){ CHECK(TTSE->T() == T); }
+                if (n == 1){ CHECK(TTSE->rhomolar() == rho); }
+            }
+        }
+        // Two-phase states from the saturation table
+        HEOS->update(CoolProp::QT_INPUTS, 0.3, 270);
+        TTSE->update(CoolProp::DmolarT_INPUTS, HEOS->rhomolar(), 270);
+        CHECK(TTSE->phase() == CoolProp::iphase_twophase);
+        CHECK(std::abs(TTSE->Q() - 0.3) < 1e-5);
+        CHECK(std::abs(TTSE->p()/HEOS->p() - 1) < 1e-5);
+    }
+    CoolProp::set_config_string(TABULAR_TABLE_TYPE, "LOGXY");
+    CHECK_THROWS(shared_ptr<CoolProp::AbstractState> bad(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a")));
+}
+
+TEST_CASE("Batch lookups against lookups one at a time", "[TTSE],[BICUBIC],[tables_batch]")
+{
+    CoolProp::TablesTestConfiguration configuration(50);
+    // The LOGDT table finds the two-phase states from the density rather than the enthalpy
+    const char *backends[3] = {"TTSE&HEOS", "BICUBIC&HEOS", "TTSE&HEOS"}, *types[3] = {"LOGPH", "LOGPH", "LOGDT"};
+    for (int m = 0; m < 3; ++m){
+        CoolProp::set_config_string(TABULAR_TABLE_TYPE, types[m]);
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory(backends[m], "R134a"));
+        CoolProp::GriddedTableBackend &table = static_cast<CoolProp::GriddedTableBackend&>(*AS);
+        AS->update(CoolProp::PT_INPUTS, 1e6, 300); // Builds the tables
+        std::string backend = backends[m], type = types[m];
+        CAPTURE(backend);
+        CAPTURE(type);
+
+        // A lattice of (x, y) that overhangs the table on all sides, so that some of the points are passed to update()
+        CoolProp::SinglePhaseGriddedTableData &t = table.single_phase;
+        std::size_t Nx = 101, Ny = 99, N = Nx*Ny;
+        std::vector<double> x(N), y(N);
+        for (std::size_t i = 0; i < Nx; ++i){
+            for (std::size_t j = 0; j < Ny; ++j){
+                double fx = 1.1*i/(Nx-1) - 0.05, fy = 1.1*j/(Ny-1) - 0.05;
+                x[i*Ny + j] = (t.logx) ? t.xmin*pow(t.xmax/t.xmin, fx) : t.xmin + (t.xmax - t.xmin)*fx;
+                y[i*Ny + j] = (t.logy) ? t.ymin*pow(t.ymax/t.ymin, fy) : t.ymin + (t.ymax - t.ymin)*fy;
+            }
+        }
+        std::vector<CoolProp::parameters> outputs;
+        outputs.push_back(CoolProp::iT); outputs.push_back(CoolProp::iP); outputs.push_back(CoolProp::iDmolar); outputs.push_back(CoolProp::iSmolar);
+        outputs.push_back(CoolProp::iCpmolar);
+        std::vector<std::vector<double> > batch(outputs.size(), std::vector<double>(N));
+        std::vector<double*> results(outputs.size());
+        for (std::size_t k = 0; k < outputs.size(); ++k){ results[k] = &(batch[k][0]); }
+        std::size_t Ninterpolated = table.evaluate_batch(N, &(x[0]), &(y[0]), outputs, results);
+
+        // Every point gets the same value as from update(), and the same points are interpolated
+        std::size_t Nmismatch = 0, Nscalar = 0;
+        for (std::size_t n = 0; n < N; ++n){
+            // Like evaluate_batch, all the outputs of a point are _HUGE if any of them fails
+            std::vector<double> expected(outputs.size(), _HUGE);
+            try{
+                double value1, value2;
+                CoolProp::input_pairs pair = CoolProp::generate_update_pair(t.xkey, x[n], t.ykey, y[n], value1, value2);
+                AS->update(pair, value1, value2);
+                if (!table.using_wrapped_backend() && AS->phase() != CoolProp::iphase_twophase){ ++Nscalar; }
+                std::vector<double> values(outputs.size());
+                for (std::size_t k = 0; k < outputs.size(); ++k){ values[k] = AS->keyed_output(outputs[k]); }
+                expected = values;
+            }
+            catch(std::exception &){}
+            for (std::size_t k = 0; k < outputs.size(); ++k){
+                if (!(batch[k][n] == expected[k] || std::abs(expected[k]/batch[k][n] - 1) < 1e-12)){ ++Nmismatch; }
+            }
+        }
+        CHECK(Nscalar > N/3);
+        CHECK(Ninterpolated == Nscalar);
+        CHECK(Nmismatch == 0);
+    }
+
+    shared_ptr<CoolProp::AbstractState> TTSE(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    std::vector<CoolProp::parameters> outputs(1, CoolProp::iGmolar);
+    std::vector<double*> results(1, static_cast<double*>(NULL));
+    double x = 25000, y = 1e6;
+    CHECK_THROWS(static_cast<CoolProp::GriddedTableBackend&>(*TTSE).evaluate_batch(1, &x, &y, outputs, results));
+}
+
+TEST_CASE("Tables of a mixture at fixed composition", "[TTSE],[mixture_tables]")
+{
+    CoolProp::TablesTestConfiguration configuration(60);
+    shared_ptr<CoolProp::AbstractState> TTSE(CoolProp::AbstractState::factory("TTSE&HEOS", "R32&R125"));
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "R32&R125"));
+    std::vector<CoolPropDbl> z(2, 0.5);
+    TTSE->set_mole_fractions(z);
+    HEOS->set_mole_fractions(z);
+    CoolProp::GriddedTableBackend &table = static_cast<CoolProp::GriddedTableBackend&>(*TTSE);
+
+    // Superheated gas and subcooled liquid, against the backend used to build the tables with the phase imposed
+    double Trho[2][2] = {{300, 200}, {250, 16500}};
+    CoolProp::phases phases[2] = {CoolProp::iphase_gas, CoolProp::iphase_liquid};
+    for (int k = 0; k < 2; ++k){
+        double T = Trho[k][0], rho = Trho[k][1];
+        CAPTURE(T);
+        CAPTURE(rho);
+        HEOS->specify_phase(phases[k]);
+        HEOS->update(CoolProp::DmolarT_INPUTS, rho, T);
+        HEOS->unspecify_phase();
+        double p = HEOS->p(), h = HEOS->hmolar();
+        TTSE->update(CoolProp::DmolarT_INPUTS, rho, T);
+        CHECK(!table.using_wrapped_backend());
+        CHECK(TTSE->phase() == phases[k]);
+        // The pressure of the compressed liquid varies steeply with its density, and there are few rows of nodes in the liquid
+        CHECK(std::abs(TTSE->p()/p-1) < 1e-2);
+        CHECK(std::abs(TTSE->hmolar()/h-1) < 1e-3);
+        CHECK(std::abs(TTSE->cpmolar()/HEOS->cpmolar()-1) < 1e-2);
+        TTSE->update(CoolProp::PT_INPUTS, p, T);
+        CHECK(!table.using_wrapped_backend());
+        CHECK(std::abs(TTSE->rhomolar()/rho-1) < 1e-3);
+    }
+
+    // The table stops at the phase envelope
+    TTSE->update(CoolProp::PQ_INPUTS, 1e6, 1);
+    double Tdew = TTSE->T(), rhodew = TTSE->rhomolar();
+    HEOS->update(CoolProp::PQ_INPUTS, 1e6, 1);
+    CHECK(std::abs(Tdew/HEOS->T()-1) < 1e-3);
+    CHECK(std::abs(rhodew/HEOS->rhomolar()-1) < 1e-2);
+    CHECK(table.mixture_envelope.phase(Tdew - 1, rhodew) == CoolProp::iphase_twophase);
+    CHECK(table.mixture_envelope.phase(Tdew + 1, rhodew) == CoolProp::iphase_gas);
+    TTSE->update(CoolProp::QT_INPUTS, 0, 250);
+    HEOS->update(CoolProp::QT_INPUTS, 0, 250);
+    CHECK(std::abs(TTSE->p()/HEOS->p()-1) < 1e-3);
+}
+
+TEST_CASE("Tables refined near the critical point", "[tables_refinement]")
+{
+    CoolProp::TablesTestConfiguration configuration(30);
+    shared_ptr<CoolProp::AbstractState> uniform(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    CoolProp::set_config_double(TABULAR_REFINEMENT_TOLERANCE, 1e-4);
+    shared_ptr<CoolProp::AbstractState> refined(CoolProp::AbstractState::factory("TTSE&HEOS", "R134a"));
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "R134a"));
+
+    CoolProp::GriddedTableBackend &u = static_cast<CoolProp::GriddedTableBackend&>(*uniform);
+    CoolProp::GriddedTableBackend &r = static_cast<CoolProp::GriddedTableBackend&>(*refined);
+    u.build_tables();
+    r.build_tables();
+    CoolProp::SinglePhaseGriddedTableData &t = r.single_phase;
+    CHECK(t.Nx > 30);
+    CHECK(t.Ny > 30);
+    CHECK(t.Nx <= CoolProp::MAX_REFINEMENT_GROWTH*30);
+    CHECK(t.Ny <= CoolProp::MAX_REFINEMENT_GROWTH*30);
+    CHECK(!t.uniform);
+    // The grid still spans the same range, in increasing order
+    CHECK(t.xvec[0] == u.single_phase.xmin);
+    CHECK(t.xvec[t.Nx-1] == u.single_phase.xmax);
+    CHECK(std::adjacent_find(t.xvec.begin(), t.xvec.end(), std::greater_equal<double>()) == t.xvec.end());
+    CHECK(std::adjacent_find(t.yvec.begin(), t.yvec.end(), std::greater_equal<double>()) == t.yvec.end());
+
+    // Supercritical states just above the critical point, where cp peaks
+    double max_uniform = 0, max_refined = 0;
+    for (double T = 372; T <= 385; T += 1){
+        HEOS->update(CoolProp::PT_INPUTS, 4.2e6, T);
+        double h = HEOS->hmolar(), rho = HEOS->rhomolar();
+        uniform->update(CoolProp::HmolarP_INPUTS, h, 4.2e6);
+        refined->update(CoolProp::HmolarP_INPUTS, h, 4.2e6);
+        max_uniform = std::max(max_uniform, std::max(std::abs(uniform->T()/T-1), std::abs(uniform->rhomolar()/rho-1)));
+        max_refined = std::max(max_refined, std::max(std::abs(refined->T()/T-1), std::abs(refined->rhomolar()/rho-1)));
+    }
+    CAPTURE(max_uniform);
+    CAPTURE(max_refined);
+    CHECK(max_refined < 1e-4);
+    CHECK(max_refined < 0.1*max_uniform);
+}
+
+#endif
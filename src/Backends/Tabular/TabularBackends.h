@@ -2,63 +2,504 @@
 #define TABULAR_BACKENDS_H
 
 #include "AbstractState.h"
+#include "Configuration.h"
+#include "crossplatform_shared_ptr.h"
+#include "Eigen/Core"
 
 namespace CoolProp{
 
+/// The version of the binary format of the tables in the cache; bump it whenever the layout of the tables changes
+const int TABLES_FORMAT_VERSION = 5;
+
+class MappedFile;
+
+/// The size in bytes of a cache line, to which the packed tables are aligned
+const std::size_t CACHE_LINE_SIZE = 64;
+
+/// An array of doubles that starts at the beginning of a cache line
+/**
+The doubles are either allocated by the array, or are part of a file that is mapped into memory, in which case they must not be
+modified.  Copies of the array share the same doubles.
+*/
+class AlignedArray{
+private:
+    shared_ptr<std::vector<double> > buffer;
+    shared_ptr<MappedFile> mapping;
+    double *_data;
+    std::size_t _size;
+public:
+    AlignedArray() : _data(NULL), _size(0) {};
+    /// Allocate N doubles, all set to value
+    void allocate(std::size_t N, double value);
+    /// Use N doubles of a mapped file, starting at offset bytes from the start of the file; offset must be a multiple of CACHE_LINE_SIZE
+    void map(shared_ptr<MappedFile> mapping, std::size_t offset, std::size_t N);
+    double *data(){ return _data; };
+    std::size_t size(){ return _size; };
+};
+
+/// The number of variables that are tabulated: the state variables T, p, rhomolar, hmolar and smolar, and the channels cpmolar,
+/// cvmolar, speed_sound, viscosity and conductivity
+const std::size_t N_TABLE_VARIABLES = 10;
+
+/// The offsets of the values that are stored for each node of the single-phase table
+/**
+The values at a node fill NODE_STRIDE doubles (eight cache lines): the phase, the flags of the cell whose lower-left corner is the
+node, and then, for each of the N_TABLE_VARIABLES variables in turn, its value and its first and second derivatives (in the order of
+gridded_derivatives).  The phase and T are in the first cache line, and each variable spans at most two.
+*/
+enum gridded_node_layout{
+    NODE_PHASE = 0, ///< The phase at the node
+    NODE_CELL_OK = 1, ///< The cell_flags of the cell whose lower-left corner is the node
+    NODE_VARIABLES = 2, ///< The offset of the first of the variables
+    NODE_STRIDE = 64 ///< The number of doubles for each node
+};
+/// The flags of a cell of the single-phase table, which are or-ed together
+enum cell_flags{
+    CELL_OK = 1, ///< The cell can be interpolated
+    CELL_TRANSPORT_OK = 2 ///< The transport properties are known at all the corners of the cell
+};
+/// The value of a variable at a node and its derivatives, in the order in which they are stored
+/**
+The derivatives are taken with respect to the table variables x and y themselves (not their logarithms), x at constant y and y at constant x
+*/
+enum gridded_derivatives{ VALUE = 0, DVDX, DVDY, D2VDX2, D2VDXDY, D2VDY2, N_GRIDDED_DERIVATIVES };
+
+/// The state variables on a grid of (x, y) nodes that covers the single-phase region
+/**
+The x values are linearly or logarithmically spaced between xmin and xmax, and likewise for y, unless the grid has been refined, in
+which case nodes have been added between them (see GriddedTableBackend::build_tables).  Nodes that are two-phase, or for which the
+state could not be calculated, are holes in the table; their values are left at _HUGE and their phase is iphase_twophase or
+iphase_not_imposed respectively.  If only the transport properties could not be calculated (the fluid has no correlations for them),
+just their values are left at _HUGE.
+
+The nodes are packed in one aligned array, row by row (node (i, j) is block i*Ny + j), with the layout of gridded_node_layout, so that a
+lookup only touches one or two cache lines of the table, and so that the array can be used straight from a file mapped into memory.
+*/
 struct SinglePhaseGriddedTableData{
+    std::size_t Nx, Ny;
     CoolProp::parameters xkey, ykey;
-    std::vector< std::vector<double> > T, p, rhomolar, hmolar, smolar;
-    std::vector< std::vector<double> > dTdx, dTdy, dpdx, dpdy, drhomolardx, drhomolardy, dhmolardx, dhmolardy, dsmolardx, dsmolardy;
-    
-    void resize(std::size_t Nx, std::size_t Ny){
-        // State variables
-        T.resize(Nx, std::vector<double>(Ny, _HUGE));
-        p.resize(Nx, std::vector<double>(Ny, _HUGE));
-        rhomolar.resize(Nx, std::vector<double>(Ny, _HUGE));
-        hmolar.resize(Nx, std::vector<double>(Ny, _HUGE));
-        smolar.resize(Nx, std::vector<double>(Ny, _HUGE));
-        
-        // First derivatives of state variables
-        dTdx.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dpdx.resize(Nx, std::vector<double>(Ny, _HUGE));
-        drhomolardx.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dhmolardx.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dsmolardx.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dTdy.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dpdy.resize(Nx, std::vector<double>(Ny, _HUGE));
-        drhomolardy.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dhmolardy.resize(Nx, std::vector<double>(Ny, _HUGE));
-        dsmolardy.resize(Nx, std::vector<double>(Ny, _HUGE));
+    bool logx, logy;
+    double xmin, xmax, ymin, ymax;
+    std::vector<double> xvec, yvec;
+    bool uniform; ///< True if the nodes are evenly spaced, so that the cell that contains a state can be found without a search
+    AlignedArray nodes;
+
+    SinglePhaseGriddedTableData() : Nx(0), Ny(0), xkey(iundefined_parameter), ykey(iundefined_parameter), logx(false), logy(false), xmin(_HUGE), xmax(_HUGE), ymin(_HUGE), ymax(_HUGE), uniform(true) {};
+
+    /// Allocate the nodes, all of them holes
+    void resize(std::size_t Nx, std::size_t Ny);
+    /// Set the values of x and y at the nodes from the limits and the spacing
+    void make_grid(void);
+    /// The index i (0 to Nx-2) of the cell for which xvec[i] <= x <= xvec[i+1]; in constant time for uniform grids, otherwise by bisection
+    std::size_t x_cell(double x);
+    /// The index j (0 to Ny-2) of the cell for which yvec[j] <= y <= yvec[j+1]; in constant time for uniform grids, otherwise by bisection
+    std::size_t y_cell(double y);
+    /// The values at node (i, j)
+    double *node(std::size_t i, std::size_t j){ return nodes.data() + (i*Ny + j)*NODE_STRIDE; };
+    /// The value and derivatives of one of the state variables at node (i, j)
+    double *variable(std::size_t i, std::size_t j, parameters key){ return node(i, j) + offset(key); };
+    /// True if the node has been filled in
+    bool valid(std::size_t i, std::size_t j){ return ValidNumber(node(i, j)[NODE_VARIABLES + VALUE]); };
+    /// The phase at node (i, j)
+    int phase(std::size_t i, std::size_t j){ return static_cast<int>(node(i, j)[NODE_PHASE]); };
+    /// True if the cell whose lower-left corner is node (i, j) can be interpolated
+    bool cell_ok(std::size_t i, std::size_t j){ return (static_cast<int>(node(i, j)[NODE_CELL_OK]) & CELL_OK) != 0; };
+    /// True if the transport properties can be interpolated in the cell whose lower-left corner is node (i, j)
+    bool transport_ok(std::size_t i, std::size_t j){ return (static_cast<int>(node(i, j)[NODE_CELL_OK]) & CELL_TRANSPORT_OK) != 0; };
+    /// The index (0 to N_TABLE_VARIABLES-1) of one of the variables, in the order in which they are stored
+    static std::size_t index(parameters key);
+    /// The variable with the index given; the inverse of index()
+    static parameters key(std::size_t index);
+    /// The offset of the values of one of the variables at a node
+    static std::size_t offset(parameters key){ return NODE_VARIABLES + N_GRIDDED_DERIVATIVES*index(key); };
+};
+
+/// The saturated liquid and vapor states of a pure fluid, from the triple point to just below the critical point
+/**
+The nodes are evenly spaced in T.  Values between the nodes are found by cubic interpolation in log(p) when the pressure
+is given, or in T when the temperature is given.
+*/
+struct PureFluidSaturationTableData{
+    std::size_t N;
+    std::vector<double> T, p, logp, rhomolarL, rhomolarV, hmolarL, hmolarV, smolarL, smolarV;
+
+    PureFluidSaturationTableData() : N(0) {};
+
+    void resize(std::size_t N){
+        this->N = N;
+        T.resize(N); p.resize(N); logp.resize(N);
+        rhomolarL.resize(N); rhomolarV.resize(N);
+        hmolarL.resize(N); hmolarV.resize(N);
+        smolarL.resize(N); smolarV.resize(N);
+    };
+    /// True if the saturation curve at the pressure (if key is iP) or the temperature (if key is iT) is in the table
+    bool is_inside(parameters key, double value);
+    /// Interpolate a saturated liquid (Q = 0) or vapor (Q = 1) variable at the pressure (if key is iP) or temperature (if key is iT) given
+    double evaluate(parameters output, parameters key, double value, int Q);
+    /// Get the saturated liquid (Q = 0) or vapor (Q = 1) values of one of the variables
+    std::vector<double> &get(parameters key, int Q);
+    /// Cubic (Lagrange) interpolation of y in x at x0, through the two nodes on either side of x0 (or the four at the end of the
+    /// curve); the logarithms of the values of y are interpolated if logy is true
+    static double cubic_interpolation(const std::vector<double> &x, const std::vector<double> &y, double x0, bool logy);
+    /// The smallest and largest values that cubic_interpolation gives for x0 from x0min to x0max (which must be within x)
+    static void cubic_interpolation_range(const std::vector<double> &x, const std::vector<double> &y, double x0min, double x0max, bool logy, double &ymin, double &ymax);
+};
+
+/// The phase envelope of a mixture at the composition of the tables, from PhaseEnvelopeRoutines::build
+/**
+The envelope is traced as the dew curve of the bulk phase all the way round, in order of increasing density of the bulk phase,
+so it is stored as the temperature of the envelope against log(rhomolar) of the bulk phase.  A state (T, rhomolar) of the bulk
+phase is two-phase if its density is within the range of the envelope and it is colder than the envelope at that density.
+
+The dew (Q = 1) and bubble (Q = 0) branches are also stored apart, each from its low-pressure end up to the point at which
+its temperature or pressure stops increasing, so that the saturated states can be interpolated in T or log(p) like those of
+a pure fluid.  The envelope between the ends of the branches, around the critical point, is not in either of them.
+*/
+struct MixtureEnvelopeTableData{
+    /// One branch of the envelope, in order of increasing T and p
+    struct Branch{
+        std::vector<double> T, p, logp, rhomolar, hmolar, smolar;
     };
+    std::vector<double> T, logrhomolar; ///< The whole envelope, in order of increasing density
+    Branch dew, bubble;
+    double Tmax; ///< The cricondentherm
+    double pmax; ///< The cricondenbar
+    double rhomolar_crit; ///< The density at the critical point, where the bulk phase becomes denser than the incipient phase
+
+    MixtureEnvelopeTableData() : Tmax(_HUGE), pmax(_HUGE), rhomolar_crit(_HUGE) {};
+
+    /// Take the envelope from the data of a backend that has built it; throws if it is not a closed envelope through a critical point
+    void build(const PhaseEnvelopeData &env);
+    /// True if the envelope has been built
+    bool empty(void){ return T.empty(); };
+    /// The phase of the bulk state (T, rhomolar): iphase_twophase inside the envelope, iphase_not_imposed if it cannot be told
+    /// (colder than the ends of the envelope), otherwise one of iphase_gas, iphase_liquid or iphase_supercritical
+    phases phase(double T, double rhomolar);
+    /// True if the branch Q (0 or 1) reaches the pressure (if key is iP) or temperature (if key is iT) given
+    bool is_inside(parameters key, double value, int Q);
+    /// Interpolate a bulk variable on the branch Q (0 or 1) at the pressure (if key is iP) or temperature (if key is iT) given
+    double evaluate(parameters output, parameters key, double value, int Q);
 };
+
+/// The number of times that an interval of the grid can be split in two by the refinement
+const int MAX_REFINEMENT_LEVELS = 3;
+/// The factor by which the refinement may increase the number of nodes in each direction
+const std::size_t MAX_REFINEMENT_GROWTH = 3;
+
+/// The number of points that a batch lookup locates and interpolates together (see GriddedTableBackend::evaluate_batch)
+const std::size_t BATCH_BLOCK_SIZE = 8;
+/// The values of one variable at the points of a block of a batch lookup, one SIMD lane per point
+typedef Eigen::Array<double, BATCH_BLOCK_SIZE, 1> BatchLanes;
+
+/// The base class for the backends that interpolate in tables built with another backend
+/**
+The tables are built the first time that the state is updated.  The variables of the single-phase table are chosen with the
+TABULAR_TABLE_TYPE configuration key:
+
+    LOGPH       hmolar and log(p)
+    LOGPT       T and log(p)
+    LOGDT       T and log(rhomolar)
+    LOGPS       smolar and log(p)
+
+Inputs of both variables of the table are interpolated directly.  Inputs of one variable of the table and one other tabulated
+variable (T, p, rhomolar, hmolar or smolar), such as PT inputs to a LOGPH table, are found by Newton iteration in the other
+variable of the table, along the nearest line of nodes and then with the derivatives of the interpolant, rather than with a
+flash of the wrapped backend.
+
+Besides the state variables, cpmolar, cvmolar, speed_sound, viscosity and conductivity are tabulated with their derivatives, and
+are interpolated like them, so that single-phase states in the table never need the wrapped backend.
+
+For pure fluids, the saturation curve is tabulated too, and two-phase states are found from it for the PQ and QT inputs, and
+for inputs of p or T with one of rhomolar, hmolar or smolar.  Where the tables cannot be used (the inputs are outside the table,
+next to a hole in the table, or the input pair is not supported), the state is updated with the wrapped backend instead, and
+all the outputs come from it.
+
+Mixtures are tabulated at the composition given by set_mole_fractions.  Their tables are always LOGDT tables, since the wrapped
+backend can only be updated with T and rhomolar (with the phase imposed) without a flash, and their limits and two-phase nodes
+come from the phase envelope (see MixtureEnvelopeTableData).  The bubble and dew points (PQ and QT inputs with Q = 0 or 1) are
+interpolated on the envelope; other two-phase states come from the wrapped backend.
+*/
 class GriddedTableBackend : public AbstractState
 {
     protected:
-    enum tabular_types {LOGPH_TABLE};
-    AbstractState *AS;
+    enum tabular_types {LOGPH_TABLE, LOGPT_TABLE, LOGDT_TABLE, LOGPS_TABLE};
+    /// The type of table named by the string given, as in the TABULAR_TABLE_TYPE configuration key
+    static tabular_types get_table_type(const std::string &name);
+    shared_ptr<AbstractState> AS; ///< The backend that is used to build the tables and to calculate the states that are not in them
+    std::string AS_backend_name; ///< The name of the backend AS, as passed to the factory
+    std::vector<CoolPropDbl> mole_fractions; ///< The composition that the tables are built for
+    std::string tables_key; ///< Everything that the tables depend on; the tables in the cache are only used if their key matches
+    std::size_t Nx_config, Ny_config; ///< The numbers of nodes of the grid, from the configuration when the backend was constructed
+    std::size_t Nthreads_config; ///< The number of threads that build the tables (0 for one per processor), from the configuration when the backend was constructed
+    double refinement_tolerance; ///< The largest relative error of the interpolated state allowed in a cell before it is refined (0 for a uniform grid), from the configuration when the backend was constructed
+    tabular_types table_type; ///< The variables of the single-phase table, from the configuration when the backend was constructed
+    bool tables_built; ///< True once the tables have been built
+    bool using_AS; ///< True if the current state was calculated by the wrapped backend
+    bool AS_updated; ///< True if the wrapped backend has been updated to the current state
+    std::size_t cached_i, cached_j; ///< The lower-left node of the cell that contains the current state
+    double cached_x, cached_y; ///< The values of the table variables at the current state
+    double p_critical_table; ///< The critical pressure (the cricondenbar of a mixture), above which there is no saturation curve to cross within a cell
+    double T_critical_table; ///< The critical temperature (the cricondentherm of a mixture), above which there is no saturation curve
+
+    /// Find the cell that contains (x, y); returns false if the state cannot be interpolated from the table
+    bool locate(double x, double y);
+    /** \brief Find the state at which the variable given by key takes the value given, at a given value of one of the variables of the table
+     *
+     * @param key The variable, which is not one of the variables of the table
+     * @param value The value of the variable
+     * @param other The value of y if solve_x is true, otherwise the value of x
+     * @param solve_x True to solve for x, false to solve for y
+     * @param result The value of x (or y) that was found
+     * @returns false if it cannot be found in the table, otherwise the cell of the state has been located
+     */
+    bool invert_single_phase(parameters key, double value, double other, bool solve_x, double &result);
+    /// Set the state from the table for the values of x and y, once the cell has been located
+    void set_state_from_table(void);
+    /// Set the cached value of one of the tabulated variables of the state
+    void set_tabulated_value(parameters key, double value);
+    /// Set a two-phase state from the saturation table, at the pressure (if key is iP) or temperature (if key is iT) given
+    void set_two_phase_state(parameters key, double value, double Q);
+    /** \brief Where the saturation table of a pure fluid puts a state given by two of T, p, rhomolar, hmolar and smolar
+     *
+     * update() and evaluate_batch() both use it, so that they take the same states from the single-phase table.
+     * @returns 1 if the state is two-phase (sat_key, sat_value and Q are then set for set_two_phase_state), -1 if it is too close to
+     * the critical point for the saturation table to tell, and 0 otherwise (also for mixtures)
+     */
+    int saturation_region(parameters key1, double value1, parameters key2, double value2, parameters &sat_key, double &sat_value, double &Q);
+    std::vector<char> saturation_clear; ///< For cell (i, j) at i*(Ny-1) + j, true if saturation_region() is 0 everywhere in the cell
+    /// Find the cells of the single-phase table in which saturation_region() is 0 everywhere, from the saturation table
+    void flag_saturation_cells(void);
+    /// Set a bubble (Q = 0) or dew (Q = 1) point of a mixture from the envelope, at the pressure (if key is iP) or temperature (if key is iT) given
+    void set_envelope_state(parameters key, double value, int Q);
+    /// Update the wrapped backend and take the state from it
+    void update_with_AS(CoolProp::input_pairs input_pair, double Value1, double Value2);
+    /// Make sure that the wrapped backend is at the current state, for the outputs that are not tabulated
+    AbstractState &state_AS(void);
+
+    /// Set the variables, spacing and limits of the table, and the key of the tables
+    void set_table_limits(tabular_types type);
+    /// Build the phase envelope of the mixture with a backend of its own, and take it into mixture_envelope
+    void build_mixture_envelope(void);
+    /// Update AS to the node (or cell center) (x, y) of the single-phase table; returns its phase, or iphase_not_imposed if it could not be calculated
+    phases update_node_state(AbstractState &AS, double x, double y);
+    /// Mark the cells of the single-phase table that can be interpolated
+    void flag_cells(void);
+    struct BuildQueue;
+    struct BuildThread;
+    enum build_stages {BUILD_NODES, ESTIMATE_ERRORS};
+    build_stages build_stage; ///< What the rows of the queue are built for during a build
+    std::vector<char> x_new, y_new; ///< Whether each column and row of nodes has been added by the last refinement (all of them before that)
+    std::vector<double> cell_error; ///< The estimated error in each cell, for cell (i, j) at i*(Ny-1) + j
+    /// Take the rows of the queue with the threads given, or with AS if there are none
+    void run_build(std::vector<BuildThread> &threads, std::size_t Nrows, bool saturation);
+    /// Build the parts of the tables that are left in the queue with the backend given, until there are none left
+    void build_from_queue(AbstractState &AS, BuildQueue &queue);
+    /// Build the nodes of the single-phase table with x = xvec[i] with the backend given, except those that are already there
+    void build_row(AbstractState &AS, std::size_t i);
+    /// Estimate the error in the cells between xvec[i] and xvec[i+1] by comparing their centers with the backend given
+    void estimate_row(AbstractState &AS, std::size_t i);
+    /// Split the columns and rows of the cells whose error is too large, as far as the levels and the number of nodes allow; returns false if none were
+    bool refine_grid(std::vector<int> &xlevel, std::vector<int> &ylevel);
+    /// Build the saturation table with the backend given
+    void build_saturation_table(AbstractState &AS);
+    /// The body of each of the threads of a parallel build
+    static void run_build_thread(BuildThread &thread);
+    /// Load the tables from the cache, or build them and store them in the cache
+    void load_or_build_tables(void);
+    /// Precompute whatever the interpolation needs, once the tables have been built
+    virtual void prepare_tables(void){};
+    /// The value of a tabulated variable at the current state
+    virtual double evaluate_single_phase(parameters key) = 0;
+    /// The derivative of a tabulated variable with respect to x at constant y (if wrt_x) or with respect to y at constant x
+    virtual double evaluate_single_phase_derivative(parameters key, bool wrt_x) = 0;
+
+    /// The points of a block of a batch lookup that can be interpolated, packed into the first n lanes, as structure of arrays
+    /**
+    The lanes from n on repeat the first point, so that the interpolation can run over all the lanes at once.
+    */
+    struct BatchBlock{
+        std::size_t n; ///< The number of points in the block that can be interpolated
+        std::size_t index[BATCH_BLOCK_SIZE]; ///< The position of each of them in the block
+        std::size_t i[BATCH_BLOCK_SIZE], j[BATCH_BLOCK_SIZE]; ///< The lower-left node of the cell of each of them
+        double x[BATCH_BLOCK_SIZE], y[BATCH_BLOCK_SIZE]; ///< The values of the table variables at each of them
+    };
+    /// Interpolate the variables given at the points of a block, which have been located; values[m][k] is variable m at lane k
+    virtual void evaluate_block(const BatchBlock &block, const std::vector<parameters> &keys, double **values) = 0;
+
     public:
     SinglePhaseGriddedTableData single_phase;
-    
+    PureFluidSaturationTableData pure_saturation;
+    MixtureEnvelopeTableData mixture_envelope; ///< The phase envelope, for mixtures only
+    std::string table_type_name; ///< The type of the single-phase table that has been built (LOGDT for mixtures, whatever TABULAR_TABLE_TYPE is)
+
+    GriddedTableBackend(shared_ptr<AbstractState> AS, const std::string &AS_backend_name) : AS(AS), AS_backend_name(AS_backend_name),
+        Nx_config(static_cast<std::size_t>(get_config_double(TABULAR_NX))), Ny_config(static_cast<std::size_t>(get_config_double(TABULAR_NY))),
+        Nthreads_config(static_cast<std::size_t>(get_config_double(TABULAR_BUILD_THREADS))), refinement_tolerance(get_config_double(TABULAR_REFINEMENT_TOLERANCE)),
+        table_type(get_table_type(get_config_string(TABULAR_TABLE_TYPE))), tables_built(false), using_AS(false), AS_updated(false),
+        cached_i(0), cached_j(0), cached_x(_HUGE), cached_y(_HUGE), p_critical_table(_HUGE), T_critical_table(_HUGE), build_stage(BUILD_NODES) {};
+
     bool using_mole_fractions(void){return true;}
     bool using_mass_fractions(void){return false;}
     bool using_volu_fractions(void){return false;}
-    
-    void update(CoolProp::input_pairs input_pair, double Value1, double Value2){};
-    void set_mole_fractions(const std::vector<long double> &mole_fractions){};
-    void set_mass_fractions(const std::vector<long double> &mass_fractions){};
-    
-    void build_tables(tabular_types type);
+
+    void update(CoolProp::input_pairs input_pair, double Value1, double Value2);
+    void set_mole_fractions(const std::vector<CoolPropDbl> &mole_fractions);
+    void set_mass_fractions(const std::vector<CoolPropDbl> &mass_fractions){throw NotImplementedError("Mass fractions are not supported by the tabular backends");};
+    /// True if the current state was calculated by the wrapped backend rather than interpolated in the tables
+    bool using_wrapped_backend(void){ return using_AS; };
+
+    /** \brief Interpolate some of the tabulated variables at a batch of points given by the variables of the table
+     *
+     * The points are taken BATCH_BLOCK_SIZE at a time.  The cells of a whole block are located first, and the values needed at its
+     * points are then gathered into structure-of-arrays form, so that one virtual call serves the block and the interpolation
+     * itself runs in SIMD lanes.  Points that cannot be interpolated (outside the table, next to a hole, inside the phase
+     * envelope of a mixture, or that update() takes from the saturation table or from the wrapped backend near the critical
+     * point) are passed to update() one at a time, and their results are _HUGE if that fails too.  The saturation table is only
+     * looked at for the points in the cells that the saturation curve can reach (see flag_saturation_cells).  The state of
+     * the backend is undefined afterwards.
+     *
+     * @param N The number of points
+     * @param x The values of the x variable of the table (single_phase.xkey) at the points
+     * @param y The values of the y variable of the table (single_phase.ykey) at the points
+     * @param outputs The variables to interpolate, each of them one of the variables of the single-phase table
+     * @param results For each output, an array of N values to fill in
+     * @returns The number of points that were interpolated
+     */
+    std::size_t evaluate_batch(std::size_t N, const double *x, const double *y, const std::vector<parameters> &outputs, const std::vector<double*> &results);
+
+    /** \brief Build the tables
+     *
+     * The rows of the single-phase table and the saturation table are shared out between Nthreads_config threads, each with a
+     * backend of its own made by the factory, and only AS is used if there is one thread.  Every node is found from a flash of its
+     * own, so the tables are the same, bit for bit, whatever the number of threads.
+     *
+     * If refinement_tolerance is greater than zero, the grid is then refined in passes.  In each pass, the state at the center of
+     * every cell is found with the backend and compared with the second-order expansions about the four corners of the cell; the
+     * cells where T or rhomolar (p or hmolar if T or rhomolar are variables of the table) is off by more than the tolerance, or
+     * which are two-phase at the center while their corners are not, have their column and row split in two.  This concentrates
+     * the nodes near the critical point and the saturation curve.  An interval is split at most MAX_REFINEMENT_LEVELS times, and
+     * the worst intervals are split first if the grid would otherwise grow beyond MAX_REFINEMENT_GROWTH times the nodes of the
+     * initial grid in either direction.
+     */
+    void build_tables(void);
+    /// Load the tables with the current key from the cache; throws if they are not there or are out of date
     void load_tables(void);
+    /// Write the tables to the cache
+    void write_tables(void);
+    /// The path of the file in the cache for the tables with the current key
+    std::string path_to_tables(void);
+    /// Build the saturation table with AS, for pure fluids
     void bounding_curves(void);
+
+    CoolPropDbl calc_hmolar(void);
+    CoolPropDbl calc_smolar(void);
+    CoolPropDbl calc_umolar(void);
+    CoolPropDbl calc_gibbsmolar(void){return hmolar() - _T*smolar();};
+    CoolPropDbl calc_cpmolar(void);
+    CoolPropDbl calc_cvmolar(void);
+    CoolPropDbl calc_speed_sound(void);
+    CoolPropDbl calc_first_partial_deriv(parameters Of, parameters Wrt, parameters Constant);
+
+    CoolPropDbl calc_cpmolar_idealgas(void){return state_AS().cp0molar();};
+    CoolPropDbl calc_viscosity(void);
+    CoolPropDbl calc_conductivity(void);
+    CoolPropDbl calc_surface_tension(void){return state_AS().surface_tension();};
+    CoolPropDbl calc_second_partial_deriv(parameters Of1, parameters Wrt1, parameters Constant1, parameters Wrt2, parameters Constant2){return state_AS().second_partial_deriv(Of1, Wrt1, Constant1, Wrt2, Constant2);};
+    CoolPropDbl calc_compressibility_factor(void){return _p/(_rhomolar*gas_constant()*_T);};
+
+    phases calc_phase(void){return _phase;};
+    CoolPropDbl calc_molar_mass(void){return AS->molar_mass();};
+    CoolPropDbl calc_gas_constant(void){return AS->gas_constant();};
+    CoolPropDbl calc_Tmin(void){return AS->Tmin();};
+    CoolPropDbl calc_Tmax(void){return AS->Tmax();};
+    CoolPropDbl calc_pmax(void){return AS->pmax();};
+    CoolPropDbl calc_Ttriple(void){return AS->Ttriple();};
+    CoolPropDbl calc_p_triple(void){return AS->p_triple();};
+    CoolPropDbl calc_T_critical(void){return AS->T_critical();};
+    CoolPropDbl calc_p_critical(void){return AS->p_critical();};
+    CoolPropDbl calc_rhomolar_critical(void){return AS->rhomolar_critical();};
+    CoolPropDbl calc_T_reducing(void){return AS->T_reducing();};
+    CoolPropDbl calc_rhomolar_reducing(void){return AS->rhomolar_reducing();};
+    CoolPropDbl calc_reduced_density(void){return _rhomolar/AS->rhomolar_reducing();};
+    CoolPropDbl calc_reciprocal_reduced_temperature(void){return AS->T_reducing()/_T;};
+    const CoolProp::SimpleState & get_reducing_state(){return AS->get_reducing_state();};
+    std::string calc_name(void){return AS->name();};
+    std::vector<std::string> calc_fluid_names(void){return AS->fluid_names();};
+    CoolPropDbl calc_saturated_liquid_keyed_output(parameters key);
+    CoolPropDbl calc_saturated_vapor_keyed_output(parameters key);
 };
-    
+
+/// The tabular backend that uses a second-order Taylor series expansion about the nearest node of the table
+/**
+The value of a variable \f$z\f$ at \f$(x, y)\f$ is given by
+\f[ z = z_{ij} + \Delta x\left(\frac{\partial z}{\partial x}\right)_y + \Delta y\left(\frac{\partial z}{\partial y}\right)_x + \frac{\Delta x^2}{2}\left(\frac{\partial^2 z}{\partial x^2}\right)_y + \Delta x\Delta y\frac{\partial^2 z}{\partial x\partial y} + \frac{\Delta y^2}{2}\left(\frac{\partial^2 z}{\partial y^2}\right)_x \f]
+where the derivatives are taken at the node \f$(x_i, y_j)\f$ nearest to \f$(x, y)\f$ and \f$\Delta x = x - x_i\f$, \f$\Delta y = y - y_j\f$
+*/
 class TTSEBackend : public GriddedTableBackend
 {
+protected:
+    double evaluate_single_phase(parameters key);
+    double evaluate_single_phase_derivative(parameters key, bool wrt_x);
+    void evaluate_block(const BatchBlock &block, const std::vector<parameters> &keys, double **values);
+    /// Get the nearest node to the current state, and the distances to it
+    void nearest_node(std::size_t &i, std::size_t &j, double &dx, double &dy);
+public:
+    TTSEBackend(shared_ptr<AbstractState> AS, const std::string &AS_backend_name) : GriddedTableBackend(AS, AS_backend_name) {};
+};
+
+/// The tabular backend that uses bicubic interpolation in the cell that contains the state
+/**
+The coefficients are fitted to the values and the first and cross derivatives at the four corners of each cell, so
+the interpolated values and their first derivatives are continuous from one cell to the next.
+*/
+class BicubicBackend : public GriddedTableBackend
+{
+protected:
+    /// The coefficients of the bicubic polynomials in each cell
+    /**
+    In the cell whose lower-left node is \f$(x_i, y_j)\f$, a variable is given by \f$ z = \sum_{m=0}^3\sum_{n=0}^3 a_{m+4n}\xi^m\eta^n \f$
+    with \f$\xi = (x-x_i)/(x_{i+1}-x_i)\f$ and \f$\eta = (y-y_j)/(y_{j+1}-y_j)\f$.  The cells are stored row by row (cell (i, j) is
+    block i*(Ny-1) + j), each with the 16 coefficients of each of the N_TABLE_VARIABLES variables in turn, so the coefficients of one
+    variable fill two cache lines.  The coefficients of cells that cannot be interpolated are left at _HUGE.
+    */
+    AlignedArray coeffs;
+
+    void prepare_tables(void);
+    double evaluate_single_phase(parameters key);
+    double evaluate_single_phase_derivative(parameters key, bool wrt_x);
+    void evaluate_block(const BatchBlock &block, const std::vector<parameters> &keys, double **values);
+    /// The coefficients of one of the variables in the current cell
+    const double *get_coeffs(parameters key){
+        return coeffs.data() + (cached_i*(single_phase.Ny-1) + cached_j)*N_TABLE_VARIABLES*16 + 16*SinglePhaseGriddedTableData::index(key);
+    };
 public:
-    TTSEBackend(AbstractState &AS){
-        this->AS = &AS; build_tables(GriddedTableBackend::LOGPH_TABLE);};
+    BicubicBackend(shared_ptr<AbstractState> AS, const std::string &AS_backend_name) : GriddedTableBackend(AS, AS_backend_name) {};
 };
 
+#if defined(ENABLE_CATCH)
+/// The configuration of the tables for the duration of a test
+/**
+Sets the size of the grid and points ALTERNATIVE_TABLES_DIRECTORY to a new temporary directory, so that the tables of the test
+are neither taken from nor left in the cache of the user.  The directory and the tables in it are removed and the configuration
+of the tables is restored when the object is destroyed, also when a check of the test throws.  Declare it before the backends
+of the test, so that their tables are closed before the directory is removed.
+*/
+class TablesTestConfiguration
+{
+private:
+    double Nx0, Ny0, Nthreads0, tolerance0;
+    std::string type0, directory0, directory;
+    TablesTestConfiguration(const TablesTestConfiguration &);
+    TablesTestConfiguration &operator=(const TablesTestConfiguration &);
+public:
+    /// Sets TABULAR_NX and TABULAR_NY to N
+    TablesTestConfiguration(double N);
+    ~TablesTestConfiguration();
+    /// The temporary directory that holds the tables
+    const std::string &tables_directory(void){ return directory; };
+};
+#endif
+
 } /* namespace CoolProp*/
 
 #endif
@@ -0,0 +1,407 @@
+
+#include "TabularValidation.h"
+#include "TabularBackends.h"
+#include "AbstractState.h"
+#include "DataStructures.h"
+#include "Configuration.h"
+#include "crossplatform_shared_ptr.h"
+#include "crossplatform_mutex.h"
+#include "rapidjson/rapidjson_include.h"
+#include <cstring>
+#include <time.h>
+
+#if defined(ENABLE_CATCH)
+#include "catch.hpp"
+#endif
+
+namespace CoolProp{
+
+/// The outputs that are checked; the first N_STATE_OUTPUTS of them are also checked in the two-phase region
+static const parameters checked_outputs[] = {iT, iP, iDmolar, iHmolar, iSmolar, iCpmolar, iCvmolar, ispeed_sound, iviscosity, iconductivity};
+static const std::size_t N_CHECKED_OUTPUTS = sizeof(checked_outputs)/sizeof(checked_outputs[0]);
+static const std::size_t N_STATE_OUTPUTS = 5;
+
+/// The input pairs with which the tabular backend is updated at each point
+static const input_pairs checked_inputs[] = {PT_INPUTS, DmolarT_INPUTS, HmolarP_INPUTS, PSmolar_INPUTS};
+static const std::size_t N_CHECKED_INPUTS = sizeof(checked_inputs)/sizeof(checked_inputs[0]);
+
+/// The shortest time over which the updates are timed, in s
+static const double MIN_TIMING_INTERVAL = 0.05;
+
+/// The relative offset in pressure from the saturation curve of the points of the saturation set
+static const double SATURATION_OFFSET = 1e-3;
+
+/// A state found with the wrapped backend, and the values of the checked outputs there
+struct ReferencePoint{
+    double T, p, rhomolar, hmolar, smolar;
+    bool twophase;
+    double outputs[N_CHECKED_OUTPUTS];
+    bool known[N_CHECKED_OUTPUTS];
+};
+
+/// The errors in one output over a set of points
+struct ErrorStatistics{
+    std::size_t N, failures;
+    double max, sum_squares, T_at_max, p_at_max;
+    ErrorStatistics() : N(0), failures(0), max(0), sum_squares(0), T_at_max(_HUGE), p_at_max(_HUGE) {};
+    void add(double error, const ReferencePoint &pt){
+        N++;
+        sum_squares += error*error;
+        if (error >= max){ max = error; T_at_max = pt.T; p_at_max = pt.p; }
+    };
+};
+
+/// A number uniformly distributed in [0, 1), from a linear congruential generator, so that the points are the same on every platform
+static double uniform_random(unsigned int &state)
+{
+    state = 1664525u*state + 1013904223u;
+    return (state >> 8)/16777216.0;
+}
+
+/// The value at a fraction f of the way from min to max, evenly in the logarithm if log is true
+static double interpolate_limits(double min, double max, bool log_spaced, double f)
+{
+    if (log_spaced){ return exp(log(min) + f*(log(max) - log(min))); }
+    return min + f*(max - min);
+}
+
+/// Update the wrapped backend and store the state and its outputs; returns false if the state cannot be calculated
+static bool add_reference_point(AbstractState &ref, input_pairs input_pair, double Value1, double Value2, std::vector<ReferencePoint> &points)
+{
+    ReferencePoint pt;
+    try{
+        ref.update(input_pair, Value1, Value2);
+        pt.T = ref.T(); pt.p = ref.p(); pt.rhomolar = ref.rhomolar(); pt.hmolar = ref.hmolar(); pt.smolar = ref.smolar();
+    }
+    catch(std::exception &){
+        return false;
+    }
+    if (!ValidNumber(pt.T) || !ValidNumber(pt.p) || !ValidNumber(pt.rhomolar) || !ValidNumber(pt.hmolar) || !ValidNumber(pt.smolar)){ return false; }
+    pt.twophase = (ref.phase() == iphase_twophase);
+    for (std::size_t k = 0; k < N_CHECKED_OUTPUTS; ++k){
+        pt.known[k] = false;
+        if (pt.twophase && k >= N_STATE_OUTPUTS){ continue; }
+        try{
+            pt.outputs[k] = ref.keyed_output(checked_outputs[k]);
+            pt.known[k] = ValidNumber(pt.outputs[k]);
+        }
+        catch(std::exception &){}
+    }
+    points.push_back(pt);
+    return true;
+}
+
+/// The values of the input pair given at a reference point; returns false if the pair does not fix the state there
+static bool inputs_at_point(const ReferencePoint &pt, input_pairs input_pair, double &Value1, double &Value2)
+{
+    switch(input_pair){
+        case PT_INPUTS: Value1 = pt.p; Value2 = pt.T; return !pt.twophase;
+        case DmolarT_INPUTS: Value1 = pt.rhomolar; Value2 = pt.T; return true;
+        case HmolarP_INPUTS: Value1 = pt.hmolar; Value2 = pt.p; return true;
+        case PSmolar_INPUTS: Value1 = pt.p; Value2 = pt.smolar; return true;
+        default: return false;
+    }
+}
+
+/// The time of an update with each of the inputs in turn, in ns per call, repeated for at least MIN_TIMING_INTERVAL
+static double time_updates(AbstractState &AS, input_pairs input_pair, const std::vector<double> &Value1, const std::vector<double> &Value2)
+{
+    if (Value1.empty()){ return _HUGE; }
+    std::size_t N = 0;
+    clock_t t1 = clock(), t2;
+    do{
+        for (std::size_t m = 0; m < Value1.size(); ++m){
+            try{ AS.update(input_pair, Value1[m], Value2[m]); } catch(std::exception &){}
+        }
+        N += Value1.size();
+        t2 = clock();
+    } while (static_cast<double>(t2 - t1)/CLOCKS_PER_SEC < MIN_TIMING_INTERVAL);
+    return static_cast<double>(t2 - t1)/CLOCKS_PER_SEC/N*1e9;
+}
+
+/// Add a member to a JSON object whose value is a copy of the string given
+static void add_string_member(rapidjson::Value &object, const char *name, const std::string &value, rapidjson::Document::AllocatorType &allocator)
+{
+    rapidjson::Value v(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), allocator);
+    object.AddMember(name, v, allocator);
+}
+
+/// Check the tabular backend at the points of one set with one input pair, and add the results to the array of cases of the report
+static void check_case(const std::string &set_name, const std::vector<ReferencePoint> &points, input_pairs input_pair,
+                       GriddedTableBackend &table, AbstractState &ref, rapidjson::Value &cases, rapidjson::Document::AllocatorType &allocator)
+{
+    // Molar enthalpy and entropy pass through zero at the reference state, so their errors are relative to R*T_reducing and R there
+    double R = ref.gas_constant(), floor[N_CHECKED_OUTPUTS];
+    for (std::size_t k = 0; k < N_CHECKED_OUTPUTS; ++k){ floor[k] = 0; }
+    floor[3] = R*ref.T_reducing();
+    floor[4] = R;
+
+    std::vector<double> Value1, Value2;
+    std::vector<ErrorStatistics> errors(N_CHECKED_OUTPUTS);
+    std::size_t Ninterpolated = 0, update_failures = 0;
+    for (std::size_t m = 0; m < points.size(); ++m){
+        const ReferencePoint &pt = points[m];
+        double v1, v2;
+        if (!inputs_at_point(pt, input_pair, v1, v2)){ continue; }
+        Value1.push_back(v1);
+        Value2.push_back(v2);
+        try{
+            table.update(input_pair, v1, v2);
+        }
+        catch(std::exception &){
+            update_failures++;
+            continue;
+        }
+        if (!table.using_wrapped_backend()){ Ninterpolated++; }
+        for (std::size_t k = 0; k < N_CHECKED_OUTPUTS; ++k){
+            if (!pt.known[k]){ continue; }
+            try{
+                double value = table.keyed_output(checked_outputs[k]);
+                if (!ValidNumber(value)){ errors[k].failures++; continue; }
+                errors[k].add(std::abs(value - pt.outputs[k])/std::max(std::abs(pt.outputs[k]), floor[k]), pt);
+            }
+            catch(std::exception &){
+                errors[k].failures++;
+            }
+        }
+    }
+
+    rapidjson::Value result(rapidjson::kObjectType);
+    add_string_member(result, "points", set_name, allocator);
+    add_string_member(result, "inputs", get_input_pair_short_desc(input_pair), allocator);
+    result.AddMember("N", static_cast<int>(Value1.size()), allocator);
+    result.AddMember("update_failures", static_cast<int>(update_failures), allocator);
+    result.AddMember("interpolated_fraction", Value1.empty() ? 0.0 : static_cast<double>(Ninterpolated)/Value1.size(), allocator);
+
+    rapidjson::Value timing(rapidjson::kObjectType);
+    timing.AddMember("table", time_updates(table, input_pair, Value1, Value2), allocator);
+    timing.AddMember("reference", time_updates(ref, input_pair, Value1, Value2), allocator);
+    result.AddMember("ns_per_update", timing, allocator);
+
+    rapidjson::Value outputs(rapidjson::kObjectType);
+    for (std::size_t k = 0; k < N_CHECKED_OUTPUTS; ++k){
+        const ErrorStatistics &e = errors[k];
+        rapidjson::Value stats(rapidjson::kObjectType);
+        stats.AddMember("N", static_cast<int>(e.N), allocator);
+        stats.AddMember("failures", static_cast<int>(e.failures), allocator);
+        if (e.N > 0){
+            stats.AddMember("max", e.max, allocator);
+            stats.AddMember("rms", sqrt(e.sum_squares/e.N), allocator);
+            stats.AddMember("T_at_max", e.T_at_max, allocator);
+            stats.AddMember("p_at_max", e.p_at_max, allocator);
+        }
+        std::string name = get_parameter_information(checked_outputs[k], "short");
+        outputs.AddMember(name.c_str(), allocator, stats, allocator);
+    }
+    result.AddMember("errors", outputs, allocator);
+    cases.PushBack(result, allocator);
+}
+
+std::string validate_tables(const std::string &backend, const std::string &fluid, const TablesValidationPoints &points)
+{
+    std::size_t iamp = backend.find('&');
+    if (iamp == std::string::npos){
+        throw ValueError(format("The backend [%s] is not a tabular backend; it should be of the form TTSE&HEOS", backend.c_str()));
+    }
+    shared_ptr<AbstractState> tabular(AbstractState::factory(backend, fluid));
+    shared_ptr<AbstractState> ref(AbstractState::factory(backend.substr(iamp + 1), fluid));
+    GriddedTableBackend *table = dynamic_cast<GriddedTableBackend*>(tabular.get());
+    if (table == NULL){
+        throw ValueError(format("The backend [%s] is not a tabular backend", backend.c_str()));
+    }
+
+    // The tables are loaded or built on the first update, whether or not the state can then be found
+    clock_t t1 = clock();
+    try{ table->update(PT_INPUTS, 101325, ref->Tmax()); } catch(std::exception &){}
+    double load_time = static_cast<double>(clock() - t1)/CLOCKS_PER_SEC;
+    SinglePhaseGriddedTableData &sp = table->single_phase;
+    if (sp.xvec.empty()){
+        throw ValueError(format("The tables of [%s] for [%s] could not be built", backend.c_str(), fluid.c_str()));
+    }
+
+    // Random points over the whole table, and points on an even lattice between its limits
+    std::vector<ReferencePoint> random_points, lattice_points, saturation_points;
+    unsigned int state = points.seed;
+    for (std::size_t m = 0; m < points.Nrandom; ++m){
+        double x = interpolate_limits(sp.xmin, sp.xmax, sp.logx, uniform_random(state));
+        double y = interpolate_limits(sp.ymin, sp.ymax, sp.logy, uniform_random(state));
+        double Value1, Value2;
+        input_pairs input_pair = generate_update_pair(sp.xkey, x, sp.ykey, y, Value1, Value2);
+        add_reference_point(*ref, input_pair, Value1, Value2, random_points);
+    }
+    std::size_t Nside = static_cast<std::size_t>(sqrt(static_cast<double>(points.Nlattice)));
+    for (std::size_t i = 0; i < Nside; ++i){
+        for (std::size_t j = 0; j < Nside; ++j){
+            double x = interpolate_limits(sp.xmin, sp.xmax, sp.logx, (i + 0.5)/Nside);
+            double y = interpolate_limits(sp.ymin, sp.ymax, sp.logy, (j + 0.5)/Nside);
+            double Value1, Value2;
+            input_pairs input_pair = generate_update_pair(sp.xkey, x, sp.ykey, y, Value1, Value2);
+            add_reference_point(*ref, input_pair, Value1, Value2, lattice_points);
+        }
+    }
+    // Compressed liquid and superheated vapor just off the saturation curve, over the temperatures of the saturation table
+    PureFluidSaturationTableData &sat = table->pure_saturation;
+    std::size_t Nsat = points.Nsaturation/2;
+    if (sat.N > 1){
+        for (std::size_t m = 0; m < Nsat; ++m){
+            double T = sat.T[0] + (sat.T[sat.N-1] - sat.T[0])*(m + 0.5)/Nsat;
+            try{ ref->update(QT_INPUTS, 0, T); } catch(std::exception &){ continue; }
+            double psat = ref->p();
+            add_reference_point(*ref, PT_INPUTS, psat*(1 + SATURATION_OFFSET), T, saturation_points);
+            add_reference_point(*ref, PT_INPUTS, psat*(1 - SATURATION_OFFSET), T, saturation_points);
+        }
+    }
+
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = doc.GetAllocator();
+    add_string_member(doc, "backend", backend, allocator);
+    add_string_member(doc, "fluid", fluid, allocator);
+    add_string_member(doc, "table_type", table->table_type_name, allocator);
+    add_string_member(doc, "x", get_parameter_information(sp.xkey, "short"), allocator);
+    add_string_member(doc, "y", get_parameter_information(sp.ykey, "short"), allocator);
+    doc.AddMember("xmin", sp.xmin, allocator);
+    doc.AddMember("xmax", sp.xmax, allocator);
+    doc.AddMember("ymin", sp.ymin, allocator);
+    doc.AddMember("ymax", sp.ymax, allocator);
+    doc.AddMember("Nx", static_cast<int>(sp.Nx), allocator);
+    doc.AddMember("Ny", static_cast<int>(sp.Ny), allocator);
+    doc.AddMember("refinement_tolerance", get_config_double(TABULAR_REFINEMENT_TOLERANCE), allocator);
+    doc.AddMember("load_or_build_time", load_time, allocator);
+
+    rapidjson::Value cases(rapidjson::kArrayType);
+    for (std::size_t n = 0; n < N_CHECKED_INPUTS; ++n){
+        check_case("random", random_points, checked_inputs[n], *table, *ref, cases, allocator);
+        check_case("lattice", lattice_points, checked_inputs[n], *table, *ref, cases, allocator);
+        if (!saturation_points.empty()){
+            check_case("saturation", saturation_points, checked_inputs[n], *table, *ref, cases, allocator);
+        }
+    }
+    doc.AddMember("cases", cases, allocator);
+    return cpjson::json2string(doc);
+}
+
+/// True if the tables of the two backends are the same, bit for bit
+static bool same_tables(GriddedTableBackend &a, GriddedTableBackend &b)
+{
+    SinglePhaseGriddedTableData &s = a.single_phase, &t = b.single_phase;
+    if (s.xvec != t.xvec || s.yvec != t.yvec || s.nodes.size() != t.nodes.size()){ return false; }
+    if (memcmp(s.nodes.data(), t.nodes.data(), s.nodes.size()*sizeof(double)) != 0){ return false; }
+    PureFluidSaturationTableData &u = a.pure_saturation, &v = b.pure_saturation;
+    return u.T == v.T && u.p == v.p && u.rhomolarL == v.rhomolarL && u.rhomolarV == v.rhomolarV
+        && u.hmolarL == v.hmolarL && u.hmolarV == v.hmolarV && u.smolarL == v.smolarL && u.smolarV == v.smolarV;
+}
+
+std::string report_build_scaling(const std::string &backend, const std::string &fluid, const std::vector<int> &Nthreads)
+{
+    if (Nthreads.empty()){ throw ValueError("No numbers of threads were given"); }
+    double Nthreads0 = get_config_double(TABULAR_BUILD_THREADS);
+
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = doc.GetAllocator();
+    add_string_member(doc, "backend", backend, allocator);
+    add_string_member(doc, "fluid", fluid, allocator);
+    doc.AddMember("processors", get_number_of_processors(), allocator);
+
+    rapidjson::Value builds(rapidjson::kArrayType);
+    shared_ptr<AbstractState> first;
+    double first_time = _HUGE;
+    try{
+        for (std::size_t k = 0; k < Nthreads.size(); ++k){
+            // The number of threads is read when the backend is constructed
+            set_config_double(TABULAR_BUILD_THREADS, Nthreads[k]);
+            shared_ptr<AbstractState> tabular(AbstractState::factory(backend, fluid));
+            GriddedTableBackend *table = dynamic_cast<GriddedTableBackend*>(tabular.get());
+            if (table == NULL){
+                throw ValueError(format("The backend [%s] is not a tabular backend", backend.c_str()));
+            }
+            double t1 = get_wall_time();
+            table->build_tables();
+            double wall_time = get_wall_time() - t1;
+            if (k == 0){
+                first = tabular;
+                first_time = wall_time;
+                add_string_member(doc, "table_type", table->table_type_name, allocator);
+                doc.AddMember("Nx", static_cast<int>(table->single_phase.Nx), allocator);
+                doc.AddMember("Ny", static_cast<int>(table->single_phase.Ny), allocator);
+            }
+
+            rapidjson::Value build(rapidjson::kObjectType);
+            build.AddMember("threads", Nthreads[k], allocator);
+            build.AddMember("wall_time", wall_time, allocator);
+            build.AddMember("speedup", first_time/wall_time, allocator);
+            build.AddMember("identical", same_tables(*table, static_cast<GriddedTableBackend&>(*first)), allocator);
+            builds.PushBack(build, allocator);
+        }
+    }
+    catch(...){
+        set_config_double(TABULAR_BUILD_THREADS, Nthreads0);
+        throw;
+    }
+    set_config_double(TABULAR_BUILD_THREADS, Nthreads0);
+    doc.AddMember("builds", builds, allocator);
+    return cpjson::json2string(doc);
+}
+
+} /* namespace CoolProp */
+
+#if defined(ENABLE_CATCH)
+
+TEST_CASE("Validation report of the tabular backends", "[TTSE],[tables_validation]")
+{
+    CoolProp::TablesTestConfiguration configuration(100);
+    CoolProp::TablesValidationPoints points;
+    points.Nrandom = 100;
+    points.Nlattice = 25;
+    points.Nsaturation = 10;
+    std::string report = CoolProp::validate_tables("TTSE&HEOS", "R134a", points);
+
+    rapidjson::Document doc;
+    doc.Parse<0>(report.c_str());
+    REQUIRE(!doc.HasParseError());
+    CHECK(cpjson::get_string(doc, "fluid") == "R134a");
+    CHECK(cpjson::get_integer(doc, "Nx") == 100);
+    rapidjson::Value &cases = doc["cases"];
+    // Random, lattice and saturation points for each of the four input pairs
+    REQUIRE(cases.Size() == 12);
+    for (rapidjson::SizeType n = 0; n < cases.Size(); ++n){
+        rapidjson::Value &c = cases[n];
+        std::string inputs = cpjson::get_string(c, "points") + " " + cpjson::get_string(c, "inputs");
+        CAPTURE(inputs);
+        CHECK(cpjson::get_integer(c, "N") > 0);
+        CHECK(cpjson::get_integer(c, "update_failures") == 0);
+        CHECK(cpjson::get_double(c["ns_per_update"], "table") > 0);
+        CHECK(cpjson::get_double(c["ns_per_update"], "reference") > 0);
+        if (inputs == "random HmolarP_INPUTS"){
+            CHECK(cpjson::get_double(c, "interpolated_fraction") > 0.9);
+            CHECK(cpjson::get_double(c["errors"]["T"], "max") < 1e-3);
+            CHECK(cpjson::get_double(c["errors"]["Hmolar"], "max") < 1e-10);
+        }
+    }
+}
+
+TEST_CASE("Report of the wall time of table builds with several threads", "[TTSE],[tables_validation]")
+{
+    CoolProp::TablesTestConfiguration configuration(30);
+    CoolProp::set_config_double(TABULAR_BUILD_THREADS, 3);
+    std::vector<int> Nthreads;
+    Nthreads.push_back(1); Nthreads.push_back(2);
+    std::string report = CoolProp::report_build_scaling("TTSE&HEOS", "R134a", Nthreads);
+
+    rapidjson::Document doc;
+    doc.Parse<0>(report.c_str());
+    REQUIRE(!doc.HasParseError());
+    CHECK(cpjson::get_integer(doc, "processors") >= 1);
+    rapidjson::Value &builds = doc["builds"];
+    REQUIRE(builds.Size() == 2);
+    for (rapidjson::SizeType n = 0; n < builds.Size(); ++n){
+        CHECK(cpjson::get_integer(builds[n], "threads") == Nthreads[n]);
+        CHECK(cpjson::get_double(builds[n], "wall_time") > 0);
+        CHECK(builds[n]["identical"].GetBool());
+    }
+    // The configuration is restored
+    CHECK(CoolProp::get_config_double(TABULAR_BUILD_THREADS) == 3);
+}
+
+#endif
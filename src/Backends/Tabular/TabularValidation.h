@@ -0,0 +1,54 @@
+#ifndef TABULAR_VALIDATION_H
+#define TABULAR_VALIDATION_H
+
+#include <string>
+#include <vector>
+
+namespace CoolProp{
+
+/// The sets of points at which the tables are checked, and how many of each
+struct TablesValidationPoints{
+    std::size_t Nrandom; ///< Points drawn at random in the table variables, over the whole table
+    std::size_t Nlattice; ///< Points on an even lattice in the table variables, offset by half a step so that they fall between the lines of a uniform grid of the same size
+    std::size_t Nsaturation; ///< Points just off the saturation curve, half on the liquid side and half on the vapor side (pure fluids only)
+    unsigned int seed; ///< The seed of the random points, so that a report can be reproduced
+
+    TablesValidationPoints() : Nrandom(2000), Nlattice(900), Nsaturation(200), seed(1) {};
+};
+
+/** \brief Check a tabular backend against the backend that it wraps, and report the errors and the speed of both as JSON
+ *
+ * The tables are those that the factory gives for the backend and fluid, so the table type and grid are set by the configuration
+ * (TABULAR_TABLE_TYPE, TABULAR_NX, TABULAR_NY, ...) as usual.  At every point of each set, the reference state is found with the
+ * wrapped backend, and the tabular backend is then updated with each of the PT, DmolarT, HmolarP and PSmolar input pairs in turn.
+ * For each set and input pair, the report gives:
+ *  - the number of points, and the fraction of them that were interpolated rather than passed on to the wrapped backend
+ *  - the maximum and the RMS relative error of T, p, rhomolar, hmolar, smolar, cpmolar, cvmolar, speed_sound, viscosity and
+ *    conductivity (the last five in the single-phase region only), with the state at which the maximum occurred
+ *  - the time of an update, in ns per call, for the tabular backend and for the wrapped backend
+ *
+ * @param backend The name of the tabular backend, for instance "TTSE&HEOS"
+ * @param fluid The fluid string
+ * @param points The sets of points
+ * @returns The report, as a JSON string
+ */
+std::string validate_tables(const std::string &backend, const std::string &fluid, const TablesValidationPoints &points);
+
+/** \brief Build the tables of a tabular backend with each of the numbers of threads given, and report the wall time of each build as JSON
+ *
+ * The tables are built afresh with build_tables() (the cache is neither read nor written), with TABULAR_BUILD_THREADS set to each
+ * number of threads in turn; the configuration is restored afterwards.  For each number of threads, the report gives the wall time
+ * of the build, the speedup over the build with the first number of threads, and whether its tables are identical to those of that
+ * build.  Nothing is checked: the speedup depends on the machine, and cannot grow beyond the number of processors, which is
+ * reported too.
+ *
+ * @param backend The name of the tabular backend, for instance "TTSE&HEOS"
+ * @param fluid The fluid string
+ * @param Nthreads The numbers of threads, for instance 1, 2, 4 and 8
+ * @returns The report, as a JSON string
+ */
+std::string report_build_scaling(const std::string &backend, const std::string &fluid, const std::vector<int> &Nthreads);
+
+} /* namespace CoolProp */
+
+#endif
@@ -24,7 +24,9 @@
 #include <exception>
 #include <stdio.h>
 #include <string>
+#include <list>
 #include "CoolPropTools.h"
+#include "crossplatform_mutex.h"
 #include "Solvers.h"
 #include "MatrixMath.h"
 #include "Backends/Helmholtz/Fluids/FluidLibrary.h"
@@ -41,22 +43,23 @@
 namespace CoolProp
 {
 
-static int debug_level = 0;
-static std::string error_string;
-static std::string warning_string;
+static AtomicInt debug_level(0); // Read by every thread that prints debugging output
+// Each thread has its own error and warning strings so that concurrent calls do not clobber each other's messages
+static ThreadLocal<std::string> error_string;
+static ThreadLocal<std::string> warning_string;
 
-void set_debug_level(int level){debug_level = level;}
-int get_debug_level(void){return debug_level;}
+void set_debug_level(int level){debug_level.store(level);}
+int get_debug_level(void){return debug_level.load();}
 
 //// This is very hacky, but pull the git revision from the file
 #include "gitrevision.h" // Contents are like "std::string gitrevision = "aa121435436ggregrea4t43t433";"
 #include "cpversion.h" // Contents are like "char version [] = "2.5";"
 
 void set_warning_string(std::string warning){
-    warning_string = warning;
+    warning_string.get() = warning;
 }
 void set_error_string(std::string error){
-    error_string = error;
+    error_string.get() = error;
 }
 
 // Return true if the string has "BACKEND::*" format where * signifies a wildcard
@@ -175,26 +178,241 @@ std::string extract_fractions(const std::string &fluid_string, std::vector<doubl
     }
 }
 
-// Internal function to do the actual calculations, make this a wrapped function so
-// that error bubbling can be done properly
-double _PropsSI(const std::string &Output, const std::string &Name1, double Prop1, const std::string &Name2, double Prop2, const std::string &backend, const std::string &Ref, const std::vector<double> &z)
+/** \brief A bounded pool of ready-to-use AbstractState instances
+ *
+ * Constructing a state (loading the fluid, building SatL/SatV, setting the mixture parameters)
+ * is much more expensive than a flash call, so the high-level functions borrow a state from this pool
+ * rather than calling AbstractState::factory every time.
+ *
+ * An instance is removed from the pool while it is in use, so two threads never share the same
+ * instance; when the work is done it is given back and becomes the most recently used entry.
+ * When more than \a capacity idle instances are held, the least recently used ones are dropped.
+ *
+ * Each flush starts a new generation of the pool; an instance that was borrowed before a flush (and might hold a fluid
+ * whose reference state has since been changed) is dropped when it is given back instead of returning to the pool.
+ */
+class AbstractStateCache
 {
-    parameters iOutput = iundefined_parameter;
-    parameters iOf = iundefined_parameter, iWrt = iundefined_parameter, iConstant = iundefined_parameter, 
-               iOf1 = iundefined_parameter, iWrt1 = iundefined_parameter, iConstant1 = iundefined_parameter, 
-               iWrt2 = iundefined_parameter, iConstant2 = iundefined_parameter;
-    double x1, x2;
-    
-    if (get_debug_level()>5){
-        std::cout << format("%s:%d: _PropsSI(%s,%s,%g,%s,%g,%s,%s)\n",__FILE__,__LINE__,Output.c_str(),Name1.c_str(),Prop1,Name2.c_str(),Prop2,backend.c_str(),Ref.c_str(), vec_to_string(z).c_str()).c_str();
+private:
+    typedef std::list<std::pair<std::string, shared_ptr<AbstractState> > > pool_type;
+    pool_type pool; ///< Idle instances, most recently used first
+    std::size_t capacity;
+    unsigned long _hits, _misses;
+    unsigned long generation; ///< The number of flushes so far
+    Mutex mutex;
+public:
+    AbstractStateCache() : capacity(32), _hits(0), _misses(0), generation(0){};
+
+    /// Build the key of the cache for a given backend, fluid string and composition
+    static std::string key(const std::string &backend, const std::string &fluid_string, const std::vector<double> &fractions){
+        std::string k = backend + "::" + fluid_string + "|";
+        for (std::size_t i = 0; i < fractions.size(); ++i){
+            k += format("%0.17g,", fractions[i]);
+        }
+        return k;
+    }
+    /// Take an instance out of the pool, or construct a new one if none is available; gen is set to the generation of the pool,
+    /// which is to be passed to give_back
+    shared_ptr<AbstractState> take(const std::string &k, const std::string &backend, const std::string &fluid_string, unsigned long &gen){
+        {
+            ScopedLock lock(mutex);
+            gen = generation;
+            for (pool_type::iterator it = pool.begin(); it != pool.end(); ++it){
+                if (it->first == k){
+                    shared_ptr<AbstractState> AS = it->second;
+                    pool.erase(it);
+                    _hits++;
+                    return AS;
+                }
+            }
+            _misses++;
+        }
+        // Construction is done outside of the lock so that other threads are not held up
+        return shared_ptr<AbstractState>(AbstractState::factory(backend, fluid_string));
+    }
+    /// Whether an idle instance with this key is in the pool; the statistics and the order of the pool are left as they are
+    bool contains(const std::string &k){
+        ScopedLock lock(mutex);
+        for (pool_type::iterator it = pool.begin(); it != pool.end(); ++it){
+            if (it->first == k){ return true; }
+        }
+        return false;
+    }
+    /// Give an instance back to the pool, unless the pool was flushed after the instance was taken
+    void give_back(const std::string &k, const shared_ptr<AbstractState> &AS, unsigned long gen){
+        ScopedLock lock(mutex);
+        if (capacity == 0 || gen != generation){ return; }
+        pool.push_front(std::pair<std::string, shared_ptr<AbstractState> >(k, AS));
+        while (pool.size() > capacity){ pool.pop_back(); }
+    }
+    void set_capacity(std::size_t N){
+        ScopedLock lock(mutex);
+        capacity = N;
+        while (pool.size() > capacity){ pool.pop_back(); }
     }
+    std::size_t get_capacity(){ ScopedLock lock(mutex); return capacity; }
+    void flush(){ ScopedLock lock(mutex); pool.clear(); generation++; }
+    void stats(unsigned long &hits, unsigned long &misses, std::size_t &size){
+        ScopedLock lock(mutex);
+        hits = _hits; misses = _misses; size = pool.size();
+    }
+    void reset_stats(){ ScopedLock lock(mutex); _hits = 0; _misses = 0; }
+};
+static AbstractStateCache state_cache;
 
-    // The state we are going to use
-    shared_ptr<AbstractState> State;
-    
-    // If the fractions of the components have been encoded in the string, extract them
-    // If they have not, this function does nothing
-    std::vector<double> fractions;
+/// Borrow an AbstractState from the cache for the lifetime of this object
+class CachedAbstractState
+{
+private:
+    std::string k;
+    shared_ptr<AbstractState> AS;
+    unsigned long generation;
+    CachedAbstractState(const CachedAbstractState &);
+    CachedAbstractState &operator=(const CachedAbstractState &);
+public:
+    CachedAbstractState(const std::string &backend, const std::string &fluid_string, const std::vector<double> &fractions){
+        k = AbstractStateCache::key(backend, fluid_string, fractions);
+        AS = state_cache.take(k, backend, fluid_string, generation);
+    };
+    ~CachedAbstractState(){ state_cache.give_back(k, AS, generation); };
+    AbstractState *operator->(){ return AS.get(); };
+    AbstractState &operator*(){ return *AS; };
+};
+
+void set_state_cache_size(std::size_t N){ state_cache.set_capacity(N); }
+std::size_t get_state_cache_size(){ return state_cache.get_capacity(); }
+void flush_state_cache(){ state_cache.flush(); state_cache.reset_stats(); }
+void get_state_cache_stats(unsigned long &hits, unsigned long &misses, std::size_t &size){ state_cache.stats(hits, misses, size); }
+
+#if defined(ENABLE_CATCH)
+TEST_CASE("Reuse of AbstractState instances by PropsSI", "[state_cache]")
+{
+    std::size_t N0 = get_state_cache_size();
+    unsigned long hits, misses;
+    std::size_t size;
+    SECTION("cached and uncached values are identical"){
+        set_state_cache_size(0);
+        flush_state_cache();
+        double uncached = PropsSI("Hmolar", "T", 300, "P", 1e5, "Nitrogen&Argon", std::vector<double>(2, 0.5));
+        get_state_cache_stats(hits, misses, size);
+        CHECK(size == 0);
+        set_state_cache_size(N0);
+        double first = PropsSI("Hmolar", "T", 300, "P", 1e5, "Nitrogen&Argon", std::vector<double>(2, 0.5));
+        double second = PropsSI("Hmolar", "T", 300, "P", 1e5, "Nitrogen&Argon", std::vector<double>(2, 0.5));
+        get_state_cache_stats(hits, misses, size);
+        CHECK(hits == 1);
+        CHECK(misses == 2);
+        CHECK(size == 1);
+        CHECK(uncached == first);
+        CHECK(uncached == second);
+    }
+    SECTION("composition is part of the key"){
+        flush_state_cache();
+        std::vector<double> z(2, 0.5);
+        PropsSI("Hmolar", "T", 300, "P", 1e5, "Nitrogen&Argon", z);
+        z[0] = 0.4; z[1] = 0.6;
+        PropsSI("Hmolar", "T", 300, "P", 1e5, "Nitrogen&Argon", z);
+        get_state_cache_stats(hits, misses, size);
+        CHECK(hits == 0);
+        CHECK(size == 2);
+    }
+    SECTION("cache is bounded"){
+        flush_state_cache();
+        set_state_cache_size(2);
+        std::string fluids[] = {"Water", "Nitrogen", "Argon", "Water"};
+        for (int i = 0; i < 4; ++i){
+            PropsSI("Dmolar", "T", 300, "P", 1e5, fluids[i]);
+        }
+        get_state_cache_stats(hits, misses, size);
+        CHECK(size == 2);
+        CHECK(hits == 0); // Water was evicted before it was used again
+        set_state_cache_size(N0);
+    }
+    SECTION("fluid probes of Props1SI leave the cache as it is"){
+        flush_state_cache();
+        PropsSI("Dmolar", "T", 300, "P", 1e5, "Water");
+        std::string Water = "Water", Nitrogen = "Nitrogen", Tcrit = "Tcrit";
+        CHECK(is_valid_fluid_string(Water));
+        CHECK(is_valid_fluid_string(Nitrogen));
+        CHECK(!is_valid_fluid_string(Tcrit));
+        get_state_cache_stats(hits, misses, size);
+        CHECK(hits == 0);
+        CHECK(misses == 1);
+        CHECK(size == 1);
+    }
+    SECTION("states borrowed before a flush are not given back to the pool"){
+        flush_state_cache();
+        {
+            CachedAbstractState AS("HEOS", "Water", std::vector<double>());
+            AS->update(PT_INPUTS, 1e5, 300);
+            // As set_reference_stateS does while the state is in use
+            flush_state_cache();
+        }
+        get_state_cache_stats(hits, misses, size);
+        CHECK(size == 0);
+        PropsSI("Dmolar", "T", 300, "P", 1e5, "Water");
+        get_state_cache_stats(hits, misses, size);
+        CHECK(size == 1);
+    }
+}
+#endif
+
+/// The output of PropsSI, resolved from its string representation once so that it can be evaluated for many states
+struct PropsSI_output
+{
+    enum output_types {OUTPUT_TYPE_TRIVIAL, OUTPUT_TYPE_NORMAL, OUTPUT_TYPE_FIRST_DERIVATIVE, OUTPUT_TYPE_SECOND_DERIVATIVE};
+    output_types type;
+    parameters Of1, Wrt1, Constant1, Wrt2, Constant2;
+    PropsSI_output(const std::string &Output){
+        Of1 = iundefined_parameter; Wrt1 = iundefined_parameter; Constant1 = iundefined_parameter;
+        Wrt2 = iundefined_parameter; Constant2 = iundefined_parameter;
+        if (is_valid_parameter(Output, Of1)){
+            type = (is_trivial_parameter(Of1)) ? OUTPUT_TYPE_TRIVIAL : OUTPUT_TYPE_NORMAL;
+        }
+        else if (is_valid_first_derivative(Output, Of1, Wrt1, Constant1)){
+            type = OUTPUT_TYPE_FIRST_DERIVATIVE;
+        }
+        else if (is_valid_second_derivative(Output, Of1, Wrt1, Constant1, Wrt2, Constant2)){
+            type = OUTPUT_TYPE_SECOND_DERIVATIVE;
+        }
+        else{
+            throw ValueError(format("Output [%s] is not a parameter or a string representation of a derivative",Output.c_str()).c_str());
+        }
+    };
+    /// Get the value of the output from a state that has already been updated (if it needs to be)
+    double evaluate(AbstractState &State) const {
+        switch (type){
+            case OUTPUT_TYPE_TRIVIAL:
+                return State.trivial_keyed_output(Of1);
+            case OUTPUT_TYPE_NORMAL:
+                return State.keyed_output(Of1);
+            case OUTPUT_TYPE_FIRST_DERIVATIVE:
+                return State.first_partial_deriv(Of1, Wrt1, Constant1);
+            case OUTPUT_TYPE_SECOND_DERIVATIVE:
+                return State.second_partial_deriv(Of1, Wrt1, Constant1, Wrt2, Constant2);
+        }
+        return _HUGE;
+    };
+};
+
+// Set the composition of the state in the form that the backend wants
+static void set_state_fractions(AbstractState &State, const std::vector<double> &fractions)
+{
+    if (State.using_mole_fractions()){
+        State.set_mole_fractions(fractions);
+    } else if (State.using_mass_fractions()){
+        State.set_mass_fractions(fractions);
+    } else if (State.using_volu_fractions()){
+        State.set_volu_fractions(fractions);
+    } else {
+        if (get_debug_level()>50) std::cout << format("%s:%d: _PropsSI, could not set composition to %s, defaulting to mole fraction.\n",__FILE__,__LINE__, vec_to_string(fractions).c_str()).c_str();
+    }
+}
+
+// If the fractions of the components have been encoded in the fluid string, extract them
+// If they have not, use the fractions that were passed in, or a pure fluid if none were given
+static std::string get_fluid_and_fractions(const std::string &Ref, const std::vector<double> &z, std::vector<double> &fractions)
+{
     if (z.empty())
     {
         // Make a one-element vector
@@ -204,30 +422,33 @@ double _PropsSI(const std::string &Output, const std::string &Name1, double Prop
         // Make a copy
         fractions = z;
     }
+    return extract_fractions(Ref, fractions);
+}
+
+// Internal function to do the actual calculations, make this a wrapped function so
+// that error bubbling can be done properly
+double _PropsSI(const std::string &Output, const std::string &Name1, double Prop1, const std::string &Name2, double Prop2, const std::string &backend, const std::string &Ref, const std::vector<double> &z)
+{
+    double x1, x2;
     
-    std::string fluid_string = extract_fractions(Ref, fractions);
+    if (get_debug_level()>5){
+        std::cout << format("%s:%d: _PropsSI(%s,%s,%g,%s,%g,%s,%s)\n",__FILE__,__LINE__,Output.c_str(),Name1.c_str(),Prop1,Name2.c_str(),Prop2,backend.c_str(),Ref.c_str(), vec_to_string(z).c_str()).c_str();
+    }
+
+    std::vector<double> fractions;
+    std::string fluid_string = get_fluid_and_fractions(Ref, z, fractions);
     
-    // We are going to let the factory function load the state
-    State.reset(AbstractState::factory(backend, fluid_string));
+    // Borrow a ready-made state from the cache, the factory function is only called if there is no idle state for these inputs
+    CachedAbstractState State(backend, fluid_string, fractions);
     
     // Set the fraction for the state
-    if (State->using_mole_fractions()){
-        State->set_mole_fractions(fractions);
-    } else if (State->using_mass_fractions()){
-        State->set_mass_fractions(fractions);
-    } else if (State->using_volu_fractions()){
-        State->set_volu_fractions(fractions);
-    } else {
-        if (get_debug_level()>50) std::cout << format("%s:%d: _PropsSI, could not set composition to %s, defaulting to mole fraction.\n",__FILE__,__LINE__, vec_to_string(z).c_str()).c_str();
-    }
+    set_state_fractions(*State, fractions);
     
-    // First check if it is a trivial input (critical/max parameters for instance)
-    if (is_valid_parameter(Output, iOutput))
-    {
-        if (is_trivial_parameter(iOutput)){
-            double val = State->trivial_keyed_output(iOutput);
-            return val;
-        }
+    PropsSI_output output(Output);
+
+    // A trivial output (critical/max parameters for instance) does not need the state to be updated
+    if (output.type == PropsSI_output::OUTPUT_TYPE_TRIVIAL){
+        return output.evaluate(*State);
     }
     
     parameters iName1 = get_parameter_index(Name1);
@@ -239,29 +460,67 @@ double _PropsSI(const std::string &Output, const std::string &Name1, double Prop
     // Update the state
     State->update(pair, x1, x2);
     
-    if (iOutput != iundefined_parameter){
-        // Get the desired output
-        double val = State->keyed_output(iOutput);
-        
-        // Return the value
-        return val;
+    // Return the desired output
+    return output.evaluate(*State);
+}
+
+// Internal function to evaluate several outputs for many states.  The outputs, the input pair and the state are all
+// resolved once, and then each point is only one update of the state, from which all the outputs are obtained.
+// The outputs are stored row by row in out, which must hold N*Outputs.size() values.  If a point fails, _HUGE is
+// stored for all the outputs of that point and the error string is set, but the remaining points are still evaluated.
+void _PropsSImulti(const std::vector<std::string> &Outputs, const std::string &Name1, const double *Prop1, const std::string &Name2, const double *Prop2, std::size_t N, const std::string &backend, const std::string &Ref, const std::vector<double> &z, double *out)
+{
+    if (get_debug_level()>5){
+        std::cout << format("%s:%d: _PropsSImulti(%s,%s,%s,%d,%s,%s)\n",__FILE__,__LINE__,strjoin(Outputs,",").c_str(),Name1.c_str(),Name2.c_str(),N,backend.c_str(),Ref.c_str()).c_str();
     }
-    else if (is_valid_first_derivative(Output, iOf, iWrt, iConstant)){
-        // Return the desired output
-        double val = State->first_partial_deriv(iOf, iWrt, iConstant);
-        
-        // Return the value
-        return val;
+    std::vector<double> fractions;
+    std::string fluid_string = get_fluid_and_fractions(Ref, z, fractions);
+    
+    CachedAbstractState State(backend, fluid_string, fractions);
+    set_state_fractions(*State, fractions);
+    
+    const std::size_t M = Outputs.size();
+    std::vector<PropsSI_output> outputs;
+    bool all_trivial = true;
+    for (std::size_t j = 0; j < M; ++j){
+        outputs.push_back(PropsSI_output(Outputs[j]));
+        if (outputs[j].type != PropsSI_output::OUTPUT_TYPE_TRIVIAL){ all_trivial = false; }
     }
-    else if (is_valid_second_derivative(Output, iOf1, iWrt1, iConstant1, iWrt2, iConstant2)){
-        // Return the desired output
-        double val = State->second_partial_deriv(iOf1, iWrt1, iConstant1, iWrt2, iConstant2);
-        
-        // Return the value
-        return val;
+    
+    // Nothing depends on the state, no need to update it at all
+    if (all_trivial){
+        for (std::size_t j = 0; j < M; ++j){
+            double val = outputs[j].evaluate(*State);
+            for (std::size_t i = 0; i < N; ++i){ out[i*M+j] = val; }
+        }
+        return;
     }
-    else{
-        throw ValueError(format("Output [%s] is not a parameter or a string representation of a derivative",Output.c_str()).c_str());
+    
+    // Find the input pair and whether the inputs need to be swapped
+    bool swap;
+    CoolProp::input_pairs pair = generate_update_pair(get_parameter_index(Name1), get_parameter_index(Name2), swap);
+    const double *in1 = (swap) ? Prop2 : Prop1, *in2 = (swap) ? Prop1 : Prop2;
+    
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        #if !defined(NO_ERROR_CATCHING)
+        try{
+        #endif
+            State->update(pair, in1[i], in2[i]);
+            for (std::size_t j = 0; j < M; ++j){
+                out[i*M+j] = outputs[j].evaluate(*State);
+            }
+        #if !defined(NO_ERROR_CATCHING)
+        }
+        catch(const std::exception& e){
+            set_error_string(e.what() + format(" : PropsSImulti(\"%s\",\"%s\",%0.10g,\"%s\",%0.10g,\"%s\")",strjoin(Outputs,",").c_str(),Name1.c_str(), Prop1[i], Name2.c_str(), Prop2[i], Ref.c_str()));
+            for (std::size_t j = 0; j < M; ++j){ out[i*M+j] = _HUGE; }
+        }
+        catch(...){
+            set_error_string(format("Indeterminate error : PropsSImulti(\"%s\",\"%s\",%0.10g,\"%s\",%0.10g,\"%s\")",strjoin(Outputs,",").c_str(),Name1.c_str(), Prop1[i], Name2.c_str(), Prop2[i], Ref.c_str()));
+            for (std::size_t j = 0; j < M; ++j){ out[i*M+j] = _HUGE; }
+        }
+        #endif
     }
 }
 double PropsSI(const std::string &Output, const std::string &Name1, double Prop1, const std::string &Name2, double Prop2, const std::string &Ref, const std::vector<double> &z)
@@ -350,12 +609,124 @@ std::vector<double> PropsSI(const std::string &Output, const std::string &Name1,
     {
         throw ValueError(format("Sizes of Prop1 [%d] and Prop2 [%d] to PropsSI are not the same", Prop1.size(), Prop2.size()));
     }
-    for (std::size_t i = 0; i < Prop1.size(); ++i)
+    if (!out.empty()){
+        PropsSIbatch(Output, Name1, &(Prop1[0]), Name2, &(Prop2[0]), Prop1.size(), Ref, z, &(out[0]));
+    }
+    return out;
+}
+void PropsSIbatch(const std::string &Output, const std::string &Name1, const double *Prop1, const std::string &Name2, const double *Prop2, std::size_t N, const std::string &Ref, const std::vector<double> &z, double *out)
+{
+    PropsSImulti(std::vector<std::string>(1, Output), Name1, Prop1, Name2, Prop2, N, Ref, z, out);
+}
+void PropsSImulti(const std::vector<std::string> &Outputs, const std::string &Name1, const double *Prop1, const std::string &Name2, const double *Prop2, std::size_t N, const std::string &Ref, const std::vector<double> &z, double *out)
+{
+    std::string backend, fluid;
+    std::vector<double> fractions = z;
+    #if !defined(NO_ERROR_CATCHING)
+    try{
+    #endif
+        extract_backend(Ref, backend, fluid);
+        Dictionary dict;
+        if (fractions.empty() && is_predefined_mixture(fluid, dict)){
+            fractions = dict.get_double_vector("mole_fractions");
+            fluid = strjoin(dict.get_string_vector("fluids"),"&");
+        }
+        _PropsSImulti(Outputs, Name1, Prop1, Name2, Prop2, N, backend, fluid, fractions, out);
+    #if !defined(NO_ERROR_CATCHING)
+    }
+    catch(const std::exception& e){
+        set_error_string(e.what() + format(" : PropsSImulti(\"%s\",\"%s\",\"%s\",\"%s\")",strjoin(Outputs,",").c_str(),Name1.c_str(), Name2.c_str(), Ref.c_str()));
+        for (std::size_t i = 0; i < N*Outputs.size(); ++i){ out[i] = _HUGE; }
+    }
+    catch(...){
+        set_error_string(format("Indeterminate error : PropsSImulti(\"%s\",\"%s\",\"%s\",\"%s\")",strjoin(Outputs,",").c_str(),Name1.c_str(), Name2.c_str(), Ref.c_str()));
+        for (std::size_t i = 0; i < N*Outputs.size(); ++i){ out[i] = _HUGE; }
+    }
+    #endif
+}
+std::vector<std::vector<double> > PropsSImulti(const std::vector<std::string> &Outputs, const std::string &Name1, const std::vector<double> &Prop1, const std::string &Name2, const std::vector<double> &Prop2, const std::string &Ref, const std::vector<double> &z)
+{
+    if (Prop1.size() != Prop2.size())
     {
-        out[i] = PropsSI(Output,Name1,Prop1[i],Name2,Prop2[i],Ref,z);
+        throw ValueError(format("Sizes of Prop1 [%d] and Prop2 [%d] to PropsSImulti are not the same", Prop1.size(), Prop2.size()));
+    }
+    const std::size_t N = Prop1.size(), M = Outputs.size();
+    std::vector<std::vector<double> > out(N, std::vector<double>(M, _HUGE));
+    if (N == 0 || M == 0){ return out; }
+    std::vector<double> buffer(N*M);
+    PropsSImulti(Outputs, Name1, &(Prop1[0]), Name2, &(Prop2[0]), N, Ref, z, &(buffer[0]));
+    for (std::size_t i = 0; i < N; ++i){
+        std::copy(buffer.begin() + i*M, buffer.begin() + (i+1)*M, out[i].begin());
     }
     return out;
 }
+#if defined(ENABLE_CATCH)
+TEST_CASE("Batched PropsSI gives the same values as PropsSI", "[PropsSIbatch]")
+{
+    const std::size_t N = 5;
+    double T[N] = {250, 300, 350, 400, 300}, p[N] = {1e5, 1e5, 2e5, 5e5, -1};
+    double out[N];
+    SECTION("pure fluid, inputs in the order of the input pair"){
+        PropsSIbatch("Hmass", "T", T, "P", p, N, "Nitrogen", std::vector<double>(), out);
+        for (std::size_t i = 0; i < N-1; ++i){
+            CAPTURE(T[i]);
+            CHECK(out[i] == PropsSI("Hmass", "T", T[i], "P", p[i], "Nitrogen"));
+        }
+        // The last point is out of range; the other points should not be affected by it
+        CHECK(!ValidNumber(out[N-1]));
+    }
+    SECTION("mixture, inputs swapped"){
+        std::vector<double> z(2, 0.5);
+        PropsSIbatch("d(Hmolar)/d(T)|P", "P", p, "T", T, N-1, "Nitrogen&Argon", z, out);
+        for (std::size_t i = 0; i < N-1; ++i){
+            CAPTURE(T[i]);
+            CHECK(out[i] == PropsSI("d(Hmolar)/d(T)|P", "P", p[i], "T", T[i], "Nitrogen&Argon", z));
+        }
+    }
+    SECTION("trivial output"){
+        PropsSIbatch("Tcrit", "T", T, "P", p, N, "Water", std::vector<double>(), out);
+        for (std::size_t i = 0; i < N; ++i){
+            CHECK(out[i] == Props1SI("Water", "Tcrit"));
+        }
+    }
+    SECTION("bad output fills the buffer with _HUGE"){
+        PropsSIbatch("notanoutput", "T", T, "P", p, N, "Water", std::vector<double>(), out);
+        for (std::size_t i = 0; i < N; ++i){
+            CHECK(!ValidNumber(out[i]));
+        }
+    }
+}
+#endif
+#if defined(ENABLE_CATCH)
+TEST_CASE("Several outputs from one flash with PropsSImulti", "[PropsSImulti]")
+{
+    std::vector<std::string> outputs = strsplit("T,Dmass,Cpmass,V,L,Tcrit,d(Hmass)/d(T)|P", ',');
+    std::vector<double> p(3), h(3);
+    p[0] = 1e5; p[1] = 1e6; p[2] = 1e7;
+    h[0] = 3e5; h[1] = 4e5; h[2] = 5e5;
+    SECTION("values are the same as PropsSI"){
+        std::vector<std::vector<double> > out = PropsSImulti(outputs, "P", p, "Hmass", h, "Nitrogen", std::vector<double>());
+        REQUIRE(out.size() == p.size());
+        for (std::size_t i = 0; i < p.size(); ++i){
+            REQUIRE(out[i].size() == outputs.size());
+            for (std::size_t j = 0; j < outputs.size(); ++j){
+                CAPTURE(outputs[j]);
+                CAPTURE(p[i]);
+                CHECK(out[i][j] == PropsSI(outputs[j], "P", p[i], "Hmass", h[i], "Nitrogen"));
+            }
+        }
+    }
+    SECTION("a failing point fills its row with _HUGE"){
+        p[1] = -1;
+        std::vector<std::vector<double> > out = PropsSImulti(outputs, "P", p, "Hmass", h, "Nitrogen", std::vector<double>());
+        for (std::size_t j = 0; j < outputs.size(); ++j){
+            CHECK(ValidNumber(out[0][j]));
+            CHECK(!ValidNumber(out[1][j]));
+            CHECK(ValidNumber(out[2][j]));
+        }
+    }
+}
+#endif
 double Props1SI(std::string FluidName,std::string Output)
 {
     return PropsSI(Output,"",0,"",0,FluidName);
@@ -369,6 +740,9 @@ bool is_valid_fluid_string(std::string &input_fluid_string)
         // First try to extract backend and fractions
         extract_backend(input_fluid_string, backend, fluid);
         std::string fluid_string = extract_fractions(fluid, fractions);
+        if (fractions.empty()){ fractions = std::vector<double>(1, 1); }
+        // A probe does not go through the cache, so that it does not count as a miss or push out the states that are in use
+        if (state_cache.contains(AbstractStateCache::key(backend, fluid_string, fractions))){ return true; }
         // We are going to let the factory function load the state
         shared_ptr<AbstractState> State(AbstractState::factory(backend, fluid_string));
         return true;
@@ -388,11 +762,18 @@ double saturation_ancillary(const std::string &fluid_name, const std::string &ou
     
     return HEOS->saturation_ancillary(iOutput, Q, iInput, value);
 }
+// Serializes the changes of the reference state so that two threads cannot replace the same fluid at the same time
+static Mutex reference_state_mutex;
+
+// The reference state is applied to a copy of the fluid, which is then swapped into the library, so that the fluid data
+// that is being used by other states (possibly in other threads) is never modified.  States that were constructed before
+// the change keep the old reference state.
 void set_reference_stateS(std::string Ref, std::string reference_state)
 {
+    ScopedLock lock(reference_state_mutex);
+    shared_ptr<CoolPropFluid> fluid = get_library().get_copy(Ref);
     shared_ptr<CoolProp::HelmholtzEOSMixtureBackend> HEOS;
-    std::vector<std::string> _comps(1, Ref);
-    HEOS.reset(new CoolProp::HelmholtzEOSMixtureBackend(_comps));
+    HEOS.reset(new CoolProp::HelmholtzEOSMixtureBackend(std::vector<CoolPropFluid*>(1, fluid.get())));
 
     if (!reference_state.compare("IIR"))
     {
@@ -403,7 +784,7 @@ void set_reference_stateS(std::string Ref, std::string reference_state)
         double deltas = HEOS->smass() - 1000; // offset from 1000 J/kg/K entropy
         double delta_a1 = deltas/(HEOS->gas_constant()/HEOS->molar_mass());
         double delta_a2 = -deltah/(HEOS->gas_constant()/HEOS->molar_mass()*HEOS->get_reducing_state().T);
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "IIR");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "IIR");
         HEOS->update_states();
     }
     else if (!reference_state.compare("ASHRAE"))
@@ -415,7 +796,7 @@ void set_reference_stateS(std::string Ref, std::string reference_state)
         double deltas = HEOS->smass() - 0; // offset from 0 J/kg/K entropy
         double delta_a1 = deltas/(HEOS->gas_constant()/HEOS->molar_mass());
         double delta_a2 = -deltah/(HEOS->gas_constant()/HEOS->molar_mass()*HEOS->get_reducing_state().T);
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "ASHRAE");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "ASHRAE");
         HEOS->update_states();
     }
     else if (!reference_state.compare("NBP"))
@@ -428,28 +809,34 @@ void set_reference_stateS(std::string Ref, std::string reference_state)
         double delta_a1 = deltas/(HEOS->gas_constant()/HEOS->molar_mass());
         double delta_a2 = -deltah/(HEOS->gas_constant()/HEOS->molar_mass()*HEOS->get_reducing_state().T);
         if (get_debug_level() > 5){std::cout << format("[set_reference_stateD] delta_a1 %g delta_a2 %g\n",delta_a1, delta_a2);}
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "NBP");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "NBP");
         HEOS->update_states();
     }
     else if (!reference_state.compare("DEF"))
     {
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(0,0,"");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(0,0,"");
+        HEOS->update_states();
     }
     else if (!reference_state.compare("RESET"))
     {
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(0, 0, "");
-        HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffsetCore.set(0, 0, "");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(0, 0, "");
+        fluid->pEOS->alpha0.EnthalpyEntropyOffsetCore.set(0, 0, "");
+        HEOS->update_states();
     }
     else
     {
         throw ValueError(format("reference state string is invalid: [%s]",reference_state.c_str()));
     }
+    get_library().replace(fluid);
+    // Cached states still point to the fluid with the old reference state
+    state_cache.flush();
 }
 void set_reference_stateD(std::string Ref, double T, double rhomolar, double h0, double s0)
 {
+    ScopedLock lock(reference_state_mutex);
+    shared_ptr<CoolPropFluid> fluid = get_library().get_copy(Ref);
     shared_ptr<CoolProp::HelmholtzEOSMixtureBackend> HEOS;
-    std::vector<std::string> _comps(1, Ref);
-    HEOS.reset(new CoolProp::HelmholtzEOSMixtureBackend(_comps));
+    HEOS.reset(new CoolProp::HelmholtzEOSMixtureBackend(std::vector<CoolPropFluid*>(1, fluid.get())));
     
     HEOS->update(DmolarT_INPUTS, rhomolar, T);
 
@@ -458,10 +845,73 @@ void set_reference_stateD(std::string Ref, double T, double rhomolar, double h0,
     double deltas = HEOS->smass() - s0; // offset from specified entropy in J/mol/K
     double delta_a1 = deltas/(8.314472/HEOS->molar_mass());
     double delta_a2 = -deltah/(8.314472/HEOS->molar_mass()*HEOS->get_reducing_state().T);
-    HEOS->get_components()[0]->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "custom");
+    fluid->pEOS->alpha0.EnthalpyEntropyOffset.set(delta_a1, delta_a2, "custom");
     HEOS->update_states();
+    get_library().replace(fluid);
+    // Cached states still point to the fluid with the old reference state
+    state_cache.flush();
 }
 
+#if defined(ENABLE_CATCH)
+
+/// The work done by one thread of the multithreading test
+struct ThreadWork
+{
+    int id;
+    std::size_t N;
+    std::vector<double> hmolar_AS, hmolar_PropsSI;
+    std::string errstring;
+};
+static void do_thread_work(ThreadWork &work){
+    shared_ptr<AbstractState> AS(AbstractState::factory("HEOS", "Water"));
+    work.hmolar_AS.resize(work.N);
+    work.hmolar_PropsSI.resize(work.N);
+    for (std::size_t i = 0; i < work.N; ++i){
+        double T = 300 + 400.0*i/work.N, p = 1e5 + 1e7*i/work.N;
+        AS->update(PT_INPUTS, p, T);
+        work.hmolar_AS[i] = AS->hmolar();
+        work.hmolar_PropsSI[i] = PropsSI("Hmolar", "T", T, "P", p, "Nitrogen");
+    }
+    // Each thread should only see its own error message
+    PropsSI("Hmolar", "T", 300, "P", 1e5, format("NotAFluid%d", work.id));
+    work.errstring = get_global_param_string("errstring");
+}
+
+TEST_CASE("Concurrent calls from several threads", "[multithreading]")
+{
+    const std::size_t N = 200;
+    // Serial reference values
+    std::vector<ThreadWork> serial(1);
+    serial[0].id = 0; serial[0].N = N;
+    run_in_threads(&do_thread_work, serial);
+
+    int Nthreads_list[] = {2, 4, 8};
+    for (int k = 0; k < 3; ++k){
+        int Nthreads = Nthreads_list[k];
+        std::vector<ThreadWork> work(Nthreads);
+        for (int i = 0; i < Nthreads; ++i){ work[i].id = i; work[i].N = N; }
+        run_in_threads(&do_thread_work, work);
+        for (int i = 0; i < Nthreads; ++i){
+            CAPTURE(i);
+            CHECK(work[i].hmolar_AS == serial[0].hmolar_AS);
+            CHECK(work[i].hmolar_PropsSI == serial[0].hmolar_PropsSI);
+            CHECK(work[i].errstring.find(format("NotAFluid%d", i)) != std::string::npos);
+        }
+    }
+    // Changing the reference state does not modify the fluid used by existing states; it only affects states constructed afterwards
+    shared_ptr<AbstractState> Water(AbstractState::factory("HEOS", "Water"));
+    Water->update(PT_INPUTS, 101325, 300);
+    double h_DEF = Water->hmass();
+    set_reference_stateS("Water", "NBP");
+    Water->update(PT_INPUTS, 101325, 300);
+    CHECK(Water->hmass() == h_DEF);
+    double h_NBP = PropsSI("Hmass", "T", 300, "P", 101325, "Water");
+    CHECK(std::abs(h_NBP - h_DEF) > 1);
+    set_reference_stateS("Water", "DEF");
+    CHECK(std::abs(PropsSI("Hmass", "T", 300, "P", 101325, "Water") - h_DEF) < 1e-6*std::abs(h_DEF));
+}
+#endif
+
 std::string get_BibTeXKey(std::string Ref, std::string key)
 {
     std::vector<std::string> names(1, Ref);
@@ -485,10 +935,10 @@ std::string get_global_param_string(std::string ParamName)
         return gitrevision;
     }
     else if (!ParamName.compare("errstring")){
-        std::string temp = error_string; error_string = ""; return temp;
+        std::string temp = error_string.get(); error_string.get() = ""; return temp;
     }
     else if (!ParamName.compare("warnstring")){
-        std::string temp = warning_string; warning_string = ""; return temp;
+        std::string temp = warning_string.get(); warning_string.get() = ""; return temp;
     }
     else if (!ParamName.compare("FluidsList") || !ParamName.compare("fluids_list") || !ParamName.compare("fluidslist")){
         return get_fluid_list();
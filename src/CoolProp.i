@@ -1,7 +1,14 @@
 %module CoolProp
 
-%ignore CoolProp::AbstractState::set_mole_fractions(const std::vector< long double> &);
-%ignore CoolProp::AbstractState::set_mass_fractions(const std::vector< long double> &);
+// The floating point type of the library, as in CoolPropTools.h; CMake passes COOLPROP_REAL_DOUBLE to SWIG as well
+#if defined(COOLPROP_REAL_DOUBLE)
+typedef double CoolPropDbl;
+#else
+typedef long double CoolPropDbl;
+// The overloads that take std::vector<double> are wrapped instead
+%ignore CoolProp::AbstractState::set_mole_fractions(const std::vector<CoolPropDbl> &);
+%ignore CoolProp::AbstractState::set_mass_fractions(const std::vector<CoolPropDbl> &);
+#endif
 %ignore CoolProp::set_config_json(rapidjson::Document &);
 %ignore CoolProp::get_config_as_json(rapidjson::Document &);
 
@@ -19,7 +26,9 @@
 
 // Instantiate templates used by example
 namespace std {
+#if !defined(COOLPROP_REAL_DOUBLE)
    %template(LongDoubleVector) vector<long double>;
+#endif
    %template(DoubleVector) vector<double>;
 }
 
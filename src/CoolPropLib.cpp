@@ -11,9 +11,13 @@
 #include "HumidAirProp.h"
 #include "DataStructures.h"
 #include "Exceptions.h"
+#include "AbstractState.h"
+#include "crossplatform_shared_ptr.h"
+#include "crossplatform_mutex.h"
 #include "float.h"
 
 #include <string.h>
+#include <map>
 
 // In Microsoft Excel, they seem to check the FPU exception bits and error out because of it.  
 // By calling the _clearfp(), we can reset these bits, and not get the error
@@ -206,6 +210,24 @@ EXPORT_CODE double CONVENTION PropsSIZ(const char *Output, const char *Name1, do
     reset_fpu();
     return val;
 }
+EXPORT_CODE void CONVENTION PropsSIbatch(const char *Output, const char *Name1, const double *Prop1, const char *Name2, const double *Prop2, long N, const char * FluidName, const double *z, int n, double *out)
+{
+    std::string _Output = Output, _Name1 = Name1, _Name2 = Name2, _FluidName = FluidName;
+    std::vector<double> _z;
+    if (z != NULL && n > 0){ _z = std::vector<double>(z, z+n); }
+    CoolProp::PropsSIbatch(_Output, _Name1, Prop1, _Name2, Prop2, static_cast<std::size_t>(N < 0 ? 0 : N), _FluidName, _z, out);
+    reset_fpu();
+}
+EXPORT_CODE void CONVENTION PropsSImulti(const char *Outputs, const char *Name1, const double *Prop1, const char *Name2, const double *Prop2, long N, const char * FluidName, const double *z, int n, double *out)
+{
+    std::string _Name1 = Name1, _Name2 = Name2, _FluidName = FluidName;
+    std::vector<std::string> _Outputs = strsplit(std::string(Outputs), ',');
+    for (std::size_t i = 0; i < _Outputs.size(); ++i){ strstrip(_Outputs[i]); }
+    std::vector<double> _z;
+    if (z != NULL && n > 0){ _z = std::vector<double>(z, z+n); }
+    CoolProp::PropsSImulti(_Outputs, _Name1, Prop1, _Name2, Prop2, static_cast<std::size_t>(N < 0 ? 0 : N), _FluidName, _z, out);
+    reset_fpu();
+}
 EXPORT_CODE void CONVENTION propssi_(const char *Output, const char *Name1, double *Prop1, const char *Name2, double *Prop2, const char * FluidName, double *output)
 {
     std::string _Output = Output, _Name1 = Name1, _Name2 = Name2, _FluidName = FluidName;
@@ -225,6 +247,23 @@ EXPORT_CODE int CONVENTION get_debug_level(){
 EXPORT_CODE void CONVENTION set_debug_level(int level){
     CoolProp::set_debug_level(level);
 }
+EXPORT_CODE void CONVENTION set_state_cache_size(long N){
+    CoolProp::set_state_cache_size(static_cast<std::size_t>(N < 0 ? 0 : N));
+}
+EXPORT_CODE long CONVENTION get_state_cache_size(){
+    return static_cast<long>(CoolProp::get_state_cache_size());
+}
+EXPORT_CODE void CONVENTION flush_state_cache(){
+    CoolProp::flush_state_cache();
+}
+EXPORT_CODE void CONVENTION get_state_cache_stats(long *hits, long *misses, long *size){
+    unsigned long _hits, _misses;
+    std::size_t _size;
+    CoolProp::get_state_cache_stats(_hits, _misses, _size);
+    if (hits != NULL){ *hits = static_cast<long>(_hits); }
+    if (misses != NULL){ *misses = static_cast<long>(_misses); }
+    if (size != NULL){ *size = static_cast<long>(_size); }
+}
 EXPORT_CODE long CONVENTION get_param_index(const char * param){
     return CoolProp::get_parameter_index(param);
 }
@@ -305,3 +344,215 @@ EXPORT_CODE void CONVENTION haprops_(const char *Output, const char *Name1, doub
     *output = HAProps(Output, Name1, *Prop1, Name2, *Prop2, Name3, *Prop3);
     reset_fpu();
 }
+
+// ---------------------------------
+//  Handle-based AbstractState API
+// ---------------------------------
+
+/// The AbstractState instances that have been handed out to the caller; the caller only ever sees the integer handle
+class AbstractStateLibrary
+{
+private:
+    std::map<long, shared_ptr<CoolProp::AbstractState> > states;
+    long next_handle;
+    CoolProp::Mutex mutex;
+public:
+    AbstractStateLibrary() : next_handle(0){};
+    long add(shared_ptr<CoolProp::AbstractState> AS){
+        CoolProp::ScopedLock lock(mutex);
+        states.insert(std::pair<long, shared_ptr<CoolProp::AbstractState> >(next_handle, AS));
+        return next_handle++;
+    }
+    void remove(long handle){
+        CoolProp::ScopedLock lock(mutex);
+        if (states.erase(handle) != 1){
+            throw CoolProp::ValueError(format("Unable to free the AbstractState handle [%ld]; it is not valid", handle));
+        }
+    }
+    shared_ptr<CoolProp::AbstractState> get(long handle){
+        CoolProp::ScopedLock lock(mutex);
+        std::map<long, shared_ptr<CoolProp::AbstractState> >::iterator it = states.find(handle);
+        if (it == states.end()){
+            throw CoolProp::ValueError(format("The AbstractState handle [%ld] is not valid", handle));
+        }
+        return it->second;
+    }
+};
+static AbstractStateLibrary handle_manager;
+
+EXPORT_CODE long CONVENTION get_input_pair_index(const char *pair_name)
+{
+    try{
+        return CoolProp::get_input_pair_index(pair_name);
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); return -1;}
+    catch(...){CoolProp::set_error_string("Undefined error"); return -1;}
+}
+EXPORT_CODE long CONVENTION AbstractState_factory(const char *backend, const char *fluids)
+{
+    try{
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory(backend, fluids));
+        reset_fpu();
+        return handle_manager.add(AS);
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); reset_fpu(); return -1;}
+    catch(...){CoolProp::set_error_string("Undefined error"); reset_fpu(); return -1;}
+}
+EXPORT_CODE long CONVENTION AbstractState_free(const long handle)
+{
+    try{
+        handle_manager.remove(handle);
+        return 1;
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); return 0;}
+    catch(...){CoolProp::set_error_string("Undefined error"); return 0;}
+}
+EXPORT_CODE long CONVENTION AbstractState_set_fractions(const long handle, const double *fractions, const long N)
+{
+    try{
+        shared_ptr<CoolProp::AbstractState> AS = handle_manager.get(handle);
+        if (N < 0){
+            throw CoolProp::ValueError(format("The number of fractions [%ld] may not be negative", N));
+        }
+        if (fractions == NULL && N > 0){
+            throw CoolProp::ValueError("The array of fractions is NULL");
+        }
+        std::vector<double> _fractions(fractions, fractions + N);
+        if (AS->using_mole_fractions()){
+            AS->set_mole_fractions(_fractions);
+        } else if (AS->using_mass_fractions()){
+            AS->set_mass_fractions(_fractions);
+        } else if (AS->using_volu_fractions()){
+            AS->set_volu_fractions(_fractions);
+        }
+        reset_fpu();
+        return 1;
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); reset_fpu(); return 0;}
+    catch(...){CoolProp::set_error_string("Undefined error"); reset_fpu(); return 0;}
+}
+EXPORT_CODE long CONVENTION AbstractState_update(const long handle, const long input_pair, const double value1, const double value2)
+{
+    try{
+        handle_manager.get(handle)->update(static_cast<CoolProp::input_pairs>(input_pair), value1, value2);
+        reset_fpu();
+        return 1;
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); reset_fpu(); return 0;}
+    catch(...){CoolProp::set_error_string("Undefined error"); reset_fpu(); return 0;}
+}
+EXPORT_CODE double CONVENTION AbstractState_keyed_output(const long handle, const long param)
+{
+    try{
+        double val = handle_manager.get(handle)->keyed_output(static_cast<CoolProp::parameters>(param));
+        reset_fpu();
+        return val;
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); reset_fpu(); return _HUGE;}
+    catch(...){CoolProp::set_error_string("Undefined error"); reset_fpu(); return _HUGE;}
+}
+EXPORT_CODE long CONVENTION AbstractState_update_and_N_out(const long handle, const long input_pair, const double *value1, const double *value2, const long length, const long *outputs, const long n_outputs, double *out)
+{
+    shared_ptr<CoolProp::AbstractState> AS;
+    try{
+        AS = handle_manager.get(handle);
+        if (length < 0){
+            throw CoolProp::ValueError(format("The number of input points [%ld] may not be negative", length));
+        }
+        if (n_outputs < 0){
+            throw CoolProp::ValueError(format("The number of outputs [%ld] may not be negative", n_outputs));
+        }
+        if (length > 0 && (value1 == NULL || value2 == NULL)){
+            throw CoolProp::ValueError("The array of first or second input values is NULL");
+        }
+        if (length > 0 && n_outputs > 0 && (outputs == NULL || out == NULL)){
+            throw CoolProp::ValueError("The array of outputs or of their values is NULL");
+        }
+    }
+    catch(std::exception &e){CoolProp::set_error_string(e.what()); return 0;}
+    catch(...){CoolProp::set_error_string("Undefined error"); return 0;}
+    // The error string is that of the first point that failed; the others are still evaluated
+    std::string error;
+    for (long i = 0; i < length; ++i){
+        try{
+            AS->update(static_cast<CoolProp::input_pairs>(input_pair), value1[i], value2[i]);
+            for (long j = 0; j < n_outputs; ++j){
+                out[i*n_outputs+j] = AS->keyed_output(static_cast<CoolProp::parameters>(outputs[j]));
+            }
+        }
+        catch(std::exception &e){
+            if (error.empty()){ error = format("Input point [%ld]: %s", i, e.what()); }
+            for (long j = 0; j < n_outputs; ++j){ out[i*n_outputs+j] = _HUGE; }
+        }
+        catch(...){
+            if (error.empty()){ error = format("Input point [%ld]: Undefined error", i); }
+            for (long j = 0; j < n_outputs; ++j){ out[i*n_outputs+j] = _HUGE; }
+        }
+    }
+    reset_fpu();
+    if (!error.empty()){
+        CoolProp::set_error_string(error);
+        return 0;
+    }
+    return 1;
+}
+EXPORT_CODE long CONVENTION AbstractState_update_and_1_out(const long handle, const long input_pair, const double *value1, const double *value2, const long length, const long output, double *out)
+{
+    return AbstractState_update_and_N_out(handle, input_pair, value1, value2, length, &output, 1, out);
+}
+
+#if defined(ENABLE_CATCH)
+#include "catch.hpp"
+
+TEST_CASE("Check the handle-based AbstractState functions of the C API", "[CoolPropLib]")
+{
+    SECTION("round trip of a pure fluid"){
+        long handle = AbstractState_factory("HEOS", "Water");
+        REQUIRE(handle >= 0);
+        REQUIRE(AbstractState_update(handle, get_input_pair_index("PT_INPUTS"), 101325, 300) == 1);
+        double rho = AbstractState_keyed_output(handle, get_param_index("Dmass"));
+        CHECK(std::abs(rho - CoolProp::PropsSI("Dmass", "P", 101325, "T", 300, "HEOS::Water")) < 1e-10*rho);
+        CHECK(AbstractState_free(handle) == 1);
+        CHECK(AbstractState_free(handle) == 0);
+        CHECK(AbstractState_update(handle, get_input_pair_index("PT_INPUTS"), 101325, 300) == 0);
+    }
+    SECTION("fractions of a mixture"){
+        long handle = AbstractState_factory("HEOS", "Nitrogen&Oxygen");
+        REQUIRE(handle >= 0);
+        double z[] = {0.79, 0.21};
+        CHECK(AbstractState_set_fractions(handle, NULL, 2) == 0);
+        CHECK(AbstractState_set_fractions(handle, z, -1) == 0);
+        REQUIRE(AbstractState_set_fractions(handle, z, 2) == 1);
+        CHECK(AbstractState_update(handle, get_input_pair_index("PT_INPUTS"), 101325, 300) == 1);
+        CHECK(ValidNumber(AbstractState_keyed_output(handle, get_param_index("Dmolar"))));
+        CHECK(AbstractState_free(handle) == 1);
+    }
+    SECTION("batched outputs"){
+        long handle = AbstractState_factory("HEOS", "Water");
+        REQUIRE(handle >= 0);
+        double T[] = {300, 350, -1}, p[] = {101325, 101325, 101325}, out[6];
+        long outputs[] = {get_param_index("T"), get_param_index("Dmass")};
+        // The last point fails, which is reported, but the others are still evaluated
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 3, outputs, 2, out) == 0);
+        CHECK(std::abs(out[0] - 300) < 1e-10);
+        CHECK(std::abs(out[2] - 350) < 1e-10);
+        CHECK(out[4] == _HUGE);
+        CHECK(out[5] == _HUGE);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 2, outputs, 2, out) == 1);
+        CHECK(AbstractState_update_and_1_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 2, outputs[1], out) == 1);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), NULL, T, 2, outputs, 2, out) == 0);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 2, NULL, 2, out) == 0);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 2, outputs, 2, NULL) == 0);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, -1, outputs, 2, out) == 0);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), p, T, 2, outputs, -2, out) == 0);
+        CHECK(AbstractState_update_and_N_out(handle, get_input_pair_index("PT_INPUTS"), NULL, NULL, 0, outputs, 2, NULL) == 1);
+        CHECK(AbstractState_free(handle) == 1);
+    }
+    CHECK(get_input_pair_index("PT") == -1);
+    long hits = -1, misses = -1;
+    get_state_cache_stats(&hits, &misses, NULL);
+    CHECK(hits >= 0);
+    CHECK(misses >= 0);
+}
+
+#endif
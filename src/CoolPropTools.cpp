@@ -11,6 +11,14 @@
 #include "CoolPropTools.h"
 #include "MatrixMath.h"
 #include "Exceptions.h"
+#include "PlatformDetermination.h"
+
+#include <errno.h>
+#if defined(__ISWINDOWS__)
+    #include <direct.h>
+#else
+    #include <sys/stat.h>
+#endif
 
 double root_sum_square(std::vector<double> x)
 {
@@ -159,6 +167,36 @@ std::string get_file_contents(const char *filename)
     }
     throw(errno);
 }
+std::string get_home_dir(void)
+{
+    #if defined(__ISWINDOWS__)
+        const char *home = getenv("USERPROFILE");
+    #else
+        const char *home = getenv("HOME");
+    #endif
+    if (home == NULL){
+        throw CoolProp::ValueError("Unable to find the home directory of the user");
+    }
+    return std::string(home);
+}
+void make_dirs(const std::string &path)
+{
+    // Make each of the parents in turn, then the directory itself
+    for (std::size_t i = 1; i <= path.size(); ++i){
+        if (i < path.size() && path[i] != '/' && path[i] != '\\'){ continue; }
+        std::string parent = path.substr(0, i);
+        // Skip the drive letter on windows
+        if (parent[parent.size()-1] == ':'){ continue; }
+        #if defined(__ISWINDOWS__)
+            int ret = _mkdir(parent.c_str());
+        #else
+            int ret = mkdir(parent.c_str(), 0777);
+        #endif
+        if (ret != 0 && errno != EEXIST){
+            throw CoolProp::ValueError(format("Unable to make directory [%s]", parent.c_str()));
+        }
+    }
+}
 
 void solve_cubic(double a, double b, double c, double d, int &N, double &x0, double &x1, double &x2)
 {
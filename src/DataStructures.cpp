@@ -379,17 +379,19 @@ parameters get_parameter_index(const std::string &param_name)
 struct input_pair_info
 {
     int key;
-    std::string short_desc, long_desc;
+    std::string name, short_desc, long_desc;
 public:
-    input_pair_info(int key, std::string short_desc, std::string long_desc): key(key), short_desc(short_desc), long_desc(long_desc){};
+    input_pair_info(int key, std::string short_desc, std::string long_desc): key(key), name(short_desc), short_desc(short_desc), long_desc(long_desc){};
+    /// For the pairs whose short description is shared with another pair, the name of the enum is also given
+    input_pair_info(int key, std::string name, std::string short_desc, std::string long_desc): key(key), name(name), short_desc(short_desc), long_desc(long_desc){};
 };
 
 input_pair_info input_pair_list[] = {
     input_pair_info(QT_INPUTS,"QT_INPUTS","Molar quality, Temperature in K"),
-    input_pair_info(QSmolar_INPUTS,"QS_INPUTS","Molar quality, Entropy in J/mol/K"),
-    input_pair_info(QSmass_INPUTS,"QS_INPUTS","Molar quality, Entropy in J/kg/K"),
-    input_pair_info(HmolarQ_INPUTS,"HQ_INPUTS","Enthalpy in J/mol, Molar quality"),
-    input_pair_info(HmassQ_INPUTS,"HQ_INPUTS","Enthalpy in J/kg, Molar quality"),
+    input_pair_info(QSmolar_INPUTS,"QSmolar_INPUTS","QS_INPUTS","Molar quality, Entropy in J/mol/K"),
+    input_pair_info(QSmass_INPUTS,"QSmass_INPUTS","QS_INPUTS","Molar quality, Entropy in J/kg/K"),
+    input_pair_info(HmolarQ_INPUTS,"HmolarQ_INPUTS","HQ_INPUTS","Enthalpy in J/mol, Molar quality"),
+    input_pair_info(HmassQ_INPUTS,"HmassQ_INPUTS","HQ_INPUTS","Enthalpy in J/kg, Molar quality"),
     input_pair_info(PQ_INPUTS,"PQ_INPUTS","Pressure in Pa, Molar quality"),
     
     input_pair_info(PT_INPUTS, "PT_INPUTS","Pressure in Pa, Temperature in K"),
@@ -430,6 +432,7 @@ class InputPairInformation
 {
 public:
     std::map<int, std::string> short_desc_map, long_desc_map;
+    std::map<std::string, int> index_map;
     InputPairInformation()
     {
         int N = sizeof(input_pair_list)/sizeof(input_pair_list[0]);
@@ -437,6 +440,9 @@ public:
         {
             short_desc_map.insert(std::pair<int, std::string>(input_pair_list[i].key, input_pair_list[i].short_desc));
             long_desc_map.insert(std::pair<int, std::string>(input_pair_list[i].key, input_pair_list[i].long_desc));
+            index_map.insert(std::pair<std::string, int>(input_pair_list[i].name, input_pair_list[i].key));
+            // A shared short description maps to the first (molar) pair that uses it
+            index_map.insert(std::pair<std::string, int>(input_pair_list[i].short_desc, input_pair_list[i].key));
         }
     }
 };
@@ -451,6 +457,16 @@ std::string get_input_pair_long_desc(int pair)
 {
     return input_pair_information.long_desc_map[pair];
 }
+input_pairs get_input_pair_index(const std::string &input_pair_name)
+{
+    std::map<std::string, int>::iterator it = input_pair_information.index_map.find(input_pair_name);
+    if (it != input_pair_information.index_map.end()){
+        return static_cast<input_pairs>(it->second);
+    }
+    else{
+        throw ValueError(format("Your input pair name [%s] is not valid in get_input_pair_index (names are case sensitive)",input_pair_name.c_str()));
+    }
+}
 
 
 
@@ -496,5 +512,27 @@ TEST_CASE("Check that all phases are descibed","[phase_index]")
     }
 }
 
+TEST_CASE("Check that all input pairs are described","[input_pair_index]")
+{
+    for (int i = 0; i <= CoolProp::DmolarUmolar_INPUTS; ++i){
+        std::ostringstream ss;
+        ss << "Input pair index," << i;
+        SECTION(ss.str(), "")
+        {
+            std::string stringrepr = CoolProp::get_input_pair_short_desc(i);
+            CAPTURE(stringrepr);
+            int key = -1;
+            CHECK_NOTHROW(key = CoolProp::get_input_pair_index(stringrepr));
+            CHECK(CoolProp::get_input_pair_short_desc(key) == stringrepr);
+        }
+    }
+    CHECK(CoolProp::get_input_pair_index("QSmolar_INPUTS") == CoolProp::QSmolar_INPUTS);
+    CHECK(CoolProp::get_input_pair_index("QSmass_INPUTS") == CoolProp::QSmass_INPUTS);
+    CHECK(CoolProp::get_input_pair_index("HmolarQ_INPUTS") == CoolProp::HmolarQ_INPUTS);
+    CHECK(CoolProp::get_input_pair_index("HmassQ_INPUTS") == CoolProp::HmassQ_INPUTS);
+    CHECK(CoolProp::get_input_pair_index("QS_INPUTS") == CoolProp::QSmolar_INPUTS);
+    CHECK_THROWS(CoolProp::get_input_pair_index("PT"));
+}
+
 #endif
 
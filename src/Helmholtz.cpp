@@ -1,12 +1,14 @@
 #include <numeric>
+#include <algorithm>
+#include <cassert>
 #include "Helmholtz.h"
 
 namespace CoolProp{
 
-long double kahanSum(std::vector<long double> &x)
+CoolPropDbl kahanSum(std::vector<CoolPropDbl> &x)
 {
-    long double sum = x[0], y, t;
-    long double c = 0.0;          //A running compensation for lost low-order bits.
+    CoolPropDbl sum = x[0], y, t;
+    CoolPropDbl c = 0.0;          //A running compensation for lost low-order bits.
     for (std::size_t i = 1; i < x.size(); ++i)
     {
         y = x[i] - c;    //So far, so good: c is zero.
@@ -16,7 +18,7 @@ long double kahanSum(std::vector<long double> &x)
     }
     return sum;
 }
-bool wayToSort(long double i, long double j) { return std::abs(i) > std::abs(j); }
+bool wayToSort(CoolPropDbl i, CoolPropDbl j) { return std::abs(i) > std::abs(j); }
 
 // define function to be applied coefficient-wise
 double ramp(double x)
@@ -27,110 +29,244 @@ double ramp(double x)
         return 0;
 }
 
-/*
-void ResidualHelmholtzGeneralizedExponential::allEigen(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw()
+/// The highest power of delta or tau that all() takes from its tables of the integer powers; higher ones are evaluated as exp(k*log(x))
+const int GENERALIZED_EXPONENTIAL_MAX_POWER = 20;
+/// The most exponents of one kind for which all() keeps the powers on the stack
+const int GENERALIZED_EXPONENTIAL_MAX_EXPONENTS = 64;
+
+/// The parts of u that a term has, as the bits of a number, so that the terms with the same parts can be sorted into a group
+static int u_parts(const ResidualHelmholtzGeneralizedExponentialElement &el)
 {
-    double log_tau = log(tau), log_delta = log(delta), 
-           one_over_delta = 1/delta, one_over_tau = 1/tau; // division is much slower than multiplication, so do one division here
-    
-    Eigen::Map<Eigen::ArrayXd> nE(&(n[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> dE(&(d[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> tE(&(t[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> cE(&(c[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXi> l_intE(&(l_int[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> l_doubleE(&(l_double[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> eta1E(&(eta1[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> eta2E(&(eta2[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> epsilon1E(&(epsilon1[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> epsilon2E(&(epsilon2[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> beta1E(&(beta1[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> beta2E(&(beta2[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> gamma1E(&(gamma1[0]), elements.size());
-    Eigen::Map<Eigen::ArrayXd> gamma2E(&(gamma2[0]), elements.size());
+    int parts = 0;
+    if (ValidNumber(el.l_double) && el.l_int > 0 && el.c != 0){ parts |= 1; }
+    if (std::abs(el.m_double) > 0 && el.omega != 0){ parts |= 2; }
+    if (el.eta1 != 0){ parts |= 4; }
+    if (el.eta2 != 0){ parts |= 8; }
+    if (el.beta1 != 0){ parts |= 16; }
+    if (el.beta2 != 0){ parts |= 32; }
+    return parts;
+}
+
+/// The exponent as an integer if its power can be taken from the integer powers, otherwise -1
+static int integer_exponent(CoolPropDbl x)
+{
+    return (x >= 0 && x <= GENERALIZED_EXPONENTIAL_MAX_POWER && x == static_cast<int>(x)) ? static_cast<int>(x) : -1;
+}
+
+/// Add the value x to the exponents that are evaluated
+static void add_exponent_value(ResidualHelmholtzGeneralizedExponential::ExponentTable &table, CoolPropDbl x)
+{
+    table.values.push_back(x);
+    table.integers.push_back(integer_exponent(x));
+    table.max_integer = std::max(table.max_integer, table.integers.back());
+}
+
+/// Add the exponent x of the next term to the table, which shares the value with the terms before it that have the same exponent
+static void add_exponent(ResidualHelmholtzGeneralizedExponential::ExponentTable &table, CoolPropDbl x)
+{
+    std::size_t k = std::find(table.values.begin(), table.values.end(), x) - table.values.begin();
+    if (k == table.values.size()){ add_exponent_value(table, x); }
+    table.index.push_back(static_cast<int>(k));
+}
+
+/// Remove the exponents of a table, before the terms are added to it again
+static void clear_exponents(ResidualHelmholtzGeneralizedExponential::ExponentTable &table)
+{
+    table.values.clear(); table.integers.clear(); table.index.clear(); table.max_integer = 0;
+}
+
+/// The powers of x for all the exponents of the table, from the integer powers of x where the exponents are integers
+static void exponent_powers(const ResidualHelmholtzGeneralizedExponential::ExponentTable &table, const CoolPropDbl *integer_powers, CoolPropDbl log_x, CoolPropDbl *powers)
+{
+    for (std::size_t k = 0; k < table.values.size(); ++k){
+        powers[k] = (table.integers[k] >= 0) ? integer_powers[table.integers[k]] : exp(table.values[k]*log_x);
+    }
+}
+
+/// Storage for the powers of the exponents of a table in all(), which is on the stack unless there are a lot of exponents
+class ExponentPowers{
+public:
+    CoolPropDbl *powers;
+    ExponentPowers(std::size_t N){
+        if (N <= static_cast<std::size_t>(GENERALIZED_EXPONENTIAL_MAX_EXPONENTS)){ powers = stack; }
+        else{ heap.resize(N); powers = &(heap[0]); }
+    };
+private:
+    CoolPropDbl stack[GENERALIZED_EXPONENTIAL_MAX_EXPONENTS];
+    std::vector<CoolPropDbl> heap;
+    ExponentPowers(const ExponentPowers &);
+    ExponentPowers& operator=(const ExponentPowers &);
+};
+
+void ResidualHelmholtzGeneralizedExponential::finish()
+{
+    const std::size_t Nterms = elements.size();
     
-    // ****************************************
-    // The u part in exp(u) and its derivatives
-    // ****************************************
+    // Sort the terms by their parts, and by their order in the elements after that
+    std::vector<std::pair<int, std::size_t> > order(Nterms);
+    for (std::size_t i = 0; i < Nterms; ++i){ order[i] = std::make_pair(u_parts(elements[i]), i); }
+    std::sort(order.begin(), order.end());
     
-    #if defined(EIGEN_VECTORIZE_SSE2)
-        //std::cout << "EIGEN_VECTORIZE_SSE2" << std::endl;
-    #endif
-
-    // Set the u part of exp(u) to zero
-    uE.fill(0);
-    du_ddeltaE.fill(0);
-    du_dtauE.fill(0);
-    d2u_ddelta2E.fill(0);
-    d2u_dtau2E.fill(0);
-    d3u_ddelta3E.fill(0);
-    d3u_dtau3E.fill(0);
+    CoefficientArray *coefficients[] = {&n, &d, &t, &c, &l_double, &omega, &m_double, &eta1, &epsilon1, &eta2, &epsilon2, &beta1, &gamma1, &beta2, &gamma2};
+    for (std::size_t k = 0; k < sizeof(coefficients)/sizeof(coefficients[0]); ++k){ coefficients[k]->resize(Nterms); }
     
-    if (delta_li_in_u){
-        Eigen::ArrayXd u_increment = -cE*(log_delta*l_doubleE).exp(); //pow(delta,L) -> exp(L*log(delta))
-        uE += u_increment;
-        du_ddeltaE += l_doubleE*u_increment*one_over_delta;
-        d2u_ddelta2E += (l_doubleE-1)*l_doubleE*u_increment*one_over_delta*one_over_delta;
-        d3u_ddelta3E += (l_doubleE-2)*(l_doubleE-1)*l_doubleE*u_increment*one_over_delta*one_over_delta*one_over_delta;
+    groups.clear();
+    clear_exponents(d_exponents); clear_exponents(t_exponents); clear_exponents(cl_l);
+    cl_c.clear();
+    for (std::size_t i = 0; i < Nterms; ++i)
+    {
+        const ResidualHelmholtzGeneralizedExponentialElement &el = elements[order[i].second];
+        n[i] = el.n; d[i] = el.d; t[i] = el.t; c[i] = el.c; l_double[i] = el.l_double; omega[i] = el.omega; m_double[i] = el.m_double;
+        eta1[i] = el.eta1; epsilon1[i] = el.epsilon1; eta2[i] = el.eta2; epsilon2[i] = el.epsilon2;
+        beta1[i] = el.beta1; gamma1[i] = el.gamma1; beta2[i] = el.beta2; gamma2[i] = el.gamma2;
+        
+        int parts = order[i].first;
+        if (i == 0 || parts != order[i-1].first){
+            TermGroup group;
+            group.start = i; group.N = 0;
+            group.delta_li_in_u = (parts & 1) != 0; group.tau_mi_in_u = (parts & 2) != 0;
+            group.eta1_in_u = (parts & 4) != 0; group.eta2_in_u = (parts & 8) != 0;
+            group.beta1_in_u = (parts & 16) != 0; group.beta2_in_u = (parts & 32) != 0;
+            groups.push_back(group);
+        }
+        ++groups.back().N;
+        
+        // Classify the exponents, so that all() evaluates the powers once for all the terms that have the same exponent
+        add_exponent(d_exponents, d[i]);
+        add_exponent(t_exponents, t[i]);
+        if (parts & 1){
+            std::size_t k = 0;
+            while (k < cl_c.size() && !(cl_c[k] == c[i] && cl_l.values[k] == l_double[i])){ ++k; }
+            if (k == cl_c.size()){
+                // A new pair; its l_i goes into the values even if another pair has the same l_i
+                cl_c.push_back(c[i]);
+                add_exponent_value(cl_l, l_double[i]);
+            }
+            cl_l.index.push_back(static_cast<int>(k));
+        }
+        else{
+            cl_l.index.push_back(-1);
+        }
     }
+    finished = true;
+}
+
+void ResidualHelmholtzGeneralizedExponential::all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags) throw()
+{
+    // finish() is called when the terms are loaded, since all() is called from several threads at once on the terms of a fluid
+    assert(finished);
     
-//    if (tau_mi_in_u){
-//        long double omegai = el.omega, m_double = el.m_double;
-//        if (std::abs(m_double) > 0){
-//            long double u_increment = -omegai*pow(tau, m_double);
-//            long double du_dtau_increment = m_double*u_increment*one_over_tau;
-//            long double d2u_dtau2_increment = (m_double-1)*du_dtau_increment*one_over_tau;
-//            long double d3u_dtau3_increment = (m_double-2)*d2u_dtau2_increment*one_over_tau;
-//            u += u_increment;
-//            du_dtau += du_dtau_increment;
-//            d2u_dtau2 += d2u_dtau2_increment;
-//            d3u_dtau3 += d3u_dtau3_increment;
-//        }
-//    }
-    if (eta1_in_u){
-        uE += -eta1E*(delta-epsilon1E);
-        du_ddeltaE += -eta1E;
-    }
-    if (eta2_in_u){
-        uE += -eta2E*POW2(delta-epsilon2E);
-        du_ddeltaE += -2*eta2E*(delta-epsilon2E);
-        d2u_ddelta2E += -2*eta2E;
-    }
-    if (beta1_in_u){
-        uE += -beta1E*(tau-gamma1E);
-        du_dtauE += -beta1E;
-    }
-    if (beta2_in_u){
-        uE += -beta2E*POW2(tau-gamma2E);
-        du_dtauE += -2*beta2E*(tau-gamma2E);
-        d2u_dtau2E += -2*beta2E;
-    }
+    // The highest orders in delta and tau of the derivatives that are wanted; the derivatives of u above them are not needed
+    const int delta_order = (flags & ALPHAR_DDELTA3) ? 3 : ((flags & (ALPHAR_DDELTA2|ALPHAR_DDELTA2_DTAU)) ? 2 : ((flags & (ALPHAR_DDELTA|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA_DTAU2)) ? 1 : 0));
+    const int tau_order = (flags & ALPHAR_DTAU3) ? 3 : ((flags & (ALPHAR_DTAU2|ALPHAR_DDELTA_DTAU2)) ? 2 : ((flags & (ALPHAR_DTAU|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA2_DTAU)) ? 1 : 0));
     
-    Eigen::ArrayXd ndteuE = nE*exp(tE*log_tau + dE*log_delta + uE);
-    Eigen::ArrayXd B_deltaE = delta*du_ddeltaE + dE;
-    Eigen::ArrayXd B_tauE = tau*du_dtauE + tE;
-    Eigen::ArrayXd B_delta2E = POW2(delta)*(d2u_ddelta2E + du_ddeltaE.square()) + 2*dE*delta*du_ddeltaE + dE*(dE-1);
-    Eigen::ArrayXd B_tau2E = POW2(tau)*(d2u_dtau2E + du_dtauE.square()) + 2*tE*tau*du_dtauE + tE*(tE-1);
-    Eigen::ArrayXd B_delta3E = POW3(delta)*d3u_ddelta3E + 3*dE*POW2(delta)*d2u_ddelta2E+3*POW3(delta)*d2u_ddelta2E*du_ddeltaE+3*dE*POW2(delta*du_ddeltaE)+3*dE*(dE-1)*delta*du_ddeltaE+dE*(dE-1)*(dE-2)+POW3(delta*du_ddeltaE);
-    Eigen::ArrayXd B_tau3E = POW3(tau)*d3u_dtau3E + 3*tE*POW2(tau)*d2u_dtau2E+3*POW3(tau)*d2u_dtau2E*du_dtauE+3*tE*POW2(tau*du_dtauE)+3*tE*(tE-1)*tau*du_dtauE+tE*(tE-1)*(tE-2)+POW3(tau*du_dtauE);
+    const CoolPropDbl tau_ = tau, delta_ = delta, log_tau = log(tau_), log_delta = log(delta_), 
+                 one_over_delta = 1/delta_, one_over_tau = 1/tau_; // division is much slower than multiplication, so do one division here
+    CoolPropDbl alphar = 0, dalphar_ddelta = 0, dalphar_dtau = 0, d2alphar_ddelta2 = 0, d2alphar_dtau2 = 0, d2alphar_ddelta_dtau = 0,
+           d3alphar_ddelta3 = 0, d3alphar_dtau3 = 0, d3alphar_ddelta2_dtau = 0, d3alphar_ddelta_dtau2 = 0;
     
-    derivs.alphar                +=  ndteuE.sum();
-    derivs.dalphar_ddelta        += (ndteuE*B_deltaE).sum()*one_over_delta;
-    derivs.dalphar_dtau          += (ndteuE*B_tauE).sum()*one_over_tau;
-    derivs.d2alphar_ddelta2      += (ndteuE*B_delta2E).sum()*POW2(one_over_delta);
-    derivs.d2alphar_dtau2        += (ndteuE*B_tau2E).sum()*POW2(one_over_tau);
-    derivs.d2alphar_ddelta_dtau  += (ndteuE*B_deltaE*B_tauE).sum()*one_over_delta*one_over_tau;
+    // The integer powers of delta and tau by multiplication rather than as exp(k*log(x)), which loses several digits at low density where log(delta) is large
+    CoolPropDbl delta_int_powers[GENERALIZED_EXPONENTIAL_MAX_POWER+1], tau_int_powers[GENERALIZED_EXPONENTIAL_MAX_POWER+1];
+    delta_int_powers[0] = 1; tau_int_powers[0] = 1;
+    for (int k = 1; k <= std::max(d_exponents.max_integer, cl_l.max_integer); ++k){ delta_int_powers[k] = delta_int_powers[k-1]*delta_; }
+    for (int k = 1; k <= t_exponents.max_integer; ++k){ tau_int_powers[k] = tau_int_powers[k-1]*tau_; }
     
-    derivs.d3alphar_ddelta3      += (ndteuE*B_delta3E).sum()*POW3(one_over_delta);
-    derivs.d3alphar_dtau3        += (ndteuE*B_tau3E).sum()*POW3(one_over_tau);
-    derivs.d3alphar_ddelta2_dtau += (ndteuE*B_delta2E*B_tauE).sum()*POW2(one_over_delta)*one_over_tau;
-    derivs.d3alphar_ddelta_dtau2 += (ndteuE*B_deltaE*B_tau2E).sum()*one_over_delta*POW2(one_over_tau);
+    // delta^d_i, tau^t_i, -c_i*delta^l_i and exp(-c_i*delta^l_i) once for each exponent, or pair (c_i, l_i), that the terms have
+    ExponentPowers delta_d(d_exponents.values.size()), tau_t(t_exponents.values.size()), c_delta_l(cl_c.size()), exp_c_delta_l(cl_c.size());
+    exponent_powers(d_exponents, delta_int_powers, log_delta, delta_d.powers);
+    exponent_powers(t_exponents, tau_int_powers, log_tau, tau_t.powers);
+    exponent_powers(cl_l, delta_int_powers, log_delta, c_delta_l.powers);
+    for (std::size_t k = 0; k < cl_c.size(); ++k){
+        c_delta_l.powers[k] *= -cl_c[k];
+        exp_c_delta_l.powers[k] = exp(c_delta_l.powers[k]);
+    }
     
-    return;
-};
-*/
-void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw()
+    for (std::size_t k = 0; k < groups.size(); ++k)
+    {
+        const TermGroup &g = groups[k];
+        // The terms of the group one at a time, with the powers that they share; Eigen array expressions over the terms, even in
+        // SIMD lanes of double, are slower than this loop, so no build evaluates the terms in lanes
+        for (std::size_t i = g.start; i < g.start + g.N; ++i)
+        {
+            const CoolPropDbl di = d[i], ti = t[i];
+            CoolPropDbl u = 0, du_ddelta = 0, du_dtau = 0, d2u_ddelta2 = 0, d2u_dtau2 = 0, d3u_ddelta3 = 0, d3u_dtau3 = 0;
+            CoolPropDbl ndteu = tau_t.powers[t_exponents.index[i]];
+            
+            if (g.delta_li_in_u){
+                const int pair = cl_l.index[i];
+                ndteu *= exp_c_delta_l.powers[pair];
+                if (delta_order >= 1){ du_ddelta = l_double[i]*c_delta_l.powers[pair]*one_over_delta; }
+                if (delta_order >= 2){ d2u_ddelta2 = (l_double[i]-1)*du_ddelta*one_over_delta; }
+                if (delta_order >= 3){ d3u_ddelta3 = (l_double[i]-2)*d2u_ddelta2*one_over_delta; }
+            }
+            if (g.tau_mi_in_u){
+                du_dtau = -omega[i]*exp(m_double[i]*log_tau);
+                u += du_dtau;
+                if (tau_order >= 1){ du_dtau *= m_double[i]*one_over_tau; }
+                if (tau_order >= 2){ d2u_dtau2 = (m_double[i]-1)*du_dtau*one_over_tau; }
+                if (tau_order >= 3){ d3u_dtau3 = (m_double[i]-2)*d2u_dtau2*one_over_tau; }
+            }
+            if (g.eta1_in_u){
+                u -= eta1[i]*(delta_-epsilon1[i]);
+                du_ddelta -= eta1[i];
+            }
+            if (g.eta2_in_u){
+                u -= eta2[i]*POW2(delta_-epsilon2[i]);
+                du_ddelta -= 2*eta2[i]*(delta_-epsilon2[i]);
+                d2u_ddelta2 -= 2*eta2[i];
+            }
+            if (g.beta1_in_u){
+                u -= beta1[i]*(tau_-gamma1[i]);
+                du_dtau -= beta1[i];
+            }
+            if (g.beta2_in_u){
+                u -= beta2[i]*POW2(tau_-gamma2[i]);
+                du_dtau -= 2*beta2[i]*(tau_-gamma2[i]);
+                d2u_dtau2 -= 2*beta2[i];
+            }
+            
+            if (g.tau_mi_in_u || g.eta1_in_u || g.eta2_in_u || g.beta1_in_u || g.beta2_in_u){ ndteu *= exp(u); }
+            ndteu *= n[i]*delta_d.powers[d_exponents.index[i]];
+            CoolPropDbl B_delta = 0, B_tau = 0, B_delta2 = 0, B_tau2 = 0;
+            if (flags & (ALPHAR_DDELTA|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA_DTAU2)){ B_delta = delta_*du_ddelta + di; }
+            if (flags & (ALPHAR_DTAU|ALPHAR_DDELTA_DTAU|ALPHAR_DDELTA2_DTAU)){ B_tau = tau_*du_dtau + ti; }
+            if (flags & (ALPHAR_DDELTA2|ALPHAR_DDELTA2_DTAU)){ B_delta2 = POW2(delta_)*(d2u_ddelta2 + POW2(du_ddelta)) + 2*di*delta_*du_ddelta + di*(di-1); }
+            if (flags & (ALPHAR_DTAU2|ALPHAR_DDELTA_DTAU2)){ B_tau2 = POW2(tau_)*(d2u_dtau2 + POW2(du_dtau)) + 2*ti*tau_*du_dtau + ti*(ti-1); }
+            
+            if (flags & ALPHAR_BASE){ alphar += ndteu; }
+            if (flags & ALPHAR_DDELTA){ dalphar_ddelta += ndteu*B_delta; }
+            if (flags & ALPHAR_DTAU){ dalphar_dtau += ndteu*B_tau; }
+            if (flags & ALPHAR_DDELTA2){ d2alphar_ddelta2 += ndteu*B_delta2; }
+            if (flags & ALPHAR_DTAU2){ d2alphar_dtau2 += ndteu*B_tau2; }
+            if (flags & ALPHAR_DDELTA_DTAU){ d2alphar_ddelta_dtau += ndteu*B_delta*B_tau; }
+            if (flags & ALPHAR_DDELTA3){
+                d3alphar_ddelta3 += ndteu*(POW3(delta_)*d3u_ddelta3 + 3*di*POW2(delta_)*d2u_ddelta2 + 3*POW3(delta_)*d2u_ddelta2*du_ddelta + 3*di*POW2(delta_*du_ddelta)
+                                           + 3*di*(di-1)*delta_*du_ddelta + di*(di-1)*(di-2) + POW3(delta_*du_ddelta));
+            }
+            if (flags & ALPHAR_DTAU3){
+                d3alphar_dtau3 += ndteu*(POW3(tau_)*d3u_dtau3 + 3*ti*POW2(tau_)*d2u_dtau2 + 3*POW3(tau_)*d2u_dtau2*du_dtau + 3*ti*POW2(tau_*du_dtau)
+                                         + 3*ti*(ti-1)*tau_*du_dtau + ti*(ti-1)*(ti-2) + POW3(tau_*du_dtau));
+            }
+            if (flags & ALPHAR_DDELTA2_DTAU){ d3alphar_ddelta2_dtau += ndteu*B_delta2*B_tau; }
+            if (flags & ALPHAR_DDELTA_DTAU2){ d3alphar_ddelta_dtau2 += ndteu*B_delta*B_tau2; }
+        }
+    }
+    derivs.alphar                += alphar;
+    derivs.dalphar_ddelta        += dalphar_ddelta*one_over_delta;
+    derivs.dalphar_dtau          += dalphar_dtau*one_over_tau;
+    derivs.d2alphar_ddelta2      += d2alphar_ddelta2*POW2(one_over_delta);
+    derivs.d2alphar_dtau2        += d2alphar_dtau2*POW2(one_over_tau);
+    derivs.d2alphar_ddelta_dtau  += d2alphar_ddelta_dtau*one_over_delta*one_over_tau;
+    
+    derivs.d3alphar_ddelta3      += d3alphar_ddelta3*POW3(one_over_delta);
+    derivs.d3alphar_dtau3        += d3alphar_dtau3*POW3(one_over_tau);
+    derivs.d3alphar_ddelta2_dtau += d3alphar_ddelta2_dtau*POW2(one_over_delta)*one_over_tau;
+    derivs.d3alphar_ddelta_dtau2 += d3alphar_ddelta_dtau2*one_over_delta*POW2(one_over_tau);
+}
+
+void ResidualHelmholtzGeneralizedExponential::all_scalar(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs) throw()
 {
-    long double log_tau = log(tau), log_delta = log(delta), ndteu, 
+    CoolPropDbl log_tau = log(tau), log_delta = log(delta), ndteu, 
                 one_over_delta = 1/delta, one_over_tau = 1/tau; // division is much slower than multiplication, so do one division here
     
     // Maybe split the construction of u and other parts into two separate loops?  
@@ -139,25 +275,25 @@ void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const
     for (std::size_t i = 0; i < N; ++i)
     {
         ResidualHelmholtzGeneralizedExponentialElement &el = elements[i];
-        long double ni = el.n, di = el.d, ti = el.t;
+        CoolPropDbl ni = el.n, di = el.d, ti = el.t;
         
         // Set the u part of exp(u) to zero
-        long double u = 0;
-        long double du_ddelta = 0;
-        long double du_dtau = 0;
-        long double d2u_ddelta2 = 0;
-        long double d2u_dtau2 = 0;
-        long double d3u_ddelta3 = 0;
-        long double d3u_dtau3 = 0;
+        CoolPropDbl u = 0;
+        CoolPropDbl du_ddelta = 0;
+        CoolPropDbl du_dtau = 0;
+        CoolPropDbl d2u_ddelta2 = 0;
+        CoolPropDbl d2u_dtau2 = 0;
+        CoolPropDbl d3u_ddelta3 = 0;
+        CoolPropDbl d3u_dtau3 = 0;
         
         if (delta_li_in_u){
-            long double  ci = el.c, l_double = el.l_double;
+            CoolPropDbl  ci = el.c, l_double = el.l_double;
             int l_int = el.l_int;
             if (ValidNumber(l_double) && l_int > 0){
-                long double u_increment = -ci*pow(delta, l_int);
-                long double du_ddelta_increment = l_double*u_increment*one_over_delta;
-                long double d2u_ddelta2_increment = (l_double-1)*du_ddelta_increment*one_over_delta;
-                long double d3u_ddelta3_increment = (l_double-2)*d2u_ddelta2_increment*one_over_delta;
+                CoolPropDbl u_increment = -ci*pow(delta, l_int);
+                CoolPropDbl du_ddelta_increment = l_double*u_increment*one_over_delta;
+                CoolPropDbl d2u_ddelta2_increment = (l_double-1)*du_ddelta_increment*one_over_delta;
+                CoolPropDbl d3u_ddelta3_increment = (l_double-2)*d2u_ddelta2_increment*one_over_delta;
                 u += u_increment;
                 du_ddelta += du_ddelta_increment;
                 d2u_ddelta2 += d2u_ddelta2_increment;
@@ -165,12 +301,12 @@ void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const
             }
         }
         if (tau_mi_in_u){
-            long double omegai = el.omega, m_double = el.m_double;
+            CoolPropDbl omegai = el.omega, m_double = el.m_double;
             if (std::abs(m_double) > 0){
-                long double u_increment = -omegai*pow(tau, m_double);
-                long double du_dtau_increment = m_double*u_increment*one_over_tau;
-                long double d2u_dtau2_increment = (m_double-1)*du_dtau_increment*one_over_tau;
-                long double d3u_dtau3_increment = (m_double-2)*d2u_dtau2_increment*one_over_tau;
+                CoolPropDbl u_increment = -omegai*pow(tau, m_double);
+                CoolPropDbl du_dtau_increment = m_double*u_increment*one_over_tau;
+                CoolPropDbl d2u_dtau2_increment = (m_double-1)*du_dtau_increment*one_over_tau;
+                CoolPropDbl d3u_dtau3_increment = (m_double-2)*d2u_dtau2_increment*one_over_tau;
                 u += u_increment;
                 du_dtau += du_dtau_increment;
                 d2u_dtau2 += d2u_dtau2_increment;
@@ -178,14 +314,14 @@ void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const
             }
         }
         if (eta1_in_u){
-            long double eta1 = el.eta1, epsilon1 = el.epsilon1;
+            CoolPropDbl eta1 = el.eta1, epsilon1 = el.epsilon1;
             if (ValidNumber(eta1)){
                 u += -eta1*(delta-epsilon1);
                 du_ddelta += -eta1;
             }
         }
         if (eta2_in_u){
-            long double eta2 = el.eta2, epsilon2 = el.epsilon2;
+            CoolPropDbl eta2 = el.eta2, epsilon2 = el.epsilon2;
             if (ValidNumber(eta2)){
                 u += -eta2*POW2(delta-epsilon2);
                 du_ddelta += -2*eta2*(delta-epsilon2);
@@ -193,14 +329,14 @@ void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const
             }
         }
         if (beta1_in_u){
-            long double beta1 = el.beta1, gamma1 = el.gamma1;
+            CoolPropDbl beta1 = el.beta1, gamma1 = el.gamma1;
             if (ValidNumber(beta1)){
                 u += -beta1*(tau-gamma1);
                 du_dtau += -beta1;
             }
         }
         if (beta2_in_u){
-            long double beta2 = el.beta2, gamma2 = el.gamma2;
+            CoolPropDbl beta2 = el.beta2, gamma2 = el.gamma2;
             if (ValidNumber(beta2)){
                 u += -beta2*POW2(tau-gamma2);
                 du_dtau += -2*beta2*(tau-gamma2);
@@ -210,12 +346,12 @@ void ResidualHelmholtzGeneralizedExponential::all(const long double &tau, const
         
         ndteu = ni*exp(ti*log_tau+di*log_delta+u);
         
-        long double B_delta = (delta*du_ddelta + di);
-        long double B_tau = (tau*du_dtau + ti);
-        long double B_delta2 = (POW2(delta)*(d2u_ddelta2 + POW2(du_ddelta)) + 2*di*delta*du_ddelta + di*(di-1));
-        long double B_tau2 = (POW2(tau)*(d2u_dtau2 + POW2(du_dtau)) + 2*ti*tau*du_dtau + ti*(ti-1));
-        long double B_delta3 = POW3(delta)*d3u_ddelta3 + 3*di*POW2(delta)*d2u_ddelta2+3*POW3(delta)*d2u_ddelta2*du_ddelta+3*di*POW2(delta*du_ddelta)+3*di*(di-1)*delta*du_ddelta+di*(di-1)*(di-2)+POW3(delta*du_ddelta);
-        long double B_tau3 = POW3(tau)*d3u_dtau3 + 3*ti*POW2(tau)*d2u_dtau2+3*POW3(tau)*d2u_dtau2*du_dtau+3*ti*POW2(tau*du_dtau)+3*ti*(ti-1)*tau*du_dtau+ti*(ti-1)*(ti-2)+POW3(tau*du_dtau);
+        CoolPropDbl B_delta = (delta*du_ddelta + di);
+        CoolPropDbl B_tau = (tau*du_dtau + ti);
+        CoolPropDbl B_delta2 = (POW2(delta)*(d2u_ddelta2 + POW2(du_ddelta)) + 2*di*delta*du_ddelta + di*(di-1));
+        CoolPropDbl B_tau2 = (POW2(tau)*(d2u_dtau2 + POW2(du_dtau)) + 2*ti*tau*du_dtau + ti*(ti-1));
+        CoolPropDbl B_delta3 = POW3(delta)*d3u_ddelta3 + 3*di*POW2(delta)*d2u_ddelta2+3*POW3(delta)*d2u_ddelta2*du_ddelta+3*di*POW2(delta*du_ddelta)+3*di*(di-1)*delta*du_ddelta+di*(di-1)*(di-2)+POW3(delta*du_ddelta);
+        CoolPropDbl B_tau3 = POW3(tau)*d3u_dtau3 + 3*ti*POW2(tau)*d2u_dtau2+3*POW3(tau)*d2u_dtau2*du_dtau+3*ti*POW2(tau*du_dtau)+3*ti*(ti-1)*tau*du_dtau+ti*(ti-1)*(ti-2)+POW3(tau*du_dtau);
         
         derivs.alphar += ndteu;
         
@@ -276,110 +412,121 @@ void ResidualHelmholtzNonAnalytic::to_json(rapidjson::Value &el, rapidjson::Docu
     el.AddMember("D",_D,doc.GetAllocator());
 }
 
-void ResidualHelmholtzNonAnalytic::all(const long double &tau, const long double &delta, HelmholtzDerivatives &derivs) throw()
+void ResidualHelmholtzNonAnalytic::all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs, int flags) throw()
 {
     if (N==0){return;}
+    // The intermediates of the second and third derivatives are only evaluated if a derivative of that order is wanted
+    const bool second_order = (flags & ~ALPHAR_UP_TO_FIRST_ORDER) != 0, third_order = (flags & ~ALPHAR_UP_TO_SECOND_ORDER) != 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double theta = (1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl theta = (1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
         
-        long double PSI = exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta = -2.0*Ci*(delta-1.0)*PSI;
-        long double dPSI_dTau = -2.0*Di*(tau-1.0)*PSI;
-        long double dPSI2_dDelta2 = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
-        long double dPSI2_dDelta_dTau = 4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
-        long double dPSI2_dTau2 = (2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
-        long double dPSI3_dDelta3 = 2.0*Ci*PSI*(-4*Ci*Ci*pow(delta-1.0,3)+6*Ci*(delta-1));
-        long double dPSI3_dDelta2_dTau = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*dPSI_dTau;
-        long double dPSI3_dDelta_dTau2 = 2*Di*(2*Di*pow(tau-1,2)-1)*dPSI_dDelta;
-        long double dPSI3_dTau3 = 2.0*Di*PSI*(-4*Di*Di*pow(tau-1,3)+6*Di*(tau-1));
+        CoolPropDbl PSI = exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta = -2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dPSI_dTau = -2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dPSI2_dDelta2 = 0, dPSI2_dDelta_dTau = 0, dPSI2_dTau2 = 0, dPSI3_dDelta3 = 0, dPSI3_dDelta2_dTau = 0, dPSI3_dDelta_dTau2 = 0, dPSI3_dTau3 = 0;
+        if (second_order){
+            dPSI2_dDelta2 = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
+            dPSI2_dDelta_dTau = 4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
+            dPSI2_dTau2 = (2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
+        }
+        if (third_order){
+            dPSI3_dDelta3 = 2.0*Ci*PSI*(-4*Ci*Ci*pow(delta-1.0,3)+6*Ci*(delta-1));
+            dPSI3_dDelta2_dTau = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*dPSI_dTau;
+            dPSI3_dDelta_dTau2 = 2*Di*(2*Di*pow(tau-1,2)-1)*dPSI_dDelta;
+            dPSI3_dTau3 = 2.0*Di*PSI*(-4*Di*Di*pow(tau-1,3)+6*Di*(tau-1));
+        }
         
-        long double DELTA = pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double dDELTA_dTau = -2*theta;
-        long double dDELTA2_dDelta_dTau = 2.0*Ai/(betai)*pow(pow(delta-1,2),1.0/(2.0*betai)-0.5);
-        long double dDELTA_dDelta = (delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
-        long double dDELTA3_dDelta2_dTau = 2.0*Ai*(betai-1)/(betai*betai)*pow(pow(delta-1,2),1/(2*betai)-1.0);
+        CoolPropDbl DELTA = pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl dDELTA_dTau = -2*theta;
+        CoolPropDbl dDELTA_dDelta = (delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
         
-        long double dDELTAbi_dDelta, dDELTA2_dDelta2, dDELTAbi2_dDelta2, dDELTAbi3_dDelta3, dDELTA3_dDelta3;
-        if (std::abs(delta-1) < 10*DBL_EPSILON){
-            dDELTAbi_dDelta = 0;
-            dDELTA2_dDelta2 = 0;
-            dDELTA3_dDelta3 = 0;
-            dDELTAbi2_dDelta2 = 0;
-            dDELTAbi3_dDelta3 = 0;
-        }
-        else{
+        CoolPropDbl dDELTAbi_dDelta = 0, dDELTA2_dDelta2 = 0, dDELTAbi2_dDelta2 = 0, dDELTAbi3_dDelta3 = 0, dDELTA3_dDelta3 = 0;
+        if (std::abs(delta-1) >= 10*DBL_EPSILON){
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
-            long double dDELTA_dDelta_over_delta_minus_1=(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
-            dDELTA2_dDelta2 = dDELTA_dDelta_over_delta_minus_1+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
-            long double PI = 4*Bi*ai*(ai-1)*pow(pow(delta-1,2),ai-2)+2*pow(Ai/betai,2)*pow(pow(delta-1,2),1/betai-2)+4*Ai*theta/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2);
-            long double dPI_dDelta = -8*Bi*ai*(ai-1)*(ai-2)*pow(pow(delta-1,2),ai-5.0/2.0)-8*pow(Ai/betai,2)*(1/(2*betai)-1)*pow(pow(delta-1,2),1/betai-5.0/2.0)-(8*Ai*theta)/betai*(1/(2*betai)-1)*(1/(2*betai)-2)*pow(pow(delta-1,2),1/(2*betai)-5.0/2.0)+4*Ai/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2)*dtheta_dDelta;
-            dDELTA3_dDelta3 = 1/(delta-1)*dDELTA2_dDelta2-1/pow(delta-1,2)*dDELTA_dDelta+pow(delta-1,2)*dPI_dDelta+2*(delta-1)*PI;
-            dDELTAbi2_dDelta2 = bi*(pow(DELTA,bi-1)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
-            dDELTAbi3_dDelta3 = bi*(pow(DELTA,bi-1)*dDELTA3_dDelta3+dDELTA2_dDelta2*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+(bi-1)*(pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta2+pow(dDELTA_dDelta,2)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta));
+            if (second_order){
+                CoolPropDbl dDELTA_dDelta_over_delta_minus_1=(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+                dDELTA2_dDelta2 = dDELTA_dDelta_over_delta_minus_1+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
+                dDELTAbi2_dDelta2 = bi*(pow(DELTA,bi-1)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
+            }
+            if (third_order){
+                CoolPropDbl PI = 4*Bi*ai*(ai-1)*pow(pow(delta-1,2),ai-2)+2*pow(Ai/betai,2)*pow(pow(delta-1,2),1/betai-2)+4*Ai*theta/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2);
+                CoolPropDbl dPI_dDelta = -8*Bi*ai*(ai-1)*(ai-2)*pow(pow(delta-1,2),ai-5.0/2.0)-8*pow(Ai/betai,2)*(1/(2*betai)-1)*pow(pow(delta-1,2),1/betai-5.0/2.0)-(8*Ai*theta)/betai*(1/(2*betai)-1)*(1/(2*betai)-2)*pow(pow(delta-1,2),1/(2*betai)-5.0/2.0)+4*Ai/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2)*dtheta_dDelta;
+                dDELTA3_dDelta3 = 1/(delta-1)*dDELTA2_dDelta2-1/pow(delta-1,2)*dDELTA_dDelta+pow(delta-1,2)*dPI_dDelta+2*(delta-1)*PI;
+                dDELTAbi3_dDelta3 = bi*(pow(DELTA,bi-1)*dDELTA3_dDelta3+dDELTA2_dDelta2*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+(bi-1)*(pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta2+pow(dDELTA_dDelta,2)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta));
+            }
         }
         
-        long double dDELTAbi_dTau = -2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl DELTAbi = pow(DELTA, bi);
+        CoolPropDbl dDELTAbi_dTau = -2.0*theta*bi*pow(DELTA,bi-1.0);
         
-        long double dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
-        long double dDELTAbi2_dTau2 = 2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
-        long double dDELTAbi3_dTau3 = -12.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2)-8*pow(theta,3)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3);
-        long double dDELTAbi3_dDelta_dTau2 = 2*bi*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+4*pow(theta,2)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta+8*theta*bi*(bi-1)*pow(DELTA,bi-2)*dtheta_dDelta;
-        long double dDELTAbi3_dDelta2_dTau = bi*((bi-1)*pow(DELTA,bi-2)*dDELTA_dTau*dDELTA2_dDelta2 + pow(DELTA,bi-1)*dDELTA3_dDelta2_dTau+(bi-1)*((bi-2)*pow(DELTA,bi-3)*dDELTA_dTau*pow(dDELTA_dDelta,2)+pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta_dTau));
+        if (flags & ALPHAR_BASE){ derivs.alphar += ni*DELTAbi*delta*PSI; }
+        if (flags & ALPHAR_DDELTA){ derivs.dalphar_ddelta += ni*(DELTAbi*(PSI+delta*dPSI_dDelta)+dDELTAbi_dDelta*delta*PSI); }
+        if (flags & ALPHAR_DTAU){ derivs.dalphar_dtau += ni*delta*(dDELTAbi_dTau*PSI+DELTAbi*dPSI_dTau); }
+        if (!second_order){ continue; }
         
-        derivs.alphar += ni*pow(DELTA, bi)*delta*PSI;
+        CoolPropDbl dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
+        CoolPropDbl dDELTAbi2_dTau2 = 2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
         
-        derivs.dalphar_ddelta += ni*(pow(DELTA,bi)*(PSI+delta*dPSI_dDelta)+dDELTAbi_dDelta*delta*PSI);
-        derivs.dalphar_dtau += ni*delta*(dDELTAbi_dTau*PSI+pow(DELTA,bi)*dPSI_dTau);
+        if (flags & ALPHAR_DDELTA2){ derivs.d2alphar_ddelta2 += ni*(DELTAbi*(2.0*dPSI_dDelta+delta*dPSI2_dDelta2)+2.0*dDELTAbi_dDelta*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta2*delta*PSI); }
+        if (flags & ALPHAR_DDELTA_DTAU){ derivs.d2alphar_ddelta_dtau += ni*(DELTAbi*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+delta*dDELTAbi_dDelta*dPSI_dTau+ dDELTAbi_dTau*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta_dTau*delta*PSI); }
+        if (flags & ALPHAR_DTAU2){ derivs.d2alphar_dtau2 += ni*delta*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+DELTAbi*dPSI2_dTau2); }
+        if (!third_order){ continue; }
         
-        derivs.d2alphar_ddelta2 += ni*(pow(DELTA,bi)*(2.0*dPSI_dDelta+delta*dPSI2_dDelta2)+2.0*dDELTAbi_dDelta*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta2*delta*PSI);
-        derivs.d2alphar_ddelta_dtau += ni*(pow(DELTA,bi)*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+delta*dDELTAbi_dDelta*dPSI_dTau+ dDELTAbi_dTau*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta_dTau*delta*PSI);
-        derivs.d2alphar_dtau2 += ni*delta*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
+        CoolPropDbl dDELTA2_dDelta_dTau = 2.0*Ai/(betai)*pow(pow(delta-1,2),1.0/(2.0*betai)-0.5);
+        CoolPropDbl dDELTA3_dDelta2_dTau = 2.0*Ai*(betai-1)/(betai*betai)*pow(pow(delta-1,2),1/(2*betai)-1.0);
+        CoolPropDbl dDELTAbi3_dTau3 = -12.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2)-8*pow(theta,3)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3);
+        CoolPropDbl dDELTAbi3_dDelta_dTau2 = 2*bi*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+4*pow(theta,2)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta+8*theta*bi*(bi-1)*pow(DELTA,bi-2)*dtheta_dDelta;
+        CoolPropDbl dDELTAbi3_dDelta2_dTau = bi*((bi-1)*pow(DELTA,bi-2)*dDELTA_dTau*dDELTA2_dDelta2 + pow(DELTA,bi-1)*dDELTA3_dDelta2_dTau+(bi-1)*((bi-2)*pow(DELTA,bi-3)*dDELTA_dTau*pow(dDELTA_dDelta,2)+pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta_dTau));
         
-        derivs.d3alphar_ddelta3 += ni*(pow(DELTA,bi)*(3.0*dPSI2_dDelta2+delta*dPSI3_dDelta3)+3.0*dDELTAbi_dDelta*(2*dPSI_dDelta+delta*dPSI2_dDelta2)+3*dDELTAbi2_dDelta2*(PSI+delta*dPSI_dDelta)+dDELTAbi3_dDelta3*PSI*delta);
-        long double Line1 = pow(DELTA,bi)*(2*dPSI2_dDelta_dTau+delta*dPSI3_dDelta2_dTau)+dDELTAbi_dTau*(2*dPSI_dDelta+delta*dPSI2_dDelta2);
-        long double Line2 = 2*dDELTAbi_dDelta*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+2*dDELTAbi2_dDelta_dTau*(PSI+delta*dPSI_dDelta);
-        long double Line3 = dDELTAbi2_dDelta2*delta*dPSI_dTau + dDELTAbi3_dDelta2_dTau*delta*PSI;
-        derivs.d3alphar_ddelta2_dtau += ni*(Line1+Line2+Line3);
-        derivs.d3alphar_ddelta_dtau2 += ni*delta*(dDELTAbi2_dTau2*dPSI_dDelta+dDELTAbi3_dDelta_dTau2*PSI+2*dDELTAbi_dTau*dPSI2_dDelta_dTau+2.0*dDELTAbi2_dDelta_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI3_dDelta_dTau2+dDELTAbi_dDelta*dPSI2_dTau2)+ni*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
-        derivs.d3alphar_dtau3 += ni*delta*(dDELTAbi3_dTau3*PSI+(3.0*dDELTAbi2_dTau2)*dPSI_dTau+(3*dDELTAbi_dTau)*dPSI2_dTau2+pow(DELTA,bi)*dPSI3_dTau3);
+        if (flags & ALPHAR_DDELTA3){ derivs.d3alphar_ddelta3 += ni*(DELTAbi*(3.0*dPSI2_dDelta2+delta*dPSI3_dDelta3)+3.0*dDELTAbi_dDelta*(2*dPSI_dDelta+delta*dPSI2_dDelta2)+3*dDELTAbi2_dDelta2*(PSI+delta*dPSI_dDelta)+dDELTAbi3_dDelta3*PSI*delta); }
+        if (flags & ALPHAR_DDELTA2_DTAU){
+            CoolPropDbl Line1 = DELTAbi*(2*dPSI2_dDelta_dTau+delta*dPSI3_dDelta2_dTau)+dDELTAbi_dTau*(2*dPSI_dDelta+delta*dPSI2_dDelta2);
+            CoolPropDbl Line2 = 2*dDELTAbi_dDelta*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+2*dDELTAbi2_dDelta_dTau*(PSI+delta*dPSI_dDelta);
+            CoolPropDbl Line3 = dDELTAbi2_dDelta2*delta*dPSI_dTau + dDELTAbi3_dDelta2_dTau*delta*PSI;
+            derivs.d3alphar_ddelta2_dtau += ni*(Line1+Line2+Line3);
+        }
+        if (flags & ALPHAR_DDELTA_DTAU2){ derivs.d3alphar_ddelta_dtau2 += ni*delta*(dDELTAbi2_dTau2*dPSI_dDelta+dDELTAbi3_dDelta_dTau2*PSI+2*dDELTAbi_dTau*dPSI2_dDelta_dTau+2.0*dDELTAbi2_dDelta_dTau*dPSI_dTau+DELTAbi*dPSI3_dDelta_dTau2+dDELTAbi_dDelta*dPSI2_dTau2)+ni*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+DELTAbi*dPSI2_dTau2); }
+        if (flags & ALPHAR_DTAU3){ derivs.d3alphar_dtau3 += ni*delta*(dDELTAbi3_dTau3*PSI+(3.0*dDELTAbi2_dTau2)*dPSI_dTau+(3*dDELTAbi_dTau)*dPSI2_dTau2+DELTAbi*dPSI3_dTau3); }
     }
 }
 
-long double ResidualHelmholtzNonAnalytic::base(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
 
-        s[i] = ni*pow(DELTA, bi)*delta*PSI;
+        summer += ni*pow(DELTA, bi)*delta*PSI;
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dDelta(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
         // At critical point, DELTA is 0, and 1/0^n is undefined
         if (std::abs(DELTA) < 10*DBL_EPSILON)
@@ -389,48 +536,50 @@ long double ResidualHelmholtzNonAnalytic::dDelta(const long double &tau, const l
         else{
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
-        s[i] = ni*(pow(DELTA,bi)*(PSI+delta*dPSI_dDelta)+dDELTAbi_dDelta*delta*PSI);
+        summer += ni*(pow(DELTA,bi)*(PSI+delta*dPSI_dDelta)+dDELTAbi_dDelta*delta*PSI);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dTau(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
-        long double dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
-
-        s[i] = ni*delta*(dDELTAbi_dTau*PSI+pow(DELTA,bi)*dPSI_dTau);
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
+
+        summer += ni*delta*(dDELTAbi_dTau*PSI+pow(DELTA,bi)*dPSI_dTau);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
 
-long double ResidualHelmholtzNonAnalytic::dDelta2(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
-    long double dDELTA2_dDelta2, dDELTAbi2_dDelta2;
+    CoolPropDbl dDELTA2_dDelta2, dDELTAbi2_dDelta2;
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
-        long double dDELTA_dDelta_over_delta_minus_1=(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl dDELTA_dDelta_over_delta_minus_1=(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
-        long double dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
+        CoolPropDbl dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
 
         if (std::abs(delta-1) < 10*DBL_EPSILON){
             dDELTA2_dDelta2 = 0;
@@ -450,30 +599,31 @@ long double ResidualHelmholtzNonAnalytic::dDelta2(const long double &tau, const
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
 
-        s[i] = ni*(pow(DELTA,bi)*(2.0*dPSI_dDelta+delta*dPSI2_dDelta2)+2.0*dDELTAbi_dDelta*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta2*delta*PSI);
+        summer += ni*(pow(DELTA,bi)*(2.0*dPSI_dDelta+delta*dPSI2_dDelta2)+2.0*dDELTAbi_dDelta*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta2*delta*PSI);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dDelta_dTau(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
-        long double dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
-        long double dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
+        CoolPropDbl dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
 
-        long double dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
-        long double dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
 
         // At critical point, DELTA is 0, and 1/0^n is undefined
         if (std::abs(DELTA) < 10*DBL_EPSILON)
@@ -484,57 +634,59 @@ long double ResidualHelmholtzNonAnalytic::dDelta_dTau(const long double &tau, co
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
 
-        s[i] = ni*(pow(DELTA,bi)*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+delta*dDELTAbi_dDelta*dPSI_dTau+ dDELTAbi_dTau*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta_dTau*delta*PSI);
+        summer += ni*(pow(DELTA,bi)*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+delta*dDELTAbi_dDelta*dPSI_dTau+ dDELTAbi_dTau*(PSI+delta*dPSI_dDelta)+dDELTAbi2_dDelta_dTau*delta*PSI);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dTau2(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-
-        long double theta = (1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA = pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI = exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dTau = -2.0*Di*(tau-1.0)*PSI;
-        long double dDELTAbi_dTau = -2.0*theta*bi*pow(DELTA,bi-1.0);
-        long double dPSI2_dTau2 = (2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
-        long double dDELTAbi2_dTau2 = 2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
-
-        s[i] = ni*delta*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+
+        CoolPropDbl theta = (1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA = pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI = exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dTau = -2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau = -2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl dPSI2_dTau2 = (2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
+        CoolPropDbl dDELTAbi2_dTau2 = 2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
+
+        summer += ni*delta*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
 
-long double ResidualHelmholtzNonAnalytic::dDelta3(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
-
-        long double dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
-        long double dDELTA2_dDelta2=1.0/(delta-1.0)*dDELTA_dDelta+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1.0,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
-        long double dDELTAbi2_dDelta2=bi*(pow(DELTA,bi-1.0)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
-
-        long double dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
-        long double dPSI3_dDelta3=2.0*Ci*PSI*(-4*Ci*Ci*pow(delta-1.0,3)+6*Ci*(delta-1));
-        long double PI = 4*Bi*ai*(ai-1)*pow(pow(delta-1,2),ai-2)+2*pow(Ai/betai,2)*pow(pow(delta-1,2),1/betai-2)+4*Ai*theta/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2);
-        long double dPI_dDelta = -8*Bi*ai*(ai-1)*(ai-2)*pow(pow(delta-1,2),ai-5.0/2.0)-8*pow(Ai/betai,2)*(1/(2*betai)-1)*pow(pow(delta-1,2),1/betai-5.0/2.0)-(8*Ai*theta)/betai*(1/(2*betai)-1)*(1/(2*betai)-2)*pow(pow(delta-1,2),1/(2*betai)-5.0/2.0)+4*Ai/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2)*dtheta_dDelta;
-        long double dDELTA3_dDelta3 = 1/(delta-1)*dDELTA2_dDelta2-1/pow(delta-1,2)*dDELTA_dDelta+pow(delta-1,2)*dPI_dDelta+2*(delta-1)*PI;
-        long double dDELTAbi3_dDelta3 = bi*(pow(DELTA,bi-1)*dDELTA3_dDelta3+dDELTA2_dDelta2*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+(bi-1)*(pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta2+pow(dDELTA_dDelta,2)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta));
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+
+        CoolPropDbl dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
+        CoolPropDbl dDELTA2_dDelta2=1.0/(delta-1.0)*dDELTA_dDelta+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1.0,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
+        CoolPropDbl dDELTAbi2_dDelta2=bi*(pow(DELTA,bi-1.0)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
+
+        CoolPropDbl dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
+        CoolPropDbl dPSI3_dDelta3=2.0*Ci*PSI*(-4*Ci*Ci*pow(delta-1.0,3)+6*Ci*(delta-1));
+        CoolPropDbl PI = 4*Bi*ai*(ai-1)*pow(pow(delta-1,2),ai-2)+2*pow(Ai/betai,2)*pow(pow(delta-1,2),1/betai-2)+4*Ai*theta/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2);
+        CoolPropDbl dPI_dDelta = -8*Bi*ai*(ai-1)*(ai-2)*pow(pow(delta-1,2),ai-5.0/2.0)-8*pow(Ai/betai,2)*(1/(2*betai)-1)*pow(pow(delta-1,2),1/betai-5.0/2.0)-(8*Ai*theta)/betai*(1/(2*betai)-1)*(1/(2*betai)-2)*pow(pow(delta-1,2),1/(2*betai)-5.0/2.0)+4*Ai/betai*(1/(2*betai)-1)*pow(pow(delta-1,2),1/(2*betai)-2)*dtheta_dDelta;
+        CoolPropDbl dDELTA3_dDelta3 = 1/(delta-1)*dDELTA2_dDelta2-1/pow(delta-1,2)*dDELTA_dDelta+pow(delta-1,2)*dPI_dDelta+2*(delta-1)*PI;
+        CoolPropDbl dDELTAbi3_dDelta3 = bi*(pow(DELTA,bi-1)*dDELTA3_dDelta3+dDELTA2_dDelta2*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+(bi-1)*(pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta2+pow(dDELTA_dDelta,2)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta));
 
         // At critical point, DELTA is 0, and 1/0^n is undefined
         if (std::abs(DELTA) < 10*DBL_EPSILON)
@@ -545,39 +697,40 @@ long double ResidualHelmholtzNonAnalytic::dDelta3(const long double &tau, const
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
 
-        s[i] = ni*(pow(DELTA,bi)*(3.0*dPSI2_dDelta2+delta*dPSI3_dDelta3)+3.0*dDELTAbi_dDelta*(2*dPSI_dDelta+delta*dPSI2_dDelta2)+3*dDELTAbi2_dDelta2*(PSI+delta*dPSI_dDelta)+dDELTAbi3_dDelta3*PSI*delta);
+        summer += ni*(pow(DELTA,bi)*(3.0*dPSI2_dDelta2+delta*dPSI3_dDelta3)+3.0*dDELTAbi_dDelta*(2*dPSI_dDelta+delta*dPSI2_dDelta2)+3*dDELTAbi2_dDelta2*(PSI+delta*dPSI_dDelta)+dDELTAbi3_dDelta3*PSI*delta);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dDelta_dTau2(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta_dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
 
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
-        long double dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
-        long double dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
 
-        long double dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
+        CoolPropDbl dtheta_dDelta = Ai/(2*betai)*pow(pow(delta-1,2),1/(2*betai)-1)*2*(delta-1);
 
-        long double dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
-        long double dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
+        CoolPropDbl dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
 
-        long double dPSI2_dTau2=(2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
-        long double dDELTAbi2_dTau2=2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
+        CoolPropDbl dPSI2_dTau2=(2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
+        CoolPropDbl dDELTAbi2_dTau2=2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
 
-        long double dPSI3_dDelta_dTau2 = 2*Di*(2*Di*pow(tau-1,2)-1)*dPSI_dDelta;
-        long double dDELTAbi3_dDelta_dTau2 = 2*bi*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+4*pow(theta,2)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta+8*theta*bi*(bi-1)*pow(DELTA,bi-2)*dtheta_dDelta;
+        CoolPropDbl dPSI3_dDelta_dTau2 = 2*Di*(2*Di*pow(tau-1,2)-1)*dPSI_dDelta;
+        CoolPropDbl dDELTAbi3_dDelta_dTau2 = 2*bi*(bi-1)*pow(DELTA,bi-2)*dDELTA_dDelta+4*pow(theta,2)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3)*dDELTA_dDelta+8*theta*bi*(bi-1)*pow(DELTA,bi-2)*dtheta_dDelta;
 
         // At critical point, DELTA is 0, and 1/0^n is undefined
         if (std::abs(DELTA) < 10*DBL_EPSILON)
@@ -588,36 +741,37 @@ long double ResidualHelmholtzNonAnalytic::dDelta_dTau2(const long double &tau, c
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
 
-        s[i] = ni*delta*(dDELTAbi2_dTau2*dPSI_dDelta+dDELTAbi3_dDelta_dTau2*PSI+2*dDELTAbi_dTau*dPSI2_dDelta_dTau+2.0*dDELTAbi2_dDelta_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI3_dDelta_dTau2+dDELTAbi_dDelta*dPSI2_dTau2)+ni*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
+        summer += ni*delta*(dDELTAbi2_dTau2*dPSI_dDelta+dDELTAbi3_dDelta_dTau2*PSI+2*dDELTAbi_dTau*dPSI2_dDelta_dTau+2.0*dDELTAbi2_dDelta_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI3_dDelta_dTau2+dDELTAbi_dDelta*dPSI2_dTau2)+ni*(dDELTAbi2_dTau2*PSI+2.0*dDELTAbi_dTau*dPSI_dTau+pow(DELTA,bi)*dPSI2_dTau2);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
 
-long double ResidualHelmholtzNonAnalytic::dDelta2_dTau(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dDelta2_dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
 
-        long double dDELTAbi_dDelta;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
-        long double dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
+        CoolPropDbl dDELTAbi_dDelta;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dDelta=-2.0*Ci*(delta-1.0)*PSI;
+        CoolPropDbl dDELTA_dDelta=(delta-1.0)*(Ai*theta*2.0/betai*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)+2.0*Bi*ai*pow(pow(delta-1.0,2),ai-1.0));
 
-        long double dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
-        long double dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
 
-        long double dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
-        long double dDELTA2_dDelta2=1.0/(delta-1.0)*dDELTA_dDelta+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1.0,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
-        long double dDELTAbi2_dDelta2=bi*(pow(DELTA,bi-1.0)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
+        CoolPropDbl dPSI2_dDelta2=(2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*PSI;
+        CoolPropDbl dDELTA2_dDelta2=1.0/(delta-1.0)*dDELTA_dDelta+pow(delta-1.0,2)*(4.0*Bi*ai*(ai-1.0)*pow(pow(delta-1.0,2),ai-2.0)+2.0*pow(Ai/betai,2)*pow(pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0),2)+Ai*theta*4.0/betai*(1.0/(2.0*betai)-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-2.0));
+        CoolPropDbl dDELTAbi2_dDelta2=bi*(pow(DELTA,bi-1.0)*dDELTA2_dDelta2+(bi-1.0)*pow(DELTA,bi-2.0)*pow(dDELTA_dDelta,2));
 
-        long double dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
-        long double dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
+        CoolPropDbl dPSI2_dDelta_dTau=4.0*Ci*Di*(delta-1.0)*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi2_dDelta_dTau=-Ai*bi*2.0/betai*pow(DELTA,bi-1.0)*(delta-1.0)*pow(pow(delta-1.0,2),1.0/(2.0*betai)-1.0)-2.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2.0)*dDELTA_dDelta;
 
         // At critical point, DELTA is 0, and 1/0^n is undefined
         if (std::abs(DELTA) < 10*DBL_EPSILON)
@@ -628,45 +782,46 @@ long double ResidualHelmholtzNonAnalytic::dDelta2_dTau(const long double &tau, c
             dDELTAbi_dDelta=bi*pow(DELTA,bi-1.0)*dDELTA_dDelta;
         }
         //Following Terms added for this derivative
-        long double dPSI3_dDelta2_dTau = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*dPSI_dTau;
-        long double dDELTA_dTau = -2*theta;
-        long double dDELTA2_dDelta_dTau = 2.0*Ai/(betai)*pow(pow(delta-1,2),1.0/(2.0*betai)-0.5);
-        long double dDELTA3_dDelta2_dTau = 2.0*Ai*(betai-1)/(betai*betai)*pow(pow(delta-1,2),1/(2*betai)-1.0);
-
-        long double dDELTAbim1_dTau = (bi-1)*pow(DELTA,bi-2)*dDELTA_dTau;
-        long double dDELTAbim2_dTau = (bi-2)*pow(DELTA,bi-3)*dDELTA_dTau;
-        long double Line11 = dDELTAbim1_dTau*dDELTA2_dDelta2 + pow(DELTA,bi-1)*dDELTA3_dDelta2_dTau;
-        long double Line21 = (bi-1)*(dDELTAbim2_dTau*pow(dDELTA_dDelta,2)+pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta_dTau);
-        long double dDELTAbi3_dDelta2_dTau = bi*(Line11+Line21);
-
-        long double Line1 = pow(DELTA,bi)*(2*dPSI2_dDelta_dTau+delta*dPSI3_dDelta2_dTau)+dDELTAbi_dTau*(2*dPSI_dDelta+delta*dPSI2_dDelta2);
-        long double Line2 = 2*dDELTAbi_dDelta*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+2*dDELTAbi2_dDelta_dTau*(PSI+delta*dPSI_dDelta);
-        long double Line3 = dDELTAbi2_dDelta2*delta*dPSI_dTau + dDELTAbi3_dDelta2_dTau*delta*PSI;
-        s[i] = ni*(Line1+Line2+Line3);
+        CoolPropDbl dPSI3_dDelta2_dTau = (2.0*Ci*pow(delta-1.0,2)-1.0)*2.0*Ci*dPSI_dTau;
+        CoolPropDbl dDELTA_dTau = -2*theta;
+        CoolPropDbl dDELTA2_dDelta_dTau = 2.0*Ai/(betai)*pow(pow(delta-1,2),1.0/(2.0*betai)-0.5);
+        CoolPropDbl dDELTA3_dDelta2_dTau = 2.0*Ai*(betai-1)/(betai*betai)*pow(pow(delta-1,2),1/(2*betai)-1.0);
+
+        CoolPropDbl dDELTAbim1_dTau = (bi-1)*pow(DELTA,bi-2)*dDELTA_dTau;
+        CoolPropDbl dDELTAbim2_dTau = (bi-2)*pow(DELTA,bi-3)*dDELTA_dTau;
+        CoolPropDbl Line11 = dDELTAbim1_dTau*dDELTA2_dDelta2 + pow(DELTA,bi-1)*dDELTA3_dDelta2_dTau;
+        CoolPropDbl Line21 = (bi-1)*(dDELTAbim2_dTau*pow(dDELTA_dDelta,2)+pow(DELTA,bi-2)*2*dDELTA_dDelta*dDELTA2_dDelta_dTau);
+        CoolPropDbl dDELTAbi3_dDelta2_dTau = bi*(Line11+Line21);
+
+        CoolPropDbl Line1 = pow(DELTA,bi)*(2*dPSI2_dDelta_dTau+delta*dPSI3_dDelta2_dTau)+dDELTAbi_dTau*(2*dPSI_dDelta+delta*dPSI2_dDelta2);
+        CoolPropDbl Line2 = 2*dDELTAbi_dDelta*(dPSI_dTau+delta*dPSI2_dDelta_dTau)+2*dDELTAbi2_dDelta_dTau*(PSI+delta*dPSI_dDelta);
+        CoolPropDbl Line3 = dDELTAbi2_dDelta2*delta*dPSI_dTau + dDELTAbi3_dDelta2_dTau*delta*PSI;
+        summer += ni*(Line1+Line2+Line3);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
-long double ResidualHelmholtzNonAnalytic::dTau3(const long double &tau, const long double &delta) throw()
+CoolPropDbl ResidualHelmholtzNonAnalytic::dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (N==0){return 0.0;}
+    double summer = 0;
     for (unsigned int i=0; i<N; ++i)
     {
         ResidualHelmholtzNonAnalyticElement &el = elements[i];
-        long double ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
-        long double Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
-        long double theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
-        long double DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
-        long double PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
-        long double dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
-        long double dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
-        long double dPSI2_dTau2=(2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
-        long double dDELTAbi2_dTau2=2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
-        long double dPSI3_dTau3=2.0*Di*PSI*(-4*Di*Di*pow(tau-1,3)+6*Di*(tau-1));
-        long double dDELTAbi3_dTau3 = -12.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2)-8*pow(theta,3)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3.0);
-
-        s[i] = ni*delta*(dDELTAbi3_dTau3*PSI+(3.0*dDELTAbi2_dTau2)*dPSI_dTau+(3*dDELTAbi_dTau )*dPSI2_dTau2+pow(DELTA,bi)*dPSI3_dTau3);
+        CoolPropDbl ni = el.n, ai = el.a, bi = el.b, betai = el.beta;
+        CoolPropDbl Ai = el.A, Bi = el.B, Ci = el.C, Di = el.D;
+        CoolPropDbl theta=(1.0-tau)+Ai*pow(pow(delta-1.0,2),1.0/(2.0*betai));
+        CoolPropDbl DELTA=pow(theta,2)+Bi*pow(pow(delta-1.0,2),ai);
+        CoolPropDbl PSI=exp(-Ci*pow(delta-1.0,2)-Di*pow(tau-1.0,2));
+        CoolPropDbl dPSI_dTau=-2.0*Di*(tau-1.0)*PSI;
+        CoolPropDbl dDELTAbi_dTau=-2.0*theta*bi*pow(DELTA,bi-1.0);
+        CoolPropDbl dPSI2_dTau2=(2.0*Di*pow(tau-1.0,2)-1.0)*2.0*Di*PSI;
+        CoolPropDbl dDELTAbi2_dTau2=2.0*bi*pow(DELTA,bi-1.0)+4.0*pow(theta,2)*bi*(bi-1.0)*pow(DELTA,bi-2.0);
+        CoolPropDbl dPSI3_dTau3=2.0*Di*PSI*(-4*Di*Di*pow(tau-1,3)+6*Di*(tau-1));
+        CoolPropDbl dDELTAbi3_dTau3 = -12.0*theta*bi*(bi-1.0)*pow(DELTA,bi-2)-8*pow(theta,3)*bi*(bi-1)*(bi-2)*pow(DELTA,bi-3.0);
+
+        summer += ni*delta*(dDELTAbi3_dTau3*PSI+(3.0*dDELTAbi2_dTau2)*dPSI_dTau+(3*dDELTAbi_dTau )*dPSI2_dTau2+pow(DELTA,bi)*dPSI3_dTau3);
     }
-    return std::accumulate(s.begin(), s.end(), 0.0);
+    return summer;
 }
 
 void ResidualHelmholtzSAFTAssociating::to_json(rapidjson::Value &el, rapidjson::Document &doc)
@@ -678,166 +833,166 @@ void ResidualHelmholtzSAFTAssociating::to_json(rapidjson::Value &el, rapidjson::
     el.AddMember("vbarn",vbarn,doc.GetAllocator());
     el.AddMember("kappabar",kappabar,doc.GetAllocator());
 }
-long double ResidualHelmholtzSAFTAssociating::Deltabar(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::Deltabar(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->g(this->eta(delta))*(exp(this->epsilonbar*tau)-1)*this->kappabar;
 }
-long double ResidualHelmholtzSAFTAssociating::dDeltabar_ddelta__consttau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dDeltabar_ddelta__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->dg_deta(this->eta(delta))*(exp(this->epsilonbar*tau)-1)*this->kappabar*this->vbarn;
 }
-long double ResidualHelmholtzSAFTAssociating::d2Deltabar_ddelta2__consttau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2Deltabar_ddelta2__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->d2g_deta2(this->eta(delta))*(exp(this->epsilonbar*tau)-1)*this->kappabar*pow(this->vbarn,(int)2);
 }
-long double ResidualHelmholtzSAFTAssociating::dDeltabar_dtau__constdelta(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dDeltabar_dtau__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->g(this->eta(delta))*this->kappabar*exp(this->epsilonbar*tau)*this->epsilonbar;
 }
-long double ResidualHelmholtzSAFTAssociating::d2Deltabar_dtau2__constdelta(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2Deltabar_dtau2__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->g(this->eta(delta))*this->kappabar*exp(this->epsilonbar*tau)*pow(this->epsilonbar,(int)2);
 }
-long double ResidualHelmholtzSAFTAssociating::d2Deltabar_ddelta_dtau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2Deltabar_ddelta_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->dg_deta(this->eta(delta))*exp(this->epsilonbar*tau)*this->epsilonbar*this->kappabar*this->vbarn;
 }
-long double ResidualHelmholtzSAFTAssociating::d3Deltabar_dtau3__constdelta(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3Deltabar_dtau3__constdelta(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->g(this->eta(delta))*this->kappabar*exp(this->epsilonbar*tau)*pow(this->epsilonbar,(int)3);
 }
-long double ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta_dtau2(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta_dtau2(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->dg_deta(this->eta(delta))*this->kappabar*exp(this->epsilonbar*tau)*pow(this->epsilonbar,(int)2)*this->vbarn;
 }
-long double ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta2_dtau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta2_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->d2g_deta2(this->eta(delta))*exp(this->epsilonbar*tau)*this->epsilonbar*this->kappabar*pow(this->vbarn,(int)2);
 }
-long double ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta3__consttau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3Deltabar_ddelta3__consttau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
     return this->d3g_deta3(this->eta(delta))*(exp(this->epsilonbar*tau)-1)*this->kappabar*pow(this->vbarn,(int)3);
 }
 
-long double ResidualHelmholtzSAFTAssociating::X(const long double &delta, const long double &Deltabar)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::X(const CoolPropDbl &delta, const CoolPropDbl &Deltabar)
 {
     return 2/(sqrt(1+4*Deltabar*delta)+1);
 }
-long double ResidualHelmholtzSAFTAssociating::dX_dDeltabar__constdelta(const long double &delta, const long double &Deltabar)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dX_dDeltabar__constdelta(const CoolPropDbl &delta, const CoolPropDbl &Deltabar)
 {
-    long double X = this->X(delta,Deltabar);
+    CoolPropDbl X = this->X(delta,Deltabar);
     return -delta*X*X/(2*Deltabar*delta*X+1);
 }
-long double ResidualHelmholtzSAFTAssociating::dX_ddelta__constDeltabar(const long double &delta, const long double &Deltabar)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dX_ddelta__constDeltabar(const CoolPropDbl &delta, const CoolPropDbl &Deltabar)
 {
-    long double X = this->X(delta,Deltabar);
+    CoolPropDbl X = this->X(delta,Deltabar);
     return -Deltabar*X*X/(2*Deltabar*delta*X+1);
 }
-long double ResidualHelmholtzSAFTAssociating::dX_dtau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dX_dtau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Deltabar = this->Deltabar(tau, delta);
+    CoolPropDbl Deltabar = this->Deltabar(tau, delta);
     return this->dX_dDeltabar__constdelta(delta, Deltabar)*this->dDeltabar_dtau__constdelta(tau, delta);
 }
-long double ResidualHelmholtzSAFTAssociating::dX_ddelta(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dX_ddelta(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Deltabar = this->Deltabar(tau, delta);
+    CoolPropDbl Deltabar = this->Deltabar(tau, delta);
     return (this->dX_ddelta__constDeltabar(delta, Deltabar)
            + this->dX_dDeltabar__constdelta(delta, Deltabar)*this->dDeltabar_ddelta__consttau(tau, delta));
 }
-long double ResidualHelmholtzSAFTAssociating::d2X_dtau2(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2X_dtau2(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Deltabar = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Deltabar);
-    long double beta = this->dDeltabar_dtau__constdelta(tau, delta);
-    long double d_dXdtau_dbeta = -delta*X*X/(2*Deltabar*delta*X+1);
-    long double d_dXdtau_dDeltabar = 2*delta*delta*X*X*X/pow(2*Deltabar*delta*X+1,2)*beta;
-    long double d_dXdtau_dX = -2*beta*delta*X*(Deltabar*delta*X+1)/pow(2*Deltabar*delta*X+1,2);
-    long double dbeta_dtau = this->d2Deltabar_dtau2__constdelta(tau, delta);
-    long double dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
+    CoolPropDbl Deltabar = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Deltabar);
+    CoolPropDbl beta = this->dDeltabar_dtau__constdelta(tau, delta);
+    CoolPropDbl d_dXdtau_dbeta = -delta*X*X/(2*Deltabar*delta*X+1);
+    CoolPropDbl d_dXdtau_dDeltabar = 2*delta*delta*X*X*X/pow(2*Deltabar*delta*X+1,2)*beta;
+    CoolPropDbl d_dXdtau_dX = -2*beta*delta*X*(Deltabar*delta*X+1)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl dbeta_dtau = this->d2Deltabar_dtau2__constdelta(tau, delta);
+    CoolPropDbl dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
     return d_dXdtau_dX*dX_dDeltabar*beta+d_dXdtau_dDeltabar*beta+d_dXdtau_dbeta*dbeta_dtau;
 }
-long double ResidualHelmholtzSAFTAssociating::d2X_ddeltadtau(const long double &tau, const long double &delta)
-{
-    long double Deltabar = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Deltabar);
-    long double alpha = this->dDeltabar_ddelta__consttau(tau, delta);
-    long double beta = this->dDeltabar_dtau__constdelta(tau, delta);
-    long double dalpha_dtau = this->d2Deltabar_ddelta_dtau(tau, delta);
-    long double d_dXddelta_dDeltabar = X*X*(2*delta*delta*X*alpha-1)/pow(2*Deltabar*delta*X+1,2);
-    long double d_dXddelta_dalpha = -delta*X*X/(2*Deltabar*delta*X+1);
-    long double d_dXddelta_dX = -(Deltabar+delta*alpha)*2*(Deltabar*delta*X*X+X)/pow(2*Deltabar*delta*X+1,2);
-    long double dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2X_ddeltadtau(const CoolPropDbl &tau, const CoolPropDbl &delta)
+{
+    CoolPropDbl Deltabar = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Deltabar);
+    CoolPropDbl alpha = this->dDeltabar_ddelta__consttau(tau, delta);
+    CoolPropDbl beta = this->dDeltabar_dtau__constdelta(tau, delta);
+    CoolPropDbl dalpha_dtau = this->d2Deltabar_ddelta_dtau(tau, delta);
+    CoolPropDbl d_dXddelta_dDeltabar = X*X*(2*delta*delta*X*alpha-1)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl d_dXddelta_dalpha = -delta*X*X/(2*Deltabar*delta*X+1);
+    CoolPropDbl d_dXddelta_dX = -(Deltabar+delta*alpha)*2*(Deltabar*delta*X*X+X)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
     return d_dXddelta_dX*dX_dDeltabar*beta+d_dXddelta_dDeltabar*beta+d_dXddelta_dalpha*dalpha_dtau;
 }
-long double ResidualHelmholtzSAFTAssociating::d2X_ddelta2(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2X_ddelta2(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Deltabar = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Deltabar);
-    long double alpha = this->dDeltabar_ddelta__consttau(tau, delta);
-    long double dalpha_ddelta = this->d2Deltabar_ddelta2__consttau(tau, delta);
+    CoolPropDbl Deltabar = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Deltabar);
+    CoolPropDbl alpha = this->dDeltabar_ddelta__consttau(tau, delta);
+    CoolPropDbl dalpha_ddelta = this->d2Deltabar_ddelta2__consttau(tau, delta);
 
-    long double dX_ddelta_constall = X*X*(2*Deltabar*Deltabar*X-alpha)/pow(2*Deltabar*delta*X+1,2);
-    long double d_dXddelta_dX = -(Deltabar+delta*alpha)*2*(Deltabar*delta*X*X+X)/pow(2*Deltabar*delta*X+1,2);
-    long double d_dXddelta_dDeltabar = X*X*(2*delta*delta*X*alpha-1)/pow(2*Deltabar*delta*X+1,2);
-    long double d_dXddelta_dalpha = -delta*X*X/(2*Deltabar*delta*X+1);
+    CoolPropDbl dX_ddelta_constall = X*X*(2*Deltabar*Deltabar*X-alpha)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl d_dXddelta_dX = -(Deltabar+delta*alpha)*2*(Deltabar*delta*X*X+X)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl d_dXddelta_dDeltabar = X*X*(2*delta*delta*X*alpha-1)/pow(2*Deltabar*delta*X+1,2);
+    CoolPropDbl d_dXddelta_dalpha = -delta*X*X/(2*Deltabar*delta*X+1);
 
-    long double dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
-    long double dX_ddelta = this->dX_ddelta__constDeltabar(delta, Deltabar);
+    CoolPropDbl dX_dDeltabar = this->dX_dDeltabar__constdelta(delta, Deltabar);
+    CoolPropDbl dX_ddelta = this->dX_ddelta__constDeltabar(delta, Deltabar);
 
-    long double val = (dX_ddelta_constall
+    CoolPropDbl val = (dX_ddelta_constall
             + d_dXddelta_dX*dX_ddelta
             + d_dXddelta_dX*dX_dDeltabar*alpha
             + d_dXddelta_dDeltabar*alpha
             + d_dXddelta_dalpha*dalpha_ddelta);
     return val;
 }
-long double ResidualHelmholtzSAFTAssociating::d3X_dtau3(const long double &tau, const long double &delta)
-{
-    long double Delta = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Delta);
-    long double dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
-    long double Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
-    long double Delta_tt = this->d2Deltabar_dtau2__constdelta(tau, delta);
-    long double Delta_ttt = this->d3Deltabar_dtau3__constdelta(tau, delta);
-    long double dXtt_dX = 2*X*delta*(-6*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + X*delta*(Delta*Delta_tt + 3*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
-    long double dXtt_dDelta = 2*pow(X, 3)*pow(delta, 2)*(-6*pow(Delta_t, 2)*X*delta*(Delta*X*delta + 1) - 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) + Delta_tt*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
-    long double dXtt_dDelta_t = 4*Delta_t*pow(X, 3)*pow(delta, 2)*(3*Delta*X*delta + 2)/pow(2*Delta*X*delta + 1, 3);
-    long double dXtt_dDelta_tt = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3X_dtau3(const CoolPropDbl &tau, const CoolPropDbl &delta)
+{
+    CoolPropDbl Delta = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Delta);
+    CoolPropDbl dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
+    CoolPropDbl Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
+    CoolPropDbl Delta_tt = this->d2Deltabar_dtau2__constdelta(tau, delta);
+    CoolPropDbl Delta_ttt = this->d3Deltabar_dtau3__constdelta(tau, delta);
+    CoolPropDbl dXtt_dX = 2*X*delta*(-6*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + X*delta*(Delta*Delta_tt + 3*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXtt_dDelta = 2*pow(X, 3)*pow(delta, 2)*(-6*pow(Delta_t, 2)*X*delta*(Delta*X*delta + 1) - 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) + Delta_tt*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXtt_dDelta_t = 4*Delta_t*pow(X, 3)*pow(delta, 2)*(3*Delta*X*delta + 2)/pow(2*Delta*X*delta + 1, 3);
+    CoolPropDbl dXtt_dDelta_tt = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
     return dXtt_dX*dX_dDelta*Delta_t+dXtt_dDelta*Delta_t + dXtt_dDelta_t*Delta_tt + dXtt_dDelta_tt*Delta_ttt;
 }
-long double ResidualHelmholtzSAFTAssociating::d3X_ddeltadtau2(const long double &tau, const long double &delta)
-{
-    long double Delta = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Delta);
-    long double dX_ddelta = this->dX_ddelta__constDeltabar(delta, Delta);
-    long double dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
-    long double Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
-    long double Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
-    long double Delta_dt = this->d2Deltabar_ddelta_dtau(tau, delta);
-    long double Delta_tt = this->d2Deltabar_dtau2__constdelta(tau, delta);
-    long double Delta_dtt = this->d3Deltabar_ddelta_dtau2(tau, delta);
-    long double dXtt_ddelta = pow(X, 2)*(-12*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 2*pow(Delta_t, 2)*X*delta*(-Delta*X*delta + 2)*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + 2*X*delta*(Delta*Delta_tt + 2*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
-    long double dXtt_dX = 2*X*delta*(-6*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + X*delta*(Delta*Delta_tt + 3*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
-    long double dXtt_dDelta = 2*pow(X, 3)*pow(delta, 2)*(-6*pow(Delta_t, 2)*X*delta*(Delta*X*delta + 1) - 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) + Delta_tt*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
-    long double dXtt_dDelta_t = 4*Delta_t*pow(X, 3)*pow(delta, 2)*(3*Delta*X*delta + 2)/pow(2*Delta*X*delta + 1, 3);
-    long double dXtt_dDelta_tt = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3X_ddeltadtau2(const CoolPropDbl &tau, const CoolPropDbl &delta)
+{
+    CoolPropDbl Delta = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Delta);
+    CoolPropDbl dX_ddelta = this->dX_ddelta__constDeltabar(delta, Delta);
+    CoolPropDbl dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
+    CoolPropDbl Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
+    CoolPropDbl Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
+    CoolPropDbl Delta_dt = this->d2Deltabar_ddelta_dtau(tau, delta);
+    CoolPropDbl Delta_tt = this->d2Deltabar_dtau2__constdelta(tau, delta);
+    CoolPropDbl Delta_dtt = this->d3Deltabar_ddelta_dtau2(tau, delta);
+    CoolPropDbl dXtt_ddelta = pow(X, 2)*(-12*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 2*pow(Delta_t, 2)*X*delta*(-Delta*X*delta + 2)*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + 2*X*delta*(Delta*Delta_tt + 2*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXtt_dX = 2*X*delta*(-6*Delta*pow(Delta_t, 2)*pow(X, 2)*pow(delta, 2)*(Delta*X*delta + 1) + 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) - Delta_tt*pow(2*Delta*X*delta + 1, 3) + X*delta*(Delta*Delta_tt + 3*pow(Delta_t, 2))*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXtt_dDelta = 2*pow(X, 3)*pow(delta, 2)*(-6*pow(Delta_t, 2)*X*delta*(Delta*X*delta + 1) - 3*pow(Delta_t, 2)*X*delta*(2*Delta*X*delta + 1) + Delta_tt*pow(2*Delta*X*delta + 1, 2))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXtt_dDelta_t = 4*Delta_t*pow(X, 3)*pow(delta, 2)*(3*Delta*X*delta + 2)/pow(2*Delta*X*delta + 1, 3);
+    CoolPropDbl dXtt_dDelta_tt = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
     return dXtt_ddelta + dXtt_dX*dX_ddelta + dXtt_dX*dX_dDelta*Delta_d + dXtt_dDelta*Delta_d + dXtt_dDelta_t*Delta_dt + dXtt_dDelta_tt*Delta_dtt;
 }
 
-long double ResidualHelmholtzSAFTAssociating::d3X_ddelta2dtau(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3X_ddelta2dtau(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Delta = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Delta);
-    long double dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
-    long double Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
-    long double Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
-    long double Delta_dd = this->d2Deltabar_ddelta2__consttau(tau, delta);
-    long double Delta_dt = this->d2Deltabar_ddelta_dtau(tau, delta);
-    long double Delta_ddt = this->d3Deltabar_ddelta2_dtau(tau, delta);
-    long double dXdd_dX = 2*X*(-6*Delta*pow(X, 2)*delta*pow(Delta + Delta_d*delta, 2)*(Delta*X*delta + 1) - Delta_dd*delta*pow(2*Delta*X*delta + 1, 3) + 2*X*(2*Delta*X*delta + 1)*(-Delta*Delta_d*delta*(2*Delta_d*X*pow(delta, 2) - 1) - Delta*delta*(2*pow(Delta, 2)*X - Delta_d) + Delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + Delta_d*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1)) + pow(2*Delta*X*delta + 1, 2)*(3*pow(Delta, 2)*X + Delta*Delta_dd*X*pow(delta, 2) + Delta*X*(Delta + Delta_d*delta) + pow(Delta_d, 2)*X*pow(delta, 2) + Delta_d*X*delta*(Delta + Delta_d*delta) + Delta_d*(2*Delta_d*X*pow(delta, 2) - 1) - Delta_d))/pow(2*Delta*X*delta + 1, 4);
-    long double dXdd_dDelta = pow(X, 3)*(-8*pow(Delta, 2)*Delta_d*pow(X, 2)*pow(delta, 3) + 8*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 4) + 10*pow(Delta, 2)*X*delta - 24*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 4) + 8*Delta*Delta_d*X*pow(delta, 2) + 8*Delta*Delta_dd*X*pow(delta, 3) + 8*Delta - 18*pow(Delta_d, 2)*X*pow(delta, 3) + 12*Delta_d*delta + 2*Delta_dd*pow(delta, 2))/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
-    long double dXdd_dDelta_d = 2*pow(X, 2)*(2*X*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + (2*Delta*X*delta + 1)*(2*Delta_d*X*pow(delta, 2) - 1))/pow(2*Delta*X*delta + 1, 3);
-    long double dXdd_dDelta_dd = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
+    CoolPropDbl Delta = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Delta);
+    CoolPropDbl dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
+    CoolPropDbl Delta_t = this->dDeltabar_dtau__constdelta(tau, delta);
+    CoolPropDbl Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
+    CoolPropDbl Delta_dd = this->d2Deltabar_ddelta2__consttau(tau, delta);
+    CoolPropDbl Delta_dt = this->d2Deltabar_ddelta_dtau(tau, delta);
+    CoolPropDbl Delta_ddt = this->d3Deltabar_ddelta2_dtau(tau, delta);
+    CoolPropDbl dXdd_dX = 2*X*(-6*Delta*pow(X, 2)*delta*pow(Delta + Delta_d*delta, 2)*(Delta*X*delta + 1) - Delta_dd*delta*pow(2*Delta*X*delta + 1, 3) + 2*X*(2*Delta*X*delta + 1)*(-Delta*Delta_d*delta*(2*Delta_d*X*pow(delta, 2) - 1) - Delta*delta*(2*pow(Delta, 2)*X - Delta_d) + Delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + Delta_d*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1)) + pow(2*Delta*X*delta + 1, 2)*(3*pow(Delta, 2)*X + Delta*Delta_dd*X*pow(delta, 2) + Delta*X*(Delta + Delta_d*delta) + pow(Delta_d, 2)*X*pow(delta, 2) + Delta_d*X*delta*(Delta + Delta_d*delta) + Delta_d*(2*Delta_d*X*pow(delta, 2) - 1) - Delta_d))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXdd_dDelta = pow(X, 3)*(-8*pow(Delta, 2)*Delta_d*pow(X, 2)*pow(delta, 3) + 8*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 4) + 10*pow(Delta, 2)*X*delta - 24*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 4) + 8*Delta*Delta_d*X*pow(delta, 2) + 8*Delta*Delta_dd*X*pow(delta, 3) + 8*Delta - 18*pow(Delta_d, 2)*X*pow(delta, 3) + 12*Delta_d*delta + 2*Delta_dd*pow(delta, 2))/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
+    CoolPropDbl dXdd_dDelta_d = 2*pow(X, 2)*(2*X*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + (2*Delta*X*delta + 1)*(2*Delta_d*X*pow(delta, 2) - 1))/pow(2*Delta*X*delta + 1, 3);
+    CoolPropDbl dXdd_dDelta_dd = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
 
     return dXdd_dX*dX_dDelta*Delta_t + dXdd_dDelta*Delta_t + dXdd_dDelta_d*Delta_dt + dXdd_dDelta_dd*Delta_ddt;
 }
@@ -847,57 +1002,57 @@ double Xdd(double X, double delta, double Delta, double Delta_d, double Delta_dd
     return Delta*pow(X, 2)*(2*Delta + 2*Delta_d*delta)*(Delta*pow(X, 2)*delta + X)/pow(2*Delta*X*delta + 1, 3) + Delta_d*pow(X, 2)*delta*(2*Delta + 2*Delta_d*delta)*(Delta*pow(X, 2)*delta + X)/pow(2*Delta*X*delta + 1, 3) + Delta_d*pow(X, 2)*(2*Delta_d*X*pow(delta, 2) - 1)/pow(2*Delta*X*delta + 1, 2) - Delta_dd*pow(X, 2)*delta/(2*Delta*X*delta + 1) + pow(X, 2)*(2*pow(Delta, 2)*X - Delta_d)/pow(2*Delta*X*delta + 1, 2);
 }
 
-long double ResidualHelmholtzSAFTAssociating::d3X_ddelta3(const long double &tau, const long double &delta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3X_ddelta3(const CoolPropDbl &tau, const CoolPropDbl &delta)
 {
-    long double Delta = this->Deltabar(tau, delta);
-    long double X = this->X(delta, Delta);
-    long double dX_ddelta = this->dX_ddelta__constDeltabar(delta, Delta);
-    long double dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
-    long double Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
-    long double Delta_dd = this->d2Deltabar_ddelta2__consttau(tau, delta);
-    long double Delta_ddd = this->d3Deltabar_ddelta3__consttau(tau, delta);
-
-    long double dXdd_dX = 2*X*(-6*Delta*pow(X, 2)*delta*pow(Delta + Delta_d*delta, 2)*(Delta*X*delta + 1) - Delta_dd*delta*pow(2*Delta*X*delta + 1, 3) + 2*X*(2*Delta*X*delta + 1)*(-Delta*Delta_d*delta*(2*Delta_d*X*pow(delta, 2) - 1) - Delta*delta*(2*pow(Delta, 2)*X - Delta_d) + Delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + Delta_d*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1)) + pow(2*Delta*X*delta + 1, 2)*(3*pow(Delta, 2)*X + Delta*Delta_dd*X*pow(delta, 2) + Delta*X*(Delta + Delta_d*delta) + pow(Delta_d, 2)*X*pow(delta, 2) + Delta_d*X*delta*(Delta + Delta_d*delta) + Delta_d*(2*Delta_d*X*pow(delta, 2) - 1) - Delta_d))/pow(2*Delta*X*delta + 1, 4);
-    long double dXdd_ddelta = pow(X, 2)*(-24*pow(Delta, 4)*pow(X, 3)*delta - 8*pow(Delta, 3)*Delta_d*pow(X, 3)*pow(delta, 2) - 18*pow(Delta, 3)*pow(X, 2) + 8*pow(Delta, 2)*Delta_d*pow(X, 2)*delta - 4*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 2) + 10*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 2) + 12*Delta*Delta_d*X - 4*Delta*Delta_dd*X*delta + 8*pow(Delta_d, 2)*X*delta - Delta_dd)/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
-    long double dXdd_dDelta = pow(X, 3)*(-8*pow(Delta, 2)*Delta_d*pow(X, 2)*pow(delta, 3) + 8*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 4) + 10*pow(Delta, 2)*X*delta - 24*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 4) + 8*Delta*Delta_d*X*pow(delta, 2) + 8*Delta*Delta_dd*X*pow(delta, 3) + 8*Delta - 18*pow(Delta_d, 2)*X*pow(delta, 3) + 12*Delta_d*delta + 2*Delta_dd*pow(delta, 2))/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
-    long double dXdd_dDelta_d = 2*pow(X, 2)*(2*X*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + (2*Delta*X*delta + 1)*(2*Delta_d*X*pow(delta, 2) - 1))/pow(2*Delta*X*delta + 1, 3);
-    long double dXdd_dDelta_dd = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
+    CoolPropDbl Delta = this->Deltabar(tau, delta);
+    CoolPropDbl X = this->X(delta, Delta);
+    CoolPropDbl dX_ddelta = this->dX_ddelta__constDeltabar(delta, Delta);
+    CoolPropDbl dX_dDelta = this->dX_dDeltabar__constdelta(delta, Delta);
+    CoolPropDbl Delta_d = this->dDeltabar_ddelta__consttau(tau, delta);
+    CoolPropDbl Delta_dd = this->d2Deltabar_ddelta2__consttau(tau, delta);
+    CoolPropDbl Delta_ddd = this->d3Deltabar_ddelta3__consttau(tau, delta);
+
+    CoolPropDbl dXdd_dX = 2*X*(-6*Delta*pow(X, 2)*delta*pow(Delta + Delta_d*delta, 2)*(Delta*X*delta + 1) - Delta_dd*delta*pow(2*Delta*X*delta + 1, 3) + 2*X*(2*Delta*X*delta + 1)*(-Delta*Delta_d*delta*(2*Delta_d*X*pow(delta, 2) - 1) - Delta*delta*(2*pow(Delta, 2)*X - Delta_d) + Delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + Delta_d*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1)) + pow(2*Delta*X*delta + 1, 2)*(3*pow(Delta, 2)*X + Delta*Delta_dd*X*pow(delta, 2) + Delta*X*(Delta + Delta_d*delta) + pow(Delta_d, 2)*X*pow(delta, 2) + Delta_d*X*delta*(Delta + Delta_d*delta) + Delta_d*(2*Delta_d*X*pow(delta, 2) - 1) - Delta_d))/pow(2*Delta*X*delta + 1, 4);
+    CoolPropDbl dXdd_ddelta = pow(X, 2)*(-24*pow(Delta, 4)*pow(X, 3)*delta - 8*pow(Delta, 3)*Delta_d*pow(X, 3)*pow(delta, 2) - 18*pow(Delta, 3)*pow(X, 2) + 8*pow(Delta, 2)*Delta_d*pow(X, 2)*delta - 4*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 2) + 10*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 2) + 12*Delta*Delta_d*X - 4*Delta*Delta_dd*X*delta + 8*pow(Delta_d, 2)*X*delta - Delta_dd)/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
+    CoolPropDbl dXdd_dDelta = pow(X, 3)*(-8*pow(Delta, 2)*Delta_d*pow(X, 2)*pow(delta, 3) + 8*pow(Delta, 2)*Delta_dd*pow(X, 2)*pow(delta, 4) + 10*pow(Delta, 2)*X*delta - 24*Delta*pow(Delta_d, 2)*pow(X, 2)*pow(delta, 4) + 8*Delta*Delta_d*X*pow(delta, 2) + 8*Delta*Delta_dd*X*pow(delta, 3) + 8*Delta - 18*pow(Delta_d, 2)*X*pow(delta, 3) + 12*Delta_d*delta + 2*Delta_dd*pow(delta, 2))/(16*pow(Delta, 4)*pow(X, 4)*pow(delta, 4) + 32*pow(Delta, 3)*pow(X, 3)*pow(delta, 3) + 24*pow(Delta, 2)*pow(X, 2)*pow(delta, 2) + 8*Delta*X*delta + 1);
+    CoolPropDbl dXdd_dDelta_d = 2*pow(X, 2)*(2*X*delta*(Delta + Delta_d*delta)*(Delta*X*delta + 1) + (2*Delta*X*delta + 1)*(2*Delta_d*X*pow(delta, 2) - 1))/pow(2*Delta*X*delta + 1, 3);
+    CoolPropDbl dXdd_dDelta_dd = -pow(X, 2)*delta/(2*Delta*X*delta + 1);
 
     return dXdd_ddelta + dXdd_dX*(dX_ddelta + dX_dDelta*Delta_d) + dXdd_dDelta*Delta_d + dXdd_dDelta_d*Delta_dd + dXdd_dDelta_dd*Delta_ddd;
 }
-long double ResidualHelmholtzSAFTAssociating::g(const long double &eta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::g(const CoolPropDbl &eta)
 {
     return 0.5*(2-eta)/pow(1-eta,(int)3);
 }
-long double ResidualHelmholtzSAFTAssociating::dg_deta(const long double &eta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::dg_deta(const CoolPropDbl &eta)
 {
     return 0.5*(5-2*eta)/pow(1-eta,(int)4);
 }
-long double ResidualHelmholtzSAFTAssociating::d2g_deta2(const long double &eta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d2g_deta2(const CoolPropDbl &eta)
 {
     return 3*(3-eta)/pow(1-eta,(int)5);
 }
-long double ResidualHelmholtzSAFTAssociating::d3g_deta3(const long double &eta)
+CoolPropDbl ResidualHelmholtzSAFTAssociating::d3g_deta3(const CoolPropDbl &eta)
 {
     return 6*(7-2*eta)/pow(1-eta,(int)6);
 }
-long double ResidualHelmholtzSAFTAssociating::eta(const long double &delta){
+CoolPropDbl ResidualHelmholtzSAFTAssociating::eta(const CoolPropDbl &delta){
     return this->vbarn*delta;
 }
 
-void ResidualHelmholtzSAFTAssociating::all(const long double &tau, const long double &delta, HelmholtzDerivatives &deriv) throw()
+void ResidualHelmholtzSAFTAssociating::all(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &deriv) throw()
 {
     if (disabled){return;}
-    long double X = this->X(delta, this->Deltabar(tau, delta));
-    long double X_t = this->dX_dtau(tau, delta);
-    long double X_d = this->dX_ddelta(tau, delta);
-    long double X_tt = this->d2X_dtau2(tau, delta);
-    long double X_dd = this->d2X_ddelta2(tau, delta);
-    long double X_dt = this->d2X_ddeltadtau(tau, delta);
-    long double X_ttt = this->d3X_dtau3(tau, delta);
-    long double X_dtt = this->d3X_ddeltadtau2(tau, delta);
-    long double X_ddt = this->d3X_ddelta2dtau(tau, delta);
-    long double X_ddd = this->d3X_ddelta3(tau, delta);
+    CoolPropDbl X = this->X(delta, this->Deltabar(tau, delta));
+    CoolPropDbl X_t = this->dX_dtau(tau, delta);
+    CoolPropDbl X_d = this->dX_ddelta(tau, delta);
+    CoolPropDbl X_tt = this->d2X_dtau2(tau, delta);
+    CoolPropDbl X_dd = this->d2X_ddelta2(tau, delta);
+    CoolPropDbl X_dt = this->d2X_ddeltadtau(tau, delta);
+    CoolPropDbl X_ttt = this->d3X_dtau3(tau, delta);
+    CoolPropDbl X_dtt = this->d3X_ddeltadtau2(tau, delta);
+    CoolPropDbl X_ddt = this->d3X_ddelta2dtau(tau, delta);
+    CoolPropDbl X_ddd = this->d3X_ddelta3(tau, delta);
     
     deriv.alphar += this->m*this->a*((log(X)-X/2.0+0.5));
     deriv.dalphar_ddelta += this->m*this->a*(1/X-0.5)*this->dX_ddelta(tau, delta);
@@ -926,7 +1081,7 @@ void IdealHelmholtzCP0PolyT::to_json(rapidjson::Value &el, rapidjson::Document &
     el.AddMember("Tc", static_cast<double>(Tc), doc.GetAllocator());
     el.AddMember("T0", static_cast<double>(T0), doc.GetAllocator());
 }
-long double IdealHelmholtzCP0PolyT::base(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0PolyT::base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     double sum=0;
     for (std::size_t i = 0; i < N; ++i){
@@ -945,7 +1100,7 @@ long double IdealHelmholtzCP0PolyT::base(const long double &tau, const long doub
     }
     return sum;
 }
-long double IdealHelmholtzCP0PolyT::dTau(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0PolyT::dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     double sum=0;
     for (std::size_t i = 0; i < N; ++i){
@@ -964,7 +1119,7 @@ long double IdealHelmholtzCP0PolyT::dTau(const long double &tau, const long doub
     }
     return sum;
 }
-long double IdealHelmholtzCP0PolyT::dTau2(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0PolyT::dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     double sum=0;
     for (std::size_t i = 0; i < N; ++i){
@@ -983,7 +1138,7 @@ long double IdealHelmholtzCP0PolyT::dTau2(const long double &tau, const long dou
     }
     return sum;
 }
-long double IdealHelmholtzCP0PolyT::dTau3(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0PolyT::dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     double sum=0;
     for (std::size_t i = 0; i < N; ++i){
@@ -1014,33 +1169,33 @@ void IdealHelmholtzCP0AlyLee::to_json(rapidjson::Value &el, rapidjson::Document
     el.AddMember("Tc",static_cast<double>(Tc),doc.GetAllocator());
     el.AddMember("T0",static_cast<double>(T0),doc.GetAllocator());
 }
-long double IdealHelmholtzCP0AlyLee::base(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0AlyLee::base(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (!enabled){ return 0.0;}
     return -tau*(anti_deriv_cp0_tau2(tau)-anti_deriv_cp0_tau2(tau0))+(anti_deriv_cp0_tau(tau)-anti_deriv_cp0_tau(tau0));
 }
-long double IdealHelmholtzCP0AlyLee::dTau(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0AlyLee::dTau(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (!enabled){ return 0.0;}
     return -(anti_deriv_cp0_tau2(tau) - anti_deriv_cp0_tau2(tau0));
 }
-long double IdealHelmholtzCP0AlyLee::anti_deriv_cp0_tau2(const long double &tau)
+CoolPropDbl IdealHelmholtzCP0AlyLee::anti_deriv_cp0_tau2(const CoolPropDbl &tau)
 {
     return -c[0]/tau + 2*c[1]*c[2]/Tc/(exp(-2*c[2]*tau/Tc)-1) - 2*c[3]*c[4]/Tc*(exp(2*c[4]*tau/Tc)+1);
 }
-long double IdealHelmholtzCP0AlyLee::anti_deriv_cp0_tau(const long double &tau)
+CoolPropDbl IdealHelmholtzCP0AlyLee::anti_deriv_cp0_tau(const CoolPropDbl &tau)
 {
-    long double term1 = c[0]*log(tau);
-    long double term2 = 2*c[1]*c[2]*tau/(-Tc + Tc*exp(-2*c[2]*tau/Tc)) + c[1]*log(-1 + exp(-2*c[2]*tau/Tc)) + 2*c[1]*c[2]*tau/Tc;
-    long double term3 = -c[3]*(Tc*exp(2*c[4]*tau/Tc)*log(exp(2*c[4]*tau/Tc) + 1) + Tc*log(exp(2*c[4]*tau/Tc) + 1) - 2*c[4]*tau*exp(2*c[4]*tau/Tc))/(Tc*(exp(2*c[4]*tau/Tc) + 1));
+    CoolPropDbl term1 = c[0]*log(tau);
+    CoolPropDbl term2 = 2*c[1]*c[2]*tau/(-Tc + Tc*exp(-2*c[2]*tau/Tc)) + c[1]*log(-1 + exp(-2*c[2]*tau/Tc)) + 2*c[1]*c[2]*tau/Tc;
+    CoolPropDbl term3 = -c[3]*(Tc*exp(2*c[4]*tau/Tc)*log(exp(2*c[4]*tau/Tc) + 1) + Tc*log(exp(2*c[4]*tau/Tc) + 1) - 2*c[4]*tau*exp(2*c[4]*tau/Tc))/(Tc*(exp(2*c[4]*tau/Tc) + 1));
     return term1 + term2 + term3;
 }
-long double IdealHelmholtzCP0AlyLee::dTau2(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0AlyLee::dTau2(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (!enabled){ return 0.0;}
     return -c[0]/pow(tau,2) - c[1]*pow(c[2]/Tc/sinh(c[2]*tau/Tc),2) - c[3]*pow(c[4]/Tc/cosh(c[4]*tau/Tc),2);
 }
-long double IdealHelmholtzCP0AlyLee::dTau3(const long double &tau, const long double &delta) throw()
+CoolPropDbl IdealHelmholtzCP0AlyLee::dTau3(const CoolPropDbl &tau, const CoolPropDbl &delta) throw()
 {
     if (!enabled){ return 0.0;}
     return 2*c[0]/pow(tau,3) + 2*c[1]*pow(c[2]/Tc,3)*cosh(c[2]*tau/Tc)/pow(sinh(c[2]*tau/Tc),3) + 2*c[3]*pow(c[4]/Tc,3)*sinh(c[4]*tau/Tc)/pow(cosh(c[4]*tau/Tc),3);
@@ -1055,13 +1210,14 @@ IdealHelmholtzEnthalpyEntropyOffset EnthalpyEntropyOffset;
 
 #ifdef ENABLE_CATCH
 #include <math.h>
+#include <limits>
 #include "catch.hpp"
 #include "crossplatform_shared_ptr.h"
 
 class HelmholtzConsistencyFixture
 {
 public:
-    long double numerical, analytic;
+    CoolPropDbl numerical, analytic;
 
     shared_ptr<CoolProp::BaseHelmholtzTerm> PlanckEinstein, Lead, LogTau, IGPower, CP0Constant, CP0PolyT, SAFT, NonAnalytic;
     shared_ptr<CoolProp::ResidualHelmholtzGeneralizedExponential> Gaussian, Lemmon2005, Exponential, GERG2008, Power;
@@ -1070,22 +1226,22 @@ public:
         Lead.reset(new CoolProp::IdealHelmholtzLead(1,3));
         LogTau.reset(new CoolProp::IdealHelmholtzLogTau(1.5));
         {
-            std::vector<long double> n(4,0), t(4,1); n[0] = -0.1; n[2] = 0.1; t[1] = -1; t[2] = -2; t[3] = 2;
+            std::vector<CoolPropDbl> n(4,0), t(4,1); n[0] = -0.1; n[2] = 0.1; t[1] = -1; t[2] = -2; t[3] = 2;
             IGPower.reset(new CoolProp::IdealHelmholtzPower(n,t));
         }
         {
-            std::vector<long double> n(4,0), t(4,1), c(4,1), d(4,-1); n[0] = 0.1; n[2] = 0.5; t[0] = -1.5; t[1] = -1; t[2] = -2; t[3] = -2;
+            std::vector<CoolPropDbl> n(4,0), t(4,1), c(4,1), d(4,-1); n[0] = 0.1; n[2] = 0.5; t[0] = -1.5; t[1] = -1; t[2] = -2; t[3] = -2;
             PlanckEinstein.reset(new CoolProp::IdealHelmholtzPlanckEinsteinGeneralized(n, t, c, d));
         }
         {
-            long double T0 = 273.15, Tc = 345.857, c = 1.0578, t = 0.33;
-            CP0PolyT.reset(new CoolProp::IdealHelmholtzCP0PolyT(std::vector<long double>(1,c),
-                                                                std::vector<long double>(1,t),
+            CoolPropDbl T0 = 273.15, Tc = 345.857, c = 1.0578, t = 0.33;
+            CP0PolyT.reset(new CoolProp::IdealHelmholtzCP0PolyT(std::vector<CoolPropDbl>(1,c),
+                                                                std::vector<CoolPropDbl>(1,t),
                                                                 Tc, T0));
         }
         CP0Constant.reset(new CoolProp::IdealHelmholtzCP0Constant(4/8.314472,300,250));
         {
-            long double beta[] = {1.24, 0.821, 15.45, 2.21, 437, 0.743},
+            CoolPropDbl beta[] = {1.24, 0.821, 15.45, 2.21, 437, 0.743},
                         d[] = {1, 1, 2, 2, 3, 3},
                         epsilon[] = {0.6734, 0.9239, 0.8636, 1.0507, 0.8482, 0.7522},
                         eta[] = {0.9667, 1.5154, 1.0591, 1.6642, 12.4856, 0.9662},
@@ -1093,76 +1249,80 @@ public:
                         n[] = {1.2198, -0.4883, -0.0033293, -0.0035387, -0.51172, -0.16882},
                         t[] = {1, 2.124, 0.4, 3.5, 0.5, 2.7};
             Gaussian.reset(new CoolProp::ResidualHelmholtzGeneralizedExponential());
-            Gaussian->add_Gaussian(std::vector<long double>(n,n+sizeof(n)/sizeof(n[0])),
-                                   std::vector<long double>(d,d+sizeof(d)/sizeof(d[0])),
-                                   std::vector<long double>(t,t+sizeof(t)/sizeof(t[0])),
-                                   std::vector<long double>(eta,eta+sizeof(eta)/sizeof(eta[0])),
-                                   std::vector<long double>(epsilon,epsilon+sizeof(epsilon)/sizeof(epsilon[0])),
-                                   std::vector<long double>(beta,beta+sizeof(beta)/sizeof(beta[0])),
-                                   std::vector<long double>(gamma,gamma+sizeof(gamma)/sizeof(gamma[0]))
+            Gaussian->add_Gaussian(std::vector<CoolPropDbl>(n,n+sizeof(n)/sizeof(n[0])),
+                                   std::vector<CoolPropDbl>(d,d+sizeof(d)/sizeof(d[0])),
+                                   std::vector<CoolPropDbl>(t,t+sizeof(t)/sizeof(t[0])),
+                                   std::vector<CoolPropDbl>(eta,eta+sizeof(eta)/sizeof(eta[0])),
+                                   std::vector<CoolPropDbl>(epsilon,epsilon+sizeof(epsilon)/sizeof(epsilon[0])),
+                                   std::vector<CoolPropDbl>(beta,beta+sizeof(beta)/sizeof(beta[0])),
+                                   std::vector<CoolPropDbl>(gamma,gamma+sizeof(gamma)/sizeof(gamma[0]))
                                    );
+            Gaussian->finish();
         }
         {
-            long double d[] = {1, 1, 1, 2, 4, 1, 1, 2, 2, 3, 4, 5, 1, 5, 1, 2, 3, 5},
+            CoolPropDbl d[] = {1, 1, 1, 2, 4, 1, 1, 2, 2, 3, 4, 5, 1, 5, 1, 2, 3, 5},
                         l[] = {0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 2, 3, 3},
                         m[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1.7, 7, 6},
                         n[] = {5.28076, -8.67658, 0.7501127, 0.7590023, 0.01451899, 4.777189, -3.330988, 3.775673, -2.290919, 0.8888268, -0.6234864, -0.04127263, -0.08455389, -0.1308752, 0.008344962, -1.532005, -0.05883649, 0.02296658},
                         t[]= {0.669, 1.05,2.75, 0.956, 1, 2, 2.75, 2.38, 3.37, 3.47, 2.63, 3.45, 0.72, 4.23, 0.2, 4.5, 29, 24};
             Lemmon2005.reset(new CoolProp::ResidualHelmholtzGeneralizedExponential());
-            Lemmon2005->add_Lemmon2005(std::vector<long double>(n, n+sizeof(n)/sizeof(n[0])),
-                                       std::vector<long double>(d, d+sizeof(d)/sizeof(d[0])),
-                                       std::vector<long double>(t, t+sizeof(t)/sizeof(t[0])),
-                                       std::vector<long double>(l, l+sizeof(l)/sizeof(l[0])),
-                                       std::vector<long double>(m, m+sizeof(m)/sizeof(m[0]))
+            Lemmon2005->add_Lemmon2005(std::vector<CoolPropDbl>(n, n+sizeof(n)/sizeof(n[0])),
+                                       std::vector<CoolPropDbl>(d, d+sizeof(d)/sizeof(d[0])),
+                                       std::vector<CoolPropDbl>(t, t+sizeof(t)/sizeof(t[0])),
+                                       std::vector<CoolPropDbl>(l, l+sizeof(l)/sizeof(l[0])),
+                                       std::vector<CoolPropDbl>(m, m+sizeof(m)/sizeof(m[0]))
                                        );
+            Lemmon2005->finish();
         }
         {
-            long double d[] = {1, 1, 1, 3, 7, 1, 2, 5, 1, 1, 4, 2},
+            CoolPropDbl d[] = {1, 1, 1, 3, 7, 1, 2, 5, 1, 1, 4, 2},
                         l[] = {0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3},
                         n[] = {1.0038, -2.7662, 0.42921, 0.081363, 0.00024174, 0.48246, 0.75542, -0.00743, -0.4146, -0.016558, -0.10644, -0.021704},
                         t[] = {0.25, 1.25, 1.5, 0.25, 0.875, 2.375, 2, 2.125, 3.5, 6.5, 4.75, 12.5};
             Power.reset(new CoolProp::ResidualHelmholtzGeneralizedExponential());
-            Power->add_Power(std::vector<long double>(n, n+sizeof(n)/sizeof(n[0])),
-                             std::vector<long double>(d, d+sizeof(d)/sizeof(d[0])),
-                             std::vector<long double>(t, t+sizeof(t)/sizeof(t[0])),
-                             std::vector<long double>(l, l+sizeof(l)/sizeof(l[0]))
+            Power->add_Power(std::vector<CoolPropDbl>(n, n+sizeof(n)/sizeof(n[0])),
+                             std::vector<CoolPropDbl>(d, d+sizeof(d)/sizeof(d[0])),
+                             std::vector<CoolPropDbl>(t, t+sizeof(t)/sizeof(t[0])),
+                             std::vector<CoolPropDbl>(l, l+sizeof(l)/sizeof(l[0]))
                              );
+            Power->finish();
         }
         {
 
-            long double a = 1, epsilonbar = 12.2735737, kappabar = 1.09117041e-05, m = 1.01871348, vbarn = 0.0444215309;
+            CoolPropDbl a = 1, epsilonbar = 12.2735737, kappabar = 1.09117041e-05, m = 1.01871348, vbarn = 0.0444215309;
             SAFT.reset(new CoolProp::ResidualHelmholtzSAFTAssociating(a,m,epsilonbar,vbarn,kappabar));
         }
         {
-            long double n[] = {-0.666422765408, 0.726086323499, 0.0550686686128},
+            CoolPropDbl n[] = {-0.666422765408, 0.726086323499, 0.0550686686128},
                 A[] = {0.7, 0.7, 0.7}, B[] = {0.3, 0.3, 1}, C[] = {10, 10, 12.5}, D[] = {275, 275, 275},
                 a[] = {3.5, 3.5, 3}, b[] = {0.875, 0.925, 0.875}, beta[] = {0.3, 0.3, 0.3};
-            NonAnalytic.reset(new CoolProp::ResidualHelmholtzNonAnalytic(std::vector<long double>(n, n+sizeof(n)/sizeof(n[0])),
-                                                             std::vector<long double>(a, a+sizeof(a)/sizeof(a[0])),
-                                                             std::vector<long double>(b, b+sizeof(b)/sizeof(b[0])),
-                                                             std::vector<long double>(beta, beta+sizeof(beta)/sizeof(beta[0])),
-                                                             std::vector<long double>(A, A+sizeof(A)/sizeof(A[0])),
-                                                             std::vector<long double>(B, B+sizeof(B)/sizeof(B[0])),
-                                                             std::vector<long double>(C, C+sizeof(C)/sizeof(C[0])),
-                                                             std::vector<long double>(D, D+sizeof(D)/sizeof(D[0]))
+            NonAnalytic.reset(new CoolProp::ResidualHelmholtzNonAnalytic(std::vector<CoolPropDbl>(n, n+sizeof(n)/sizeof(n[0])),
+                                                             std::vector<CoolPropDbl>(a, a+sizeof(a)/sizeof(a[0])),
+                                                             std::vector<CoolPropDbl>(b, b+sizeof(b)/sizeof(b[0])),
+                                                             std::vector<CoolPropDbl>(beta, beta+sizeof(beta)/sizeof(beta[0])),
+                                                             std::vector<CoolPropDbl>(A, A+sizeof(A)/sizeof(A[0])),
+                                                             std::vector<CoolPropDbl>(B, B+sizeof(B)/sizeof(B[0])),
+                                                             std::vector<CoolPropDbl>(C, C+sizeof(C)/sizeof(C[0])),
+                                                             std::vector<CoolPropDbl>(D, D+sizeof(D)/sizeof(D[0]))
                                                              ));
         }
         {
-            long double d[] = {2, 2, 2, 0, 0, 0},
+            CoolPropDbl d[] = {2, 2, 2, 0, 0, 0},
             g[] = {1.65533788, 1.65533788, 1.65533788, 1.65533788, 1.65533788, 1.65533788},
             l[] = {2, 2, 2, 2, 2, 2},
             n[] = {-3.821884669859, 8.30345065618981, -4.4832307260286, -1.02590136933231, 2.20786016506394, -1.07889905203761},
             t[] = {3, 4, 5, 3, 4, 5};
             Exponential.reset(new CoolProp::ResidualHelmholtzGeneralizedExponential());
-            Exponential->add_Exponential(std::vector<long double>(n, n+sizeof(n)/sizeof(n[0])),
-                                         std::vector<long double>(d, d+sizeof(d)/sizeof(n[0])),
-                                         std::vector<long double>(t, t+sizeof(t)/sizeof(d[0])),
-                                         std::vector<long double>(g, g+sizeof(g)/sizeof(t[0])),
-                                         std::vector<long double>(l, l+sizeof(l)/sizeof(l[0]))
+            Exponential->add_Exponential(std::vector<CoolPropDbl>(n, n+sizeof(n)/sizeof(n[0])),
+                                         std::vector<CoolPropDbl>(d, d+sizeof(d)/sizeof(n[0])),
+                                         std::vector<CoolPropDbl>(t, t+sizeof(t)/sizeof(d[0])),
+                                         std::vector<CoolPropDbl>(g, g+sizeof(g)/sizeof(t[0])),
+                                         std::vector<CoolPropDbl>(l, l+sizeof(l)/sizeof(l[0]))
                                          );
+            Exponential->finish();
         }
         {
-            long double d[] = {1, 4, 1, 2, 2, 2, 2, 2, 3},
+            CoolPropDbl d[] = {1, 4, 1, 2, 2, 2, 2, 2, 3},
                 t[] = {0.0, 1.85, 7.85, 5.4, 0.0, 0.75, 2.8, 4.45, 4.25},
                 n[] = {-0.0098038985517335, 0.00042487270143005, -0.034800214576142, -0.13333813013896, -0.011993694974627, 0.069243379775168, -0.31022508148249, 0.24495491753226, 0.22369816716981},
                 eta[] = {0.0, 0.0, 1.0, 1.0, 0.25, 0.0, 0.0, 0.0, 0.0},
@@ -1170,18 +1330,19 @@ public:
                 beta[] = {0.0, 0.0, 1.0, 1.0, 2.5, 3.0, 3.0, 3.0, 3.0},
                 gamma[] = {0.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5};
             GERG2008.reset(new CoolProp::ResidualHelmholtzGeneralizedExponential());
-            GERG2008->add_GERG2008Gaussian(std::vector<long double>(n, n+sizeof(n)/sizeof(n[0])),
-                                           std::vector<long double>(d, d+sizeof(d)/sizeof(n[0])),
-                                           std::vector<long double>(t, t+sizeof(t)/sizeof(d[0])),
-                                           std::vector<long double>(eta, eta+sizeof(eta)/sizeof(eta[0])),
-                                           std::vector<long double>(epsilon, epsilon+sizeof(epsilon)/sizeof(epsilon[0])),
-                                           std::vector<long double>(beta, beta+sizeof(beta)/sizeof(beta[0])),
-                                           std::vector<long double>(gamma, gamma+sizeof(gamma)/sizeof(gamma[0]))
+            GERG2008->add_GERG2008Gaussian(std::vector<CoolPropDbl>(n, n+sizeof(n)/sizeof(n[0])),
+                                           std::vector<CoolPropDbl>(d, d+sizeof(d)/sizeof(n[0])),
+                                           std::vector<CoolPropDbl>(t, t+sizeof(t)/sizeof(d[0])),
+                                           std::vector<CoolPropDbl>(eta, eta+sizeof(eta)/sizeof(eta[0])),
+                                           std::vector<CoolPropDbl>(epsilon, epsilon+sizeof(epsilon)/sizeof(epsilon[0])),
+                                           std::vector<CoolPropDbl>(beta, beta+sizeof(beta)/sizeof(beta[0])),
+                                           std::vector<CoolPropDbl>(gamma, gamma+sizeof(gamma)/sizeof(gamma[0]))
                                            );
+            GERG2008->finish();
         }
 
     }
-    void call(std::string d, shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta)
+    void call(std::string d, shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta)
     {
               if (!d.compare("dTau")){return dTau(term,tau,delta,ddelta);}
         else if (!d.compare("dTau2")){return dTau2(term,tau,delta,ddelta);}
@@ -1216,60 +1377,65 @@ public:
             throw CoolProp::ValueError(format("don't understand helmholtz type: %s",t.c_str()));
         }
     }
-    void dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double dtau){
-        long double term_plus = term->base(tau + dtau, delta);
-        long double term_minus = term->base(tau - dtau, delta);
+    void dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl dtau){
+        CoolPropDbl term_plus = term->base(tau + dtau, delta);
+        CoolPropDbl term_minus = term->base(tau - dtau, delta);
         numerical = (term_plus - term_minus)/(2*dtau);
         analytic = term->dTau(tau, delta);
     };
-    void dTau2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double dtau){
-        long double term_plus = term->dTau(tau + dtau, delta);
-        long double term_minus = term->dTau(tau - dtau, delta);
+    void dTau2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl dtau){
+        CoolPropDbl term_plus = term->dTau(tau + dtau, delta);
+        CoolPropDbl term_minus = term->dTau(tau - dtau, delta);
         numerical = (term_plus - term_minus)/(2*dtau);
         analytic = term->dTau2(tau, delta);
     };
-    void dTau3(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double dtau){
-        long double term_plus = term->dTau2(tau + dtau, delta);
-        long double term_minus = term->dTau2(tau - dtau, delta);
+    void dTau3(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl dtau){
+        CoolPropDbl term_plus = term->dTau2(tau + dtau, delta);
+        CoolPropDbl term_minus = term->dTau2(tau - dtau, delta);
         numerical = (term_plus - term_minus)/(2*dtau);
         analytic = term->dTau3(tau, delta);
     };
-    void dDelta(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->base(tau, delta + ddelta);
-        long double term_minus = term->base(tau, delta - ddelta);
+    void dDelta(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->base(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->base(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta(tau, delta);
     };
-    void dDelta2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->dDelta(tau, delta + ddelta);
-        long double term_minus = term->dDelta(tau, delta - ddelta);
+    void dDelta2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->dDelta(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->dDelta(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta2(tau, delta);
     };
-    void dDelta3(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->dDelta2(tau, delta + ddelta);
-        long double term_minus = term->dDelta2(tau, delta - ddelta);
+    void dDelta3(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->dDelta2(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->dDelta2(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta3(tau, delta);
     };
-    void dDelta_dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->dTau(tau, delta + ddelta);
-        long double term_minus = term->dTau(tau, delta - ddelta);
+    void dDelta_dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->dTau(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->dTau(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta_dTau(tau, delta);
     };
-    void dDelta_dTau2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->dTau2(tau, delta + ddelta);
-        long double term_minus = term->dTau2(tau, delta - ddelta);
+    void dDelta_dTau2(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->dTau2(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->dTau2(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta_dTau2(tau, delta);
     };
-    void dDelta2_dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, long double tau, long double delta, long double ddelta){
-        long double term_plus = term->dDelta_dTau(tau, delta + ddelta);
-        long double term_minus = term->dDelta_dTau(tau, delta - ddelta);
+    void dDelta2_dTau(shared_ptr<CoolProp::BaseHelmholtzTerm> term, CoolPropDbl tau, CoolPropDbl delta, CoolPropDbl ddelta){
+        CoolPropDbl term_plus = term->dDelta_dTau(tau, delta + ddelta);
+        CoolPropDbl term_minus = term->dDelta_dTau(tau, delta - ddelta);
         numerical = (term_plus - term_minus)/(2*ddelta);
         analytic = term->dDelta2_dTau(tau, delta);
     };
+    /// The step of the central differences, the cube root of the machine epsilon, which balances their truncation and round-off
+    /// errors; about 5e-7 with long double and 6e-6 with double
+    static CoolPropDbl step(){ return pow(std::numeric_limits<CoolPropDbl>::epsilon(), static_cast<CoolPropDbl>(1.0/3.0)); }
+    /// The relative error allowed in the central differences, which goes as the square of the step; about 1e-7 with long double
+    static double tolerance(){ return 4e5*static_cast<double>(POW2(step())); }
     double err(double v1, double v2)
     {
         if (std::abs(v2) > 1e-15){
@@ -1295,12 +1461,69 @@ TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Helmholtz energy derivatives", "[
         term = get(terms[i]);
         for (std::size_t j = 0; j < sizeof(derivs)/sizeof(derivs[0]); ++j)
         {
-            call(derivs[j], term, 1.3, 0.7, 1e-6);
+            call(derivs[j], term, 1.3, 0.7, step());
             CAPTURE(derivs[j]);
             CAPTURE(numerical);
             CAPTURE(analytic);
             CAPTURE(terms[i]);
-            CHECK(err(analytic, numerical) < 1e-7);
+            CHECK(err(analytic, numerical) < tolerance());
+        }
+    }
+}
+
+TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Helmholtz energy derivatives selected by flags", "[helmholtz]")
+{
+    std::string residual_terms[] = {"Gaussian","Lemmon2005","Power","NonAnalytic","Exponential","GERG2008"};
+    for (std::size_t i = 0; i < sizeof(residual_terms)/sizeof(residual_terms[0]); ++i)
+    {
+        shared_ptr<CoolProp::BaseHelmholtzTerm> term = get(residual_terms[i]);
+        CoolProp::HelmholtzDerivatives all, one;
+        CoolProp::ResidualHelmholtzGeneralizedExponential *GenExp = dynamic_cast<CoolProp::ResidualHelmholtzGeneralizedExponential*>(term.get());
+        CoolProp::ResidualHelmholtzNonAnalytic *NA = dynamic_cast<CoolProp::ResidualHelmholtzNonAnalytic*>(term.get());
+        if (GenExp != NULL){ GenExp->all(1.3, 0.7, all); } else { NA->all(1.3, 0.7, all); }
+        Eigen::Array<double, 10, 1> all_values = all.values();
+        for (int k = 0; k < 10; ++k)
+        {
+            // Each derivative on its own is the same as from the evaluation of all of them
+            one.reset();
+            if (GenExp != NULL){ GenExp->all(1.3, 0.7, one, 1 << k); } else { NA->all(1.3, 0.7, one, 1 << k); }
+            Eigen::Array<double, 10, 1> one_values = one.values();
+            CAPTURE(residual_terms[i]);
+            CAPTURE(k);
+            CHECK(one_values[k] == all_values[k]);
+        }
+    }
+    CHECK(CoolProp::alphar_derivative_flag(1, 2) == CoolProp::ALPHAR_DDELTA2_DTAU);
+    CHECK(CoolProp::alphar_derivative_flag(2, 0) == CoolProp::ALPHAR_DTAU2);
+    CHECK(CoolProp::alphar_derivative_flag(2, 2) == 0);
+}
+
+TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Powers shared by the generalized exponential terms", "[helmholtz]")
+{
+    Exponential->finish();
+    // The six terms have two d_i, three t_i and one pair (c_i, l_i)
+    CHECK(Exponential->d_exponents.values.size() == 2);
+    CHECK(Exponential->t_exponents.values.size() == 3);
+    CHECK(Exponential->cl_c.size() == 1);
+    CHECK(Exponential->t_exponents.max_integer == 5);
+    
+    std::string residual_terms[] = {"Gaussian","Lemmon2005","Power","Exponential","GERG2008"};
+    shared_ptr<CoolProp::ResidualHelmholtzGeneralizedExponential> GenExps[] = {Gaussian, Lemmon2005, Power, Exponential, GERG2008};
+    for (std::size_t i = 0; i < sizeof(residual_terms)/sizeof(residual_terms[0]); ++i)
+    {
+        // The same as each term evaluated on its own
+        shared_ptr<CoolProp::ResidualHelmholtzGeneralizedExponential> GenExp = GenExps[i];
+        CoolProp::HelmholtzDerivatives shared, scalar;
+        GenExp->all(1.3, 0.7, shared);
+        GenExp->all_scalar(1.3, 0.7, scalar);
+        Eigen::Array<double, 10, 1> shared_values = shared.values(), scalar_values = scalar.values();
+        for (int k = 0; k < 10; ++k)
+        {
+            CAPTURE(residual_terms[i]);
+            CAPTURE(k);
+            CAPTURE(shared_values[k]);
+            CAPTURE(scalar_values[k]);
+            CHECK(err(shared_values[k], scalar_values[k]) < 1e-12);
         }
     }
 }
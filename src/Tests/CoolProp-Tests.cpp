@@ -251,7 +251,7 @@ vel("EthylBenzene", "T", 617, "Dmass", 316, "V", 33.22e-6, 1e-2),
 class TransportValidationFixture
 {
 protected:
-    long double actual, x1, x2;
+    CoolPropDbl actual, x1, x2;
     shared_ptr<CoolProp::AbstractState> pState;
     CoolProp::input_pairs pair;
 public:
@@ -556,7 +556,7 @@ static CoolProp::input_pairs inputs[] = {
 class ConsistencyFixture
 {
 protected:
-    long double hmolar, pmolar, smolar, umolar, rhomolar, T, p, x1, x2;
+    CoolPropDbl hmolar, pmolar, smolar, umolar, rhomolar, T, p, x1, x2;
     shared_ptr<CoolProp::AbstractState> pState;
     CoolProp::input_pairs pair;
 public:
@@ -568,7 +568,7 @@ public:
     void set_pair(CoolProp::input_pairs pair){
         this->pair = pair;
     }
-    void set_TP(long double T, long double p)
+    void set_TP(CoolPropDbl T, CoolPropDbl p)
     {
         this->T = T; this->p = p;
         CoolProp::AbstractState &State = *pState;
@@ -628,8 +628,8 @@ public:
 
         // Make sure we end up back at the same temperature and pressure we started out with
 		if(State.Q() < 1 && State.Q() > 0) throw CoolProp::ValueError(format("Q [%g K] is between 0 and 1; two-phase solution",State.Q()));
-        if(std::abs(T-State.T()) > 1e-2) throw CoolProp::ValueError(format("Error on T [%Lg K] is greater than 1e-2",std::abs(State.T()-T)));
-        if(std::abs(p-State.p())/p*100 > 1e-2)  throw CoolProp::ValueError(format("Error on p [%Lg %%] is greater than 1e-2 %%",std::abs(p-State.p())/p*100));
+        if(std::abs(T-State.T()) > 1e-2) throw CoolProp::ValueError(format("Error on T [%g K] is greater than 1e-2",static_cast<double>(std::abs(State.T()-T))));
+        if(std::abs(p-State.p())/p*100 > 1e-2)  throw CoolProp::ValueError(format("Error on p [%g %%] is greater than 1e-2 %%",static_cast<double>(std::abs(p-State.p())/p*100)));
     }
 };
 
@@ -749,7 +749,26 @@ TEST_CASE("Tests for solvers in P,T flash using Water", "[flash],[PT]")
         CAPTURE(rho);
         CHECK(ValidNumber(rho));
     }
-    
+    SECTION("The density solver leaves the state at the density that it returns")
+    {
+        std::vector<std::string> names(1, "Water");
+        CoolProp::HelmholtzEOSMixtureBackend HEOS(names);
+        // The liquid and the supercritical liquid are solved with Brent's method from the ancillary, the gas with Newton's method
+        CoolProp::phases phases[3] = {CoolProp::iphase_liquid, CoolProp::iphase_supercritical_liquid, CoolProp::iphase_gas};
+        double Tp[3][2] = {{300, 1e6}, {400, 3e7}, {500, 1e5}};
+        for (int i = 0; i < 3; ++i){
+            double T = Tp[i][0], p = Tp[i][1];
+            CAPTURE(T);
+            CAPTURE(p);
+            HEOS.update(CoolProp::PT_INPUTS, 101325, 350);
+            HEOS.specify_phase(phases[i]);
+            double rho = HEOS.solver_rho_Tp(T, p);
+            HEOS.unspecify_phase();
+            CHECK(HEOS.rhomolar() == rho);
+            CHECK(HEOS.T() == T);
+            CHECK(std::abs(HEOS.p()/p - 1) < 1e-7);
+        }
+    }
 }
 
 TEST_CASE("Tests for solvers in P,Y flash using Water", "[flash],[PH],[PS],[PU]")
@@ -987,7 +1006,7 @@ TEST_CASE("Test first partial derivatives using PropsSI", "[derivatives]")
         T = 80+273.15;
         shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", "Water"));
         AS->update(CoolProp::PT_INPUTS, 101325, T);
-        long double rhomolar = AS->rhomolar();
+        CoolPropDbl rhomolar = AS->rhomolar();
         double dpdrhomolar__T_AbstractState = AS->first_partial_deriv(CoolProp::iP, CoolProp::iDmolar, CoolProp::iT);
         double dpdrhomolar__T_PropsSI_num = (PropsSI("P","T",T,"Dmolar",rhomolar+1e-3,"Water") - PropsSI("P","T",T,"Dmolar",rhomolar-1e-3,"Water"))/(2*1e-3);
         double dpdrhomolar__T_PropsSI = PropsSI("d(P)/d(Dmolar)|T","T",T,"P",101325,"Water");
@@ -1005,7 +1024,7 @@ TEST_CASE("Test first partial derivatives using PropsSI", "[derivatives]")
         T = 80+273.15;
         shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", "Water"));
         AS->update(CoolProp::PT_INPUTS, 101325, T);
-        long double rhomass = AS->rhomass();
+        CoolPropDbl rhomass = AS->rhomass();
         double dpdrhomass__T_AbstractState = AS->first_partial_deriv(CoolProp::iP, CoolProp::iDmass, CoolProp::iT);
         double dpdrhomass__T_PropsSI_num = (PropsSI("P","T",T,"Dmass",rhomass+1e-3,"Water") - PropsSI("P","T",T,"Dmass",rhomass-1e-3,"Water"))/(2*1e-3);
         double dpdrhomass__T_PropsSI = PropsSI("d(P)/d(Dmass)|T","T",T,"P",101325,"Water");
@@ -1070,33 +1089,33 @@ TEST_CASE("Test second partial derivatives", "[derivatives]")
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar, T);
         
         // base state
-        long double T0 = AS->T(), rhomolar0 = AS->rhomolar(), hmolar0 = AS->hmolar(), smolar0 = AS->smolar(), umolar0 = AS->umolar(), p0 = AS->p();
-        long double dhdT_rho_ana = AS->first_partial_deriv(CoolProp::iHmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double d2hdT2_rho_ana = AS->second_partial_deriv(CoolProp::iHmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double dsdT_rho_ana = AS->first_partial_deriv(CoolProp::iSmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double d2sdT2_rho_ana = AS->second_partial_deriv(CoolProp::iSmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double dudT_rho_ana = AS->first_partial_deriv(CoolProp::iUmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double d2udT2_rho_ana = AS->second_partial_deriv(CoolProp::iUmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
-        long double dpdT_rho_ana = AS->first_partial_deriv(CoolProp::iP, CoolProp::iT, CoolProp::iDmolar);
-        long double d2pdT2_rho_ana = AS->second_partial_deriv(CoolProp::iP, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl T0 = AS->T(), rhomolar0 = AS->rhomolar(), hmolar0 = AS->hmolar(), smolar0 = AS->smolar(), umolar0 = AS->umolar(), p0 = AS->p();
+        CoolPropDbl dhdT_rho_ana = AS->first_partial_deriv(CoolProp::iHmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl d2hdT2_rho_ana = AS->second_partial_deriv(CoolProp::iHmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl dsdT_rho_ana = AS->first_partial_deriv(CoolProp::iSmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl d2sdT2_rho_ana = AS->second_partial_deriv(CoolProp::iSmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl dudT_rho_ana = AS->first_partial_deriv(CoolProp::iUmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl d2udT2_rho_ana = AS->second_partial_deriv(CoolProp::iUmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl dpdT_rho_ana = AS->first_partial_deriv(CoolProp::iP, CoolProp::iT, CoolProp::iDmolar);
+        CoolPropDbl d2pdT2_rho_ana = AS->second_partial_deriv(CoolProp::iP, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar);
         
         // increment T
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar, T+dT);
-        long double Tpt = AS->T(), rhomolarpt = AS->rhomolar(), hmolarpt = AS->hmolar(), smolarpt = AS->smolar(), umolarpt = AS->umolar(), ppt = AS->p();
+        CoolPropDbl Tpt = AS->T(), rhomolarpt = AS->rhomolar(), hmolarpt = AS->hmolar(), smolarpt = AS->smolar(), umolarpt = AS->umolar(), ppt = AS->p();
         // decrement T
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar, T-dT);
-        long double Tmt = AS->T(), rhomolarmt = AS->rhomolar(), hmolarmt = AS->hmolar(), smolarmt = AS->smolar(), umolarmt = AS->umolar(), pmt = AS->p();
+        CoolPropDbl Tmt = AS->T(), rhomolarmt = AS->rhomolar(), hmolarmt = AS->hmolar(), smolarmt = AS->smolar(), umolarmt = AS->umolar(), pmt = AS->p();
         
-        long double dhdT_rho_num = (hmolarpt-hmolarmt)/(2*dT);
-        long double d2hdT2_rho_num = (hmolarpt-2*hmolar0+hmolarmt)/pow(dT,2);
-        long double dsdT_rho_num = (smolarpt-smolarmt)/(2*dT);
-        long double d2sdT2_rho_num = (smolarpt-2*smolar0+smolarmt)/pow(dT,2);
-        long double dudT_rho_num = (umolarpt-umolarmt)/(2*dT);
-        long double d2udT2_rho_num = (umolarpt-2*umolar0+umolarmt)/pow(dT,2);
-        long double dpdT_rho_num = (ppt-pmt)/(2*dT);
-        long double d2pdT2_rho_num = (ppt-2*p0+pmt)/pow(dT,2);
+        CoolPropDbl dhdT_rho_num = (hmolarpt-hmolarmt)/(2*dT);
+        CoolPropDbl d2hdT2_rho_num = (hmolarpt-2*hmolar0+hmolarmt)/pow(dT,2);
+        CoolPropDbl dsdT_rho_num = (smolarpt-smolarmt)/(2*dT);
+        CoolPropDbl d2sdT2_rho_num = (smolarpt-2*smolar0+smolarmt)/pow(dT,2);
+        CoolPropDbl dudT_rho_num = (umolarpt-umolarmt)/(2*dT);
+        CoolPropDbl d2udT2_rho_num = (umolarpt-2*umolar0+umolarmt)/pow(dT,2);
+        CoolPropDbl dpdT_rho_num = (ppt-pmt)/(2*dT);
+        CoolPropDbl d2pdT2_rho_num = (ppt-2*p0+pmt)/pow(dT,2);
         
-        CAPTURE(format("%0.15Lg",d2pdT2_rho_ana).c_str());
+        CAPTURE(format("%0.15g",static_cast<double>(d2pdT2_rho_ana)).c_str());
         
         double tol = 1e-4;
         CHECK(std::abs((dhdT_rho_num-dhdT_rho_ana)/dhdT_rho_ana) < tol);
@@ -1116,33 +1135,33 @@ TEST_CASE("Test second partial derivatives", "[derivatives]")
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar, T);
         
         // base state
-        long double T0 = AS->T(), rhomolar0 = AS->rhomolar(), hmolar0 = AS->hmolar(), smolar0 = AS->smolar(), umolar0 = AS->umolar(), p0 = AS->p();
-        long double dhdrho_T_ana = AS->first_partial_deriv(CoolProp::iHmolar, CoolProp::iDmolar, CoolProp::iT);
-        long double d2hdrho2_T_ana = AS->second_partial_deriv(CoolProp::iHmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
-        long double dsdrho_T_ana = AS->first_partial_deriv(CoolProp::iSmolar, CoolProp::iDmolar, CoolProp::iT);
-        long double d2sdrho2_T_ana = AS->second_partial_deriv(CoolProp::iSmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
-        long double dudrho_T_ana = AS->first_partial_deriv(CoolProp::iUmolar, CoolProp::iDmolar, CoolProp::iT);
-        long double d2udrho2_T_ana = AS->second_partial_deriv(CoolProp::iUmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
-        long double dpdrho_T_ana = AS->first_partial_deriv(CoolProp::iP, CoolProp::iDmolar, CoolProp::iT);
-        long double d2pdrho2_T_ana = AS->second_partial_deriv(CoolProp::iP, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl T0 = AS->T(), rhomolar0 = AS->rhomolar(), hmolar0 = AS->hmolar(), smolar0 = AS->smolar(), umolar0 = AS->umolar(), p0 = AS->p();
+        CoolPropDbl dhdrho_T_ana = AS->first_partial_deriv(CoolProp::iHmolar, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl d2hdrho2_T_ana = AS->second_partial_deriv(CoolProp::iHmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl dsdrho_T_ana = AS->first_partial_deriv(CoolProp::iSmolar, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl d2sdrho2_T_ana = AS->second_partial_deriv(CoolProp::iSmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl dudrho_T_ana = AS->first_partial_deriv(CoolProp::iUmolar, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl d2udrho2_T_ana = AS->second_partial_deriv(CoolProp::iUmolar, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl dpdrho_T_ana = AS->first_partial_deriv(CoolProp::iP, CoolProp::iDmolar, CoolProp::iT);
+        CoolPropDbl d2pdrho2_T_ana = AS->second_partial_deriv(CoolProp::iP, CoolProp::iDmolar, CoolProp::iT, CoolProp::iDmolar, CoolProp::iT);
         
         // increment rho
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar+drho, T);
-        long double Tpr = AS->T(), rhomolarpr = AS->rhomolar(), hmolarpr = AS->hmolar(), smolarpr = AS->smolar(), umolarpr = AS->umolar(), ppr = AS->p();
+        CoolPropDbl Tpr = AS->T(), rhomolarpr = AS->rhomolar(), hmolarpr = AS->hmolar(), smolarpr = AS->smolar(), umolarpr = AS->umolar(), ppr = AS->p();
         // decrement rho
         AS->update(CoolProp::DmolarT_INPUTS, rhomolar-drho, T);
-        long double Tmr = AS->T(), rhomolarmr = AS->rhomolar(), hmolarmr = AS->hmolar(), smolarmr = AS->smolar(), umolarmr = AS->umolar(), pmr = AS->p();
+        CoolPropDbl Tmr = AS->T(), rhomolarmr = AS->rhomolar(), hmolarmr = AS->hmolar(), smolarmr = AS->smolar(), umolarmr = AS->umolar(), pmr = AS->p();
         
-        long double dhdrho_T_num = (hmolarpr-hmolarmr)/(2*drho);
-        long double d2hdrho2_T_num = (hmolarpr-2*hmolar0+hmolarmr)/pow(drho,2);
-        long double dsdrho_T_num = (smolarpr-smolarmr)/(2*drho);
-        long double d2sdrho2_T_num = (smolarpr-2*smolar0+smolarmr)/pow(drho,2);
-        long double dudrho_T_num = (umolarpr-umolarmr)/(2*drho);
-        long double d2udrho2_T_num = (umolarpr-2*umolar0+umolarmr)/pow(drho,2);
-        long double dpdrho_T_num = (ppr-pmr)/(2*drho);
-        long double d2pdrho2_T_num = (ppr-2*p0+pmr)/pow(drho,2);
+        CoolPropDbl dhdrho_T_num = (hmolarpr-hmolarmr)/(2*drho);
+        CoolPropDbl d2hdrho2_T_num = (hmolarpr-2*hmolar0+hmolarmr)/pow(drho,2);
+        CoolPropDbl dsdrho_T_num = (smolarpr-smolarmr)/(2*drho);
+        CoolPropDbl d2sdrho2_T_num = (smolarpr-2*smolar0+smolarmr)/pow(drho,2);
+        CoolPropDbl dudrho_T_num = (umolarpr-umolarmr)/(2*drho);
+        CoolPropDbl d2udrho2_T_num = (umolarpr-2*umolar0+umolarmr)/pow(drho,2);
+        CoolPropDbl dpdrho_T_num = (ppr-pmr)/(2*drho);
+        CoolPropDbl d2pdrho2_T_num = (ppr-2*p0+pmr)/pow(drho,2);
         
-        CAPTURE(format("%0.15Lg",d2pdrho2_T_ana).c_str());
+        CAPTURE(format("%0.15g",static_cast<double>(d2pdrho2_T_ana)).c_str());
         
         double tol = 1e-4;
         CHECK(std::abs((dhdrho_T_num-dhdrho_T_ana)/dhdrho_T_ana) < tol);
@@ -1446,22 +1465,22 @@ TEST_CASE("Check the first partial derivatives", "[first_saturation_partial_deri
 		SECTION(ss1.str(),"")
 		{
 			AS->update(QT_INPUTS, 1, 300);
-			long double p = AS->p();
-			long double analytical = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
+			CoolPropDbl p = AS->p();
+			CoolPropDbl analytical = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
 			CAPTURE(analytical);
-			long double numerical;
+			CoolPropDbl numerical;
 			if (pairs[i].p2 == iT){
 				AS->update(QT_INPUTS, 1, 300+1e-5);
-				long double v1 = AS->keyed_output(pairs[i].p1);
+				CoolPropDbl v1 = AS->keyed_output(pairs[i].p1);
 				AS->update(QT_INPUTS, 1, 300-1e-5);
-				long double v2 = AS->keyed_output(pairs[i].p1);
+				CoolPropDbl v2 = AS->keyed_output(pairs[i].p1);
 				numerical = (v1-v2)/(2e-5);
 			}
 			else if (pairs[i].p2 == iP){
 				AS->update(PQ_INPUTS, p+1e-2, 1);
-				long double v1 = AS->keyed_output(pairs[i].p1);
+				CoolPropDbl v1 = AS->keyed_output(pairs[i].p1);
 				AS->update(PQ_INPUTS, p-1e-2, 1);
-				long double v2 = AS->keyed_output(pairs[i].p1);
+				CoolPropDbl v2 = AS->keyed_output(pairs[i].p1);
 				numerical = (v1-v2)/(2e-2);
 			}
 			else{
@@ -1488,18 +1507,18 @@ TEST_CASE("Check the second saturation derivatives", "[second_saturation_partial
 		SECTION(ss1.str(),"")
 		{
 			AS->update(QT_INPUTS, 1, 300);
-			long double p = AS->p();
-			long double analytical = AS->second_saturation_deriv(pairs[i].p1, pairs[i].p2, pairs[i].p3, pairs[i].p4);
+			CoolPropDbl p = AS->p();
+			CoolPropDbl analytical = AS->second_saturation_deriv(pairs[i].p1, pairs[i].p2, pairs[i].p3, pairs[i].p4);
 			CAPTURE(analytical);
-			long double numerical;
+			CoolPropDbl numerical;
 			if (pairs[i].p2 == iT){
 				throw NotImplementedError();
 			}
 			else if (pairs[i].p2 == iP){
 				AS->update(PQ_INPUTS, p+1e-2, 1);
-				long double v1 = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
+				CoolPropDbl v1 = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
 				AS->update(PQ_INPUTS, p-1e-2, 1);
-				long double v2 = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
+				CoolPropDbl v2 = AS->first_saturation_deriv(pairs[i].p1, pairs[i].p2);
 				numerical = (v1-v2)/(2e-2);
 			}
 			else{
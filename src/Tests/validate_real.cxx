@@ -0,0 +1,273 @@
+// Compare the builds of the library with each floating point type (COOLPROP_REAL), and write a JSON report of their
+// results and speed
+//
+// Usage: RealValidation [report file] [reference report]
+//
+// Each build flashes the same fluids at the same points, times the flashes, and keeps the values that it finds.  When
+// the report of the other build is given as reference, the relative deviations of the values from those of the reference
+// and the ratio of the times are added to each case.  The values are written with 16 significant digits, so that
+// deviations below about 1e-15 are not resolved.  The report is written to stdout if no file is given.
+
+#include "AbstractState.h"
+#include "DataStructures.h"
+#include "CoolPropTools.h"
+#include "crossplatform_shared_ptr.h"
+#include "rapidjson/rapidjson_include.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <time.h>
+
+/// The fluids that are flashed
+static const char *fluids[] = {"Water", "CO2", "R134a", "Nitrogen"};
+static const std::size_t N_FLUIDS = sizeof(fluids)/sizeof(fluids[0]);
+
+/// The outputs that are kept at each point
+static const CoolProp::parameters kept_outputs[] = {CoolProp::iT, CoolProp::iP, CoolProp::iDmolar, CoolProp::iHmolar,
+                                                    CoolProp::iSmolar, CoolProp::iCpmolar, CoolProp::ispeed_sound};
+static const std::size_t N_KEPT_OUTPUTS = sizeof(kept_outputs)/sizeof(kept_outputs[0]);
+
+/// The number of temperatures and pressures of the single-phase grid, and of temperatures along the saturation curve
+static const std::size_t N_T = 15, N_P = 15, N_SAT = 30;
+
+/// The shortest time over which the flashes are timed, in s
+static const double MIN_TIMING_INTERVAL = 0.1;
+
+/// The inputs of one case, and the values that are found with them; the failed flashes are flagged
+struct FlashCase
+{
+    std::string fluid, points;
+    CoolProp::input_pairs input_pair;
+    std::vector<double> Value1, Value2;
+    std::vector<bool> failed;
+    std::vector<std::vector<double> > values;
+    double ns_per_update;
+};
+
+/// Flash at each of the inputs of the case, and keep the outputs
+static void flash(CoolProp::AbstractState &AS, FlashCase &c)
+{
+    c.failed.assign(c.Value1.size(), false);
+    c.values.assign(N_KEPT_OUTPUTS, std::vector<double>(c.Value1.size(), 0.0));
+    for (std::size_t m = 0; m < c.Value1.size(); ++m){
+        try{
+            AS.update(c.input_pair, c.Value1[m], c.Value2[m]);
+            for (std::size_t k = 0; k < N_KEPT_OUTPUTS; ++k){
+                double value = AS.keyed_output(kept_outputs[k]);
+                if (!ValidNumber(value)){ c.failed[m] = true; }
+                c.values[k][m] = value;
+            }
+        }
+        catch(std::exception &){
+            c.failed[m] = true;
+        }
+    }
+    std::size_t N = 0;
+    clock_t t1 = clock(), t2;
+    do{
+        for (std::size_t m = 0; m < c.Value1.size(); ++m){
+            try{ AS.update(c.input_pair, c.Value1[m], c.Value2[m]); } catch(std::exception &){}
+        }
+        N += c.Value1.size();
+        t2 = clock();
+    } while (static_cast<double>(t2 - t1)/CLOCKS_PER_SEC < MIN_TIMING_INTERVAL);
+    c.ns_per_update = static_cast<double>(t2 - t1)/CLOCKS_PER_SEC/N*1e9;
+}
+
+/// The cases of one fluid: a (p, T) grid over the single-phase region, the two saturated phases as a function of T, and
+/// the (h, p) and (p, s) flashes back to the points of the grid.  The inputs of the last two are found with the first, so
+/// that they differ from one build to the other by round-off
+static void add_cases(const std::string &fluid, std::vector<FlashCase> &cases)
+{
+    shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", fluid));
+    double Tmin = AS->Ttriple() + 1, Tmax = AS->Tmax(), Tc = AS->T_critical();
+    double pmin = std::max(AS->p_triple(), 1e4), pmax = 0.5*AS->pmax();
+
+    FlashCase PT;
+    PT.fluid = fluid;
+    PT.points = "single_phase";
+    PT.input_pair = CoolProp::PT_INPUTS;
+    for (std::size_t i = 0; i < N_T; ++i){
+        for (std::size_t j = 0; j < N_P; ++j){
+            PT.Value1.push_back(pmin*pow(pmax/pmin, (j + 0.5)/N_P));
+            PT.Value2.push_back(Tmin + (Tmax - Tmin)*(i + 0.5)/N_T);
+        }
+    }
+    flash(*AS, PT);
+    cases.push_back(PT);
+
+    for (int Q = 0; Q <= 1; ++Q){
+        FlashCase QT;
+        QT.fluid = fluid;
+        QT.points = (Q == 0) ? "saturated_liquid" : "saturated_vapor";
+        QT.input_pair = CoolProp::QT_INPUTS;
+        for (std::size_t i = 0; i < N_SAT; ++i){
+            QT.Value1.push_back(Q);
+            QT.Value2.push_back(Tmin + (0.99*Tc - Tmin)*(i + 0.5)/N_SAT);
+        }
+        flash(*AS, QT);
+        cases.push_back(QT);
+    }
+
+    FlashCase HP, PS;
+    HP.fluid = fluid;
+    HP.points = "single_phase";
+    HP.input_pair = CoolProp::HmolarP_INPUTS;
+    PS.fluid = fluid;
+    PS.points = "single_phase";
+    PS.input_pair = CoolProp::PSmolar_INPUTS;
+    for (std::size_t m = 0; m < PT.Value1.size(); ++m){
+        if (PT.failed[m]){ continue; }
+        HP.Value1.push_back(PT.values[3][m]);
+        HP.Value2.push_back(PT.Value1[m]);
+        PS.Value1.push_back(PT.Value1[m]);
+        PS.Value2.push_back(PT.values[4][m]);
+    }
+    flash(*AS, HP);
+    cases.push_back(HP);
+    flash(*AS, PS);
+    cases.push_back(PS);
+}
+
+/// Add a member to a JSON object whose value is a copy of the string given
+static void add_string_member(rapidjson::Value &object, const char *name, const std::string &value, rapidjson::Document::AllocatorType &allocator)
+{
+    rapidjson::Value v(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), allocator);
+    object.AddMember(name, v, allocator);
+}
+
+/// The case of the reference report in the same place with the same fluid, points and inputs, or NULL if there is none
+static rapidjson::Value *find_reference_case(rapidjson::Document &reference, const FlashCase &c, std::size_t index)
+{
+    if (!reference.IsObject() || !reference.HasMember("cases")){ return NULL; }
+    rapidjson::Value &cases = reference["cases"];
+    if (!cases.IsArray() || index >= cases.Size()){ return NULL; }
+    rapidjson::Value &r = cases[static_cast<rapidjson::SizeType>(index)];
+    if (cpjson::get_string(r, "fluid") != c.fluid || cpjson::get_string(r, "points") != c.points
+        || cpjson::get_string(r, "inputs") != CoolProp::get_input_pair_short_desc(c.input_pair)
+        || cpjson::get_integer(r, "N") != static_cast<int>(c.Value1.size())){
+        return NULL;
+    }
+    return &r;
+}
+
+/// Add the deviations of the values of the case from those of the reference case, and the ratio of their times
+static void add_comparison(const FlashCase &c, rapidjson::Value &r, rapidjson::Value &result, rapidjson::Document::AllocatorType &allocator)
+{
+    rapidjson::Value comparison(rapidjson::kObjectType);
+    comparison.AddMember("speedup", cpjson::get_double(r, "ns_per_update")/c.ns_per_update, allocator);
+    rapidjson::Value deviations(rapidjson::kObjectType);
+    for (std::size_t k = 0; k < N_KEPT_OUTPUTS; ++k){
+        std::string name = CoolProp::get_parameter_information(kept_outputs[k], "short");
+        rapidjson::Value &ref_values = r["values"][name.c_str()];
+        double max = 0, sum_squares = 0;
+        std::size_t N = 0, imax = 0;
+        for (std::size_t m = 0; m < c.Value1.size(); ++m){
+            rapidjson::Value &ref_value = ref_values[static_cast<rapidjson::SizeType>(m)];
+            if (c.failed[m] || !ref_value.IsNumber()){ continue; }
+            double ref = ref_value.GetDouble();
+            // Molar enthalpy and entropy pass through zero at the reference state, where their deviations are not meaningful
+            if (std::abs(ref) < 1e-3){ continue; }
+            double dev = std::abs(c.values[k][m] - ref)/std::abs(ref);
+            if (dev > max){ max = dev; imax = m; }
+            sum_squares += dev*dev;
+            N++;
+        }
+        rapidjson::Value stats(rapidjson::kObjectType);
+        stats.AddMember("N", static_cast<int>(N), allocator);
+        if (N > 0){
+            stats.AddMember("max", max, allocator);
+            stats.AddMember("rms", sqrt(sum_squares/N), allocator);
+            stats.AddMember("Value1_at_max", c.Value1[imax], allocator);
+            stats.AddMember("Value2_at_max", c.Value2[imax], allocator);
+        }
+        deviations.AddMember(name.c_str(), allocator, stats, allocator);
+    }
+    comparison.AddMember("relative_deviations", deviations, allocator);
+    result.AddMember("comparison", comparison, allocator);
+}
+
+int main(int argc, char *argv[])
+{
+    rapidjson::Document reference;
+    std::string reference_real;
+    if (argc > 2){
+        std::string contents;
+        try{ contents = get_file_contents(argv[2]); } catch(...){}
+        reference.Parse<0>(contents.c_str());
+        if (reference.HasParseError() || !reference.IsObject()){
+            std::fprintf(stderr, "Unable to parse the reference report %s\n", argv[2]);
+            return 1;
+        }
+        reference_real = cpjson::get_string(reference, "real");
+    }
+
+    std::vector<FlashCase> cases;
+    try{
+        for (std::size_t i = 0; i < N_FLUIDS; ++i){
+            add_cases(fluids[i], cases);
+        }
+    }
+    catch(std::exception &e){
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = doc.GetAllocator();
+    #if defined(COOLPROP_REAL_DOUBLE)
+    add_string_member(doc, "real", "double", allocator);
+    #else
+    add_string_member(doc, "real", "long double", allocator);
+    #endif
+    doc.AddMember("sizeof_real", static_cast<int>(sizeof(CoolPropDbl)), allocator);
+    if (!reference_real.empty()){ add_string_member(doc, "reference_real", reference_real, allocator); }
+
+    rapidjson::Value cases_json(rapidjson::kArrayType);
+    for (std::size_t n = 0; n < cases.size(); ++n){
+        const FlashCase &c = cases[n];
+        rapidjson::Value result(rapidjson::kObjectType);
+        add_string_member(result, "fluid", c.fluid, allocator);
+        add_string_member(result, "points", c.points, allocator);
+        add_string_member(result, "inputs", CoolProp::get_input_pair_short_desc(c.input_pair), allocator);
+        result.AddMember("N", static_cast<int>(c.Value1.size()), allocator);
+        std::size_t failures = 0;
+        for (std::size_t m = 0; m < c.failed.size(); ++m){ if (c.failed[m]){ failures++; } }
+        result.AddMember("failures", static_cast<int>(failures), allocator);
+        result.AddMember("ns_per_update", c.ns_per_update, allocator);
+
+        rapidjson::Value *r = find_reference_case(reference, c, n);
+        if (r != NULL){ add_comparison(c, *r, result, allocator); }
+
+        // The values of the failed flashes are null
+        rapidjson::Value values(rapidjson::kObjectType);
+        for (std::size_t k = 0; k < N_KEPT_OUTPUTS; ++k){
+            rapidjson::Value v(rapidjson::kArrayType);
+            for (std::size_t m = 0; m < c.Value1.size(); ++m){
+                if (c.failed[m]){ rapidjson::Value null; v.PushBack(null, allocator); }
+                else{ v.PushBack(c.values[k][m], allocator); }
+            }
+            std::string name = CoolProp::get_parameter_information(kept_outputs[k], "short");
+            values.AddMember(name.c_str(), allocator, v, allocator);
+        }
+        result.AddMember("values", values, allocator);
+        cases_json.PushBack(result, allocator);
+    }
+    doc.AddMember("cases", cases_json, allocator);
+    std::string report = cpjson::json2string(doc);
+
+    if (argc > 1){
+        FILE *fp = std::fopen(argv[1], "w");
+        if (fp == NULL){
+            std::fprintf(stderr, "Unable to open %s for writing\n", argv[1]);
+            return 1;
+        }
+        std::fprintf(fp, "%s\n", report.c_str());
+        std::fclose(fp);
+    }
+    else{
+        std::printf("%s\n", report.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+// Check the tabular backends against the backend that they wrap, and write a JSON report of their errors and speed
+//
+// Usage: TablesValidation fluid [backend=TTSE&HEOS] [table type=LOGPH] [Nx=200] [Ny=200] [report file]
+//        TablesValidation --build-scaling fluid [backend=TTSE&HEOS] [table type=LOGPH] [Nx=200] [Ny=200] [threads=1,2,4,8] [report file]
+//
+// The report is written to stdout if no file is given.  The tables are taken from the cache if they are there, as usual; the
+// numbers of random, lattice and saturation points are those of TablesValidationPoints.  With --build-scaling, the tables are
+// instead built with each of the comma-separated numbers of threads in turn, and the wall time of each build is reported.
+
+#include "TabularValidation.h"
+#include "Configuration.h"
+#include "Exceptions.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char *argv[])
+{
+    bool build_scaling = (argc > 1 && std::string(argv[1]) == "--build-scaling");
+    // The arguments after the mode
+    int first = (build_scaling) ? 2 : 1, Nargs = argc - first;
+    char **args = argv + first;
+    if (Nargs < 1){
+        std::printf("Usage: %s fluid [backend=TTSE&HEOS] [table type=LOGPH] [Nx=200] [Ny=200] [report file]\n", argv[0]);
+        std::printf("       %s --build-scaling fluid [backend=TTSE&HEOS] [table type=LOGPH] [Nx=200] [Ny=200] [threads=1,2,4,8] [report file]\n", argv[0]);
+        return 1;
+    }
+    std::string fluid = args[0];
+    std::string backend = (Nargs > 1) ? args[1] : "TTSE&HEOS";
+    if (Nargs > 2){ CoolProp::set_config_string(TABULAR_TABLE_TYPE, args[2]); }
+    if (Nargs > 3){ CoolProp::set_config_double(TABULAR_NX, std::atof(args[3])); }
+    if (Nargs > 4){ CoolProp::set_config_double(TABULAR_NY, std::atof(args[4])); }
+    std::vector<int> Nthreads;
+    int ifile = 5;
+    if (build_scaling){
+        std::string list = (Nargs > 5) ? args[5] : "1,2,4,8";
+        for (std::size_t start = 0; start < list.size(); ){
+            std::size_t end = list.find(',', start);
+            if (end == std::string::npos){ end = list.size(); }
+            Nthreads.push_back(std::atoi(list.substr(start, end - start).c_str()));
+            start = end + 1;
+        }
+        ifile = 6;
+    }
+
+    std::string report;
+    try{
+        if (build_scaling){
+            report = CoolProp::report_build_scaling(backend, fluid, Nthreads);
+        }
+        else{
+            report = CoolProp::validate_tables(backend, fluid, CoolProp::TablesValidationPoints());
+        }
+    }
+    catch(std::exception &e){
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    if (Nargs > ifile){
+        FILE *fp = std::fopen(args[ifile], "w");
+        if (fp == NULL){
+            std::fprintf(stderr, "Unable to open %s for writing\n", args[ifile]);
+            return 1;
+        }
+        std::fprintf(fp, "%s\n", report.c_str());
+        std::fclose(fp);
+    }
+    else{
+        std::printf("%s\n", report.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Measure how the throughput of HEOS updates scales with the number of threads, and write a JSON report
+//
+// Usage: ThreadsValidation [fluid=Water] [threads=1,2,4,8] [updates per thread=20000] [report file]
+//
+// Each thread constructs a HEOS backend of its own and runs the same PT flashes, over a grid of the single-phase region, so
+// the total work grows with the number of threads.  For each number of threads, the report gives the wall time, the updates
+// per second of all the threads together, the speedup of that throughput over the first number of threads, and whether every
+// thread found the same enthalpies as the first thread of the first run.  The speedup can only be expected to grow with the
+// number of threads up to the number of processors, which is reported too.  Nothing is checked.  The report is written to
+// stdout if no file is given.
+
+#include "AbstractState.h"
+#include "DataStructures.h"
+#include "CoolPropTools.h"
+#include "crossplatform_shared_ptr.h"
+#include "crossplatform_mutex.h"
+#include "rapidjson/rapidjson_include.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/// The number of temperatures and pressures of the grid of PT flashes
+static const std::size_t N_T = 20, N_P = 20;
+
+/// The work of one thread: the same flashes as every other thread, repeated until Nupdates have been done
+struct ThreadWork
+{
+    std::string fluid;
+    const std::vector<double> *p, *T;
+    std::size_t Nupdates;
+    std::vector<double> hmolar; ///< The enthalpy at each point of the grid, from the first pass over it (_HUGE if the flash failed)
+    std::string error; ///< The error that stopped the thread, if any
+};
+
+static void run_updates(ThreadWork &work)
+{
+    try{
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", work.fluid));
+        std::size_t Npoints = work.p->size();
+        work.hmolar.assign(Npoints, _HUGE);
+        for (std::size_t n = 0; n < work.Nupdates; ++n){
+            std::size_t m = n % Npoints;
+            try{
+                AS->update(CoolProp::PT_INPUTS, (*work.p)[m], (*work.T)[m]);
+                if (n < Npoints){ work.hmolar[m] = AS->hmolar(); }
+            }
+            catch(std::exception &){}
+        }
+    }
+    catch(std::exception &e){
+        work.error = e.what();
+    }
+}
+
+/// Add a member to a JSON object whose value is a copy of the string given
+static void add_string_member(rapidjson::Value &object, const char *name, const std::string &value, rapidjson::Document::AllocatorType &allocator)
+{
+    rapidjson::Value v(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), allocator);
+    object.AddMember(name, v, allocator);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string fluid = (argc > 1) ? argv[1] : "Water";
+    std::string list = (argc > 2) ? argv[2] : "1,2,4,8";
+    std::size_t Nupdates = (argc > 3) ? static_cast<std::size_t>(std::atof(argv[3])) : 20000;
+    std::vector<int> Nthreads;
+    for (std::size_t start = 0; start < list.size(); ){
+        std::size_t end = list.find(',', start);
+        if (end == std::string::npos){ end = list.size(); }
+        int N = std::atoi(list.substr(start, end - start).c_str());
+        if (N < 1){
+            std::fprintf(stderr, "Invalid number of threads in [%s]\n", list.c_str());
+            return 1;
+        }
+        Nthreads.push_back(N);
+        start = end + 1;
+    }
+
+    // The grid, found with a backend of the main thread, which also loads the fluid library before anything is timed
+    std::vector<double> p, T;
+    try{
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", fluid));
+        double Tmin = AS->Ttriple() + 1, Tmax = AS->Tmax();
+        double pmin = std::max(AS->p_triple(), 1e4), pmax = 0.5*AS->pmax();
+        for (std::size_t i = 0; i < N_T; ++i){
+            for (std::size_t j = 0; j < N_P; ++j){
+                p.push_back(pmin*pow(pmax/pmin, (j + 0.5)/N_P));
+                T.push_back(Tmin + (Tmax - Tmin)*(i + 0.5)/N_T);
+            }
+        }
+    }
+    catch(std::exception &e){
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = doc.GetAllocator();
+    add_string_member(doc, "fluid", fluid, allocator);
+    doc.AddMember("processors", CoolProp::get_number_of_processors(), allocator);
+    doc.AddMember("points", static_cast<int>(p.size()), allocator);
+    doc.AddMember("updates_per_thread", static_cast<int>(Nupdates), allocator);
+
+    rapidjson::Value runs(rapidjson::kArrayType);
+    std::vector<double> first_hmolar;
+    double first_throughput = _HUGE;
+    for (std::size_t k = 0; k < Nthreads.size(); ++k){
+        std::vector<ThreadWork> work(Nthreads[k]);
+        for (std::size_t i = 0; i < work.size(); ++i){
+            work[i].fluid = fluid; work[i].p = &p; work[i].T = &T; work[i].Nupdates = Nupdates;
+        }
+        double t1 = CoolProp::get_wall_time();
+        CoolProp::run_in_threads(&run_updates, work);
+        double wall_time = CoolProp::get_wall_time() - t1;
+        double throughput = work.size()*Nupdates/wall_time;
+        if (k == 0){ first_hmolar = work[0].hmolar; first_throughput = throughput; }
+
+        rapidjson::Value run(rapidjson::kObjectType);
+        run.AddMember("threads", Nthreads[k], allocator);
+        run.AddMember("wall_time", wall_time, allocator);
+        run.AddMember("updates_per_second", throughput, allocator);
+        run.AddMember("speedup", throughput/first_throughput, allocator);
+        bool identical = true;
+        std::string error;
+        for (std::size_t i = 0; i < work.size(); ++i){
+            if (!work[i].error.empty()){ error = work[i].error; }
+            if (work[i].hmolar != first_hmolar){ identical = false; }
+        }
+        run.AddMember("identical", identical, allocator);
+        if (!error.empty()){ add_string_member(run, "error", error, allocator); }
+        runs.PushBack(run, allocator);
+    }
+    doc.AddMember("runs", runs, allocator);
+    std::string report = cpjson::json2string(doc);
+
+    if (argc > 4){
+        FILE *fp = std::fopen(argv[4], "w");
+        if (fp == NULL){
+            std::fprintf(stderr, "Unable to open %s for writing\n", argv[4]);
+            return 1;
+        }
+        std::fprintf(fp, "%s\n", report.c_str());
+        std::fclose(fp);
+    }
+    else{
+        std::printf("%s\n", report.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+// Write the fluids that are built into the library to a binary fluid database, so that they can be read rather than
+// parsed from JSON when the library is loaded
+//
+// Usage: FluidDatabase file
+//
+// The database is only used by the builds of the library with the same fluids and CoolPropDbl as the build that wrote it;
+// to use it, set the ALTERNATIVE_FLUIDS_DATABASE_PATH configuration key to its path before the first fluid is requested.
+
+#include "Backends/Helmholtz/Fluids/FluidLibrary.h"
+#include <cstdio>
+#include <fstream>
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2){
+        std::printf("Usage: %s file\n", argv[0]);
+        return 1;
+    }
+    try{
+        std::string DB = CoolProp::write_fluid_database();
+        std::ofstream file(argv[1], std::ios::binary);
+        file.write(DB.c_str(), DB.size());
+        if (!file){
+            std::printf("Unable to write the fluid database to [%s]\n", argv[1]);
+            return 1;
+        }
+        std::printf("Fluid database of %d bytes written to [%s]\n", static_cast<int>(DB.size()), argv[1]);
+    }
+    catch (std::exception &e){
+        std::printf("Unable to write the fluid database: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
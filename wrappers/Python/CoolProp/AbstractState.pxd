@@ -47,10 +47,10 @@ cdef class AbstractState:
     cpdef double molar_mass(self) except *
     cpdef double keyed_output(self, constants_header.parameters) except *
     
-    cpdef long double first_partial_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
-    cpdef long double second_partial_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
-    cpdef long double first_saturation_deriv(self, constants_header.parameters, constants_header.parameters) except *
-    cpdef long double second_saturation_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
+    cpdef cAbstractState.CoolPropDbl first_partial_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
+    cpdef cAbstractState.CoolPropDbl second_partial_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
+    cpdef cAbstractState.CoolPropDbl first_saturation_deriv(self, constants_header.parameters, constants_header.parameters) except *
+    cpdef cAbstractState.CoolPropDbl second_saturation_deriv(self, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except *
     
     cpdef double melting_line(self, int, int, double) except *
     cpdef bool has_melting_line(self) except *
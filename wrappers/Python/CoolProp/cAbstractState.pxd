@@ -4,11 +4,15 @@ from libcpp.vector cimport vector
 
 cimport constants_header
 
+cdef extern from "CoolPropTools.h":
+    # long double, or double if the library is built with COOLPROP_REAL=double; declared as double, which converts to and from either
+    ctypedef double CoolPropDbl
+
 cdef extern from "PhaseEnvelope.h" namespace "CoolProp":
     cdef cppclass PhaseEnvelopeData:
         bool TypeI
         size_t iTsat_max, ipsat_max, icrit
-        vector[long double] T, p, lnT, lnp, rhomolar_liq, rhomolar_vap, lnrhomolar_liq, lnrhomolar_vap, hmolar_liq, hmolar_vap, smolar_liq, smolar_vap, Q
+        vector[CoolPropDbl] T, p, lnT, lnp, rhomolar_liq, rhomolar_vap, lnrhomolar_liq, lnrhomolar_vap, hmolar_liq, hmolar_vap, smolar_liq, smolar_vap, Q
     
 cdef extern from "AbstractState.h" namespace "CoolProp":
     cdef cppclass AbstractState:
@@ -59,10 +63,10 @@ cdef extern from "AbstractState.h" namespace "CoolProp":
         double conductivity() except+ValueError
         double surface_tension() except+ValueError
         
-        long double first_partial_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
-        long double second_partial_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
-        long double first_saturation_deriv(constants_header.parameters, constants_header.parameters) except+ValueError
-        long double second_saturation_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
+        CoolPropDbl first_partial_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
+        CoolPropDbl second_partial_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
+        CoolPropDbl first_saturation_deriv(constants_header.parameters, constants_header.parameters) except+ValueError
+        CoolPropDbl second_saturation_deriv(constants_header.parameters, constants_header.parameters, constants_header.parameters, constants_header.parameters) except+ValueError
         
         void set_mole_fractions(vector[double]) except+ValueError
         void set_mass_fractions(vector[double]) except+ValueError
@@ -74,8 +78,8 @@ cdef extern from "AbstractState.h" namespace "CoolProp":
         void build_phase_envelope(string) except+ValueError
         PhaseEnvelopeData get_phase_envelope_data() except+ValueError
         
-        vector[long double] mole_fractions_liquid() except +ValueError
-        vector[long double] mole_fractions_vapor() except +ValueError
+        vector[CoolPropDbl] mole_fractions_liquid() except +ValueError
+        vector[CoolPropDbl] mole_fractions_vapor() except +ValueError
 
 # The static factory method for the AbstractState
 cdef extern from "AbstractState.h" namespace "CoolProp::AbstractState":